@@ -0,0 +1,587 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_BLOOM_FILTER_H_
+#define ARA_CORE_BLOOM_FILTER_H_
+
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+
+/**
+ * @brief Blocked Bloom filter over 64-bit hashes.
+ *
+ * The filter answers whether a hash may have been inserted: it never reports
+ * an inserted hash as absent, and reports an absent one as present with a
+ * small probability that depends on the bits per key. Every hash maps to one
+ * block of 32 bytes and sets one bit in each of its eight 32-bit words, so a
+ * query reads a single cache line and the eight tests vectorize. With the
+ * default 12 bits per key about 0.5% of absent hashes pass.
+ *
+ * Hashes are mixed before use, so identity hashes of integers are fine.
+ */
+class BlockedBloomFilter
+{
+ public:
+    /** bits per key the filter is sized with by default */
+    static constexpr std::size_t kDefaultBitsPerKey = 12;
+
+    /**
+     * @brief Constructs a filter without blocks, which reports every hash as
+     * possibly present.
+     */
+    BlockedBloomFilter() = default;
+
+    /**
+     * @brief Constructs an empty filter sized for capacity hashes.
+     *
+     * @param capacity number of hashes the filter is sized for.
+     * @param bitsPerKey bits of the filter per hash.
+     */
+    explicit BlockedBloomFilter(std::size_t capacity,
+                                std::size_t bitsPerKey = kDefaultBitsPerKey)
+      : blocks_(std::max<std::size_t>(
+                  1, (capacity * bitsPerKey + kBlockBits - 1) / kBlockBits),
+                Block{}),
+        capacity_(capacity)
+    {}
+
+    /**
+     * @brief Adds a hash to the filter. A filter without blocks ignores it.
+     *
+     * @param hash the hash to add.
+     */
+    void insert(std::uint64_t hash) noexcept
+    {
+        if (blocks_.empty())
+        { return; }
+
+        std::uint64_t const mixed = Mix(hash);
+        Block&              block = blocks_[index(mixed)];
+        auto const          key   = static_cast<std::uint32_t>(mixed);
+        for (std::size_t i = 0; i < kWords; ++i)
+        { block.words[i] |= Bit(key, i); }
+    }
+
+    /**
+     * @brief Checks if a hash may have been added.
+     *
+     * @param hash the hash to check.
+     *
+     * @return false if the hash has certainly not been added.
+     */
+    bool may_contain(std::uint64_t hash) const noexcept
+    {
+        if (blocks_.empty())
+        { return true; }
+
+        std::uint64_t const mixed   = Mix(hash);
+        const Block&        block   = blocks_[index(mixed)];
+        auto const          key     = static_cast<std::uint32_t>(mixed);
+        std::uint32_t       missing = 0;
+        for (std::size_t i = 0; i < kWords; ++i)
+        { missing |= Bit(key, i) & ~block.words[i]; }
+
+        return missing == 0;
+    }
+
+    /**
+     * @brief Removes all hashes, keeping the size of the filter.
+     */
+    void clear() noexcept
+    {
+        std::fill(blocks_.begin(), blocks_.end(), Block{});
+    }
+
+    /**
+     * @brief Returns the number of hashes the filter was sized for.
+     *
+     * @return the capacity of the filter.
+     */
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Returns the size of the bit array.
+     *
+     * @return number of bytes of the blocks.
+     */
+    std::size_t size_in_bytes() const noexcept
+    {
+        return blocks_.size() * sizeof(Block);
+    }
+
+ private:
+    static constexpr std::size_t kWords     = 8;
+    static constexpr std::size_t kBlockBits = kWords * 32;
+
+    struct alignas(32) Block
+    {
+        std::uint32_t words[kWords];
+    };
+
+    /**
+     * @brief Final mix of MurmurHash3, spreads all input bits.
+     */
+    static constexpr std::uint64_t Mix(std::uint64_t hash) noexcept
+    {
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
+
+    /**
+     * @brief The bit of word i for key, from one odd multiplier per word.
+     */
+    static constexpr std::uint32_t Bit(std::uint32_t key,
+                                       std::size_t   i) noexcept
+    {
+        constexpr std::uint32_t kSalt[kWords] = {0x47b6137bu,
+                                                 0x44974d91u,
+                                                 0x8824ad5bu,
+                                                 0xa2b7289du,
+                                                 0x705495c7u,
+                                                 0x2df1424bu,
+                                                 0x9efc4947u,
+                                                 0x5c6bfb31u};
+
+        return std::uint32_t{1} << ((key * kSalt[i]) >> 27);
+    }
+
+    /**
+     * @brief The block of a mixed hash, from its upper half.
+     */
+    std::size_t index(std::uint64_t mixed) const noexcept
+    {
+        return ((mixed >> 32) * blocks_.size()) >> 32;
+    }
+
+    Vector<Block> blocks_;
+    std::size_t   capacity_{0};
+};
+
+/**
+ * @brief Map or FlatMap with a Bloom filter in front of its lookups.
+ *
+ * Lookups of keys that are not in the map are mostly answered by the filter
+ * from a single cache line, instead of by a search of the map. The filter is
+ * kept in sync on insertion and sized with room for twice the elements; it
+ * is rebuilt when the map outgrows it and when the keys erased since the last
+ * rebuild outnumber half of the remaining ones, since erased keys cannot be
+ * removed from a Bloom filter. Modifications therefore have to go through
+ * FilteredMap; base() gives read access to the map itself.
+ *
+ * @tparam Container ara::core::Map, ara::core::FlatMap or a map with the same
+ * interface.
+ * @tparam Hash hash function object for the keys. Lookups with other types
+ * than key_type need a transparent Hash and key comparison.
+ */
+template<class Container,
+         class Hash = std::hash<typename Container::key_type>>
+class FilteredMap
+{
+ public:
+    using key_type       = typename Container::key_type;
+    using mapped_type    = typename Container::mapped_type;
+    using value_type     = typename Container::value_type;
+    using size_type      = typename Container::size_type;
+    using iterator       = typename Container::iterator;
+    using const_iterator = typename Container::const_iterator;
+
+    /** bits of the filter per element by default */
+    static constexpr std::size_t kBitsPerKey =
+      BlockedBloomFilter::kDefaultBitsPerKey;
+
+    /**
+     * @brief Constructs an empty map.
+     */
+    FilteredMap() { rebuild(); }
+
+    /**
+     * @brief Constructs the map with the contents of map.
+     *
+     * @param map the elements of the map.
+     * @param bitsPerKey bits of the filter per element.
+     * @param hash hash function object to use.
+     */
+    explicit FilteredMap(
+      Container   map,
+      std::size_t bitsPerKey = kBitsPerKey,
+      const Hash& hash       = Hash())
+      : map_(std::move(map)), bits_per_key_(bitsPerKey), hash_(hash)
+    {
+        rebuild();
+    }
+
+    /**
+     * @brief Returns the map without the filter.
+     *
+     * @return reference to the map.
+     */
+    const Container& base() const noexcept { return map_; }
+
+    /**
+     * @brief Returns the filter in front of the map.
+     *
+     * @return reference to the filter.
+     */
+    const BlockedBloomFilter& filter() const noexcept { return filter_; }
+
+    iterator       begin() noexcept { return map_.begin(); }
+    const_iterator begin() const noexcept { return map_.begin(); }
+    iterator       end() noexcept { return map_.end(); }
+    const_iterator end() const noexcept { return map_.end(); }
+
+    /**
+     * @brief Checks if the map has no elements.
+     *
+     * @return true if the map is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return map_.empty(); }
+
+    /**
+     * @brief Returns the number of elements in the map.
+     *
+     * @return the number of elements in the map.
+     */
+    size_type size() const noexcept { return map_.size(); }
+
+    /**
+     * @brief Finds an element with key equivalent to key, consulting the
+     * filter first.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to the element, or end() if no such element is found.
+     */
+    iterator find(const key_type& key) { return find_key(*this, key); }
+
+    /**
+     * @copydoc find(const key_type&)
+     */
+    const_iterator find(const key_type& key) const
+    {
+        return find_key(*this, key);
+    }
+
+    /**
+     * @copydoc find(const key_type&)
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+    iterator find(const Key& key)
+    {
+        return find_key(*this, key);
+    }
+
+    /**
+     * @copydoc find(const key_type&)
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+    const_iterator find(const Key& key) const
+    {
+        return find_key(*this, key);
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key, either 1 or 0.
+     */
+    template<class Key = key_type>
+        requires(std::is_same_v<Key, key_type>
+                 || detail::TransparentFunction<Hash>)
+    size_type count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    template<class Key = key_type>
+        requires(std::is_same_v<Key, key_type>
+                 || detail::TransparentFunction<Hash>)
+    bool contains(const Key& key) const
+    {
+        return find_key(*this, key) != map_.end();
+    }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the map does not have an element with the
+     * specified key.
+     */
+    mapped_type& at(const key_type& key)
+    {
+        auto const it = find(key);
+        if (it == map_.end())
+        { throw std::out_of_range("FilteredMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @copydoc at(const key_type&)
+     */
+    const mapped_type& at(const key_type& key) const
+    {
+        auto const it = find(key);
+        if (it == map_.end())
+        { throw std::out_of_range("FilteredMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to a key
+     * equivalent to key, performing an insertion if such key does not already
+     * exist.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key.
+     */
+    mapped_type& operator[](const key_type& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Inserts value if the map doesn't already contain an element with
+     * an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether
+     * the insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        will_add(value.first);
+
+        return map_.insert(value);
+    }
+
+    /**
+     * @copydoc insert(const value_type&)
+     */
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        will_add(value.first);
+
+        return map_.insert(std::move(value));
+    }
+
+    /**
+     * @brief Inserts a new element constructed from args if there is no
+     * element with the key in the map. The element is constructed before the
+     * lookup, since the filter needs its key first.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether
+     * the insertion took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts an element with key key and a value constructed from
+     * args if the map doesn't already contain an element with an equivalent
+     * key.
+     *
+     * @param key the key of the element to insert.
+     * @param args arguments to forward to the constructor of the value.
+     *
+     * @return pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether
+     * the insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+    {
+        will_add(key);
+
+        return map_.try_emplace(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos)
+    {
+        if (erased_ + 1 <= (map_.size() - 1) / 2)
+        {
+            ++erased_;
+            return map_.erase(pos);
+        }
+
+        // The new filter is built before the element goes, so that a failed
+        // allocation or hash leaves the map unchanged.
+        BlockedBloomFilter filter = make_filter(pos);
+        iterator const     next   = map_.erase(pos);
+        filter_                   = std::move(filter);
+        erased_                   = 0;
+
+        return next;
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if one
+     * exists.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const key_type& key)
+    {
+        auto const it = find(key);
+        if (it == map_.end())
+        { return 0; }
+
+        erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Erases all elements from the map.
+     */
+    void clear()
+    {
+        map_.clear();
+        rebuild();
+    }
+
+    /**
+     * @brief Sizes the filter for the current elements, with room for as
+     * many more, and adds their keys.
+     */
+    void rebuild()
+    {
+        filter_ = make_filter(map_.cend());
+        erased_ = 0;
+    }
+
+ private:
+    /**
+     * @brief Returns a filter sized for the elements except skip, with room
+     * for as many more, holding their keys.
+     */
+    BlockedBloomFilter make_filter(const_iterator skip) const
+    {
+        constexpr std::size_t kMinCapacity = 64;
+
+        std::size_t const size = map_.size() - (skip != map_.cend() ? 1 : 0);
+        BlockedBloomFilter filter(std::max(kMinCapacity, 2 * size),
+                                  bits_per_key_);
+        for (auto it = map_.cbegin(); it != map_.cend(); ++it)
+        {
+            if (it != skip)
+            { filter.insert(hash_(it->first)); }
+        }
+
+        return filter;
+    }
+
+    template<class Self, class Key>
+    static auto find_key(Self& self, const Key& key)
+    {
+        if (! self.filter_.may_contain(self.hash_(key)))
+        { return self.map_.end(); }
+
+        return self.map_.find(key);
+    }
+
+    /**
+     * @brief Adds key to the filter ahead of its insertion into the map,
+     * growing the filter first if the map is about to outgrow it. Should the
+     * hash or the insertion throw, the filter is left with at most a false
+     * positive, never with a key of the map missing.
+     */
+    void will_add(const key_type& key)
+    {
+        if (map_.size() >= filter_.capacity())
+        { rebuild(); }
+        filter_.insert(hash_(key));
+    }
+
+    Container                  map_;
+    BlockedBloomFilter         filter_;
+    std::size_t                erased_{0};
+    std::size_t                bits_per_key_{kBitsPerKey};
+    [[no_unique_address]] Hash hash_;
+};
+
+/**
+ * @brief BlockedBloomFilter owns one allocation holding its blocks, all of
+ * which are in use.
+ */
+template<> struct MemoryFootprintTraits<BlockedBloomFilter>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const BlockedBloomFilter& value)
+    {
+        std::size_t const bytes = value.size_in_bytes();
+
+        return MemoryFootprint{bytes, bytes, bytes == 0 ? 0u : 1u};
+    }
+};
+
+/**
+ * @brief FilteredMap owns its map and the filter in front of it.
+ */
+template<class Container, class Hash>
+struct MemoryFootprintTraits<FilteredMap<Container, Hash>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const FilteredMap<Container, Hash>& value)
+    {
+        return memory_footprint(value.base())
+               + memory_footprint(value.filter());
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BLOOM_FILTER_H_
@@ -0,0 +1,2161 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_BTREE_MAP_H_
+#define ARA_CORE_BTREE_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/map_slot.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/simd_key.h"
+#include "ara/core/utility.h"
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Size of a cache line. B-tree nodes are aligned to it and their size
+ * is a multiple of it.
+ */
+constexpr std::size_t kCacheLineSize = 64;
+}  // namespace detail
+
+/**
+ * @brief Sorted associative container that contains key-value pairs with unique
+ * keys, stored in a B-tree.
+ *
+ * Every node holds up to a few dozen elements in one allocation aligned to and
+ * sized in multiples of a cache line, so lookups touch few cache lines and
+ * range scans walk contiguous memory instead of chasing one pointer per
+ * element. Numeric keys in their natural order are additionally kept packed in
+ * every node and searched with SIMD comparisons.
+ *
+ * The interface matches ara::core::Map, without node handles. Unlike Map,
+ * elements live inside the nodes and are relocated between node slots when the
+ * tree is modified, so insertion and erasure invalidate all iterators, pointers
+ * and references into the container. Erasure shifts the elements behind the
+ * erased one within its node, and merges or rebalances nodes that run low;
+ * keeping the other elements in place would take one allocation per element,
+ * which is the overhead this container exists to avoid. erase() returns a
+ * valid iterator to the element following the erased ones. Relocation moves
+ * the elements, including the keys; if a move constructor throws while
+ * elements are relocated, the container is left in an unspecified state.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class BTreeMap
+{
+    template<bool Const> class Iterator;
+
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<const K, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = C;
+    using allocator_type  = Allocator;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename AllocatorTraits<Allocator>::pointer;
+    using const_pointer   = typename AllocatorTraits<Allocator>::const_pointer;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Compares elements by their keys.
+     */
+    class value_compare
+    {
+     public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return comp_(lhs.first, rhs.first);
+        }
+
+     private:
+        friend class BTreeMap;
+
+        explicit value_compare(C comp) : comp_(std::move(comp)) {}
+
+        C comp_;
+    };
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     */
+    BTreeMap() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit BTreeMap(const C& comp, const Allocator& alloc = Allocator())
+      : comp_(comp), alloc_(alloc)
+    {}
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit BTreeMap(const Allocator& alloc) : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last). If multiple elements in the range have keys that compare
+     * equivalent, only the first one is inserted.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    BTreeMap(InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : BTreeMap(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which must be sorted by key and free of duplicates. Runs
+     * in linear time and fills the nodes densely.
+     *
+     * @param first start of the sorted range to copy the elements from.
+     * @param last end of the sorted range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    BTreeMap(sorted_unique_t,
+             InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : BTreeMap(comp, alloc)
+    {
+        insert(sorted_unique, first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    BTreeMap(std::initializer_list<value_type> init,
+             const C&                          comp  = C(),
+             const Allocator&                  alloc = Allocator())
+      : BTreeMap(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Copy constructor. Constructs the container with the copy of the
+     * contents of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    BTreeMap(const BTreeMap& other)
+      : BTreeMap(other.comp_,
+                 AllocatorTraits<Allocator>::
+                   select_on_container_copy_construction(other.alloc_))
+    {
+        append(other);
+    }
+
+    /**
+     * @brief Constructs the container with the copy of the contents of other,
+     * using alloc as allocator.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    BTreeMap(const BTreeMap& other, const Allocator& alloc)
+      : BTreeMap(other.comp_, alloc)
+    {
+        append(other);
+    }
+
+    /**
+     * @brief Move constructor. Constructs the container with the contents of
+     * other using move semantics, other is left empty.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    BTreeMap(BTreeMap&& other) noexcept
+      : root_(std::exchange(other.root_, nullptr)),
+        leftmost_(std::exchange(other.leftmost_, nullptr)),
+        rightmost_(std::exchange(other.rightmost_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        leaf_nodes_(std::exchange(other.leaf_nodes_, 0)),
+        internal_nodes_(std::exchange(other.internal_nodes_, 0)),
+        comp_(other.comp_),
+        alloc_(std::move(other.alloc_))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of other using move
+     * semantics and alloc as allocator. The elements are moved one by one if
+     * alloc differs from the allocator of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    BTreeMap(BTreeMap&& other, const Allocator& alloc)
+      : BTreeMap(other.comp_, alloc)
+    {
+        if (alloc_ == other.alloc_)
+        {
+            swap_tree(other);
+            return;
+        }
+
+        for (auto& value : other)
+        { insert_at(end_position(), Slot::rvalue(Slot::of(&value))); }
+        other.clear();
+    }
+
+    ~BTreeMap() { clear(); }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to BTreeMap instance.
+     */
+    BTreeMap& operator=(const BTreeMap& other)
+    {
+        if (this != &other)
+        {
+            BTreeMap copy{other};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container using move semantics.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to BTreeMap instance.
+     */
+    BTreeMap& operator=(BTreeMap&& other) noexcept
+    {
+        BTreeMap moved{std::move(other)};
+        swap(moved);
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to BTreeMap instance.
+     */
+    BTreeMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if both maps contain the same key-value pairs.
+     */
+    friend bool operator==(const BTreeMap& lhs, const BTreeMap& rhs)
+    {
+        return lhs.size() == rhs.size()
+               && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    /**
+     * @brief Compares the contents of two maps lexicographically.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const BTreeMap& lhs, const BTreeMap& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    mapped_type& at(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("BTreeMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a const reference to the mapped value of the element with
+     * key equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    const mapped_type& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("BTreeMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept { return begin_position(); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator begin() const noexcept { return begin_position(); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    iterator end() noexcept { return end_position(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator end() const noexcept { return end_position(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return size_; }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept
+    {
+        return AllocatorTraits<ValueAllocator>::max_size(alloc_);
+    }
+
+    /**
+     * @brief Erases all elements from the container and releases all nodes.
+     */
+    void clear() noexcept
+    {
+        if (root_ == nullptr)
+        { return; }
+
+        destroy_subtree(root_);
+        root_      = nullptr;
+        leftmost_  = nullptr;
+        rightmost_ = nullptr;
+        size_      = 0;
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace_key(value.first, value);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return emplace_hint_key(hint, value.first, value);
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last). If multiple elements in
+     * the range have keys that compare equivalent, only the first one is
+     * inserted.
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) { emplace(*first); }
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last), which must be sorted by
+     * key and free of duplicates.
+     *
+     * Each element is inserted with a hint that follows the previous one, which
+     * costs amortized constant time per element. Appending to the end of the
+     * map fills the nodes densely.
+     *
+     * @param first start of the sorted range of elements to insert.
+     * @param last end of the sorted range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        if (first == last)
+        { return; }
+
+        const_iterator hint = lower_bound((*first).first);
+        for (; first != last; ++first)
+        { hint = std::next(insert(hint, *first)); }
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new element into the container constructed in-place
+     * with the given args if there is no element with the key in the
+     * container.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+
+        return emplace_key(
+          value.first, std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element into the container as close as possible to
+     * the position just before hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+
+        return emplace_hint_key(
+          hint, value.first, std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. args
+     * are not moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(std::move(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args as close as possible to the position just before hint, if
+     * there is no element with the key in the container.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, const K& key, Args&&... args)
+    {
+        return emplace_hint_key(
+          hint,
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args as close as possible to the position just before hint, if
+     * there is no element with the key in the container.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        return emplace_hint_key(
+          hint,
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(std::move(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the element and a bool denoting whether
+     * an insertion took place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
+    {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the element and a bool denoting whether
+     * an insertion took place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        auto result = try_emplace(std::move(key), std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Inserts a new element as close as possible to the position just
+     * before hint, or assigns to the mapped value of the existing element with
+     * key key.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const K& key, M&& obj)
+    {
+        auto const sizeBefore = size_;
+        auto       it         = try_emplace(hint, key, std::forward<M>(obj));
+        if (size_ == sizeBefore)
+        { it->second = std::forward<M>(obj); }
+
+        return it;
+    }
+
+    /**
+     * @brief Inserts a new element as close as possible to the position just
+     * before hint, or assigns to the mapped value of the existing element with
+     * key key.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        auto const sizeBefore = size_;
+        auto it = try_emplace(hint, std::move(key), std::forward<M>(obj));
+        if (size_ == sizeBefore)
+        { it->second = std::forward<M>(obj); }
+
+        return it;
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos)
+    {
+        return erase_at(iterator(pos.node_, pos.position_));
+    }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first == begin() && last == end())
+        {
+            clear();
+            return end();
+        }
+
+        iterator it(first.node_, first.position_);
+        for (auto count = std::distance(first, last); count > 0; --count)
+        { it = erase_at(it); }
+
+        return it;
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { return 0; }
+
+        erase_at(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(BTreeMap& other) noexcept
+    {
+        using std::swap;
+        swap_tree(other);
+        swap(comp_, other.comp_);
+        if constexpr (AllocatorTraits<
+                        Allocator>::propagate_on_container_swap::value)
+        { swap(alloc_, other.alloc_); }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<class C2> void merge(BTreeMap<K, V, C2, Allocator>& source)
+    {
+        for (auto it = source.begin(); it != source.end();)
+        {
+            if (emplace_key(it->first, it->first, std::move(it->second)).second)
+            { it = source.erase(it); }
+            else
+            { ++it; }
+        }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<class C2> void merge(BTreeMap<K, V, C2, Allocator>&& source)
+    {
+        merge(source);
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to key, which is either 1 or 0. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    iterator find(const K& key) { return find_position(key); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const { return find_position(key); }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator find(const Key& key)
+    {
+        return find_position(key);
+    }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return find_position(key);
+    }
+
+    /**
+     * @brief Checks whether there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Checks whether there is an element with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    iterator lower_bound(const K& key) { return bound_position<false>(key); }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator lower_bound(const Key& key)
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    iterator upper_bound(const K& key) { return bound_position<true>(key); }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator upper_bound(const Key& key)
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns the function object that compares the keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return comp_; }
+
+    /**
+     * @brief Returns a function object that compares objects of type
+     * value_type by their keys.
+     *
+     * @return the value comparison function object.
+     */
+    value_compare value_comp() const { return value_compare(comp_); }
+
+ private:
+    friend struct MemoryFootprintTraits<BTreeMap>;
+
+    using ValueAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<value_type>;
+    using Slot = detail::MapSlot<K, V>;
+
+    static_assert(sizeof(Slot) == sizeof(value_type));
+
+    static constexpr bool kSimdSearch = detail::kSimdSearchableKey<K, C>;
+
+    /**
+     * @brief Elements per node: as many as fit into four cache lines next to
+     * the node header and the packed key copies, but at least three, which
+     * splitting and merging rely on.
+     */
+    static constexpr size_type kSlots = std::clamp<size_type>(
+      (4 * detail::kCacheLineSize - sizeof(void*) - 3)
+        / (sizeof(value_type) + (kSimdSearch ? sizeof(K) : 0)),
+      3,
+      std::numeric_limits<std::uint8_t>::max() - 1);
+
+    /**
+     * @brief Nodes other than the root hold at least this many elements.
+     */
+    static constexpr size_type kMinSlots = kSlots / 2;
+
+    static constexpr size_type kKeyLanes = detail::SimdKeyOps<K>::kWidth;
+
+    /**
+     * @brief Packed copy of the keys of a node, padded to whole SIMD blocks.
+     */
+    struct KeyMirror
+    {
+        K keys[(kSlots + kKeyLanes - 1) / kKeyLanes * kKeyLanes]{};
+    };
+
+    struct NoKeyMirror
+    {};
+
+    struct InternalNode;
+
+    /**
+     * @brief Leaf node, and header of internal nodes. The element storage is
+     * left uninitialized, only the first count slots hold elements.
+     */
+    struct alignas(detail::kCacheLineSize) Node
+    {
+        InternalNode* parent{nullptr};
+        std::uint8_t  position{0};
+        std::uint8_t  count{0};
+        bool          leaf{true};
+        [[no_unique_address]] std::
+          conditional_t<kSimdSearch, KeyMirror, NoKeyMirror> mirror;
+        alignas(value_type) unsigned char storage[kSlots * sizeof(value_type)];
+
+        value_type* raw_slot(size_type i) noexcept
+        {
+            return reinterpret_cast<value_type*>(storage
+                                                 + i * sizeof(value_type));
+        }
+
+        value_type* slot(size_type i) noexcept
+        {
+            return std::launder(raw_slot(i));
+        }
+
+        const value_type* slot(size_type i) const noexcept
+        {
+            return std::launder(reinterpret_cast<const value_type*>(
+              storage + i * sizeof(value_type)));
+        }
+
+        const K& key(size_type i) const noexcept { return slot(i)->first; }
+    };
+
+    struct InternalNode : Node
+    {
+        Node* children[kSlots + 1];
+    };
+
+    static_assert(std::is_trivially_destructible_v<InternalNode>);
+
+    using LeafAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<Node>;
+    using InternalAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<InternalNode>;
+
+    template<bool Const> class Iterator
+    {
+        using Slot = std::conditional_t<Const,
+                                        const typename BTreeMap::value_type,
+                                        typename BTreeMap::value_type>;
+
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename BTreeMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Slot*;
+        using reference         = Slot&;
+
+        Iterator() = default;
+
+        /**
+         * @brief Converts an iterator to a const_iterator.
+         */
+        template<bool OtherConst>
+            requires(Const && ! OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept
+          : node_(other.node_), position_(other.position_)
+        {}
+
+        reference operator*() const noexcept
+        {
+            return *node_->slot(position_);
+        }
+
+        pointer operator->() const noexcept { return node_->slot(position_); }
+
+        Iterator& operator++() noexcept
+        {
+            if (! node_->leaf)
+            {
+                // The successor is the leftmost element right of the slot.
+                node_ = Child(node_, position_ + 1);
+                while (! node_->leaf) { node_ = Child(node_, 0); }
+                position_ = 0;
+            }
+            else if (++position_ == node_->count)
+            {
+                // Climb to the first ancestor with an element right of the
+                // subtree. There is none past the last element, which leaves
+                // the iterator at end().
+                Node*     node     = node_;
+                size_type position = position_;
+                while (position == node->count && node->parent != nullptr)
+                {
+                    position = node->position;
+                    node     = node->parent;
+                }
+                if (position < node->count)
+                {
+                    node_     = node;
+                    position_ = position;
+                }
+            }
+
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            ++(*this);
+
+            return previous;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            // Only the end() of an empty container has no node; it has no
+            // predecessor either.
+            if (node_ == nullptr)
+            { return *this; }
+
+            if (! node_->leaf)
+            {
+                // The predecessor is the rightmost element left of the slot.
+                node_ = Child(node_, position_);
+                while (! node_->leaf) { node_ = Child(node_, node_->count); }
+                position_ = node_->count - 1u;
+            }
+            else if (position_ > 0)
+            {
+                --position_;
+            }
+            else
+            {
+                while (position_ == 0 && node_->parent != nullptr)
+                {
+                    position_ = node_->position;
+                    node_     = node_->parent;
+                }
+                --position_;
+            }
+
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator previous = *this;
+            --(*this);
+
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.node_ == rhs.node_ && lhs.position_ == rhs.position_;
+        }
+
+     private:
+        friend class BTreeMap;
+        template<bool> friend class Iterator;
+
+        Iterator(Node* node, size_type position) noexcept
+          : node_(node), position_(position)
+        {}
+
+        Node*     node_{nullptr};
+        size_type position_{0};
+    };
+
+    static Node* Child(const Node* node, size_type i) noexcept
+    {
+        return static_cast<const InternalNode*>(node)->children[i];
+    }
+
+    static void SetChild(InternalNode* node, size_type i, Node* child) noexcept
+    {
+        node->children[i] = child;
+        child->parent     = node;
+        child->position   = static_cast<std::uint8_t>(i);
+    }
+
+    iterator begin_position() const noexcept { return {leftmost_, 0}; }
+
+    iterator end_position() const noexcept
+    {
+        return {rightmost_, rightmost_ == nullptr ? 0u : rightmost_->count};
+    }
+
+    /**
+     * @brief Index of the first element of node that is not less than key, or
+     * greater than key if Upper is set.
+     */
+    template<bool Upper, class Key>
+    size_type search(const Node* node, const Key& key) const
+    {
+        if constexpr (kSimdSearch && std::is_same_v<Key, K>)
+        {
+            return detail::CountBelow<Upper>(
+              node->mirror.keys, node->count, key);
+        }
+        else
+        {
+            size_type first = 0;
+            size_type last  = node->count;
+            while (first < last)
+            {
+                size_type const middle = first + (last - first) / 2;
+                bool const      below  = Upper ? ! comp_(key, node->key(middle))
+                                               : comp_(node->key(middle), key);
+                if (below)
+                { first = middle + 1; }
+                else
+                { last = middle; }
+            }
+
+            return first;
+        }
+    }
+
+    template<class Key> iterator find_position(const Key& key) const
+    {
+        for (Node* node = root_; node != nullptr;)
+        {
+            size_type const i = search<false>(node, key);
+            if (i < node->count && ! comp_(key, node->key(i)))
+            { return {node, i}; }
+            if (node->leaf)
+            { break; }
+
+            node = Child(node, i);
+        }
+
+        return end_position();
+    }
+
+    /**
+     * @brief Lower bound, or upper bound if Upper is set: the last element
+     * found on the way down that is not below key.
+     */
+    template<bool Upper, class Key>
+    iterator bound_position(const Key& key) const
+    {
+        iterator result = end_position();
+        for (Node* node = root_; node != nullptr;)
+        {
+            size_type const i = search<Upper>(node, key);
+            if (i < node->count)
+            { result = {node, i}; }
+            if (node->leaf)
+            { break; }
+
+            node = Child(node, i);
+        }
+
+        return result;
+    }
+
+    template<class Key>
+    std::pair<iterator, iterator> equal_range_position(const Key& key) const
+    {
+        iterator const first = bound_position<false>(key);
+        if (first == end_position() || comp_(key, first->first))
+        { return {first, first}; }
+
+        return {first, std::next(first)};
+    }
+
+    /**
+     * @brief Inserts the element constructed from args unless an element with
+     * key key exists. args are only used if the element is inserted.
+     */
+    template<class Key, class... Args>
+    std::pair<iterator, bool> emplace_key(const Key& key, Args&&... args)
+    {
+        iterator position = end_position();
+        for (Node* node = root_; node != nullptr;)
+        {
+            size_type const i = search<false>(node, key);
+            if (i < node->count && ! comp_(key, node->key(i)))
+            { return {{node, i}, false}; }
+            if (node->leaf)
+            {
+                position = {node, i};
+                break;
+            }
+
+            node = Child(node, i);
+        }
+
+        return {insert_at(position, std::forward<Args>(args)...), true};
+    }
+
+    /**
+     * @brief Inserts the element constructed from args right before hint if
+     * key belongs there, otherwise falls back to emplace_key().
+     */
+    template<class Key, class... Args>
+    iterator
+    emplace_hint_key(const_iterator hint, const Key& key, Args&&... args)
+    {
+        iterator const position(hint.node_, hint.position_);
+        iterator const last = end_position();
+        if (position == last || comp_(key, position->first))
+        {
+            if (position == begin_position()
+                || comp_(std::prev(position)->first, key))
+            { return insert_at(position, std::forward<Args>(args)...); }
+        }
+        else if (comp_(position->first, key))
+        {
+            iterator const next = std::next(position);
+            if (next == last || comp_(key, next->first))
+            { return insert_at(next, std::forward<Args>(args)...); }
+        }
+        else
+        {
+            return position;
+        }
+
+        return emplace_key(key, std::forward<Args>(args)...).first;
+    }
+
+    /**
+     * @brief Appends copies of the elements of other, which sort after all
+     * elements of the container.
+     */
+    void append(const BTreeMap& other)
+    {
+        for (const auto& value : other) { insert_at(end_position(), value); }
+    }
+
+    /**
+     * @brief Constructs an element from args before position, splitting full
+     * nodes on the way up as needed.
+     */
+    template<class... Args>
+    iterator insert_at(iterator position, Args&&... args)
+    {
+        if (root_ == nullptr)
+        {
+            root_     = new_node(true);
+            leftmost_ = rightmost_ = root_;
+            position               = {root_, 0};
+        }
+        else if (! position.node_->leaf)
+        {
+            // Insert right after the predecessor, which is the last element
+            // of a leaf.
+            --position;
+            ++position.position_;
+        }
+
+        if (position.node_->count == kSlots)
+        {
+            // Construct the element first, so that a throwing constructor
+            // leaves the tree untouched.
+            std::pair<K, V> value(std::forward<Args>(args)...);
+            split(position);
+            open_slot(position);
+            Slot::construct(
+              alloc_,
+              Slot::of(position.node_->raw_slot(position.position_)),
+              std::move(value));
+        }
+        else
+        {
+            open_slot(position);
+            try
+            {
+                Slot::construct(
+                  alloc_,
+                  Slot::of(position.node_->raw_slot(position.position_)),
+                  std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                close_slot(position);
+                if (size_ == 0)
+                { clear(); }
+                throw;
+            }
+        }
+
+        set_mirror(position.node_, position.position_);
+        ++size_;
+
+        return position;
+    }
+
+    /**
+     * @brief Shifts the elements at and after position one slot to the right
+     * and counts the uninitialized slot at position.
+     */
+    void open_slot(iterator position)
+    {
+        Node* const node = position.node_;
+        for (size_type i = node->count; i > position.position_; --i)
+        { relocate(node, i, node, i - 1); }
+        ++node->count;
+    }
+
+    /**
+     * @brief Reverts open_slot().
+     */
+    void close_slot(iterator position)
+    {
+        Node* const node = position.node_;
+        --node->count;
+        for (size_type i = position.position_; i < node->count; ++i)
+        { relocate(node, i, node, i + 1); }
+    }
+
+    /**
+     * @brief Splits the full node of position, moving its upper elements into
+     * a new right sibling and the middle element into the parent, which is
+     * split first if it is full as well. position is updated to the insert
+     * position in the node it ends up in.
+     *
+     * The split is biased towards the insert position: appending to the
+     * right-most leaf keeps the left node full, so sequential insertion
+     * fills the nodes densely.
+     */
+    void split(iterator& position)
+    {
+        Node* const node = position.node_;
+        if (node == root_)
+        {
+            auto* const root = static_cast<InternalNode*>(new_node(false));
+            SetChild(root, 0, node);
+            root_ = root;
+        }
+        else if (node->parent->count == kSlots)
+        {
+            iterator parentPosition(node->parent, node->position);
+            split(parentPosition);
+        }
+
+        InternalNode* const parent  = node->parent;
+        Node* const         sibling = new_node(node->leaf);
+
+        size_type const insert = position.position_;
+        size_type const moved  = insert == 0       ? kSlots - 1
+                                 : insert == kSlots ? 0
+                                                    : kSlots / 2;
+        size_type const kept   = kSlots - moved - 1;
+
+        for (size_type i = 0; i < moved; ++i)
+        { relocate(sibling, i, node, kept + 1 + i); }
+        if (! node->leaf)
+        {
+            auto* const internal = static_cast<InternalNode*>(sibling);
+            for (size_type i = 0; i <= moved; ++i)
+            { SetChild(internal, i, Child(node, kept + 1 + i)); }
+        }
+        sibling->count = static_cast<std::uint8_t>(moved);
+
+        size_type const at = node->position;
+        for (size_type i = parent->count; i > at; --i)
+        {
+            relocate(parent, i, parent, i - 1);
+            SetChild(parent, i + 1, parent->children[i]);
+        }
+        relocate(parent, at, node, kept);
+        SetChild(parent, at + 1, sibling);
+        ++parent->count;
+        node->count = static_cast<std::uint8_t>(kept);
+
+        if (rightmost_ == node)
+        { rightmost_ = sibling; }
+        if (insert > kept)
+        { position = {sibling, insert - kept - 1}; }
+    }
+
+    /**
+     * @brief Removes the element at position. Elements of internal nodes are
+     * replaced by their predecessor, so that only leaves shrink, and
+     * underfull nodes are merged with or refilled from a sibling on the way
+     * up.
+     */
+    iterator erase_at(iterator position)
+    {
+        bool const internal = ! position.node_->leaf;
+        Slot::destroy(
+          alloc_, Slot::of(position.node_->slot(position.position_)));
+        if (internal)
+        {
+            iterator const target = position;
+            --position;
+            relocate(target.node_, target.position_, position.node_,
+                     position.position_);
+        }
+
+        Node* const node = position.node_;
+        --node->count;
+        for (size_type i = position.position_; i < node->count; ++i)
+        { relocate(node, i, node, i + 1); }
+        --size_;
+
+        position = rebalance_after_erase(position);
+        if (internal)
+        {
+            // position is at the predecessor that took the erased slot.
+            ++position;
+        }
+
+        return position;
+    }
+
+    iterator rebalance_after_erase(iterator position)
+    {
+        iterator result = position;
+        bool     first  = true;
+        while (true)
+        {
+            if (position.node_ == root_)
+            {
+                shrink_root();
+                if (size_ == 0)
+                { return end_position(); }
+
+                break;
+            }
+            if (position.node_->count >= kMinSlots)
+            { break; }
+
+            bool const merged = merge_or_rebalance(position);
+            if (first)
+            {
+                // Only the leaf level holds the erased position.
+                result = position;
+                first  = false;
+            }
+            if (! merged)
+            { break; }
+
+            position = {position.node_->parent, position.node_->position};
+        }
+
+        if (result.position_ == result.node_->count)
+        {
+            --result.position_;
+            ++result;
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Merges the underfull node of position with a sibling if both fit
+     * into one node, otherwise moves elements over from a sibling. Returns
+     * whether a merge took place, which shrinks the parent. position follows
+     * the element it pointed to.
+     */
+    bool merge_or_rebalance(iterator& position)
+    {
+        Node* const         node   = position.node_;
+        InternalNode* const parent = node->parent;
+        size_type const     count  = node->count;
+
+        if (node->position > 0)
+        {
+            Node* const     left      = parent->children[node->position - 1];
+            size_type const leftCount = left->count;
+            if (leftCount + 1 + count <= kSlots)
+            {
+                position = {left, position.position_ + leftCount + 1};
+                merge(left, node);
+                return true;
+            }
+        }
+        if (node->position < parent->count)
+        {
+            Node* const     right      = parent->children[node->position + 1];
+            size_type const rightCount = right->count;
+            if (count + 1 + rightCount <= kSlots)
+            {
+                merge(node, right);
+                return true;
+            }
+            // Erasing from the front of a node is common when draining a map,
+            // leave such nodes underfull unless they ran empty.
+            if (rightCount > kMinSlots
+                && (count == 0 || position.position_ > 0))
+            {
+                size_type const moved =
+                  std::min((rightCount - count) / 2, rightCount - 1);
+                rotate_left(node, right, moved);
+                return false;
+            }
+        }
+        if (node->position > 0)
+        {
+            Node* const     left      = parent->children[node->position - 1];
+            size_type const leftCount = left->count;
+            if (leftCount > kMinSlots
+                && (count == 0 || position.position_ < count))
+            {
+                size_type const moved =
+                  std::min((leftCount - count) / 2, leftCount - 1);
+                rotate_right(left, node, moved);
+                position.position_ += moved;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Moves the separator in the parent and all of right into left, and
+     * releases right.
+     */
+    void merge(Node* left, Node* right) noexcept
+    {
+        InternalNode* const parent = left->parent;
+        size_type const     at     = left->position;
+        size_type const     base   = left->count;
+
+        relocate(left, base, parent, at);
+        for (size_type i = 0; i < right->count; ++i)
+        { relocate(left, base + 1 + i, right, i); }
+        if (! left->leaf)
+        {
+            auto* const internal = static_cast<InternalNode*>(left);
+            for (size_type i = 0; i <= right->count; ++i)
+            { SetChild(internal, base + 1 + i, Child(right, i)); }
+        }
+        left->count = static_cast<std::uint8_t>(base + 1u + right->count);
+
+        for (size_type i = at + 1; i < parent->count; ++i)
+        {
+            relocate(parent, i - 1, parent, i);
+            SetChild(parent, i, parent->children[i + 1]);
+        }
+        --parent->count;
+
+        if (rightmost_ == right)
+        { rightmost_ = left; }
+        delete_node(right);
+    }
+
+    /**
+     * @brief Moves the first moved elements of right through the parent into
+     * left.
+     */
+    void rotate_left(Node* left, Node* right, size_type moved) noexcept
+    {
+        InternalNode* const parent = left->parent;
+        size_type const     at     = left->position;
+        size_type const     base   = left->count;
+
+        relocate(left, base, parent, at);
+        for (size_type i = 0; i + 1 < moved; ++i)
+        { relocate(left, base + 1 + i, right, i); }
+        relocate(parent, at, right, moved - 1);
+        for (size_type i = moved; i < right->count; ++i)
+        { relocate(right, i - moved, right, i); }
+
+        if (! left->leaf)
+        {
+            auto* const leftInternal  = static_cast<InternalNode*>(left);
+            auto* const rightInternal = static_cast<InternalNode*>(right);
+            for (size_type i = 0; i < moved; ++i)
+            { SetChild(leftInternal, base + 1 + i, Child(right, i)); }
+            for (size_type i = moved; i <= right->count; ++i)
+            { SetChild(rightInternal, i - moved, Child(right, i)); }
+        }
+
+        left->count  = static_cast<std::uint8_t>(base + moved);
+        right->count = static_cast<std::uint8_t>(right->count - moved);
+    }
+
+    /**
+     * @brief Moves the last moved elements of left through the parent into
+     * right.
+     */
+    void rotate_right(Node* left, Node* right, size_type moved) noexcept
+    {
+        InternalNode* const parent = left->parent;
+        size_type const     at     = left->position;
+        size_type const     base   = left->count - moved;
+
+        for (size_type i = right->count; i > 0; --i)
+        { relocate(right, i - 1 + moved, right, i - 1); }
+        relocate(right, moved - 1, parent, at);
+        for (size_type i = 0; i + 1 < moved; ++i)
+        { relocate(right, i, left, base + 1 + i); }
+        relocate(parent, at, left, base);
+
+        if (! left->leaf)
+        {
+            auto* const rightInternal = static_cast<InternalNode*>(right);
+            for (size_type i = right->count + 1u; i > 0; --i)
+            { SetChild(rightInternal, i - 1 + moved, Child(right, i - 1)); }
+            for (size_type i = 0; i < moved; ++i)
+            { SetChild(rightInternal, i, Child(left, base + 1 + i)); }
+        }
+
+        left->count  = static_cast<std::uint8_t>(base);
+        right->count = static_cast<std::uint8_t>(right->count + moved);
+    }
+
+    /**
+     * @brief Drops an empty root, making its only child the new root.
+     */
+    void shrink_root() noexcept
+    {
+        if (root_->count > 0)
+        { return; }
+
+        Node* const root = root_;
+        if (root->leaf)
+        {
+            root_      = nullptr;
+            leftmost_  = nullptr;
+            rightmost_ = nullptr;
+        }
+        else
+        {
+            root_           = Child(root, 0);
+            root_->parent   = nullptr;
+            root_->position = 0;
+        }
+        delete_node(root);
+    }
+
+    /**
+     * @brief Move constructs the element at slot from of src into the
+     * uninitialized slot to of dst and destroys the source element.
+     */
+    void relocate(Node* dst, size_type to, Node* src, size_type from) noexcept
+    {
+        Slot::relocate(
+          alloc_, Slot::of(dst->raw_slot(to)), Slot::of(src->slot(from)));
+        set_mirror(dst, to);
+    }
+
+    void set_mirror(Node* node, size_type i) noexcept
+    {
+        if constexpr (kSimdSearch)
+        { node->mirror.keys[i] = node->key(i); }
+    }
+
+    Node* new_node(bool leaf)
+    {
+        // Default-initialize, leaving the element storage uninitialized.
+        if (leaf)
+        {
+            LeafAllocator alloc{alloc_};
+            Node* const   node = ::new (static_cast<void*>(
+              AllocatorTraits<LeafAllocator>::allocate(alloc, 1))) Node;
+            ++leaf_nodes_;
+
+            return node;
+        }
+
+        InternalAllocator   alloc{alloc_};
+        InternalNode* const node = ::new (static_cast<void*>(
+          AllocatorTraits<InternalAllocator>::allocate(alloc, 1))) InternalNode;
+        node->leaf = false;
+        ++internal_nodes_;
+
+        return node;
+    }
+
+    void delete_node(Node* node) noexcept
+    {
+        if (node->leaf)
+        {
+            LeafAllocator alloc{alloc_};
+            AllocatorTraits<LeafAllocator>::deallocate(alloc, node, 1);
+            --leaf_nodes_;
+        }
+        else
+        {
+            InternalAllocator alloc{alloc_};
+            AllocatorTraits<InternalAllocator>::deallocate(
+              alloc, static_cast<InternalNode*>(node), 1);
+            --internal_nodes_;
+        }
+    }
+
+    void destroy_subtree(Node* node) noexcept
+    {
+        for (size_type i = 0; i < node->count; ++i)
+        { Slot::destroy(alloc_, Slot::of(node->slot(i))); }
+        if (! node->leaf)
+        {
+            for (size_type i = 0; i <= node->count; ++i)
+            { destroy_subtree(Child(node, i)); }
+        }
+        delete_node(node);
+    }
+
+    void swap_tree(BTreeMap& other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(leftmost_, other.leftmost_);
+        std::swap(rightmost_, other.rightmost_);
+        std::swap(size_, other.size_);
+        std::swap(leaf_nodes_, other.leaf_nodes_);
+        std::swap(internal_nodes_, other.internal_nodes_);
+    }
+
+    Node*                                root_{nullptr};
+    Node*                                leftmost_{nullptr};
+    Node*                                rightmost_{nullptr};
+    size_type                            size_{0};
+    size_type                            leaf_nodes_{0};
+    size_type                            internal_nodes_{0};
+    [[no_unique_address]] C              comp_;
+    [[no_unique_address]] ValueAllocator alloc_;
+};
+
+/**
+ * @brief Exchanges the contents of two maps.
+ *
+ * @param lhs first map.
+ * @param rhs second map.
+ */
+template<class K, class V, class C, class Allocator> void
+swap(BTreeMap<K, V, C, Allocator>& lhs,
+     BTreeMap<K, V, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief BTreeMap allocates nodes of several elements each; the free slots of
+ * the nodes are reserved but unused.
+ */
+template<class K, class V, class C, class Allocator>
+struct MemoryFootprintTraits<BTreeMap<K, V, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const BTreeMap<K, V, C, Allocator>& value)
+    {
+        using Tree = BTreeMap<K, V, C, Allocator>;
+
+        std::size_t const nodes = value.leaf_nodes_ + value.internal_nodes_;
+        std::size_t const slot  = sizeof(typename Tree::value_type)
+                                 + (Tree::kSimdSearch ? sizeof(K) : 0);
+        std::size_t const reserved =
+          value.leaf_nodes_ * sizeof(typename Tree::Node)
+          + value.internal_nodes_ * sizeof(typename Tree::InternalNode);
+        std::size_t const unused = (nodes * Tree::kSlots - value.size()) * slot;
+
+        MemoryFootprint footprint{reserved - unused, reserved, nodes};
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [k, v] : value)
+            { footprint += memory_footprint(k) + memory_footprint(v); }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BTREE_MAP_H_
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_BYTE_ALGORITHM_H_
+#define ARA_CORE_BYTE_ALGORITHM_H_
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+#include <cstddef>
+
+/**
+ * Bulk operations over contiguous ranges of ara::core::Byte, such as a
+ * Vector<Byte> or an Array<Byte, N>. The bitwise operators of Byte work on
+ * one byte at a time, and compilers don't reliably vectorize loops through
+ * the class. These kernels process 16, 32 or 64 bytes per instruction with
+ * SSE2, AVX2 or AVX-512, whichever the CPU supports, chosen once at runtime;
+ * other targets use a portable scalar loop.
+ */
+namespace ara::core {
+
+/**
+ * @brief Stores the bitwise XOR of lhs and rhs in out.
+ *
+ * @param lhs first operand.
+ * @param rhs second operand, of the same size.
+ * @param out destination, of the same size. May be lhs or rhs, but must not
+ * overlap them otherwise.
+ *
+ * @throws std::invalid_argument if the sizes differ.
+ */
+void bytes_xor(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out);
+
+/**
+ * @brief Stores the bitwise AND of lhs and rhs in out.
+ *
+ * @param lhs first operand.
+ * @param rhs second operand, of the same size.
+ * @param out destination, of the same size. May be lhs or rhs, but must not
+ * overlap them otherwise.
+ *
+ * @throws std::invalid_argument if the sizes differ.
+ */
+void bytes_and(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out);
+
+/**
+ * @brief Stores the bitwise OR of lhs and rhs in out.
+ *
+ * @param lhs first operand.
+ * @param rhs second operand, of the same size.
+ * @param out destination, of the same size. May be lhs or rhs, but must not
+ * overlap them otherwise.
+ *
+ * @throws std::invalid_argument if the sizes differ.
+ */
+void bytes_or(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out);
+
+/**
+ * @brief Stores the bitwise complement of bytes in out.
+ *
+ * @param bytes operand.
+ * @param out destination, of the same size. May be bytes, but must not
+ * overlap it otherwise.
+ *
+ * @throws std::invalid_argument if the sizes differ.
+ */
+void bytes_not(Span<const Byte> bytes, Span<Byte> out);
+
+/**
+ * @brief Counts the set bits.
+ *
+ * @param bytes bytes to count the bits of.
+ *
+ * @return number of bits that are one.
+ */
+std::size_t popcount(Span<const Byte> bytes) noexcept;
+
+/**
+ * @brief Finds the first byte equal to value.
+ *
+ * @param bytes bytes to search.
+ * @param value byte to search for.
+ *
+ * @return position of the first match, or bytes.size() if there is none.
+ */
+std::size_t find_byte(Span<const Byte> bytes, Byte value) noexcept;
+
+/**
+ * @brief Counts the bytes equal to value.
+ *
+ * @param bytes bytes to search.
+ * @param value byte to count.
+ *
+ * @return number of matches.
+ */
+std::size_t count_byte(Span<const Byte> bytes, Byte value) noexcept;
+
+namespace detail {
+/**
+ * @brief Instruction sets the byte kernels are implemented with.
+ */
+enum class ByteKernelIsa
+{
+    kScalar,
+    kSse2,
+    kAvx2,
+    kAvx512
+};
+
+/**
+ * @brief Returns the instruction set the byte kernels currently use, the best
+ * one the CPU supports unless UseByteKernels() chose another.
+ */
+ByteKernelIsa ActiveByteKernels() noexcept;
+
+/**
+ * @brief Switches the byte kernels to isa, for tests and benchmarks.
+ *
+ * @param isa instruction set to use.
+ *
+ * @return false, leaving the kernels unchanged, if the CPU or the compiler
+ * doesn't support isa.
+ */
+bool UseByteKernels(ByteKernelIsa isa) noexcept;
+}  // namespace detail
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BYTE_ALGORITHM_H_
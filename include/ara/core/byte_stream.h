@@ -0,0 +1,615 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_BYTE_STREAM_H_
+#define ARA_CORE_BYTE_STREAM_H_
+
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+
+/**
+ * Cursors that serialize fixed width values to and from Byte buffers in a
+ * given byte order. A value is moved with one load or store, byte swapped
+ * when the order differs from the one of the machine, instead of being
+ * assembled from single Bytes. Writing or reading several values at once, or
+ * a whole range of them, checks the bounds once for the batch.
+ */
+namespace ara::core {
+
+namespace detail {
+static_assert(std::endian::native == std::endian::little
+                || std::endian::native == std::endian::big,
+              "mixed-endian machines are not supported");
+
+/**
+ * @brief Types that ByteWriter and ByteReader move as fixed width values:
+ * integers other than bool, enumerations and floating point numbers of 1, 2,
+ * 4 or 8 bytes.
+ */
+template<class T>
+concept ByteStreamValue =
+  ((std::is_integral_v<T> && ! std::is_same_v<T, bool>) || std::is_enum_v<T>
+   || std::is_floating_point_v<T>)
+  && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template<std::size_t Size> struct UnsignedOfSize;
+template<> struct UnsignedOfSize<1>
+{
+    using type = std::uint8_t;
+};
+template<> struct UnsignedOfSize<2>
+{
+    using type = std::uint16_t;
+};
+template<> struct UnsignedOfSize<4>
+{
+    using type = std::uint32_t;
+};
+template<> struct UnsignedOfSize<8>
+{
+    using type = std::uint64_t;
+};
+
+/**
+ * @brief Reverses the bytes of value, with a single instruction where the
+ * compiler has one.
+ */
+template<class U> constexpr U ByteSwap(U value) noexcept
+{
+    if constexpr (sizeof(U) == 1)
+    { return value; }
+#if defined(__GNUC__)
+    else if constexpr (sizeof(U) == 2)
+    { return __builtin_bswap16(value); }
+    else if constexpr (sizeof(U) == 4)
+    { return __builtin_bswap32(value); }
+    else
+    { return __builtin_bswap64(value); }
+#else
+    else
+    {
+        U swapped = 0;
+        for (std::size_t i = 0; i < sizeof(U); ++i)
+        {
+            swapped = static_cast<U>((swapped << 8) | (value & 0xff));
+            value   = static_cast<U>(value >> 8);
+        }
+        return swapped;
+    }
+#endif
+}
+
+/**
+ * @brief Stores value at out in byte order Order.
+ */
+template<std::endian Order, ByteStreamValue T>
+inline void StoreValue(Byte* out, T value) noexcept
+{
+    using U = typename UnsignedOfSize<sizeof(T)>::type;
+
+    U bits = std::bit_cast<U>(value);
+    if constexpr (Order != std::endian::native)
+    { bits = ByteSwap(bits); }
+    std::memcpy(static_cast<void*>(out), &bits, sizeof(bits));
+}
+
+/**
+ * @brief Loads a value stored in byte order Order at in.
+ */
+template<std::endian Order, ByteStreamValue T>
+inline T LoadValue(const Byte* in) noexcept
+{
+    using U = typename UnsignedOfSize<sizeof(T)>::type;
+
+    U bits;
+    std::memcpy(&bits, static_cast<const void*>(in), sizeof(bits));
+    if constexpr (Order != std::endian::native)
+    { bits = ByteSwap(bits); }
+
+    return std::bit_cast<T>(bits);
+}
+
+/**
+ * @brief Stores the values of [first, first + count) at out in byte order
+ * Order, with one copy when that is the order of the machine.
+ */
+template<std::endian Order, ByteStreamValue T>
+inline void StoreValues(Byte* out, const T* first, std::size_t count) noexcept
+{
+    if constexpr (Order == std::endian::native || sizeof(T) == 1)
+    {
+        if (count != 0)
+        { std::memcpy(static_cast<void*>(out), first, count * sizeof(T)); }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        { StoreValue<Order>(out + i * sizeof(T), first[i]); }
+    }
+}
+
+/**
+ * @brief Loads count values stored in byte order Order at in into first.
+ */
+template<std::endian Order, ByteStreamValue T>
+inline void LoadValues(T* first, const Byte* in, std::size_t count) noexcept
+{
+    if constexpr (Order == std::endian::native || sizeof(T) == 1)
+    {
+        if (count != 0)
+        { std::memcpy(first, static_cast<const void*>(in), count * sizeof(T)); }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        { first[i] = LoadValue<Order, T>(in + i * sizeof(T)); }
+    }
+}
+
+/**
+ * @brief Contiguous ranges of values that ByteWriter can write in one batch.
+ */
+template<class R>
+concept ByteStreamInputRange =
+  std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+  && ByteStreamValue<std::remove_cv_t<std::ranges::range_value_t<R>>>;
+
+/**
+ * @brief Contiguous ranges of values that ByteReader can fill in one batch.
+ */
+template<class R>
+concept ByteStreamOutputRange =
+  ByteStreamInputRange<R>
+  && ! std::is_const_v<
+    std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+}  // namespace detail
+
+/**
+ * @brief Cursor that appends fixed width values in a given byte order to a
+ * Byte buffer.
+ *
+ * Over a Span the writer fills the span and throws once it is full. Over a
+ * Vector it appends to the vector, which grows geometrically:
+ * @code
+ * Vector<Byte> frame;
+ * {
+ *     ByteWriter writer(frame);
+ *     writer.write_be(std::uint16_t{0x1234}, std::uint32_t{length});
+ *     writer.write_bytes(payload);
+ * }
+ * @endcode
+ * While the writer is alive the vector may hold spare bytes past the ones
+ * written; flush() or destroying the writer trims them.
+ *
+ * Each call checks and, over a vector, reserves the space of all its values
+ * at once and then stores them without further checks. On overflow nothing
+ * is written.
+ */
+class ByteWriter
+{
+ public:
+    /**
+     * @brief Writes into buffer, starting at its first byte.
+     *
+     * @param buffer bytes to fill, which must outlive the writer.
+     */
+    explicit ByteWriter(Span<Byte> buffer) noexcept
+      : begin_{buffer.data()}
+      , pos_{buffer.data()}
+      , end_{buffer.data() + buffer.size()}
+    {}
+
+    /**
+     * @brief Appends to buffer, after the bytes it already holds.
+     *
+     * @param buffer vector to grow, which must outlive the writer and not be
+     * modified otherwise while it is alive.
+     */
+    explicit ByteWriter(Vector<Byte>& buffer) noexcept
+      : sink_{&buffer}
+      , begin_{buffer.data() + buffer.size()}
+      , pos_{begin_}
+      , end_{begin_}
+    {}
+
+    ByteWriter(const ByteWriter&)            = delete;
+    ByteWriter& operator=(const ByteWriter&) = delete;
+
+    ~ByteWriter() { flush(); }
+
+    /**
+     * @brief Writes values in big-endian (network) byte order.
+     *
+     * @param values values to write, one after the other.
+     *
+     * @throws std::out_of_range if a span has no room for all of them.
+     */
+    template<detail::ByteStreamValue... Ts>
+        requires(sizeof...(Ts) > 0)
+    void write_be(Ts... values)
+    {
+        write_values<std::endian::big>(values...);
+    }
+
+    /**
+     * @brief Writes values in little-endian byte order.
+     *
+     * @param values values to write, one after the other.
+     *
+     * @throws std::out_of_range if a span has no room for all of them.
+     */
+    template<detail::ByteStreamValue... Ts>
+        requires(sizeof...(Ts) > 0)
+    void write_le(Ts... values)
+    {
+        write_values<std::endian::little>(values...);
+    }
+
+    /**
+     * @brief Writes a contiguous range of values, such as a Vector or an
+     * Array, in big-endian byte order.
+     *
+     * @param values values to write.
+     *
+     * @throws std::out_of_range if a span has no room for all of them.
+     */
+    template<detail::ByteStreamInputRange R> void write_be(const R& values)
+    {
+        write_range<std::endian::big>(values);
+    }
+
+    /**
+     * @brief Writes a contiguous range of values, such as a Vector or an
+     * Array, in little-endian byte order.
+     *
+     * @param values values to write.
+     *
+     * @throws std::out_of_range if a span has no room for all of them.
+     */
+    template<detail::ByteStreamInputRange R> void write_le(const R& values)
+    {
+        write_range<std::endian::little>(values);
+    }
+
+    /**
+     * @brief Copies bytes unchanged.
+     *
+     * @param bytes bytes to write, which must not lie in the buffer.
+     *
+     * @throws std::out_of_range if a span has no room for them.
+     */
+    void write_bytes(Span<const Byte> bytes)
+    {
+        Byte* const out = claim(bytes.size());
+        if (! bytes.empty())
+        {
+            std::memcpy(static_cast<void*>(out),
+                        static_cast<const void*>(bytes.data()),
+                        bytes.size());
+        }
+    }
+
+    /**
+     * @brief Returns the number of bytes written.
+     */
+    std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>(pos_ - begin_);
+    }
+
+    /**
+     * @brief Returns the bytes written, valid until the next write.
+     */
+    Span<const Byte> written() const noexcept { return {begin_, size()}; }
+
+    /**
+     * @brief Trims the spare bytes of a vector, so that it ends with the last
+     * byte written. Writing may continue afterwards. Does nothing over a
+     * span.
+     */
+    void flush() noexcept
+    {
+        if (sink_ && pos_ != end_)
+        {
+            // Shrinking a vector neither allocates nor moves its bytes.
+            sink_->resize(static_cast<std::size_t>(pos_ - sink_->data()));
+            end_ = pos_;
+        }
+    }
+
+ private:
+    /**
+     * @brief Returns where to store the next count bytes and moves the
+     * cursor past them; the one bounds check of a batch.
+     */
+    Byte* claim(std::size_t count)
+    {
+        if (count > static_cast<std::size_t>(end_ - pos_))
+        { grow(count); }
+
+        Byte* const out = pos_;
+        pos_ += count;
+        return out;
+    }
+
+    /**
+     * @brief Makes room for count more bytes in the vector, at least
+     * doubling it so that appending stays amortized constant time.
+     */
+    void grow(std::size_t count)
+    {
+        if (! sink_)
+        { throw std::out_of_range("ByteWriter: buffer full"); }
+
+        constexpr std::size_t kMinimumSize = 64;
+
+        auto const begin = static_cast<std::size_t>(begin_ - sink_->data());
+        auto const pos   = static_cast<std::size_t>(pos_ - sink_->data());
+        if (count > sink_->max_size() - pos)
+        { throw std::length_error("ByteWriter: buffer too large"); }
+        auto const size = std::max({pos + count, 2 * pos, kMinimumSize});
+        sink_->reserve(size);
+
+        // resize() would value-initialize the new bytes one Byte at a time;
+        // copying zeros lets the library use memcpy().
+        static constexpr Byte kZeros[4096]{};
+        while (sink_->size() < size)
+        {
+            auto const chunk =
+              std::min(size - sink_->size(), std::size(kZeros));
+            sink_->insert(sink_->end(), kZeros, kZeros + chunk);
+        }
+        begin_ = sink_->data() + begin;
+        pos_   = sink_->data() + pos;
+        end_   = sink_->data() + sink_->size();
+    }
+
+    template<std::endian Order, class... Ts> void write_values(Ts... values)
+    {
+        Byte* out = claim((sizeof(Ts) + ...));
+        ((detail::StoreValue<Order>(out, values), out += sizeof(Ts)), ...);
+    }
+
+    template<std::endian Order, class R> void write_range(const R& values)
+    {
+        using T = std::remove_cv_t<std::ranges::range_value_t<R>>;
+
+        auto const count = static_cast<std::size_t>(std::ranges::size(values));
+        if (count > static_cast<std::size_t>(-1) / sizeof(T))
+        { throw std::length_error("ByteWriter: range too large"); }
+        detail::StoreValues<Order, T>(
+          claim(count * sizeof(T)), std::ranges::data(values), count);
+    }
+
+    Vector<Byte>* sink_{nullptr};
+    Byte*         begin_{nullptr};
+    Byte*         pos_{nullptr};
+    Byte*         end_{nullptr};
+};
+
+/**
+ * @brief Cursor that reads fixed width values in a given byte order from a
+ * Byte buffer, without copying it.
+ *
+ * @code
+ * ByteReader reader(frame);
+ * auto const [tag, length] = reader.read_be<std::uint16_t, std::uint32_t>();
+ * Span<const Byte> const payload = reader.read_bytes(length);
+ * @endcode
+ *
+ * Each call checks the bounds once for all the values it reads. Reading past
+ * the end throws and leaves the cursor where it was.
+ */
+class ByteReader
+{
+ public:
+    /**
+     * @brief Reads from bytes, starting at the first one.
+     *
+     * @param bytes bytes to read, which must outlive the reader.
+     */
+    explicit ByteReader(Span<const Byte> bytes) noexcept
+      : begin_{bytes.data()}
+      , pos_{bytes.data()}
+      , end_{bytes.data() + bytes.size()}
+    {}
+
+    /**
+     * @brief Reads a value stored in big-endian (network) byte order.
+     *
+     * @tparam T type of the value.
+     *
+     * @return the value.
+     *
+     * @throws std::out_of_range if fewer than sizeof(T) bytes remain.
+     */
+    template<detail::ByteStreamValue T> T read_be()
+    {
+        return detail::LoadValue<std::endian::big, T>(take(sizeof(T)));
+    }
+
+    /**
+     * @brief Reads consecutive values stored in big-endian byte order.
+     *
+     * @tparam Ts types of the values, in the order they are stored.
+     *
+     * @return the values.
+     *
+     * @throws std::out_of_range if fewer bytes remain than they take.
+     */
+    template<detail::ByteStreamValue T1,
+             detail::ByteStreamValue T2,
+             detail::ByteStreamValue... Ts>
+    std::tuple<T1, T2, Ts...> read_be()
+    {
+        return read_values<std::endian::big, T1, T2, Ts...>();
+    }
+
+    /**
+     * @brief Reads a value stored in little-endian byte order.
+     *
+     * @tparam T type of the value.
+     *
+     * @return the value.
+     *
+     * @throws std::out_of_range if fewer than sizeof(T) bytes remain.
+     */
+    template<detail::ByteStreamValue T> T read_le()
+    {
+        return detail::LoadValue<std::endian::little, T>(take(sizeof(T)));
+    }
+
+    /**
+     * @brief Reads consecutive values stored in little-endian byte order.
+     *
+     * @tparam Ts types of the values, in the order they are stored.
+     *
+     * @return the values.
+     *
+     * @throws std::out_of_range if fewer bytes remain than they take.
+     */
+    template<detail::ByteStreamValue T1,
+             detail::ByteStreamValue T2,
+             detail::ByteStreamValue... Ts>
+    std::tuple<T1, T2, Ts...> read_le()
+    {
+        return read_values<std::endian::little, T1, T2, Ts...>();
+    }
+
+    /**
+     * @brief Fills a contiguous range, such as a Vector or an Array, with
+     * values stored in big-endian byte order.
+     *
+     * @param values range to fill, its size the number of values to read.
+     *
+     * @throws std::out_of_range if fewer bytes remain than the values take.
+     */
+    template<detail::ByteStreamOutputRange R> void read_be(R&& values)
+    {
+        read_range<std::endian::big>(values);
+    }
+
+    /**
+     * @brief Fills a contiguous range, such as a Vector or an Array, with
+     * values stored in little-endian byte order.
+     *
+     * @param values range to fill, its size the number of values to read.
+     *
+     * @throws std::out_of_range if fewer bytes remain than the values take.
+     */
+    template<detail::ByteStreamOutputRange R> void read_le(R&& values)
+    {
+        read_range<std::endian::little>(values);
+    }
+
+    /**
+     * @brief Reads count bytes without copying them.
+     *
+     * @param count number of bytes.
+     *
+     * @return the bytes, a view into the buffer.
+     *
+     * @throws std::out_of_range if fewer than count bytes remain.
+     */
+    Span<const Byte> read_bytes(std::size_t count)
+    {
+        return {take(count), count};
+    }
+
+    /**
+     * @brief Moves the cursor past count bytes.
+     *
+     * @param count number of bytes to skip.
+     *
+     * @throws std::out_of_range if fewer than count bytes remain.
+     */
+    void skip(std::size_t count) { take(count); }
+
+    /**
+     * @brief Returns the number of bytes read.
+     */
+    std::size_t position() const noexcept
+    {
+        return static_cast<std::size_t>(pos_ - begin_);
+    }
+
+    /**
+     * @brief Returns the number of bytes left to read.
+     */
+    std::size_t remaining() const noexcept
+    {
+        return static_cast<std::size_t>(end_ - pos_);
+    }
+
+    /**
+     * @brief Checks whether all bytes have been read.
+     */
+    bool empty() const noexcept { return pos_ == end_; }
+
+    /**
+     * @brief Returns the bytes left to read, without moving the cursor.
+     */
+    Span<const Byte> rest() const noexcept { return {pos_, remaining()}; }
+
+ private:
+    /**
+     * @brief Returns where the next count bytes are and moves the cursor past
+     * them; the one bounds check of a batch.
+     */
+    const Byte* take(std::size_t count)
+    {
+        if (count > remaining())
+        { throw std::out_of_range("ByteReader: read past the end"); }
+
+        const Byte* const in = pos_;
+        pos_ += count;
+        return in;
+    }
+
+    template<std::endian Order, class... Ts>
+    std::tuple<Ts...> read_values()
+    {
+        const Byte* in = take((sizeof(Ts) + ...));
+        auto const  next = [&in]<class T>(std::type_identity<T>) {
+            T const value = detail::LoadValue<Order, T>(in);
+            in += sizeof(T);
+            return value;
+        };
+
+        // The elements of a braced initializer are evaluated in order.
+        return std::tuple<Ts...>{next(std::type_identity<Ts>{})...};
+    }
+
+    template<std::endian Order, class R> void read_range(R& values)
+    {
+        using T = std::ranges::range_value_t<R>;
+
+        auto const count = static_cast<std::size_t>(std::ranges::size(values));
+        if (count > remaining() / sizeof(T))
+        { throw std::out_of_range("ByteReader: read past the end"); }
+        detail::LoadValues<Order, T>(
+          std::ranges::data(values), take(count * sizeof(T)), count);
+    }
+
+    const Byte* begin_{nullptr};
+    const Byte* pos_{nullptr};
+    const Byte* end_{nullptr};
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_BYTE_STREAM_H_
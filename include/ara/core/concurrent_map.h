@@ -0,0 +1,515 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_CONCURRENT_MAP_H_
+#define ARA_CORE_CONCURRENT_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/unordered_map.h"
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Hash map supporting concurrent lookups and updates.
+ *
+ * Keys are partitioned over a power of two number of shards by the high bits
+ * of their hash. Every shard is an UnorderedMap guarded by its own
+ * reader-writer lock and padded to a cache line, so threads working on
+ * different shards neither contend for a lock nor share a cache line, and
+ * readers of the same shard proceed in parallel.
+ *
+ * The container never hands out iterators or references to its elements, as
+ * those could dangle as soon as the shard lock is released. Lookups return a
+ * copy of the mapped value, visit() and update() run a function on the element
+ * while the shard is locked, and for_each_shard() exposes one locked shard at a
+ * time. Functions passed to the container must not call back into it.
+ *
+ * size() and empty() lock the shards one after another; with concurrent
+ * writers their result is a snapshot that may never have existed as a whole.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam Hash hash function.
+ * @tparam Eq key equality function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         typename Hash      = std::hash<K>,
+         typename Eq        = std::equal_to<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class ConcurrentMap
+{
+ public:
+    using key_type       = K;
+    using mapped_type    = V;
+    using value_type     = std::pair<const K, V>;
+    using size_type      = std::size_t;
+    using hasher         = Hash;
+    using key_equal      = Eq;
+    using allocator_type = Allocator;
+    using shard_type     = UnorderedMap<K, V, Hash, Eq, Allocator>;
+
+    /**
+     * @brief Constructs an empty container without allocating any elements.
+     *
+     * @param shard_count number of shards, rounded up to a power of two. Zero
+     * selects DefaultShardCount().
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of the shards.
+     */
+    explicit ConcurrentMap(size_type        shard_count = DefaultShardCount(),
+                           const Hash&      hash        = Hash(),
+                           const Eq&        equal       = Eq(),
+                           const Allocator& alloc       = Allocator())
+      : shard_count_{std::bit_ceil(std::max<size_type>(
+        shard_count == 0 ? DefaultShardCount() : shard_count, 1))}
+      , shift_{static_cast<unsigned>(std::numeric_limits<size_type>::digits
+                                     - std::countr_zero(shard_count_))}
+      , shards_{std::make_unique<Shard[]>(shard_count_)}
+      , hash_{hash}
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        { shards_[i].map = shard_type(0, hash, equal, alloc); }
+    }
+
+    ConcurrentMap(const ConcurrentMap&) = delete;
+    ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+
+    /**
+     * @brief Returns the number of shards used by default constructed maps.
+     *
+     * @return four shards per hardware thread, rounded up to a power of two.
+     */
+    static size_type DefaultShardCount() noexcept
+    {
+        auto const hardware =
+          static_cast<size_type>(std::thread::hardware_concurrency());
+
+        return std::bit_ceil(4 * std::max<size_type>(hardware, 1));
+    }
+
+    /**
+     * @brief Returns the number of shards.
+     *
+     * @return number of shards, a power of two.
+     */
+    size_type shard_count() const noexcept { return shard_count_; }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const { return size() == 0; }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     *
+     * @return sum of the sizes of all shards.
+     */
+    size_type size() const
+    {
+        size_type size = 0;
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::shared_lock<std::shared_mutex> lock{shards_[i].mutex};
+            size += shards_[i].map.size();
+        }
+
+        return size;
+    }
+
+    /**
+     * @brief Erases all elements from the container.
+     */
+    void clear()
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock{shards_[i].mutex};
+            shards_[i].map.clear();
+        }
+    }
+
+    /**
+     * @brief Reserves room for at least count elements, assuming that the keys
+     * are spread evenly over the shards.
+     *
+     * @param count number of elements to reserve room for.
+     */
+    void reserve(size_type count)
+    {
+        size_type const perShard = (count + shard_count_ - 1) / shard_count_;
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock{shards_[i].mutex};
+            shards_[i].map.reserve(perShard);
+        }
+    }
+
+    /**
+     * @brief Inserts value, if the container has no element with an equivalent
+     * key.
+     *
+     * @param value element to insert.
+     *
+     * @return true if the insertion took place.
+     */
+    bool insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    /**
+     * @brief Inserts value, if the container has no element with an equivalent
+     * key. value is not moved from if the key exists.
+     *
+     * @param value element to insert.
+     *
+     * @return true if the insertion took place.
+     */
+    bool insert(value_type&& value)
+    {
+        Shard&                              shard = shard_for(value.first);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.map.insert(std::move(value)).second;
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return true if the insertion took place.
+     */
+    template<class... Args> bool try_emplace(const K& key, Args&&... args)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.map.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return true if the insertion took place.
+     */
+    template<class... Args> bool try_emplace(K&& key, Args&&... args)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.map
+          .try_emplace(std::move(key), std::forward<Args>(args)...)
+          .second;
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return true if an insertion took place, false if a value was assigned.
+     */
+    template<class M> bool insert_or_assign(const K& key, M&& obj)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.map.insert_or_assign(key, std::forward<M>(obj)).second;
+    }
+
+    /**
+     * @brief Returns a copy of the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return the mapped value, or an empty optional if no such element is
+     * found.
+     */
+    std::optional<V> find(const K& key) const { return find_key(key); }
+
+    /**
+     * @brief Returns a copy of the mapped value of the element with key
+     * equivalent to key, without constructing a key_type. Requires
+     * transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return the mapped value, or an empty optional if no such element is
+     * found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    std::optional<V> find(const Key& key) const
+    {
+        return find_key(key);
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(const K& key) const
+    {
+        return visit(key, [](const V&) {});
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key, without
+     * constructing a key_type. Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    bool contains(const Key& key) const
+    {
+        return visit(key, [](const V&) {});
+    }
+
+    /**
+     * @brief Calls fn with the mapped value of the element with key equivalent
+     * to key, holding the shared lock of its shard. Other readers of the shard
+     * may run concurrently.
+     *
+     * @param key the key of the element to find.
+     * @param fn function called with a const reference to the mapped value.
+     *
+     * @return true if the element was found and fn was called.
+     */
+    template<class Fn> bool visit(const K& key, Fn&& fn) const
+    {
+        return visit_key(key, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Calls fn with the mapped value of the element with key equivalent
+     * to key, without constructing a key_type. Requires transparent Hash and
+     * Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     * @param fn function called with a const reference to the mapped value.
+     *
+     * @return true if the element was found and fn was called.
+     */
+    template<class Key, class Fn>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    bool visit(const Key& key, Fn&& fn) const
+    {
+        return visit_key(key, std::forward<Fn>(fn));
+    }
+
+    /**
+     * @brief Calls fn with the mapped value of the element with key equivalent
+     * to key, holding the exclusive lock of its shard, so fn may modify the
+     * value atomically with respect to all other operations.
+     *
+     * @param key the key of the element to update.
+     * @param fn function called with a reference to the mapped value.
+     *
+     * @return true if the element was found and fn was called.
+     */
+    template<class Fn> bool update(const K& key, Fn&& fn)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        auto const it = shard.map.find(key);
+        if (it == shard.map.end())
+        { return false; }
+
+        std::forward<Fn>(fn)(it->second);
+        return true;
+    }
+
+    /**
+     * @brief Calls fn with the mapped value of the element with key key,
+     * inserting a mapped value constructed from args first if there is no such
+     * element. Both steps run under the exclusive lock of the shard.
+     *
+     * @param key the key of the element.
+     * @param fn function called with a reference to the mapped value.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return true if an insertion took place.
+     */
+    template<class Fn, class... Args>
+    bool try_emplace_and_update(const K& key, Fn&& fn, Args&&... args)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        auto const result =
+          shard.map.try_emplace(key, std::forward<Args>(args)...);
+        std::forward<Fn>(fn)(result.first->second);
+
+        return result.second;
+    }
+
+    /**
+     * @brief Removes the element with key equivalent to key, if there is any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed, either 0 or 1.
+     */
+    size_type erase(const K& key)
+    {
+        Shard&                              shard = shard_for(key);
+        std::unique_lock<std::shared_mutex> lock{shard.mutex};
+
+        return shard.map.erase(key);
+    }
+
+    /**
+     * @brief Calls fn with every shard in turn, holding the shared lock of the
+     * shard for the duration of the call.
+     *
+     * @param fn function called with a const reference to each shard_type.
+     */
+    template<class Fn> void for_each_shard(Fn&& fn) const
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::shared_lock<std::shared_mutex> lock{shards_[i].mutex};
+            fn(std::as_const(shards_[i].map));
+        }
+    }
+
+    /**
+     * @brief Calls fn with every shard in turn, holding the exclusive lock of
+     * the shard for the duration of the call. fn may modify the shard, but must
+     * not insert elements whose key belongs to another shard.
+     *
+     * @param fn function called with a reference to each shard_type.
+     */
+    template<class Fn> void for_each_shard(Fn&& fn)
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock{shards_[i].mutex};
+            fn(shards_[i].map);
+        }
+    }
+
+    /**
+     * @brief Returns the function that hashes the keys.
+     *
+     * @return the hash function.
+     */
+    hasher hash_function() const { return hash_; }
+
+ private:
+    friend struct MemoryFootprintTraits<ConcurrentMap>;
+
+    /**
+     * @brief One partition of the keys, on a cache line of its own.
+     */
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex mutex;
+        shard_type                map;
+    };
+
+    template<class Key> Shard& shard_for(const Key& key) const
+    {
+        // shift_ is the number of hash bits that are not used, which is the
+        // full width for a single shard; split the shift to keep it defined.
+        return shards_[(detail::MixHash(hash_(key)) >> 1) >> (shift_ - 1)];
+    }
+
+    template<class Key> std::optional<V> find_key(const Key& key) const
+    {
+        std::optional<V> result;
+        visit_key(key, [&result](const V& value) { result.emplace(value); });
+
+        return result;
+    }
+
+    template<class Key, class Fn> bool visit_key(const Key& key, Fn&& fn) const
+    {
+        const Shard&                        shard = shard_for(key);
+        std::shared_lock<std::shared_mutex> lock{shard.mutex};
+
+        auto const it = shard.map.find(key);
+        if (it == shard.map.end())
+        { return false; }
+
+        std::forward<Fn>(fn)(std::as_const(it->second));
+        return true;
+    }
+
+    size_type                shard_count_;
+    unsigned                 shift_;
+    std::unique_ptr<Shard[]> shards_;
+    [[no_unique_address]] Hash hash_;
+};
+
+/**
+ * @brief ConcurrentMap owns one allocation holding the shards plus the memory
+ * of every shard.
+ */
+template<class K, class V, class Hash, class Eq, class Allocator>
+struct MemoryFootprintTraits<ConcurrentMap<K, V, Hash, Eq, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint
+    heap(const ConcurrentMap<K, V, Hash, Eq, Allocator>& value)
+    {
+        using Container = ConcurrentMap<K, V, Hash, Eq, Allocator>;
+
+        std::size_t const shards =
+          value.shard_count() * sizeof(typename Container::Shard);
+
+        MemoryFootprint footprint{shards, shards, 1};
+        value.for_each_shard(
+          [&footprint](const typename Container::shard_type& shard) {
+              footprint += memory_footprint(shard);
+          });
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_CONCURRENT_MAP_H_
@@ -0,0 +1,611 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_CONCURRENT_VECTOR_H_
+#define ARA_CORE_CONCURRENT_VECTOR_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/memory_footprint.h"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+namespace ara::core {
+/**
+ * @brief Append-only vector supporting concurrent push_back and reads.
+ *
+ * Elements live in segments of geometrically growing size which are never
+ * moved, so references and indices stay valid for the lifetime of the
+ * container. A producer claims a slot with a single fetch_add, constructs the
+ * element in place and marks the slot ready. The published size is then
+ * advanced over the run of ready slots by whichever producer finishes last,
+ * so producers never wait for each other. size() always describes a fully
+ * constructed prefix that readers can iterate wait-free while producers keep
+ * appending.
+ *
+ * Constructing an element must not throw: a claimed slot cannot be skipped
+ * without breaking the published prefix, so push_back() and emplace_back()
+ * are noexcept and terminate the program on failure.
+ *
+ * clear(), reserve(), copy and move are not safe to run concurrently with
+ * other operations.
+ *
+ * @tparam T element type.
+ * @tparam Allocator allocator type.
+ */
+template<class T, class Allocator = Allocator<T>> class ConcurrentVector
+{
+    using Traits = AllocatorTraits<Allocator>;
+
+ public:
+    using value_type      = T;
+    using allocator_type  = Allocator;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    /**
+     * @brief Number of elements in the first segment; segment k holds
+     * kFirstSegmentSize << k elements.
+     */
+    static constexpr size_type kFirstSegmentSize = 32;
+
+    /**
+     * @brief Maximal number of segments.
+     */
+    static constexpr size_type kMaxSegments = 48;
+
+    /**
+     * @brief Random access iterator over a snapshot of the published prefix.
+     *
+     * @tparam Const true for a const iterator.
+     */
+    template<bool Const> class Iterator
+    {
+        using Owner = std::conditional_t<Const,
+                                         const ConcurrentVector,
+                                         ConcurrentVector>;
+
+     public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer   = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() = default;
+
+        Iterator(Owner* owner, size_type pos) noexcept
+          : owner_{owner}
+          , pos_{pos}
+        {}
+
+        operator Iterator<true>() const noexcept { return {owner_, pos_}; }
+
+        reference operator*() const noexcept { return (*owner_)[pos_]; }
+        pointer   operator->() const noexcept { return &(*owner_)[pos_]; }
+        reference operator[](difference_type n) const noexcept
+        {
+            return *(*this + n);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++pos_;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            auto tmp = *this;
+            ++pos_;
+            return tmp;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            --pos_;
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            auto tmp = *this;
+            --pos_;
+            return tmp;
+        }
+
+        Iterator& operator+=(difference_type n) noexcept
+        {
+            pos_ += static_cast<size_type>(n);
+            return *this;
+        }
+
+        Iterator& operator-=(difference_type n) noexcept
+        {
+            pos_ -= static_cast<size_type>(n);
+            return *this;
+        }
+
+        friend Iterator operator+(Iterator it, difference_type n) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator+(difference_type n, Iterator it) noexcept
+        {
+            return it += n;
+        }
+
+        friend Iterator operator-(Iterator it, difference_type n) noexcept
+        {
+            return it -= n;
+        }
+
+        friend difference_type
+        operator-(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return static_cast<difference_type>(lhs.pos_ - rhs.pos_);
+        }
+
+        friend bool
+        operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.pos_ == rhs.pos_;
+        }
+
+        friend auto
+        operator<=>(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.pos_ <=> rhs.pos_;
+        }
+
+     private:
+        Owner*    owner_{nullptr};
+        size_type pos_{0};
+    };
+
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     *
+     * @param alloc allocator to use for all memory allocations.
+     */
+    explicit ConcurrentVector(const Allocator& alloc = Allocator()) noexcept
+      : alloc_{alloc}
+    {}
+
+    /**
+     * @brief Copy constructor. Copies the published prefix of @c other.
+     *
+     * @param other container to copy.
+     */
+    ConcurrentVector(const ConcurrentVector& other)
+      : alloc_{Traits::select_on_container_copy_construction(other.alloc_)}
+    {
+        reserve(other.size());
+        for (const auto& value : other) { push_back(value); }
+    }
+
+    /**
+     * @brief Move constructor. Steals the segments of @c other.
+     *
+     * @param other container to move from.
+     */
+    ConcurrentVector(ConcurrentVector&& other) noexcept
+      : alloc_{std::move(other.alloc_)}
+    {
+        steal(other);
+    }
+
+    /**
+     * @brief Destroys the elements and releases the segments.
+     */
+    ~ConcurrentVector() { release(); }
+
+    ConcurrentVector& operator=(const ConcurrentVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size());
+            for (const auto& value : other) { push_back(value); }
+        }
+
+        return *this;
+    }
+
+    ConcurrentVector& operator=(ConcurrentVector&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            if constexpr (Traits::propagate_on_container_move_assignment::value)
+            {
+                alloc_     = std::move(other.alloc_);
+                flagAlloc_ = FlagAlloc{alloc_};
+            }
+            else if (alloc_ != other.alloc_)
+            {
+                // The segments of other cannot be freed by this allocator.
+                reserve(other.size());
+                for (auto& value : other) { push_back(std::move(value)); }
+                other.release();
+
+                return *this;
+            }
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Appends an element. Safe to call concurrently.
+     *
+     * @param value element value to append.
+     *
+     * @return index of the new element.
+     */
+    size_type push_back(const T& value) noexcept
+    {
+        return emplace_back(value);
+    }
+
+    /**
+     * @brief Appends an element. Safe to call concurrently.
+     *
+     * @param value element value to append.
+     *
+     * @return index of the new element.
+     */
+    size_type push_back(T&& value) noexcept
+    {
+        return emplace_back(std::move(value));
+    }
+
+    /**
+     * @brief Appends a new element constructed in-place. Safe to call
+     * concurrently.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @tparam Args arguments type.
+     *
+     * @return index of the new element.
+     */
+    template<class... Args> size_type emplace_back(Args&&... args) noexcept
+    {
+        size_type const index =
+          claimed_.fetch_add(1, std::memory_order_relaxed);
+        size_type const k      = segment_of(index);
+        size_type const offset = index - segment_begin(k);
+
+        std::construct_at(segment(segments_, alloc_, k) + offset,
+                          std::forward<Args>(args)...);
+        segment(flags_, flagAlloc_, k)[offset].store(1);
+        publish();
+
+        return index;
+    }
+
+    /**
+     * @brief Returns the number of published elements. Safe to call
+     * concurrently.
+     *
+     * @return the number of elements readers may access.
+     */
+    size_type size() const noexcept
+    {
+        return published_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Checks whether the container has no published elements.
+     */
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Returns the number of elements that fit into the allocated
+     * segments.
+     */
+    size_type capacity() const noexcept
+    {
+        size_type capacity = 0;
+        for (size_type k = 0; k < kMaxSegments; ++k)
+        {
+            if (! segments_[k].load(std::memory_order_acquire))
+            { break; }
+            capacity += segment_size(k);
+        }
+
+        return capacity;
+    }
+
+    /**
+     * @brief Access a published element. Safe to call concurrently.
+     *
+     * @param pos index of the element, less than size().
+     *
+     * @return reference to the requested element.
+     */
+    reference operator[](size_type pos) noexcept { return *slot(pos); }
+
+    /**
+     * @brief Access a published element. Safe to call concurrently.
+     *
+     * @param pos index of the element, less than size().
+     *
+     * @return const reference to the requested element.
+     */
+    const_reference operator[](size_type pos) const noexcept
+    {
+        return *slot(pos);
+    }
+
+    /**
+     * @brief Access a published element with bounds checking.
+     *
+     * @param pos index of the element.
+     *
+     * @return reference to the requested element.
+     */
+    reference at(size_type pos)
+    {
+        check_position(pos);
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Access a published element with bounds checking.
+     *
+     * @param pos index of the element.
+     *
+     * @return const reference to the requested element.
+     */
+    const_reference at(size_type pos) const
+    {
+        check_position(pos);
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     */
+    iterator begin() noexcept { return {this, 0}; }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     */
+    const_iterator begin() const noexcept { return {this, 0}; }
+
+    /**
+     * @brief Returns an iterator past the elements published at the time of
+     * the call.
+     */
+    iterator end() noexcept { return {this, size()}; }
+
+    /**
+     * @brief Returns an iterator past the elements published at the time of
+     * the call.
+     */
+    const_iterator end() const noexcept { return {this, size()}; }
+
+    /**
+     * @brief Allocates segments for at least @c n elements.
+     *
+     * @param n number of elements.
+     */
+    void reserve(size_type n)
+    {
+        for (size_type k = 0; segment_begin(k) < n; ++k)
+        {
+            (void) segment(segments_, alloc_, k);
+            (void) segment(flags_, flagAlloc_, k);
+        }
+    }
+
+    /**
+     * @brief Destroys all elements, the segments are kept. Not thread-safe.
+     */
+    void clear() noexcept
+    {
+        size_type const n = size();
+        for (size_type i = 0; i < n; ++i)
+        {
+            std::destroy_at(slot(i));
+            flag(i)->store(0, std::memory_order_relaxed);
+        }
+        claimed_.store(0, std::memory_order_relaxed);
+        published_.store(0, std::memory_order_relaxed);
+    }
+
+ private:
+    using Flag      = std::atomic<unsigned char>;
+    using FlagAlloc = typename Traits::template rebind_alloc<Flag>;
+
+    template<class U>
+    using Segments = std::array<std::atomic<U*>, kMaxSegments>;
+
+    static constexpr size_type segment_size(size_type k) noexcept
+    {
+        return kFirstSegmentSize << k;
+    }
+
+    static constexpr size_type segment_begin(size_type k) noexcept
+    {
+        return kFirstSegmentSize * ((size_type{1} << k) - 1);
+    }
+
+    static constexpr size_type segment_of(size_type index) noexcept
+    {
+        return static_cast<size_type>(
+          std::numeric_limits<size_type>::digits - 1
+          - std::countl_zero(index / kFirstSegmentSize + 1));
+    }
+
+    /**
+     * @brief Returns segment @c k of @c segments, allocating it if needed.
+     * Concurrent callers race with a CAS, the losers release their copy.
+     */
+    template<class U, class Alloc>
+    static U* segment(Segments<U>& segments, Alloc& alloc, size_type k)
+    {
+        using UTraits = AllocatorTraits<Alloc>;
+
+        if (k >= kMaxSegments)
+        { throw std::length_error("ara::core::ConcurrentVector is full"); }
+
+        U* current = segments[k].load(std::memory_order_acquire);
+        if (current)
+        { return current; }
+
+        U* fresh = UTraits::allocate(alloc, segment_size(k));
+        if constexpr (std::is_same_v<U, Flag>)
+        {
+            for (size_type i = 0; i < segment_size(k); ++i)
+            { std::construct_at(fresh + i, 0); }
+        }
+
+        if (segments[k].compare_exchange_strong(current,
+                                                fresh,
+                                                std::memory_order_acq_rel,
+                                                std::memory_order_acquire))
+        { return fresh; }
+
+        UTraits::deallocate(alloc, fresh, segment_size(k));
+
+        return current;
+    }
+
+    template<class U, class Alloc>
+    static void release(Segments<U>& segments, Alloc& alloc) noexcept
+    {
+        for (size_type k = 0; k < kMaxSegments; ++k)
+        {
+            if (U* s = segments[k].exchange(nullptr))
+            { AllocatorTraits<Alloc>::deallocate(alloc, s, segment_size(k)); }
+        }
+    }
+
+    template<class U>
+    static void steal(Segments<U>& segments, Segments<U>& other) noexcept
+    {
+        for (size_type k = 0; k < kMaxSegments; ++k)
+        {
+            segments[k].store(other[k].exchange(nullptr),
+                              std::memory_order_relaxed);
+        }
+    }
+
+    T* slot(size_type index) const noexcept
+    {
+        size_type const k = segment_of(index);
+
+        return segments_[k].load(std::memory_order_acquire)
+               + (index - segment_begin(k));
+    }
+
+    Flag* flag(size_type index) const noexcept
+    {
+        size_type const k = segment_of(index);
+        Flag*           s = flags_[k].load(std::memory_order_acquire);
+
+        return s ? s + (index - segment_begin(k)) : nullptr;
+    }
+
+    /**
+     * @brief Advances the published index over all ready slots.
+     *
+     * Every producer calls this after marking its own slot ready. The seq_cst
+     * ordering between marking a slot and reading published_ guarantees that
+     * the last producer to finish sees all slots in front of it.
+     */
+    void publish() noexcept
+    {
+        size_type pos = published_.load();
+        while (true)
+        {
+            Flag const* ready = flag(pos);
+            if (! ready || ready->load() == 0)
+            { return; }
+            // On failure pos holds the current value, retry from there.
+            if (published_.compare_exchange_weak(pos, pos + 1))
+            { ++pos; }
+        }
+    }
+
+    void check_position(size_type pos) const
+    {
+        if (pos >= size())
+        { throw std::out_of_range("ara::core::ConcurrentVector::at"); }
+    }
+
+    void release() noexcept
+    {
+        clear();
+        release(segments_, alloc_);
+        release(flags_, flagAlloc_);
+    }
+
+    void steal(ConcurrentVector& other) noexcept
+    {
+        steal(segments_, other.segments_);
+        steal(flags_, other.flags_);
+        claimed_.store(other.claimed_.exchange(0), std::memory_order_relaxed);
+        published_.store(other.published_.exchange(0),
+                         std::memory_order_relaxed);
+    }
+
+    Allocator                          alloc_;
+    FlagAlloc                          flagAlloc_{alloc_};
+    mutable Segments<T>                segments_{};
+    mutable Segments<Flag>             flags_{};
+    alignas(64) std::atomic<size_type> claimed_{0};
+    alignas(64) std::atomic<size_type> published_{0};
+};
+
+/**
+ * @brief ConcurrentVector owns an element segment and a ready flag segment
+ * per allocated segment.
+ */
+template<class T, class Allocator>
+struct MemoryFootprintTraits<ConcurrentVector<T, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const ConcurrentVector<T, Allocator>& value)
+    {
+        using Container = ConcurrentVector<T, Allocator>;
+
+        std::size_t const capacity = value.capacity();
+        std::size_t const segments = static_cast<std::size_t>(
+          std::numeric_limits<std::size_t>::digits
+          - std::countl_zero(capacity / Container::kFirstSegmentSize));
+        std::size_t const slot = sizeof(T) + 1;
+
+        return MemoryFootprint{value.size() * slot,
+                               capacity * slot,
+                               2 * segments}
+               + detail::elements_footprint(value);
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_CONCURRENT_VECTOR_H_
@@ -0,0 +1,1512 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_FLAT_MAP_H_
+#define ARA_CORE_FLAT_MAP_H_
+
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Random access iterator over two parallel arrays of keys and mapped
+ * values.
+ *
+ * Dereferencing yields a pair of references into both arrays, so the iterator
+ * behaves like a Map iterator although no std::pair is stored anywhere.
+ *
+ * @tparam KeyIterator iterator of the key array.
+ * @tparam MappedIterator iterator of the mapped value array.
+ */
+template<class KeyIterator, class MappedIterator> class FlatMapIterator
+{
+ public:
+    using iterator_category = std::random_access_iterator_tag;
+    using difference_type   = std::ptrdiff_t;
+    using value_type        = std::pair<std::iter_value_t<KeyIterator>,
+                                 std::iter_value_t<MappedIterator>>;
+    using reference         = std::pair<std::iter_reference_t<KeyIterator>,
+                                std::iter_reference_t<MappedIterator>>;
+
+    /**
+     * @brief Proxy returned by operator->, keeps the pair of references alive
+     * for the duration of the member access.
+     */
+    struct pointer
+    {
+        reference        ref;
+        const reference* operator->() const noexcept { return &ref; }
+    };
+
+    FlatMapIterator() = default;
+
+    FlatMapIterator(KeyIterator key, MappedIterator mapped)
+      : key_(key), mapped_(mapped)
+    {}
+
+    /**
+     * @brief Converts an iterator to a const_iterator.
+     */
+    template<class OtherMapped>
+        requires std::is_convertible_v<OtherMapped, MappedIterator>
+    FlatMapIterator(const FlatMapIterator<KeyIterator, OtherMapped>& other)
+      : key_(other.key_), mapped_(other.mapped_)
+    {}
+
+    reference operator*() const { return {*key_, *mapped_}; }
+
+    pointer operator->() const { return {**this}; }
+
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    FlatMapIterator& operator++()
+    {
+        ++key_;
+        ++mapped_;
+
+        return *this;
+    }
+
+    FlatMapIterator operator++(int)
+    {
+        FlatMapIterator copy{*this};
+        ++*this;
+
+        return copy;
+    }
+
+    FlatMapIterator& operator--()
+    {
+        --key_;
+        --mapped_;
+
+        return *this;
+    }
+
+    FlatMapIterator operator--(int)
+    {
+        FlatMapIterator copy{*this};
+        --*this;
+
+        return copy;
+    }
+
+    FlatMapIterator& operator+=(difference_type n)
+    {
+        key_ += n;
+        mapped_ += n;
+
+        return *this;
+    }
+
+    FlatMapIterator& operator-=(difference_type n) { return *this += -n; }
+
+    friend FlatMapIterator operator+(FlatMapIterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend FlatMapIterator operator+(difference_type n, FlatMapIterator it)
+    {
+        return it += n;
+    }
+
+    friend FlatMapIterator operator-(FlatMapIterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type
+    operator-(const FlatMapIterator& lhs, const FlatMapIterator& rhs)
+    {
+        return lhs.key_ - rhs.key_;
+    }
+
+    friend bool
+    operator==(const FlatMapIterator& lhs, const FlatMapIterator& rhs)
+    {
+        return lhs.key_ == rhs.key_;
+    }
+
+    friend auto
+    operator<=>(const FlatMapIterator& lhs, const FlatMapIterator& rhs)
+    {
+        return lhs.key_ <=> rhs.key_;
+    }
+
+ private:
+    template<class, class> friend class FlatMapIterator;
+
+    KeyIterator    key_{};
+    MappedIterator mapped_{};
+};
+}  // namespace detail
+
+/**
+ * @brief Sorted associative container that contains key-value pairs with unique
+ * keys, stored in two contiguous arrays.
+ *
+ * Keys and mapped values live in separate sorted arrays, so a lookup is a
+ * binary search over densely packed keys and there is no per-element node
+ * overhead. Insertion and erasure of single elements are linear in size();
+ * prefer the bulk insert functions or adopting presorted containers when
+ * building large maps.
+ *
+ * Any insertion or erasure invalidates all iterators and references.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam C key_compare function.
+ * @tparam KeyContainer sequence container storing the keys.
+ * @tparam MappedContainer sequence container storing the mapped values.
+ */
+template<typename K,
+         typename V,
+         typename C               = std::less<K>,
+         typename KeyContainer    = Vector<K>,
+         typename MappedContainer = Vector<V>>
+class FlatMap
+{
+ public:
+    using key_type              = K;
+    using mapped_type           = V;
+    using value_type            = std::pair<K, V>;
+    using key_compare           = C;
+    using reference             = std::pair<const K&, V&>;
+    using const_reference       = std::pair<const K&, const V&>;
+    using size_type             = std::size_t;
+    using difference_type       = std::ptrdiff_t;
+    using key_container_type    = KeyContainer;
+    using mapped_container_type = MappedContainer;
+    using iterator =
+      detail::FlatMapIterator<typename KeyContainer::const_iterator,
+                              typename MappedContainer::iterator>;
+    using const_iterator =
+      detail::FlatMapIterator<typename KeyContainer::const_iterator,
+                              typename MappedContainer::const_iterator>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Compares elements by their keys.
+     */
+    class value_compare
+    {
+     public:
+        template<class L, class R>
+        bool operator()(const L& lhs, const R& rhs) const
+        {
+            return comp_(lhs.first, rhs.first);
+        }
+
+     private:
+        friend class FlatMap;
+
+        explicit value_compare(C comp) : comp_(std::move(comp)) {}
+
+        C comp_;
+    };
+
+    /**
+     * @brief The underlying containers, as returned by extract().
+     */
+    struct containers
+    {
+        KeyContainer    keys;
+        MappedContainer values;
+    };
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    FlatMap() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    explicit FlatMap(const C& comp) : compare_(comp) {}
+
+    /**
+     * @brief Constructs the container from unsorted key and value containers.
+     *
+     * The elements are sorted by key; of several elements with equivalent keys
+     * only the first one is kept.
+     *
+     * @param keys keys of the elements.
+     * @param values mapped values of the elements, in the order of keys.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     *
+     * @throws std::invalid_argument if keys and values differ in size.
+     */
+    FlatMap(KeyContainer    keys,
+            MappedContainer values,
+            const C&        comp = C())
+      : keys_(std::move(keys)), values_(std::move(values)), compare_(comp)
+    {
+        check_sizes();
+        sort_and_unique();
+    }
+
+    /**
+     * @brief Adopts key and value containers that are already sorted by key
+     * and free of duplicates, without copying or sorting them.
+     *
+     * @param keys sorted unique keys of the elements.
+     * @param values mapped values of the elements, in the order of keys.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     *
+     * @throws std::invalid_argument if keys and values differ in size.
+     */
+    FlatMap(sorted_unique_t,
+            KeyContainer    keys,
+            MappedContainer values,
+            const C&        comp = C())
+      : keys_(std::move(keys)), values_(std::move(values)), compare_(comp)
+    {
+        check_sizes();
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    template<std::input_iterator InputIt>
+    FlatMap(InputIt first, InputIt last, const C& comp = C()) : compare_(comp)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted by key and free of duplicates.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    template<std::input_iterator InputIt>
+    FlatMap(sorted_unique_t, InputIt first, InputIt last, const C& comp = C())
+      : compare_(comp)
+    {
+        insert(sorted_unique, first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    FlatMap(std::initializer_list<value_type> init, const C& comp = C())
+      : FlatMap(init.begin(), init.end(), comp)
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init, which is sorted by key and free of duplicates.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    FlatMap(sorted_unique_t                   tag,
+            std::initializer_list<value_type> init,
+            const C&                          comp = C())
+      : FlatMap(tag, init.begin(), init.end(), comp)
+    {}
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to FlatMap instance.
+     */
+    FlatMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if the contents of the maps are equal, false otherwise.
+     */
+    friend bool operator==(const FlatMap& lhs, const FlatMap& rhs)
+    {
+        return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_;
+    }
+
+    /**
+     * @brief Compares the contents of two maps lexicographically.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const FlatMap& lhs, const FlatMap& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    mapped_type& at(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("FlatMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a const reference to the mapped value of the element with
+     * key equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    const mapped_type& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("FlatMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept { return make_iterator(0); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator begin() const noexcept { return make_iterator(0); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    iterator end() noexcept { return make_iterator(size()); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator end() const noexcept { return make_iterator(size()); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the last element.
+     */
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the last element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the last element.
+     */
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator before the first element.
+     */
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator before the first element.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator before the first element.
+     */
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return keys_.empty(); }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return keys_.size(); }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>(keys_.max_size(), values_.max_size());
+    }
+
+    /**
+     * @brief Reserves storage for at least new_cap elements in both arrays.
+     *
+     * @param new_cap new capacity of the container.
+     */
+    void reserve(size_type new_cap)
+    {
+        keys_.reserve(new_cap);
+        values_.reserve(new_cap);
+    }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     */
+    void shrink_to_fit()
+    {
+        keys_.shrink_to_fit();
+        values_.shrink_to_fit();
+    }
+
+    /**
+     * @brief Erases all elements from the container.
+     */
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    /**
+     * @brief Returns the sorted keys.
+     *
+     * @return const reference to the key container.
+     */
+    const KeyContainer& keys() const noexcept { return keys_; }
+
+    /**
+     * @brief Returns the mapped values, in the order of keys().
+     *
+     * @return const reference to the mapped value container.
+     */
+    const MappedContainer& values() const noexcept { return values_; }
+
+    /**
+     * @brief Moves the underlying containers out of the map, leaving it empty.
+     *
+     * @return the sorted key container and the mapped value container.
+     */
+    containers extract() &&
+    {
+        containers result{std::move(keys_), std::move(values_)};
+        clear();
+
+        return result;
+    }
+
+    /**
+     * @brief Replaces the underlying containers with containers that are
+     * already sorted by key and free of duplicates.
+     *
+     * @param keys sorted unique keys of the elements.
+     * @param values mapped values of the elements, in the order of keys.
+     *
+     * @throws std::invalid_argument if keys and values differ in size.
+     */
+    void replace(KeyContainer&& keys, MappedContainer&& values)
+    {
+        keys_   = std::move(keys);
+        values_ = std::move(values);
+        check_sizes();
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return emplace_hint(hint, value);
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last).
+     *
+     * The range is sorted once and merged with the existing elements, so
+     * inserting m elements costs O(m log m + size()) instead of O(m size()).
+     * Of several elements with equivalent keys only the first is inserted. If
+     * an exception is thrown the container is left empty.
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        Vector<value_type> incoming(first, last);
+        std::stable_sort(incoming.begin(), incoming.end(), value_comp());
+        merge(std::make_move_iterator(incoming.begin()),
+              std::make_move_iterator(incoming.end()));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last), which is sorted by key
+     * and free of duplicates, in O(size() + m).
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        merge(first, last);
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist, which is sorted by
+     * key and free of duplicates.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(sorted_unique_t tag, std::initializer_list<value_type> ilist)
+    {
+        insert(tag, ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new element into the container constructed in-place
+     * with the given args if there is no element with the key in the
+     * container.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element into the container as close as possible to
+     * the position just before hint.
+     *
+     * A correct hint skips the binary search.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args> iterator
+    emplace_hint(const_iterator hint, Args&&... args)
+    {
+        value_type      value(std::forward<Args>(args)...);
+        size_type const pos = static_cast<size_type>(hint - cbegin());
+
+        if ((pos == 0 || compare_(keys_[pos - 1], value.first))
+            && (pos == size() || compare_(value.first, keys_[pos])))
+        {
+            return emplace_at(
+              pos, std::move(value.first), std::move(value.second));
+        }
+
+        return try_emplace(std::move(value.first), std::move(value.second))
+          .first;
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element if there is none.
+     *
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
+     *
+     * @return a pair consisting of an iterator to the element and a bool that
+     * is true if the insertion took place and false if the assignment took
+     * place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
+    {
+        return insert_or_assign_at(
+          lower_bound_index(key), key, std::forward<M>(obj));
+    }
+
+    /**
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element if there is none.
+     *
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
+     *
+     * @return a pair consisting of an iterator to the element and a bool that
+     * is true if the insertion took place and false if the assignment took
+     * place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        size_type const pos = lower_bound_index(key);
+
+        return insert_or_assign_at(pos, std::move(key), std::forward<M>(obj));
+    }
+
+    /**
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element as close as possible to the position just prior
+     * to hint.
+     *
+     * A correct hint skips the binary search.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
+     *
+     * @return iterator to the element that was inserted or assigned to.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const K& key, M&& obj)
+    {
+        return insert_or_assign_at(hinted_index(hint, key), key,
+                                   std::forward<M>(obj))
+          .first;
+    }
+
+    /**
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element as close as possible to the position just prior
+     * to hint.
+     *
+     * A correct hint skips the binary search.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
+     *
+     * @return iterator to the element that was inserted or assigned to.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        size_type const pos = hinted_index(hint, key);
+
+        return insert_or_assign_at(pos, std::move(key), std::forward<M>(obj))
+          .first;
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        auto const from = first - cbegin();
+        auto const to   = last - cbegin();
+
+        keys_.erase(keys_.begin() + from, keys_.begin() + to);
+        values_.erase(values_.begin() + from, values_.begin() + to);
+
+        return make_iterator(static_cast<size_type>(from));
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { return 0; }
+
+        erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(FlatMap& other) noexcept
+    {
+        using std::swap;
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+        swap(compare_, other.compare_);
+    }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to the specified argument, which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key that compares equivalent to key.
+     */
+    size_type count(const K& key) const
+    {
+        return find_index(key) == size() ? 0 : 1;
+    }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key that compares equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type count(const Key& key) const
+    {
+        return upper_bound_index(key) - lower_bound_index(key);
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    iterator find(const K& key) { return make_iterator(find_index(key)); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const
+    {
+        return make_iterator(find_index(key));
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key, without constructing
+     * a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator find(const Key& key)
+    {
+        return make_iterator(find_index(key));
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key, without constructing
+     * a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return make_iterator(find_index(key));
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    bool contains(const K& key) const { return find_index(key) != size(); }
+
+    /**
+     * @brief Checks if there is an element with key that compares equivalent
+     * to key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != size();
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        size_type const first = lower_bound_index(key);
+        size_type const last =
+          first != size() && ! compare_(key, keys_[first]) ? first + 1 : first;
+
+        return {make_iterator(first), make_iterator(last)};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        size_type const first = lower_bound_index(key);
+        size_type const last =
+          first != size() && ! compare_(key, keys_[first]) ? first + 1 : first;
+
+        return {make_iterator(first), make_iterator(last)};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key, without constructing a key_type. Requires a
+     * transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return {make_iterator(lower_bound_index(key)),
+                make_iterator(upper_bound_index(key))};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key, without constructing a key_type. Requires a
+     * transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<const_iterator, const_iterator>
+    equal_range(const Key& key) const
+    {
+        return {make_iterator(lower_bound_index(key)),
+                make_iterator(upper_bound_index(key))};
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    iterator lower_bound(const K& key)
+    {
+        return make_iterator(lower_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator lower_bound(const Key& key)
+    {
+        return make_iterator(lower_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return make_iterator(lower_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return make_iterator(lower_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    iterator upper_bound(const K& key)
+    {
+        return make_iterator(upper_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator upper_bound(const Key& key)
+    {
+        return make_iterator(upper_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return make_iterator(upper_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return make_iterator(upper_bound_index(key));
+    }
+
+    /**
+     * @brief Returns the function that compares keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return compare_; }
+
+    /**
+     * @brief Returns the function that compares keys in objects of type
+     * value_type.
+     *
+     * @return the value comparison function object.
+     */
+    value_compare value_comp() const { return value_compare(compare_); }
+
+ private:
+    iterator make_iterator(size_type pos) noexcept
+    {
+        auto const offset = static_cast<difference_type>(pos);
+
+        return {keys_.cbegin() + offset, values_.begin() + offset};
+    }
+
+    const_iterator make_iterator(size_type pos) const noexcept
+    {
+        auto const offset = static_cast<difference_type>(pos);
+
+        return {keys_.cbegin() + offset, values_.cbegin() + offset};
+    }
+
+    template<class Key> size_type lower_bound_index(const Key& key) const
+    {
+        return static_cast<size_type>(
+          std::lower_bound(keys_.begin(), keys_.end(), key, compare_)
+          - keys_.begin());
+    }
+
+    template<class Key> size_type upper_bound_index(const Key& key) const
+    {
+        return static_cast<size_type>(
+          std::upper_bound(keys_.begin(), keys_.end(), key, compare_)
+          - keys_.begin());
+    }
+
+    template<class Key> size_type find_index(const Key& key) const
+    {
+        size_type const pos = lower_bound_index(key);
+        if (pos == size() || compare_(key, keys_[pos]))
+        { return size(); }
+
+        return pos;
+    }
+
+    template<class Key, class... Args>
+    std::pair<iterator, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        size_type const pos = lower_bound_index(key);
+        if (pos != size() && ! compare_(key, keys_[pos]))
+        { return {make_iterator(pos), false}; }
+
+        return {emplace_at(
+                  pos, std::forward<Key>(key), std::forward<Args>(args)...),
+                true};
+    }
+
+    /**
+     * @brief Returns the lower bound of key, skipping the binary search if it
+     * is hint.
+     */
+    size_type hinted_index(const_iterator hint, const K& key) const
+    {
+        size_type const pos = static_cast<size_type>(hint - cbegin());
+        if ((pos == 0 || compare_(keys_[pos - 1], key))
+            && (pos == size() || ! compare_(keys_[pos], key)))
+        { return pos; }
+
+        return lower_bound_index(key);
+    }
+
+    template<class Key, class M>
+    std::pair<iterator, bool>
+    insert_or_assign_at(size_type pos, Key&& key, M&& obj)
+    {
+        if (pos != size() && ! compare_(key, keys_[pos]))
+        {
+            values_[pos] = std::forward<M>(obj);
+
+            return {make_iterator(pos), false};
+        }
+
+        return {emplace_at(pos, std::forward<Key>(key), std::forward<M>(obj)),
+                true};
+    }
+
+    template<class Key, class... Args>
+    iterator emplace_at(size_type pos, Key&& key, Args&&... args)
+    {
+        auto const offset = static_cast<difference_type>(pos);
+
+        keys_.emplace(keys_.begin() + offset, std::forward<Key>(key));
+        try
+        {
+            values_.emplace(values_.begin() + offset,
+                            std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            keys_.erase(keys_.begin() + offset);
+            throw;
+        }
+
+        return make_iterator(pos);
+    }
+
+    /**
+     * @brief Merges the sorted range [first, last) into the container. Existing
+     * elements win over incoming ones with equivalent keys, and among incoming
+     * elements the first one wins.
+     */
+    template<class InputIt> void merge(InputIt first, InputIt last)
+    {
+        if (first == last)
+        { return; }
+
+        KeyContainer    keys;
+        MappedContainer values;
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            auto const incoming = static_cast<size_type>(
+              std::distance(first, last));
+            keys.reserve(size() + incoming);
+            values.reserve(size() + incoming);
+        }
+
+        auto const append = [&keys, &values, this](auto&& key, auto&& value) {
+            if (keys.empty() || compare_(keys.back(), key))
+            {
+                keys.push_back(std::forward<decltype(key)>(key));
+                values.push_back(std::forward<decltype(value)>(value));
+            }
+        };
+
+        try
+        {
+            size_type i = 0;
+            for (; first != last; ++first)
+            {
+                auto&& element = *first;
+                while (i < size() && ! compare_(element.first, keys_[i]))
+                {
+                    append(std::move(keys_[i]), std::move(values_[i]));
+                    ++i;
+                }
+                append(std::forward<decltype(element)>(element).first,
+                       std::forward<decltype(element)>(element).second);
+            }
+            for (; i < size(); ++i)
+            { append(std::move(keys_[i]), std::move(values_[i])); }
+        }
+        catch (...)
+        {
+            // Elements were moved out already, there is no consistent state
+            // to roll back to.
+            clear();
+            throw;
+        }
+
+        keys_   = std::move(keys);
+        values_ = std::move(values);
+    }
+
+    /**
+     * @brief Sorts both arrays by key and drops all but the first of several
+     * elements with equivalent keys.
+     */
+    void sort_and_unique()
+    {
+        auto const disorder = std::adjacent_find(
+          keys_.begin(), keys_.end(), [this](const K& lhs, const K& rhs) {
+              return ! compare_(lhs, rhs);
+          });
+        if (disorder == keys_.end())
+        { return; }
+
+        Vector<size_type> order(size());
+        std::iota(order.begin(), order.end(), size_type{0});
+        std::stable_sort(
+          order.begin(), order.end(), [this](size_type lhs, size_type rhs) {
+              return compare_(keys_[lhs], keys_[rhs]);
+          });
+
+        KeyContainer    keys;
+        MappedContainer values;
+        keys.reserve(size());
+        values.reserve(size());
+        try
+        {
+            for (size_type const i : order)
+            {
+                if (keys.empty() || compare_(keys.back(), keys_[i]))
+                {
+                    keys.push_back(std::move(keys_[i]));
+                    values.push_back(std::move(values_[i]));
+                }
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+
+        keys_   = std::move(keys);
+        values_ = std::move(values);
+    }
+
+    void check_sizes()
+    {
+        if (keys_.size() != values_.size())
+        {
+            clear();
+            throw std::invalid_argument(
+              "FlatMap: key and value containers differ in size");
+        }
+    }
+
+    KeyContainer            keys_;
+    MappedContainer         values_;
+    [[no_unique_address]] C compare_;
+};
+
+/**
+ * @brief Exchanges the contents of two maps.
+ *
+ * @param lhs first map.
+ * @param rhs second map.
+ */
+template<class K, class V, class C, class KC, class MC> void
+swap(FlatMap<K, V, C, KC, MC>& lhs, FlatMap<K, V, C, KC, MC>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief FlatMap owns its key and mapped value containers.
+ */
+template<class K, class V, class C, class KC, class MC>
+struct MemoryFootprintTraits<FlatMap<K, V, C, KC, MC>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const FlatMap<K, V, C, KC, MC>& value)
+    {
+        return memory_footprint(value.keys())
+               + memory_footprint(value.values());
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_FLAT_MAP_H_
@@ -0,0 +1,809 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_FLAT_SET_H_
+#define ARA_CORE_FLAT_SET_H_
+
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Sorted associative container of unique keys, stored in one
+ * contiguous array.
+ *
+ * The set counterpart of FlatMap: a lookup is a binary search over densely
+ * packed keys and there is no per-key node overhead. Insertion and erasure of
+ * single keys are linear in size(); prefer the bulk insert functions or
+ * adopting a presorted container when building large sets.
+ *
+ * Any insertion or erasure invalidates all iterators and references.
+ *
+ * @tparam K key type.
+ * @tparam C key_compare function.
+ * @tparam KeyContainer sequence container storing the keys.
+ */
+template<typename K,
+         typename C            = std::less<K>,
+         typename KeyContainer = Vector<K>>
+class FlatSet
+{
+ public:
+    using key_type               = K;
+    using value_type             = K;
+    using key_compare            = C;
+    using value_compare          = C;
+    using reference              = const K&;
+    using const_reference        = const K&;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using container_type         = KeyContainer;
+    using iterator               = typename KeyContainer::const_iterator;
+    using const_iterator         = typename KeyContainer::const_iterator;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    FlatSet() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    explicit FlatSet(const C& comp) : compare_(comp) {}
+
+    /**
+     * @brief Constructs the container from an unsorted key container. Of
+     * several equivalent keys only the first one is kept.
+     *
+     * @param keys keys of the set.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    explicit FlatSet(KeyContainer keys, const C& comp = C())
+      : keys_(std::move(keys)), compare_(comp)
+    {
+        sort_and_unique();
+    }
+
+    /**
+     * @brief Adopts a key container that is already sorted and free of
+     * duplicates, without copying or sorting it.
+     *
+     * @param keys sorted unique keys of the set.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    FlatSet(sorted_unique_t, KeyContainer keys, const C& comp = C())
+      : keys_(std::move(keys)), compare_(comp)
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    template<std::input_iterator InputIt>
+    FlatSet(InputIt first, InputIt last, const C& comp = C())
+      : keys_(first, last), compare_(comp)
+    {
+        sort_and_unique();
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted and free of duplicates.
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    template<std::input_iterator InputIt>
+    FlatSet(sorted_unique_t, InputIt first, InputIt last, const C& comp = C())
+      : keys_(first, last), compare_(comp)
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the keys of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    FlatSet(std::initializer_list<value_type> init, const C& comp = C())
+      : FlatSet(init.begin(), init.end(), comp)
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init, which is sorted and free of duplicates.
+     *
+     * @param init initializer list to initialize the keys of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    FlatSet(sorted_unique_t                   tag,
+            std::initializer_list<value_type> init,
+            const C&                          comp = C())
+      : FlatSet(tag, init.begin(), init.end(), comp)
+    {}
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to FlatSet instance.
+     */
+    FlatSet& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two sets.
+     *
+     * @param lhs first set.
+     * @param rhs second set.
+     *
+     * @return true if the contents of the sets are equal, false otherwise.
+     */
+    friend bool operator==(const FlatSet& lhs, const FlatSet& rhs)
+    {
+        return lhs.keys_ == rhs.keys_;
+    }
+
+    /**
+     * @brief Compares the contents of two sets lexicographically.
+     *
+     * @param lhs first set.
+     * @param rhs second set.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const FlatSet& lhs, const FlatSet& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief Returns an iterator to the first key.
+     *
+     * @return iterator to the first key.
+     */
+    const_iterator begin() const noexcept { return keys_.begin(); }
+
+    /**
+     * @brief Returns an iterator to the first key.
+     *
+     * @return iterator to the first key.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the key following the last key.
+     *
+     * @return iterator to the key following the last key.
+     */
+    const_iterator end() const noexcept { return keys_.end(); }
+
+    /**
+     * @brief Returns an iterator to the key following the last key.
+     *
+     * @return iterator to the key following the last key.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the first key of the reversed set.
+     *
+     * @return reverse iterator to the first key.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the first key of the reversed set.
+     *
+     * @return reverse iterator to the first key.
+     */
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+     * @brief Returns a reverse iterator to the key following the last key of
+     * the reversed set.
+     *
+     * @return reverse iterator to the key following the last key.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the key following the last key of
+     * the reversed set.
+     *
+     * @return reverse iterator to the key following the last key.
+     */
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return keys_.empty(); }
+
+    /**
+     * @brief Returns the number of keys.
+     *
+     * @return the number of keys in the container.
+     */
+    size_type size() const noexcept { return keys_.size(); }
+
+    /**
+     * @brief Returns the maximum possible number of keys.
+     *
+     * @return maximum number of keys.
+     */
+    size_type max_size() const noexcept { return keys_.max_size(); }
+
+    /**
+     * @brief Reserves storage for at least new_cap keys.
+     *
+     * @param new_cap new capacity of the container.
+     */
+    void reserve(size_type new_cap) { keys_.reserve(new_cap); }
+
+    /**
+     * @brief Requests the removal of unused capacity.
+     */
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+    /**
+     * @brief Erases all keys from the container.
+     */
+    void clear() noexcept { keys_.clear(); }
+
+    /**
+     * @brief Returns the sorted keys.
+     *
+     * @return const reference to the key container.
+     */
+    const KeyContainer& keys() const noexcept { return keys_; }
+
+    /**
+     * @brief Moves the underlying container out of the set, leaving it empty.
+     *
+     * @return the sorted key container.
+     */
+    KeyContainer extract() &&
+    {
+        KeyContainer result = std::move(keys_);
+        clear();
+
+        return result;
+    }
+
+    /**
+     * @brief Replaces the underlying container with a container that is
+     * already sorted and free of duplicates.
+     *
+     * @param keys sorted unique keys of the set.
+     */
+    void replace(KeyContainer&& keys) { keys_ = std::move(keys); }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an
+     * equivalent key.
+     *
+     * @param value key to insert.
+     *
+     * @return pair of an iterator to the inserted key, or to the key that
+     * prevented the insertion, and a bool denoting whether the insertion took
+     * place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return insert_key(value);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an
+     * equivalent key.
+     *
+     * @param value key to insert.
+     *
+     * @return pair of an iterator to the inserted key, or to the key that
+     * prevented the insertion, and a bool denoting whether the insertion took
+     * place.
+     */
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return insert_key(std::move(value));
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new key will be
+     * inserted.
+     * @param value key to insert.
+     *
+     * @return iterator to the inserted key, or to the key that prevented the
+     * insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return emplace_hint(hint, value);
+    }
+
+    /**
+     * @brief Inserts keys from range [first, last).
+     *
+     * The range is sorted once and merged with the existing keys, so
+     * inserting m keys costs O(m log m + size()) instead of O(m size()).
+     *
+     * @param first start of the range of keys to insert.
+     * @param last end of the range of keys to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        Vector<value_type> incoming(first, last);
+        std::stable_sort(incoming.begin(), incoming.end(), compare_);
+        merge(std::make_move_iterator(incoming.begin()),
+              std::make_move_iterator(incoming.end()));
+    }
+
+    /**
+     * @brief Inserts keys from range [first, last), which is sorted and free
+     * of duplicates, in O(size() + m).
+     *
+     * @param first start of the range of keys to insert.
+     * @param last end of the range of keys to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        merge(first, last);
+    }
+
+    /**
+     * @brief Inserts keys from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the keys from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts keys from initializer list ilist, which is sorted and
+     * free of duplicates.
+     *
+     * @param ilist initializer list to insert the keys from.
+     */
+    void insert(sorted_unique_t tag, std::initializer_list<value_type> ilist)
+    {
+        insert(tag, ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new key constructed in-place with the given args if
+     * there is no equivalent key in the container.
+     *
+     * @param args arguments to forward to the constructor of the key.
+     *
+     * @return pair of an iterator to the inserted key, or to the key that
+     * prevented the insertion, and a bool denoting whether the insertion took
+     * place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert_key(value_type(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new key into the container as close as possible to the
+     * position just before hint.
+     *
+     * A correct hint skips the binary search.
+     *
+     * @param hint iterator to the position before which the new key will be
+     * inserted.
+     * @param args arguments to forward to the constructor of the key.
+     *
+     * @return iterator to the inserted key, or to the key that prevented the
+     * insertion.
+     */
+    template<class... Args> iterator
+    emplace_hint(const_iterator hint, Args&&... args)
+    {
+        value_type value(std::forward<Args>(args)...);
+
+        if ((hint == begin() || compare_(*std::prev(hint), value))
+            && (hint == end() || compare_(value, *hint)))
+        { return keys_.insert(hint, std::move(value)); }
+
+        return insert_key(std::move(value)).first;
+    }
+
+    /**
+     * @brief Removes the key at pos.
+     *
+     * @param pos iterator to the key to remove.
+     *
+     * @return iterator following the removed key.
+     */
+    iterator erase(const_iterator pos) { return keys_.erase(pos); }
+
+    /**
+     * @brief Removes the keys in the range [first, last).
+     *
+     * @param first start of the range of keys to remove.
+     * @param last end of the range of keys to remove.
+     *
+     * @return iterator following the last removed key.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return keys_.erase(first, last);
+    }
+
+    /**
+     * @brief Removes the key equivalent to key, if any.
+     *
+     * @param key key to remove.
+     *
+     * @return number of keys removed.
+     */
+    size_type erase(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { return 0; }
+
+        erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(FlatSet& other) noexcept
+    {
+        using std::swap;
+        keys_.swap(other.keys_);
+        swap(compare_, other.compare_);
+    }
+
+    /**
+     * @brief Returns the number of keys that compare equivalent to the
+     * specified argument, which is either 1 or 0.
+     *
+     * @param key key to count.
+     *
+     * @return number of keys that compare equivalent to key.
+     */
+    size_type count(const K& key) const { return find(key) == end() ? 0 : 1; }
+
+    /**
+     * @brief Returns the number of keys that compare equivalent to key,
+     * without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return number of keys that compare equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type count(const Key& key) const
+    {
+        auto const [first, last] = equal_range(key);
+
+        return static_cast<size_type>(last - first);
+    }
+
+    /**
+     * @brief Checks if the container contains a key equivalent to key.
+     *
+     * @param key key to search for.
+     *
+     * @return true if there is such a key, false otherwise.
+     */
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Checks if the container contains a key that compares equivalent
+     * to key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return true if there is such a key, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Finds a key equivalent to key.
+     *
+     * @param key key to search for.
+     *
+     * @return iterator to a key equivalent to key, or end() if no such key is
+     * found.
+     */
+    const_iterator find(const K& key) const { return find_key(key); }
+
+    /**
+     * @brief Finds a key that compares equivalent to key, without
+     * constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return iterator to a key equivalent to key, or end() if no such key is
+     * found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return find_key(key);
+    }
+
+    /**
+     * @brief Returns a range containing all keys equivalent to key.
+     *
+     * @param key key to compare the keys to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        auto const first = lower_bound(key);
+        auto const last =
+          first != end() && ! compare_(key, *first) ? std::next(first) : first;
+
+        return {first, last};
+    }
+
+    /**
+     * @brief Returns a range containing all keys that compare equivalent to
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<const_iterator, const_iterator>
+    equal_range(const Key& key) const
+    {
+        return std::equal_range(begin(), end(), key, compare_);
+    }
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given
+     * key.
+     *
+     * @param key key to compare the keys to.
+     *
+     * @return iterator pointing to the first key that is not less than key.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return std::lower_bound(begin(), end(), key, compare_);
+    }
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given
+     * key, without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return iterator pointing to the first key that is not less than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return std::lower_bound(begin(), end(), key, compare_);
+    }
+
+    /**
+     * @brief Returns an iterator to the first key greater than the given key.
+     *
+     * @param key key to compare the keys to.
+     *
+     * @return iterator pointing to the first key that is greater than key.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return std::upper_bound(begin(), end(), key, compare_);
+    }
+
+    /**
+     * @brief Returns an iterator to the first key greater than the given key,
+     * without constructing a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys.
+     *
+     * @return iterator pointing to the first key that is greater than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return std::upper_bound(begin(), end(), key, compare_);
+    }
+
+    /**
+     * @brief Returns the function that compares keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return compare_; }
+
+    /**
+     * @brief Returns the function that compares keys.
+     *
+     * @return the key comparison function object.
+     */
+    value_compare value_comp() const { return compare_; }
+
+ private:
+    template<class Key> const_iterator find_key(const Key& key) const
+    {
+        auto const it = lower_bound(key);
+        if (it == end() || compare_(key, *it))
+        { return end(); }
+
+        return it;
+    }
+
+    template<class Key> std::pair<iterator, bool> insert_key(Key&& key)
+    {
+        auto const it = lower_bound(key);
+        if (it != end() && ! compare_(key, *it))
+        { return {it, false}; }
+
+        return {keys_.insert(it, std::forward<Key>(key)), true};
+    }
+
+    /**
+     * @brief Merges the sorted range [first, last) into the container.
+     * Existing keys win over incoming equivalent ones, and among incoming
+     * equivalent keys the first one wins.
+     */
+    template<class InputIt> void merge(InputIt first, InputIt last)
+    {
+        if (first == last)
+        { return; }
+
+        KeyContainer keys;
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            keys.reserve(size()
+                         + static_cast<size_type>(std::distance(first, last)));
+        }
+
+        auto const append = [&keys, this](auto&& key) {
+            if (keys.empty() || compare_(keys.back(), key))
+            { keys.push_back(std::forward<decltype(key)>(key)); }
+        };
+
+        try
+        {
+            size_type i = 0;
+            for (; first != last; ++first)
+            {
+                auto&& key = *first;
+                while (i < size() && ! compare_(key, keys_[i]))
+                {
+                    append(std::move(keys_[i]));
+                    ++i;
+                }
+                append(std::forward<decltype(key)>(key));
+            }
+            for (; i < size(); ++i)
+            { append(std::move(keys_[i])); }
+        }
+        catch (...)
+        {
+            // Keys were moved out already, there is no consistent state to
+            // roll back to.
+            clear();
+            throw;
+        }
+
+        keys_ = std::move(keys);
+    }
+
+    /**
+     * @brief Sorts the keys and drops all but the first of several equivalent
+     * keys.
+     */
+    void sort_and_unique()
+    {
+        std::stable_sort(keys_.begin(), keys_.end(), compare_);
+        keys_.erase(std::unique(keys_.begin(),
+                                keys_.end(),
+                                [this](const K& lhs, const K& rhs) {
+                                    return ! compare_(lhs, rhs);
+                                }),
+                    keys_.end());
+    }
+
+    KeyContainer            keys_;
+    [[no_unique_address]] C compare_;
+};
+
+/**
+ * @brief Exchanges the contents of two sets.
+ *
+ * @param lhs first set.
+ * @param rhs second set.
+ */
+template<class K, class C, class KC>
+void swap(FlatSet<K, C, KC>& lhs, FlatSet<K, C, KC>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief FlatSet owns its key container.
+ */
+template<class K, class C, class KC>
+struct MemoryFootprintTraits<FlatSet<K, C, KC>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const FlatSet<K, C, KC>& value)
+    {
+        return memory_footprint(value.keys());
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_FLAT_SET_H_
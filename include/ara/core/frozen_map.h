@@ -0,0 +1,530 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_FROZEN_MAP_H_
+#define ARA_CORE_FROZEN_MAP_H_
+
+#include "ara/core/string_view.h"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Bijective 64 bit mixing function (the splitmix64 finalizer).
+ */
+constexpr std::uint64_t FrozenMix(std::uint64_t x) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Minimal-search perfect hash function over N distinct 64 bit hashes,
+ * computed by hash and displace.
+ *
+ * The hashes are spread over kSlots buckets by their low bits. Starting with
+ * the largest bucket, every bucket is assigned the first seed that moves all of
+ * its hashes to distinct free slots, slot = FrozenMix(hash + seed) % kSlots.
+ * A lookup thus costs two table reads and one mix, without any branch.
+ *
+ * @tparam N number of hashes.
+ */
+template<std::size_t N> class PerfectHash
+{
+ public:
+    /**
+     * @brief Number of buckets and of slots, a power of two not below N.
+     */
+    static constexpr std::size_t kSlots =
+      std::bit_ceil(std::max<std::size_t>(N, 1));
+
+    using Index =
+      std::conditional_t<(N <= 0xFFFF), std::uint16_t, std::uint32_t>;
+
+    /**
+     * @brief Computes the perfect hash function of hashes.
+     *
+     * @param hashes hashes of the keys, in the order of the items.
+     *
+     * @throws std::invalid_argument if two hashes are equal, which is a
+     * compile time error if evaluated in a constant expression.
+     */
+    constexpr explicit PerfectHash(const std::array<std::uint64_t, N>& hashes)
+    {
+        auto sorted = hashes;
+        std::sort(sorted.begin(), sorted.end());
+        if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+        { throw std::invalid_argument("FrozenMap: duplicate key"); }
+
+        // Counting sort of the items by bucket.
+        std::array<std::size_t, kSlots + 1> start{};
+        for (auto hash : hashes) { ++start[Bucket(hash) + 1]; }
+        for (std::size_t b = 0; b < kSlots; ++b) { start[b + 1] += start[b]; }
+
+        std::array<std::size_t, N> items{};
+        auto                       fill = start;
+        for (std::size_t i = 0; i < N; ++i)
+        { items[fill[Bucket(hashes[i])]++] = i; }
+
+        std::array<std::size_t, kSlots> buckets{};
+        for (std::size_t b = 0; b < kSlots; ++b) { buckets[b] = b; }
+        std::sort(buckets.begin(), buckets.end(), [&start](auto l, auto r) {
+            return start[l + 1] - start[l] > start[r + 1] - start[r];
+        });
+
+        std::array<bool, kSlots>   taken{};
+        std::array<std::size_t, N> slots{};
+        for (auto bucket : buckets)
+        {
+            std::size_t const first = start[bucket];
+            std::size_t const count = start[bucket + 1] - first;
+            if (count == 0)
+            { break; }
+
+            std::uint32_t seed = 0;
+            while (! Place(hashes, items, first, count, ++seed, taken, slots))
+            {}
+
+            seeds_[bucket] = seed;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                taken[slots[i]]  = true;
+                index_[slots[i]] = static_cast<Index>(items[first + i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the index of the item whose hash is hash. For any other
+     * hash an arbitrary index below N is returned.
+     *
+     * @param hash hash of the key to look up.
+     *
+     * @return index of the item.
+     */
+    constexpr std::size_t operator()(std::uint64_t hash) const noexcept
+    {
+        return index_[Slot(hash, seeds_[Bucket(hash)])];
+    }
+
+ private:
+    static constexpr std::size_t Bucket(std::uint64_t hash) noexcept
+    {
+        return hash & (kSlots - 1);
+    }
+
+    static constexpr std::size_t Slot(std::uint64_t hash,
+                                      std::uint32_t seed) noexcept
+    {
+        return FrozenMix(hash + seed) & (kSlots - 1);
+    }
+
+    /**
+     * @brief Checks whether seed moves the items [first, first + count) to
+     * distinct free slots, which are stored to slots.
+     */
+    static constexpr bool Place(const std::array<std::uint64_t, N>& hashes,
+                                const std::array<std::size_t, N>&   items,
+                                std::size_t                         first,
+                                std::size_t                         count,
+                                std::uint32_t                       seed,
+                                const std::array<bool, kSlots>&     taken,
+                                std::array<std::size_t, N>&         slots)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            slots[i] = Slot(hashes[items[first + i]], seed);
+            if (taken[slots[i]]
+                || std::find(slots.begin(), slots.begin() + i, slots[i])
+                     != slots.begin() + i)
+            { return false; }
+        }
+
+        return true;
+    }
+
+    std::array<std::uint32_t, kSlots> seeds_{};
+    std::array<Index, kSlots>         index_{};
+};
+}  // namespace detail
+
+/**
+ * @brief Hash function usable in constant expressions, as required by
+ * FrozenMap and FrozenSet.
+ *
+ * Specializations exist for integral and enumeration types and for
+ * StringView. Custom key types provide a specialization with a constexpr
+ * operator() returning a std::uint64_t.
+ *
+ * @tparam K key type.
+ */
+template<class K> struct FrozenHash;
+
+/**
+ * @brief FrozenHash of integral and enumeration types.
+ */
+template<class K>
+    requires std::is_integral_v<K> || std::is_enum_v<K>
+struct FrozenHash<K>
+{
+    constexpr std::uint64_t operator()(K key) const noexcept
+    {
+        if constexpr (std::is_enum_v<K>)
+        {
+            return FrozenHash<std::underlying_type_t<K>>{}(
+              static_cast<std::underlying_type_t<K>>(key));
+        }
+        else
+        { return detail::FrozenMix(static_cast<std::uint64_t>(key)); }
+    }
+};
+
+/**
+ * @brief FrozenHash of strings, FNV-1a followed by a mix.
+ */
+template<> struct FrozenHash<StringView>
+{
+    constexpr std::uint64_t operator()(StringView key) const noexcept
+    {
+        std::uint64_t hash = 0xCBF29CE484222325ull;
+        for (char c : key)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001B3ull;
+        }
+
+        return detail::FrozenMix(hash);
+    }
+};
+
+/**
+ * @brief Immutable associative container of N key-value pairs, constructible
+ * in constant expressions.
+ *
+ * The constructor computes a perfect hash function of the keys, so a lookup
+ * hashes the key, reads two small tables and compares a single key. The
+ * elements and the tables are stored inline; a constexpr FrozenMap has no
+ * startup cost and never allocates. Iteration visits the elements in the
+ * order they were given.
+ *
+ * Create instances with MakeFrozenMap(), which deduces N:
+ * @code
+ * constexpr auto kNames = MakeFrozenMap<int, StringView>({{1, "one"},
+ *                                                         {2, "two"}});
+ * static_assert(kNames.at(2) == "two");
+ * @endcode
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam N number of elements.
+ * @tparam Hash constexpr hash function returning std::uint64_t.
+ * @tparam Eq key equality function.
+ */
+template<typename K,
+         typename V,
+         std::size_t N,
+         typename Hash = FrozenHash<K>,
+         typename Eq   = std::equal_to<K>>
+class FrozenMap
+{
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<K, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = Eq;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+    using iterator        = const value_type*;
+    using const_iterator  = const value_type*;
+
+    /**
+     * @brief Constructs the container from items.
+     *
+     * @param items the elements, with distinct keys.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     *
+     * @throws std::invalid_argument if two keys are equal.
+     */
+    constexpr explicit FrozenMap(const std::array<value_type, N>& items,
+                                 const Hash& hash  = Hash(),
+                                 const Eq&   equal = Eq())
+      : items_{items}, table_{Hashes(items, hash)}, hash_{hash}, equal_{equal}
+    {}
+
+    constexpr const_iterator begin() const noexcept { return items_.data(); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator end() const noexcept { return begin() + N; }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    constexpr bool      empty() const noexcept { return N == 0; }
+    constexpr size_type size() const noexcept { return N; }
+    constexpr size_type max_size() const noexcept { return N; }
+
+    /**
+     * @brief Finds the element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to the element, or end() if there is no such element.
+     */
+    constexpr const_iterator find(const K& key) const
+    {
+        if constexpr (N == 0)
+        { return end(); }
+        else
+        {
+            const_iterator const candidate = begin() + table_(hash_(key));
+            return equal_(candidate->first, key) ? candidate : end();
+        }
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    constexpr bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    constexpr size_type count(const K& key) const { return contains(key); }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    constexpr const V& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("FrozenMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns the function that hashes the keys.
+     *
+     * @return the hash function.
+     */
+    constexpr hasher hash_function() const { return hash_; }
+
+    /**
+     * @brief Returns the function that compares keys for equality.
+     *
+     * @return the key equality function.
+     */
+    constexpr key_equal key_eq() const { return equal_; }
+
+ private:
+    static constexpr std::array<std::uint64_t, N>
+    Hashes(const std::array<value_type, N>& items, const Hash& hash)
+    {
+        std::array<std::uint64_t, N> hashes{};
+        for (std::size_t i = 0; i < N; ++i)
+        { hashes[i] = hash(items[i].first); }
+
+        return hashes;
+    }
+
+    std::array<value_type, N>  items_;
+    detail::PerfectHash<N>     table_;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] Eq   equal_;
+};
+
+/**
+ * @brief Immutable set of N keys, constructible in constant expressions.
+ *
+ * The counterpart of FrozenMap without mapped values; create instances with
+ * MakeFrozenSet().
+ *
+ * @tparam K key type.
+ * @tparam N number of elements.
+ * @tparam Hash constexpr hash function returning std::uint64_t.
+ * @tparam Eq key equality function.
+ */
+template<typename K,
+         std::size_t N,
+         typename Hash = FrozenHash<K>,
+         typename Eq   = std::equal_to<K>>
+class FrozenSet
+{
+ public:
+    using key_type        = K;
+    using value_type      = K;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = Eq;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+    using iterator        = const value_type*;
+    using const_iterator  = const value_type*;
+
+    /**
+     * @brief Constructs the container from keys.
+     *
+     * @param keys the elements, all distinct.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     *
+     * @throws std::invalid_argument if two keys are equal.
+     */
+    constexpr explicit FrozenSet(const std::array<K, N>& keys,
+                                 const Hash&             hash  = Hash(),
+                                 const Eq&               equal = Eq())
+      : keys_{keys}, table_{Hashes(keys, hash)}, hash_{hash}, equal_{equal}
+    {}
+
+    constexpr const_iterator begin() const noexcept { return keys_.data(); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator end() const noexcept { return begin() + N; }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    constexpr bool      empty() const noexcept { return N == 0; }
+    constexpr size_type size() const noexcept { return N; }
+    constexpr size_type max_size() const noexcept { return N; }
+
+    /**
+     * @brief Finds the element equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to the element, or end() if there is no such element.
+     */
+    constexpr const_iterator find(const K& key) const
+    {
+        if constexpr (N == 0)
+        { return end(); }
+        else
+        {
+            const_iterator const candidate = begin() + table_(hash_(key));
+            return equal_(*candidate, key) ? candidate : end();
+        }
+    }
+
+    /**
+     * @brief Checks if there is an element equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    constexpr bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Returns the number of elements equivalent to key, which is
+     * either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements equivalent to key.
+     */
+    constexpr size_type count(const K& key) const { return contains(key); }
+
+    /**
+     * @brief Returns the function that hashes the keys.
+     *
+     * @return the hash function.
+     */
+    constexpr hasher hash_function() const { return hash_; }
+
+    /**
+     * @brief Returns the function that compares keys for equality.
+     *
+     * @return the key equality function.
+     */
+    constexpr key_equal key_eq() const { return equal_; }
+
+ private:
+    static constexpr std::array<std::uint64_t, N>
+    Hashes(const std::array<K, N>& keys, const Hash& hash)
+    {
+        std::array<std::uint64_t, N> hashes{};
+        for (std::size_t i = 0; i < N; ++i) { hashes[i] = hash(keys[i]); }
+
+        return hashes;
+    }
+
+    std::array<K, N>           keys_;
+    detail::PerfectHash<N>     table_;
+    [[no_unique_address]] Hash hash_;
+    [[no_unique_address]] Eq   equal_;
+};
+
+/**
+ * @brief Creates a FrozenMap from a braced list of key-value pairs.
+ *
+ * @param items the elements, with distinct keys.
+ *
+ * @return the FrozenMap.
+ *
+ * @throws std::invalid_argument if two keys are equal, which is a compile
+ * time error if evaluated in a constant expression.
+ */
+template<typename K,
+         typename V,
+         typename Hash = FrozenHash<K>,
+         typename Eq   = std::equal_to<K>,
+         std::size_t N>
+constexpr FrozenMap<K, V, N, Hash, Eq>
+MakeFrozenMap(const std::pair<K, V> (&items)[N])
+{
+    return FrozenMap<K, V, N, Hash, Eq>{std::to_array(items)};
+}
+
+/**
+ * @brief Creates a FrozenSet from a braced list of keys.
+ *
+ * @param keys the elements, all distinct.
+ *
+ * @return the FrozenSet.
+ *
+ * @throws std::invalid_argument if two keys are equal, which is a compile
+ * time error if evaluated in a constant expression.
+ */
+template<typename K,
+         typename Hash = FrozenHash<K>,
+         typename Eq   = std::equal_to<K>,
+         std::size_t N>
+constexpr FrozenSet<K, N, Hash, Eq> MakeFrozenSet(const K (&keys)[N])
+{
+    return FrozenSet<K, N, Hash, Eq>{std::to_array(keys)};
+}
+}  // namespace ara::core
+
+#endif  // ARA_CORE_FROZEN_MAP_H_
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_FUNCTIONAL_H_
+#define ARA_CORE_FUNCTIONAL_H_
+
+#include "ara/core/string_view.h"
+#include <cstddef>
+#include <functional>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Satisfied by comparison and hash function objects that declare
+ * is_transparent, i.e. accept any type comparable to the key type.
+ * Associative containers offer heterogeneous lookup for those.
+ */
+template<class T>
+concept TransparentFunction = requires { typename T::is_transparent; };
+}  // namespace detail
+
+/**
+ * @brief Transparent less-than comparison for string keys.
+ *
+ * Compares anything convertible to StringView, so a Map<std::string, V,
+ * StringLess> can be searched with a StringView or a string literal without
+ * constructing a temporary string.
+ */
+struct StringLess
+{
+    using is_transparent = void;
+
+    bool operator()(StringView lhs, StringView rhs) const noexcept
+    {
+        return lhs < rhs;
+    }
+};
+
+/**
+ * @brief Transparent equality comparison for string keys.
+ */
+struct StringEqual
+{
+    using is_transparent = void;
+
+    bool operator()(StringView lhs, StringView rhs) const noexcept
+    {
+        return lhs == rhs;
+    }
+};
+
+/**
+ * @brief Transparent hash for string keys, consistent with std::hash of
+ * std::string.
+ */
+struct StringHash
+{
+    using is_transparent = void;
+
+    std::size_t operator()(StringView value) const noexcept
+    {
+        return std::hash<StringView>{}(value);
+    }
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_FUNCTIONAL_H_
@@ -0,0 +1,491 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_INTERVAL_MAP_H_
+#define ARA_CORE_INTERVAL_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Associative container mapping half-open ranges [lower, upper) of
+ * keys to values.
+ *
+ * The ranges are kept as disjoint segments in a Map ordered by their lower
+ * bounds, so a point lookup is one search of the Map. Assigning a value to a
+ * range overwrites whatever the range covered before: segments that
+ * partially overlap it are cut, and segments inside it are removed. Adjacent
+ * segments with equal values are coalesced into one, so the number of
+ * segments only depends on how many distinct runs of values there are.
+ *
+ * assign() and erase() take O(log n + k) for k segments overlapping the range,
+ * and reuse the nodes of the segments they replace, so they allocate at most
+ * one node. If that allocation throws, the map is left unchanged.
+ *
+ * @tparam K key type.
+ * @tparam V value type, equality comparable.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type, rebound to the nodes of the Map.
+ */
+template<typename K,
+         typename V,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class IntervalMap
+{
+ public:
+    /**
+     * @brief Range [lower, upper) of keys mapped to value.
+     */
+    struct Segment
+    {
+        K lower;
+        K upper;
+        V value;
+
+        friend bool operator==(const Segment&, const Segment&) = default;
+    };
+
+ private:
+    using SegmentAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<std::pair<const K, Segment>>;
+    using Segments = Map<K, Segment, C, SegmentAllocator>;
+    using Iterator = typename Segments::iterator;
+
+ public:
+    class const_iterator;
+
+    using key_type       = K;
+    using mapped_type    = V;
+    using value_type     = Segment;
+    using size_type      = std::size_t;
+    using key_compare    = C;
+    using allocator_type = Allocator;
+    using iterator       = const_iterator;
+
+    /**
+     * @brief Bidirectional iterator over the segments in key order. Segments
+     * cannot be modified through it, as that could break the coalescing.
+     */
+    class const_iterator
+    {
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = Segment;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const Segment*;
+        using reference         = const Segment&;
+
+        const_iterator() = default;
+
+        reference operator*() const noexcept { return it_->second; }
+        pointer   operator->() const noexcept { return &it_->second; }
+
+        const_iterator& operator++() noexcept
+        {
+            ++it_;
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            return const_iterator(it_++);
+        }
+
+        const_iterator& operator--() noexcept
+        {
+            --it_;
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept
+        {
+            return const_iterator(it_--);
+        }
+
+        friend bool operator==(const const_iterator&,
+                               const const_iterator&) = default;
+
+     private:
+        friend class IntervalMap;
+
+        using Base = typename Segments::const_iterator;
+
+        explicit const_iterator(Base it) noexcept : it_(it) {}
+
+        Base it_;
+    };
+
+    /**
+     * @brief Constructs an empty map.
+     */
+    IntervalMap() = default;
+
+    /**
+     * @brief Constructs an empty map.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit IntervalMap(const C& comp, const Allocator& alloc = Allocator())
+      : segments_(comp, SegmentAllocator(alloc))
+    {}
+
+    /**
+     * @brief Compares the segments of two maps.
+     *
+     * @return true if both maps assign the same values to the same keys.
+     */
+    friend bool operator==(const IntervalMap& lhs, const IntervalMap& rhs)
+    {
+        return lhs.segments_ == rhs.segments_;
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(segments_.begin());
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(segments_.end());
+    }
+
+    /**
+     * @brief Checks if no key is mapped to a value.
+     *
+     * @return true if the map is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return segments_.empty(); }
+
+    /**
+     * @brief Returns the number of segments.
+     *
+     * @return the number of maximal ranges of keys mapped to equal values.
+     */
+    size_type size() const noexcept { return segments_.size(); }
+
+    /**
+     * @brief Erases all segments.
+     */
+    void clear() noexcept { segments_.clear(); }
+
+    /**
+     * @brief Returns the function that compares the keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return segments_.key_comp(); }
+
+    /**
+     * @brief Finds the segment containing key.
+     *
+     * @param key key to look up.
+     *
+     * @return iterator to the segment, or end() if key is not mapped.
+     */
+    const_iterator find(const K& key) const
+    {
+        auto it = segments_.upper_bound(key);
+        if (it == segments_.begin())
+        { return end(); }
+
+        --it;
+        return comp()(key, it->second.upper) ? const_iterator(it) : end();
+    }
+
+    /**
+     * @brief Checks if key is mapped to a value.
+     *
+     * @param key key to look up.
+     *
+     * @return true if a segment contains key.
+     */
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Returns the value key is mapped to.
+     *
+     * @param key key to look up.
+     *
+     * @return reference to the value of the segment containing key.
+     *
+     * @throws std::out_of_range if no segment contains key.
+     */
+    const V& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("IntervalMap::at"); }
+
+        return it->value;
+    }
+
+    /**
+     * @brief Returns the segments that overlap the range [lower, upper).
+     *
+     * @param lower first key of the range.
+     * @param upper key after the last key of the range.
+     *
+     * @return range of the segments in key order, empty if no segment
+     * overlaps or if upper is not greater than lower.
+     */
+    std::pair<const_iterator, const_iterator>
+    overlapping(const K& lower, const K& upper) const
+    {
+        if (! comp()(lower, upper))
+        { return {end(), end()}; }
+
+        auto first = segments_.upper_bound(lower);
+        if (first != segments_.begin()
+            && comp()(lower, std::prev(first)->second.upper))
+        { --first; }
+
+        return {const_iterator(first),
+                const_iterator(segments_.lower_bound(upper))};
+    }
+
+    /**
+     * @brief Checks if any key of the range [lower, upper) is mapped.
+     *
+     * @param lower first key of the range.
+     * @param upper key after the last key of the range.
+     *
+     * @return true if a segment overlaps the range.
+     */
+    bool overlaps(const K& lower, const K& upper) const
+    {
+        auto const [first, last] = overlapping(lower, upper);
+
+        return first != last;
+    }
+
+    /**
+     * @brief Maps every key of the range [lower, upper) to value, replacing
+     * the values the keys were mapped to before.
+     *
+     * @param lower first key of the range.
+     * @param upper key after the last key of the range. Nothing happens if it
+     * is not greater than lower.
+     * @param value value to map the keys to.
+     */
+    void assign(const K& lower, const K& upper, const V& value)
+    {
+        if (! comp()(lower, upper))
+        { return; }
+
+        // [first, last) are the segments that overlap or touch the range.
+        auto first = segments_.lower_bound(lower);
+        if (first != segments_.begin()
+            && ! comp()(std::prev(first)->second.upper, lower))
+        { --first; }
+        auto last = segments_.upper_bound(upper);
+
+        K        lo   = lower;
+        K        hi   = upper;
+        Segment* trim = nullptr;
+        if (first != last && comp()(first->first, lower))
+        {
+            Segment& left = first->second;
+            if (left.value == value)
+            { lo = left.lower; }
+            else if (comp()(upper, left.upper))
+            {
+                // The range lies inside a segment with another value, which
+                // is split into three. The segment is cut only once both new
+                // ones exist, so a failed allocation changes nothing.
+                auto const right = segments_.emplace_hint(
+                  last, upper, Segment{upper, left.upper, left.value});
+                try
+                {
+                    segments_.emplace_hint(
+                      right, lower, Segment{lower, upper, value});
+                }
+                catch (...)
+                {
+                    segments_.erase(right);
+                    throw;
+                }
+                left.upper = lower;
+                return;
+            }
+            else
+            {
+                // Cut once the range has its segment, see below.
+                trim = &left;
+                ++first;
+            }
+        }
+
+        if (first != last)
+        {
+            auto const back = std::prev(last);
+            if (comp()(upper, back->second.upper))
+            {
+                if (back->second.value == value)
+                { hi = back->second.upper; }
+                else if (comp()(back->first, upper))
+                {
+                    if (back != first)
+                    { last = move_lower(back, upper); }
+                    else
+                    {
+                        // The back is the only node to reuse for the range,
+                        // so its part behind the range gets a new one.
+                        last = segments_.emplace_hint(
+                          last,
+                          upper,
+                          Segment{
+                            upper, back->second.upper, back->second.value});
+                    }
+                }
+                else
+                { last = back; }
+            }
+        }
+
+        // At most one node is allocated: above when the back is split, or in
+        // replace() when there is no node to reuse, before any segment has
+        // changed. The left segment is cut last, so a failed allocation
+        // changes nothing.
+        replace(first, last, Segment{std::move(lo), std::move(hi), value});
+        if (trim != nullptr)
+        { trim->upper = lower; }
+    }
+
+    /**
+     * @brief Unmaps every key of the range [lower, upper).
+     *
+     * @param lower first key of the range.
+     * @param upper key after the last key of the range. Nothing happens if it
+     * is not greater than lower.
+     */
+    void erase(const K& lower, const K& upper)
+    {
+        if (! comp()(lower, upper))
+        { return; }
+
+        auto first = segments_.upper_bound(lower);
+        if (first != segments_.begin()
+            && comp()(lower, std::prev(first)->second.upper))
+        { --first; }
+        auto last = segments_.lower_bound(upper);
+
+        if (first != last && comp()(first->first, lower))
+        {
+            Segment& left = first->second;
+            if (comp()(upper, left.upper))
+            {
+                segments_.emplace_hint(
+                  last, upper, Segment{upper, left.upper, left.value});
+                left.upper = lower;
+                return;
+            }
+            left.upper = lower;
+            ++first;
+        }
+
+        if (first != last && comp()(upper, std::prev(last)->second.upper))
+        {
+            // Moving the node invalidates first if it is the back.
+            bool const single = std::next(first) == last;
+            last              = move_lower(std::prev(last), upper);
+            if (single)
+            { first = last; }
+        }
+
+        segments_.erase(first, last);
+    }
+
+ private:
+    friend struct MemoryFootprintTraits<IntervalMap>;
+
+    C comp() const { return segments_.key_comp(); }
+
+    /**
+     * @brief Moves the lower bound of the segment at it up to lower, reusing
+     * its node.
+     *
+     * @return iterator to the moved segment.
+     */
+    Iterator move_lower(Iterator it, const K& lower)
+    {
+        auto const next = std::next(it);
+        auto       node = segments_.extract(it);
+        // A valid iterator never yields an empty node, the check only tells
+        // the compiler so.
+        if (node.empty())
+        { return next; }
+        node.key()          = lower;
+        node.mapped().lower = lower;
+
+        return segments_.insert(next, std::move(node));
+    }
+
+    /**
+     * @brief Replaces the segments [first, last) by segment, reusing the node
+     * of the first one if there is any.
+     */
+    void replace(Iterator first, Iterator last, Segment&& segment)
+    {
+        if (first == last)
+        {
+            K const key = segment.lower;
+            segments_.emplace_hint(last, key, std::move(segment));
+            return;
+        }
+
+        auto node = segments_.extract(first++);
+        segments_.erase(first, last);
+        if (node.empty())
+        { return; }
+        node.key()    = segment.lower;
+        node.mapped() = std::move(segment);
+        segments_.insert(last, std::move(node));
+    }
+
+    Segments segments_;
+};
+
+/**
+ * @brief IntervalMap allocates one Map node per segment. The Map measures
+ * the keys of the nodes, the bounds and values of the segments are added.
+ */
+template<class K, class V, class C, class Allocator>
+struct MemoryFootprintTraits<IntervalMap<K, V, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const IntervalMap<K, V, C, Allocator>& value)
+    {
+        MemoryFootprint footprint = memory_footprint(value.segments_);
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [key, segment] : value.segments_)
+            {
+                footprint += memory_footprint(segment.lower)
+                             + memory_footprint(segment.upper)
+                             + memory_footprint(segment.value);
+            }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_INTERVAL_MAP_H_
@@ -0,0 +1,1021 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_LRU_CACHE_H_
+#define ARA_CORE_LRU_CACHE_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/unordered_map.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Counters of a cache, see BoundedCache::stats().
+ */
+struct CacheStats
+{
+    /** lookups that found the key */
+    std::uint64_t hits{0};
+    /** lookups that did not find the key */
+    std::uint64_t misses{0};
+    /** elements removed to make room for others */
+    std::uint64_t evictions{0};
+
+    CacheStats& operator+=(const CacheStats& other) noexcept
+    {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+
+        return *this;
+    }
+
+    friend bool operator==(const CacheStats&, const CacheStats&) = default;
+};
+
+/**
+ * @brief Weigher counting every element as 1, which limits a cache by the
+ * number of its elements.
+ */
+struct UnitWeight
+{
+    template<class K, class V>
+    constexpr std::size_t operator()(const K&, const V&) const noexcept
+    {
+        return 1;
+    }
+};
+
+/**
+ * @brief Policy choosing the element a full cache evicts.
+ */
+enum class Eviction
+{
+    /**
+     * The least recently used element. Every hit moves the element to the
+     * front of the recency list.
+     */
+    kLru,
+    /**
+     * SIEVE, a variant of CLOCK: a hit only marks the element as visited. A
+     * hand moving from the oldest element towards the newest one evicts the
+     * first element that is not marked and clears the marks it passes. Hits
+     * are cheaper than with kLru, and keys looked up only once leave the cache
+     * sooner.
+     */
+    kSieve
+};
+
+/**
+ * @brief Cache holding elements up to a total weight, evicting elements by
+ * Policy to make room for new ones.
+ *
+ * The elements live in a pool of nodes linked into a list by 32-bit indices,
+ * and an UnorderedMap maps every key to its node. Nodes of evicted and erased
+ * elements are reused, so once the pool has grown to the capacity, a hit never
+ * allocates and a miss only when the index cleans up its erased slots, which
+ * is rare. A hit does not write to anything but its own node and, with kLru,
+ * its neighbours.
+ *
+ * Every key is stored twice, in its node and in the index. The index cannot
+ * hash and compare through the nodes instead, since its function objects
+ * would have to point into the cache and could not follow it when the cache
+ * is moved. Caches of large keys should therefore key by a handle or hash.
+ *
+ * The weight of an element is weigher(key, value), computed when the value is
+ * inserted or assigned. With the default UnitWeight the capacity is a number
+ * of elements. An element heavier than the whole capacity is not cached.
+ *
+ * Pointers returned by find() stay valid until the next modification of the
+ * cache. The cache is not thread-safe, see ShardedCache for concurrent use.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam Policy eviction policy.
+ * @tparam Hash hash function.
+ * @tparam Eq key equality function.
+ * @tparam Weigher function object returning the weight of a key and a value.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         Eviction Policy,
+         typename Hash      = std::hash<K>,
+         typename Eq        = std::equal_to<K>,
+         typename Weigher   = UnitWeight,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class BoundedCache
+{
+ public:
+    using key_type       = K;
+    using mapped_type    = V;
+    using value_type     = std::pair<const K, V>;
+    using size_type      = std::size_t;
+    using hasher         = Hash;
+    using key_equal      = Eq;
+    using weigher_type   = Weigher;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Constructs a cache with a capacity of zero, which caches nothing.
+     */
+    BoundedCache() = default;
+
+    /**
+     * @brief Constructs an empty cache without allocating.
+     *
+     * @param capacity maximal total weight of the elements.
+     * @param weigher function returning the weight of an element.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of the cache.
+     */
+    explicit BoundedCache(size_type        capacity,
+                          const Weigher&   weigher = Weigher(),
+                          const Hash&      hash    = Hash(),
+                          const Eq&        equal   = Eq(),
+                          const Allocator& alloc   = Allocator())
+      : nodes_(NodeAllocator(alloc)),
+        index_(0, hash, equal, IndexAllocator(alloc)),
+        capacity_(capacity),
+        weigher_(weigher)
+    {}
+
+    BoundedCache(const BoundedCache&) = default;
+    BoundedCache& operator=(const BoundedCache&) = default;
+
+    /**
+     * @brief Move constructor, other is left empty.
+     *
+     * @param other cache to take the elements from.
+     */
+    BoundedCache(BoundedCache&& other) noexcept
+      : nodes_(std::move(other.nodes_)),
+        index_(std::move(other.index_)),
+        head_(std::exchange(other.head_, kNil)),
+        tail_(std::exchange(other.tail_, kNil)),
+        hand_(std::exchange(other.hand_, kNil)),
+        free_(std::exchange(other.free_, kNil)),
+        capacity_(other.capacity_),
+        weight_(std::exchange(other.weight_, 0)),
+        stats_(other.stats_),
+        weigher_(other.weigher_)
+    {
+        other.nodes_.clear();
+    }
+
+    /**
+     * @brief Move assignment, other is left empty.
+     *
+     * @param other cache to take the elements from.
+     *
+     * @return *this.
+     */
+    BoundedCache& operator=(BoundedCache&& other) noexcept
+    {
+        if (this != &other)
+        {
+            nodes_    = std::move(other.nodes_);
+            index_    = std::move(other.index_);
+            head_     = std::exchange(other.head_, kNil);
+            tail_     = std::exchange(other.tail_, kNil);
+            hand_     = std::exchange(other.hand_, kNil);
+            free_     = std::exchange(other.free_, kNil);
+            capacity_ = other.capacity_;
+            weight_   = std::exchange(other.weight_, 0);
+            stats_    = other.stats_;
+            weigher_  = other.weigher_;
+            other.nodes_.clear();
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the maximal total weight of the elements.
+     *
+     * @return the capacity of the cache.
+     */
+    size_type capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Changes the capacity, evicting elements if the cache is heavier
+     * than the new capacity.
+     *
+     * @param capacity maximal total weight of the elements.
+     */
+    void set_capacity(size_type capacity)
+    {
+        capacity_ = capacity;
+        make_room(0);
+    }
+
+    /**
+     * @brief Checks if the cache has no elements.
+     *
+     * @return true if the cache is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return index_.empty(); }
+
+    /**
+     * @brief Returns the number of elements in the cache.
+     *
+     * @return the number of elements in the cache.
+     */
+    size_type size() const noexcept { return index_.size(); }
+
+    /**
+     * @brief Returns the total weight of the elements.
+     *
+     * @return sum of the weights of all elements, at most capacity().
+     */
+    size_type weight() const noexcept { return weight_; }
+
+    /**
+     * @brief Returns the counters of lookups and evictions since construction
+     * or the last call of reset_stats().
+     *
+     * @return hits and misses of find() and the number of evictions.
+     */
+    const CacheStats& stats() const noexcept { return stats_; }
+
+    /**
+     * @brief Sets all counters to zero.
+     */
+    void reset_stats() noexcept { stats_ = CacheStats{}; }
+
+    /**
+     * @brief Looks up the value of key and marks it as used, counting a hit
+     * or a miss.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return pointer to the value, or nullptr if key is not cached.
+     */
+    V* find(const K& key) { return find_key(key); }
+
+    /**
+     * @brief Looks up the value of key without constructing a key_type.
+     * Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pointer to the value, or nullptr if key is not cached.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    V* find(const Key& key)
+    {
+        return find_key(key);
+    }
+
+    /**
+     * @brief Looks up the value of key without marking it as used or counting
+     * the lookup.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return pointer to the value, or nullptr if key is not cached.
+     */
+    const V* peek(const K& key) const { return peek_key(key); }
+
+    /**
+     * @copydoc peek(const K&)
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    const V* peek(const Key& key) const
+    {
+        return peek_key(key);
+    }
+
+    /**
+     * @brief Checks if key is cached, without marking it as used or counting
+     * the lookup.
+     *
+     * @param key the key of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(const K& key) const { return peek_key(key) != nullptr; }
+
+    /**
+     * @brief Inserts an element with key key and a value constructed from
+     * args if key is not cached, evicting elements to make room for it.
+     * Otherwise marks the existing element as used.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the value.
+     *
+     * @return pair of a pointer to the cached value and a bool denoting
+     * whether the insertion took place. The pointer is nullptr if the new
+     * element is heavier than the capacity.
+     */
+    template<class... Args>
+    std::pair<V*, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @copydoc try_emplace(const K&, Args&&...)
+     */
+    template<class... Args>
+    std::pair<V*, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts an element, or assigns to the value of the cached element
+     * with key key. Either way the element becomes the newest one and is
+     * weighed again, evicting other elements if it got heavier.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pointer to the cached value, or nullptr if the element is
+     * heavier than the capacity, in which case an existing element with key
+     * is erased.
+     */
+    template<class M> V* insert_or_assign(const K& key, M&& obj)
+    {
+        auto const it = index_.find(key);
+        if (it == index_.end())
+        { return try_emplace_key(key, std::forward<M>(obj)).first; }
+
+        Link const link = it->second;
+        Node&      node = nodes_[link];
+        node.element->second = std::forward<M>(obj);
+
+        // Weighed before the node leaves the list, which a throwing weigher
+        // would otherwise leave it out of.
+        size_type const weight = weigh(node);
+        unlink(link);
+        weight_ -= node.weight;
+        node.weight = weight;
+        if (node.weight > capacity_)
+        {
+            index_.erase(it);
+            free_node(link);
+            return nullptr;
+        }
+
+        make_room(node.weight);
+        push_front(link);
+
+        return &nodes_[link].element->second;
+    }
+
+    /**
+     * @brief Removes the element with key equivalent to key, if there is any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed, either 0 or 1.
+     */
+    size_type erase(const K& key)
+    {
+        auto const it = index_.find(key);
+        if (it == index_.end())
+        { return 0; }
+
+        Link const link = it->second;
+        index_.erase(it);
+        unlink(link);
+        weight_ -= nodes_[link].weight;
+        free_node(link);
+
+        return 1;
+    }
+
+    /**
+     * @brief Removes all elements, keeping the counters.
+     */
+    void clear() noexcept
+    {
+        index_.clear();
+        nodes_.clear();
+        head_   = kNil;
+        tail_   = kNil;
+        hand_   = kNil;
+        free_   = kNil;
+        weight_ = 0;
+    }
+
+    /**
+     * @brief Calls fn with the key and the value of every element, from the
+     * most recently used one to the least recently used one with kLru, and
+     * from the newest one to the oldest one with kSieve.
+     *
+     * @param fn function called with a const K& and a const V&.
+     */
+    template<class Fn> void for_each(Fn&& fn) const
+    {
+        for (Link link = head_; link != kNil; link = nodes_[link].next)
+        {
+            const auto& [key, value] = *nodes_[link].element;
+            fn(key, value);
+        }
+    }
+
+ private:
+    friend struct MemoryFootprintTraits<BoundedCache>;
+
+    using Link = std::uint32_t;
+
+    static constexpr Link kNil = std::numeric_limits<Link>::max();
+
+    /**
+     * @brief Element of the cache with its links. prev points towards the
+     * newer elements and next towards the older ones; next also links the
+     * free nodes.
+     */
+    struct Node
+    {
+        std::optional<std::pair<K, V>> element;
+        size_type                      weight{0};
+        Link                           prev{kNil};
+        Link                           next{kNil};
+        bool                           visited{false};
+    };
+
+    using NodeAllocator =
+      typename AllocatorTraits<Allocator>::template rebind_alloc<Node>;
+    using IndexAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<std::pair<const K, Link>>;
+    using Index = UnorderedMap<K, Link, Hash, Eq, IndexAllocator>;
+
+    template<class Key> V* find_key(const Key& key)
+    {
+        auto const it = index_.find(key);
+        if (it == index_.end())
+        {
+            ++stats_.misses;
+            return nullptr;
+        }
+
+        ++stats_.hits;
+        Link const link = it->second;
+        if constexpr (Policy == Eviction::kLru)
+        {
+            if (link != head_)
+            {
+                unlink(link);
+                push_front(link);
+            }
+        }
+        else
+        { nodes_[link].visited = true; }
+
+        return &nodes_[link].element->second;
+    }
+
+    template<class Key> const V* peek_key(const Key& key) const
+    {
+        auto const it = index_.find(key);
+
+        return it == index_.end() ? nullptr
+                                  : &nodes_[it->second].element->second;
+    }
+
+    template<class Key, class... Args>
+    std::pair<V*, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        auto const [it, inserted] =
+          index_.try_emplace(std::forward<Key>(key), kNil);
+        if (! inserted)
+        {
+            if constexpr (Policy == Eviction::kLru)
+            {
+                unlink(it->second);
+                push_front(it->second);
+            }
+            else
+            { nodes_[it->second].visited = true; }
+
+            return {&nodes_[it->second].element->second, false};
+        }
+
+        Link link = kNil;
+        try
+        {
+            link = new_node();
+            nodes_[link].element.emplace(
+              std::piecewise_construct,
+              std::forward_as_tuple(it->first),
+              std::forward_as_tuple(std::forward<Args>(args)...));
+            nodes_[link].weight = weigh(nodes_[link]);
+        }
+        catch (...)
+        {
+            if (link != kNil)
+            { free_node(link); }
+            index_.erase(it);
+            throw;
+        }
+
+        if (nodes_[link].weight > capacity_)
+        {
+            free_node(link);
+            index_.erase(it);
+            return {nullptr, false};
+        }
+
+        // Erasing other keys does not move the slot of this one.
+        make_room(nodes_[link].weight);
+        it->second = link;
+        push_front(link);
+
+        return {&nodes_[link].element->second, true};
+    }
+
+    size_type weigh(const Node& node) const
+    {
+        return weigher_(std::as_const(node.element->first),
+                        std::as_const(node.element->second));
+    }
+
+    /**
+     * @brief Evicts elements until an element of the given weight fits, and
+     * adds that weight.
+     */
+    void make_room(size_type weight)
+    {
+        while (weight_ + weight > capacity_)
+        {
+            Link const victim = next_victim();
+            index_.erase(nodes_[victim].element->first);
+            unlink(victim);
+            weight_ -= nodes_[victim].weight;
+            free_node(victim);
+            ++stats_.evictions;
+        }
+        weight_ += weight;
+    }
+
+    Link next_victim() noexcept
+    {
+        if constexpr (Policy == Eviction::kLru)
+        { return tail_; }
+        else
+        {
+            Link link = hand_ == kNil ? tail_ : hand_;
+            while (nodes_[link].visited)
+            {
+                nodes_[link].visited = false;
+                link = nodes_[link].prev == kNil ? tail_ : nodes_[link].prev;
+            }
+            // Unlinking the victim moves the hand on to the next newer node.
+            hand_ = link;
+
+            return link;
+        }
+    }
+
+    void push_front(Link link) noexcept
+    {
+        Node& node = nodes_[link];
+        node.prev  = kNil;
+        node.next  = head_;
+        (head_ == kNil ? tail_ : nodes_[head_].prev) = link;
+        head_ = link;
+    }
+
+    void unlink(Link link) noexcept
+    {
+        Node& node = nodes_[link];
+        if (hand_ == link)
+        { hand_ = node.prev; }
+        (node.prev == kNil ? head_ : nodes_[node.prev].next) = node.next;
+        (node.next == kNil ? tail_ : nodes_[node.next].prev) = node.prev;
+    }
+
+    Link new_node()
+    {
+        if (free_ != kNil)
+        {
+            Link const link = free_;
+            free_           = nodes_[link].next;
+            return link;
+        }
+
+        if (nodes_.size() >= kNil)
+        { throw std::length_error("ara::core::BoundedCache is full"); }
+        nodes_.emplace_back();
+
+        return static_cast<Link>(nodes_.size() - 1);
+    }
+
+    void free_node(Link link) noexcept
+    {
+        Node& node = nodes_[link];
+        node.element.reset();
+        node.visited = false;
+        node.next    = free_;
+        free_        = link;
+    }
+
+    Vector<Node, NodeAllocator>   nodes_;
+    Index                         index_;
+    Link                          head_{kNil};
+    Link                          tail_{kNil};
+    Link                          hand_{kNil};
+    Link                          free_{kNil};
+    size_type                     capacity_{0};
+    size_type                     weight_{0};
+    CacheStats                    stats_;
+    [[no_unique_address]] Weigher weigher_;
+};
+
+/**
+ * @brief BoundedCache evicting the least recently used elements.
+ */
+template<typename K,
+         typename V,
+         typename Hash      = std::hash<K>,
+         typename Eq        = std::equal_to<K>,
+         typename Weigher   = UnitWeight,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+using LruCache =
+  BoundedCache<K, V, Eviction::kLru, Hash, Eq, Weigher, Allocator>;
+
+/**
+ * @brief BoundedCache evicting by SIEVE, with cheaper hits than LruCache.
+ */
+template<typename K,
+         typename V,
+         typename Hash      = std::hash<K>,
+         typename Eq        = std::equal_to<K>,
+         typename Weigher   = UnitWeight,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+using SieveCache =
+  BoundedCache<K, V, Eviction::kSieve, Hash, Eq, Weigher, Allocator>;
+
+/**
+ * @brief Cache supporting concurrent lookups and updates.
+ *
+ * Keys are partitioned over a power of two number of shards by the high bits
+ * of their hash, like in ConcurrentMap. Every shard is a Cache with an equal
+ * part of the capacity, guarded by its own mutex and padded to a cache line.
+ * Since a lookup updates the recency of the element, lookups of the same
+ * shard do not run in parallel.
+ *
+ * The container never hands out pointers to its elements; find() returns a
+ * copy of the value and visit() runs a function on it while the shard is
+ * locked. Functions passed to the container must not call back into it.
+ *
+ * @tparam Cache cache type of the shards, an LruCache or a SieveCache.
+ */
+template<class Cache> class ShardedCache
+{
+ public:
+    using key_type       = typename Cache::key_type;
+    using mapped_type    = typename Cache::mapped_type;
+    using size_type      = typename Cache::size_type;
+    using hasher         = typename Cache::hasher;
+    using key_equal      = typename Cache::key_equal;
+    using weigher_type   = typename Cache::weigher_type;
+    using allocator_type = typename Cache::allocator_type;
+
+    /**
+     * @brief Constructs an empty cache without allocating any elements.
+     *
+     * @param capacity maximal total weight of the elements, divided evenly
+     * over the shards and rounded up.
+     * @param shard_count number of shards, rounded up to a power of two. Zero
+     * selects DefaultShardCount().
+     * @param weigher function returning the weight of an element.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of the shards.
+     */
+    explicit ShardedCache(
+      size_type             capacity,
+      size_type             shard_count = DefaultShardCount(),
+      const weigher_type&   weigher     = weigher_type(),
+      const hasher&         hash        = hasher(),
+      const key_equal&      equal       = key_equal(),
+      const allocator_type& alloc       = allocator_type())
+      : shard_count_{std::bit_ceil(std::max<size_type>(
+        shard_count == 0 ? DefaultShardCount() : shard_count, 1))}
+      , shift_{static_cast<unsigned>(std::numeric_limits<size_type>::digits
+                                     - std::countr_zero(shard_count_))}
+      , shards_{std::make_unique<Shard[]>(shard_count_)}
+      , hash_{hash}
+    {
+        size_type const perShard = (capacity + shard_count_ - 1) / shard_count_;
+        for (size_type i = 0; i < shard_count_; ++i)
+        { shards_[i].cache = Cache(perShard, weigher, hash, equal, alloc); }
+    }
+
+    ShardedCache(const ShardedCache&) = delete;
+    ShardedCache& operator=(const ShardedCache&) = delete;
+
+    /**
+     * @brief Returns the number of shards used by default constructed caches.
+     *
+     * @return one shard per hardware thread, rounded up to a power of two. More
+     * shards would split the capacity into parts too small to keep the hot
+     * keys of each.
+     */
+    static size_type DefaultShardCount() noexcept
+    {
+        auto const hardware =
+          static_cast<size_type>(std::thread::hardware_concurrency());
+
+        return std::bit_ceil(std::max<size_type>(hardware, 1));
+    }
+
+    /**
+     * @brief Returns the number of shards.
+     *
+     * @return number of shards, a power of two.
+     */
+    size_type shard_count() const noexcept { return shard_count_; }
+
+    /**
+     * @brief Returns the number of elements in the cache.
+     *
+     * @return sum of the sizes of all shards.
+     */
+    size_type size() const
+    {
+        return sum([](const Cache& cache) { return cache.size(); });
+    }
+
+    /**
+     * @brief Returns the total weight of the elements.
+     *
+     * @return sum of the weights of all shards.
+     */
+    size_type weight() const
+    {
+        return sum([](const Cache& cache) { return cache.weight(); });
+    }
+
+    /**
+     * @brief Returns the counters of all shards added up.
+     *
+     * @return hits, misses and evictions of the cache.
+     */
+    CacheStats stats() const
+    {
+        CacheStats stats;
+        for_each_shard(
+          [&stats](const Cache& cache) { stats += cache.stats(); });
+
+        return stats;
+    }
+
+    /**
+     * @brief Erases all elements from the cache, keeping the counters.
+     */
+    void clear()
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock{shards_[i].mutex};
+            shards_[i].cache.clear();
+        }
+    }
+
+    /**
+     * @brief Returns a copy of the value of key and marks it as used, counting
+     * a hit or a miss.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return the value, or an empty optional if key is not cached.
+     */
+    std::optional<mapped_type> find(const key_type& key)
+    {
+        std::optional<mapped_type> result;
+        visit(key,
+              [&result](const mapped_type& value) { result.emplace(value); });
+
+        return result;
+    }
+
+    /**
+     * @brief Calls fn with the value of key, holding the lock of its shard.
+     * Marks the element as used and counts a hit or a miss.
+     *
+     * @param key the key of the element to find.
+     * @param fn function called with a reference to the value.
+     *
+     * @return true if the element was found and fn was called.
+     */
+    template<class Fn> bool visit(const key_type& key, Fn&& fn)
+    {
+        Shard&                      shard = shard_for(key);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        auto* const value = shard.cache.find(key);
+        if (value == nullptr)
+        { return false; }
+
+        std::forward<Fn>(fn)(*value);
+        return true;
+    }
+
+    /**
+     * @brief Checks if key is cached, without marking it as used or counting
+     * the lookup.
+     *
+     * @param key the key of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(const key_type& key) const
+    {
+        const Shard&                shard = shard_for(key);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        return shard.cache.contains(key);
+    }
+
+    /**
+     * @brief Inserts an element with key key and a value constructed from
+     * args, if key is not cached.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the value.
+     *
+     * @return true if the insertion took place.
+     */
+    template<class... Args>
+    bool try_emplace(const key_type& key, Args&&... args)
+    {
+        Shard&                      shard = shard_for(key);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        return shard.cache.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    /**
+     * @brief Inserts an element, or assigns to the value of the cached element
+     * with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return true if the element is cached, false if it is heavier than the
+     * capacity of a shard.
+     */
+    template<class M> bool insert_or_assign(const key_type& key, M&& obj)
+    {
+        Shard&                      shard = shard_for(key);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        return shard.cache.insert_or_assign(key, std::forward<M>(obj))
+               != nullptr;
+    }
+
+    /**
+     * @brief Removes the element with key equivalent to key, if there is any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed, either 0 or 1.
+     */
+    size_type erase(const key_type& key)
+    {
+        Shard&                      shard = shard_for(key);
+        std::lock_guard<std::mutex> lock{shard.mutex};
+
+        return shard.cache.erase(key);
+    }
+
+    /**
+     * @brief Calls fn with every shard in turn, holding the lock of the shard
+     * for the duration of the call.
+     *
+     * @param fn function called with a const reference to each Cache.
+     */
+    template<class Fn> void for_each_shard(Fn&& fn) const
+    {
+        for (size_type i = 0; i < shard_count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock{shards_[i].mutex};
+            fn(std::as_const(shards_[i].cache));
+        }
+    }
+
+ private:
+    friend struct MemoryFootprintTraits<ShardedCache>;
+
+    /**
+     * @brief One partition of the keys, on a cache line of its own.
+     */
+    struct alignas(64) Shard
+    {
+        mutable std::mutex mutex;
+        Cache              cache;
+    };
+
+    Shard& shard_for(const key_type& key) const
+    {
+        // shift_ is the number of hash bits that are not used, which is the
+        // full width for a single shard; split the shift to keep it defined.
+        return shards_[(detail::MixHash(hash_(key)) >> 1) >> (shift_ - 1)];
+    }
+
+    template<class Fn> size_type sum(Fn fn) const
+    {
+        size_type total = 0;
+        for_each_shard(
+          [&total, &fn](const Cache& cache) { total += fn(cache); });
+
+        return total;
+    }
+
+    size_type                    shard_count_;
+    unsigned                     shift_;
+    std::unique_ptr<Shard[]>     shards_;
+    [[no_unique_address]] hasher hash_;
+};
+
+/**
+ * @brief BoundedCache owns its pool of nodes and its index. Nodes of evicted
+ * elements count as reserved only.
+ */
+template<class K,
+         class V,
+         Eviction Policy,
+         class Hash,
+         class Eq,
+         class Weigher,
+         class Allocator>
+struct MemoryFootprintTraits<
+  BoundedCache<K, V, Policy, Hash, Eq, Weigher, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint
+    heap(const BoundedCache<K, V, Policy, Hash, Eq, Weigher, Allocator>& value)
+    {
+        using Node = typename BoundedCache<K, V, Policy, Hash, Eq, Weigher,
+                                           Allocator>::Node;
+
+        MemoryFootprint footprint = detail::buffer_footprint<Node>(
+          value.size(), value.nodes_.capacity());
+        footprint += memory_footprint(value.index_);
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            value.for_each([&footprint](const K& k, const V& v) {
+                footprint += memory_footprint(k) + memory_footprint(v);
+            });
+        }
+
+        return footprint;
+    }
+};
+
+/**
+ * @brief ShardedCache owns one allocation holding the shards plus the memory
+ * of every shard.
+ */
+template<class Cache> struct MemoryFootprintTraits<ShardedCache<Cache>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const ShardedCache<Cache>& value)
+    {
+        using Container = ShardedCache<Cache>;
+
+        std::size_t const shards =
+          value.shard_count() * sizeof(typename Container::Shard);
+
+        MemoryFootprint footprint{shards, shards, 1};
+        value.for_each_shard([&footprint](const Cache& shard) {
+            footprint += memory_footprint(shard);
+        });
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_LRU_CACHE_H_
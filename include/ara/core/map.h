@@ -9,7 +9,14 @@
 #define ARA_CORE_MAP_H_
 
 #include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/tree_container.h"
+#include "ara/core/utility.h"
+#include <algorithm>
+#include <compare>
+#include <iterator>
 #include <map>
+#include <utility>
 
 namespace ara::core {
 /**
@@ -27,31 +34,19 @@ template<typename K,
          typename V,
          typename C         = std::less<K>,
          typename Allocator = Allocator<std::pair<const K, V>>>
-class Map
+class Map : public detail::TreeContainer<std::map<K, V, C, Allocator>>
 {
+    using Base = detail::TreeContainer<std::map<K, V, C, Allocator>>;
+
  public:
-    // Draft only
-    // todo: write our own iterators
-    using iterator = typename std::map<K, V, C, Allocator>::iterator;
-    using const_iterator =
-      typename std::map<K, V, C, Allocator>::const_iterator;
-    using reverse_iterator =
-      typename std::map<K, V, C, Allocator>::reverse_iterator;
-    using const_reverse_iterator =
-      typename std::map<K, V, C, Allocator>::const_reverse_iterator;
-    using value_compare = typename std::map<K, V, C, Allocator>::value_compare;
-
-    typedef K                                                  key_type;
-    typedef V                                                  mapped_type;
-    typedef std::pair<const K, V>                              value_type;
-    typedef std::size_t                                        size_type;
-    typedef std::ptrdiff_t                                     difference_type;
-    typedef C                                                  key_compare;
-    typedef Allocator                                          allocator_type;
-    typedef value_type&                                        reference;
-    typedef const value_type&                                  const_reference;
-    typedef typename AllocatorTraits<Allocator>::pointer       pointer;
-    typedef typename AllocatorTraits<Allocator>::const_pointer const_pointer;
+    using typename Base::const_iterator;
+    using typename Base::iterator;
+    using typename Base::node_type;
+    using typename Base::size_type;
+    using typename Base::value_type;
+    using insert_return_type =
+      typename std::map<K, V, C, Allocator>::insert_return_type;
+    using mapped_type = V;
 
     /**
      * @brief Constructs an empty container.
@@ -68,9 +63,8 @@ class Map
      * container.
      */
     explicit Map(const C& comp, const Allocator& alloc = Allocator())
-    {
-        m_ = std::map<K, V, C, Allocator>(comp, alloc);
-    }
+      : Base(std::map<K, V, C, Allocator>(comp, alloc))
+    {}
 
     /**
      * @brief Constructs an empty container.
@@ -79,9 +73,8 @@ class Map
      * container.
      */
     explicit Map(const Allocator& alloc)
-    {
-        m_ = std::map<K, V, C, Allocator>(alloc);
-    }
+      : Base(std::map<K, V, C, Allocator>(alloc))
+    {}
 
     /**
      * @brief Copy constructor. Constructs the container with the copy of the
@@ -90,7 +83,8 @@ class Map
      * @param other another container to be used as source to initialize the
      * elements of the container with.
      */
-    Map(const Map& other) { m_ = std::map<K, V, C, Allocator>(other.m_); }
+    Map(const Map& other) : Base(std::map<K, V, C, Allocator>(other.tree_))
+    {}
 
     /**
      * @brief Copy constructor. Constructs the container with the copy of the
@@ -102,9 +96,8 @@ class Map
      * container.
      */
     Map(const Map& other, const Allocator& alloc)
-    {
-        m_ = std::map<K, V, C, Allocator>(other.m_, alloc);
-    }
+      : Base(std::map<K, V, C, Allocator>(other.tree_, alloc))
+    {}
 
     /**
      * @brief Move constructor. Constructs the container with the contents of
@@ -114,9 +107,8 @@ class Map
      * elements of the container with.
      */
     Map(const Map&& other)
-    {
-        m_ = std::map<K, V, C, Allocator>(std::move(other.m_));
-    }
+      : Base(std::map<K, V, C, Allocator>(std::move(other.tree_)))
+    {}
 
     /**
      * @brief Move constructor. Constructs the container with the contents of
@@ -128,10 +120,69 @@ class Map
      * container.
      */
     Map(const Map&& other, const Allocator& alloc)
+      : Base(std::map<K, V, C, Allocator>(std::move(other.tree_), alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    Map(InputIt          first,
+        InputIt          last,
+        const C&         comp  = C(),
+        const Allocator& alloc = Allocator())
+      : Base(std::map<K, V, C, Allocator>(first, last, comp, alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted by key and free of duplicates, in linear
+     * time.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    Map(sorted_unique_t,
+        InputIt          first,
+        InputIt          last,
+        const C&         comp  = C(),
+        const Allocator& alloc = Allocator())
+      : Map(comp, alloc)
     {
-        m_ = std::map<K, V, C, Allocator>(std::move(other.m_), alloc);
+        this->append_sorted(first, last);
     }
 
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init, which is sorted by key and free of duplicates, in linear time.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    Map(sorted_unique_t                   tag,
+        std::initializer_list<value_type> init,
+        const C&                          comp  = C(),
+        const Allocator&                  alloc = Allocator())
+      : Map(tag, init.begin(), init.end(), comp, alloc)
+    {}
+
     /**
      * @brief Constructs the container with the contents of the initializer list
      * init.
@@ -146,9 +197,8 @@ class Map
     Map(std::initializer_list<value_type> init,
         const C&                          comp  = C(),
         const Allocator&                  alloc = Allocator())
-    {
-        m_ = std::map<K, V, C, Allocator>(init, comp, alloc);
-    }
+      : Base(std::map<K, V, C, Allocator>(init, comp, alloc))
+    {}
 
     /**
      * @brief Replaces the contents of the container.
@@ -159,7 +209,7 @@ class Map
      */
     Map& operator=(const Map& other)
     {
-        m_ = other.m_;
+        this->tree_ = other.tree_;
 
         return *this;
     }
@@ -173,7 +223,7 @@ class Map
      */
     Map& operator=(std::initializer_list<value_type> ilist)
     {
-        m_ = ilist;
+        this->tree_ = ilist;
 
         return *this;
     }
@@ -189,7 +239,7 @@ class Map
     friend bool operator==(const Map<K, V, C, Allocator>& lhs,
                            const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ == rhs.m_;
+        return lhs.tree_ == rhs.tree_;
     }
 
     /**
@@ -203,7 +253,7 @@ class Map
     friend bool operator!=(const Map<K, V, C, Allocator>& lhs,
                            const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ != rhs.m_;
+        return lhs.tree_ != rhs.tree_;
     }
 
     /**
@@ -218,7 +268,7 @@ class Map
     friend bool operator<(const Map<K, V, C, Allocator>& lhs,
                           const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ < rhs.m_;
+        return lhs.tree_ < rhs.tree_;
     }
 
     /**
@@ -233,7 +283,7 @@ class Map
     friend bool operator<=(const Map<K, V, C, Allocator>& lhs,
                            const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ <= rhs.m_;
+        return lhs.tree_ <= rhs.tree_;
     }
 
     /**
@@ -248,7 +298,7 @@ class Map
     friend bool operator>(const Map<K, V, C, Allocator>& lhs,
                           const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ > rhs.m_;
+        return lhs.tree_ > rhs.tree_;
     }
 
     /**
@@ -263,16 +313,9 @@ class Map
     friend bool operator>=(const Map<K, V, C, Allocator>& lhs,
                            const Map<K, V, C, Allocator>& rhs)
     {
-        return lhs.m_ >= rhs.m_;
+        return lhs.tree_ >= rhs.tree_;
     }
 
-    /**
-     * @brief Returns the allocator associated with the container.
-     *
-     * @return the associated allocator.
-     */
-    allocator_type get_allocator() const noexcept { return m_.get_allocator(); }
-
     /**
      * @brief Returns a reference to the mapped value of the element with key
      * equivalent to key.
@@ -281,7 +324,7 @@ class Map
      *
      * @return reference to the mapped value of the requested element.
      */
-    mapped_type& at(const K& key) { return m_.at(key); }
+    mapped_type& at(const K& key) { return this->tree_.at(key); }
 
     /**
      * @brief Returns a const reference to the mapped value of the element with
@@ -291,7 +334,7 @@ class Map
      *
      * @return reference to the mapped value of the requested element.
      */
-    const mapped_type& at(const K& key) const { return m_.at(key); }
+    const mapped_type& at(const K& key) const { return this->tree_.at(key); }
 
     /**
      * @brief Returns a reference to the value.
@@ -301,7 +344,7 @@ class Map
      * @return reference to the mapped value of the new element if no element
      * with key key existed.
      */
-    mapped_type& operator[](const K& key) { return m_[key]; }
+    mapped_type& operator[](const K& key) { return this->tree_[key]; }
 
     /**
      * @brief Returns a reference to the value.
@@ -311,398 +354,435 @@ class Map
      * @return reference to the mapped value of the new element if no element
      * with key key existed.
      */
-    mapped_type& operator[](const K&& key) { return m_[key]; }
-
-    /**
-     * @brief Returns an iterator to the beginning.
-     *
-     * @return iterator to the first element.
-     */
-    iterator begin() noexcept { return m_.begin(); }
-
-    /**
-     * @brief Returns an iterator to the beginning.
-     *
-     * @return iterator to the first element.
-     */
-    const_iterator begin() const noexcept { return m_.begin(); }
-
-    /**
-     * @brief Returns an iterator to the beginning.
-     *
-     * @return iterator to the first element.
-     */
-    const_iterator cbegin() const noexcept { return m_.cbegin(); }
-
-    /**
-     * @brief Returns an iterator to the end.
-     *
-     * @return iterator to the last element.
-     */
-    iterator end() noexcept { return m_.end(); }
-
-    /**
-     * @brief Returns an iterator to the end.
-     *
-     * @return iterator to the last element.
-     */
-    const_iterator end() const noexcept { return m_.end(); }
-
-    /**
-     * @brief Returns an iterator to the end.
-     *
-     * @return iterator to the last element.
-     */
-    const_iterator cend() const noexcept { return m_.cend(); }
-
-    /**
-     * @brief Returns an reverse iterator to the beginning.
-     *
-     * @return reverse iterator to the first element.
-     */
-    reverse_iterator rbegin() noexcept { return m_.rbegin(); }
+    mapped_type& operator[](const K&& key) { return this->tree_[key]; }
 
-    /**
-     * @brief Returns an reverse iterator to the beginning.
-     *
-     * @return reverse iterator to the first element.
-     */
-    const_reverse_iterator rbegin() const noexcept { return m_.rbegin(); }
+    using Base::insert;
 
     /**
-     * @brief Returns an reverse iterator to the beginning.
+     * @brief Inserts element(s) into the container
      *
-     * @return reverse iterator to the first element.
-     */
-    const_reverse_iterator crbegin() const noexcept { return m_.crbegin(); }
-
-    /**
-     * @brief Returns an reverse iterator to the end.
+     * @param value element value to insert.
      *
-     * @return reverse iterator to the last element.
-     */
-    reverse_iterator rend() noexcept { return m_.rend(); }
-
-    /**
-     * @brief Returns an reverse iterator to the end.
+     * @tparam P value type.
      *
-     * @return reverse iterator to the last element.
+     * @return a pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether the
+     * insertion took place.
      */
-    const_reverse_iterator rend() const noexcept { return m_.rend(); }
+    template<class P> std::pair<iterator, bool> insert(const P&& value)
+    {
+        return this->tree_.insert(value);
+    }
 
     /**
-     * @brief Returns an reverse iterator to the end.
+     * @brief Inserts value in the position as close as possible to hint.
      *
-     * @return reverse iterator to the last element.
-     */
-    const_reverse_iterator crend() const noexcept { return m_.crend(); }
-
-    /**
-     * @brief Checks whether the container is empty.
+     * @param hint iterator to the position before which the new element will be
+     * inserted.
+     * @param value element value to insert.
      *
-     * @return true if the container is empty, false otherwise.
-     */
-    bool empty() const noexcept { return m_.empty(); }
-
-    /**
-     * @brief Returns the number of elements.
+     * @tparam P value_type.
      *
-     * @return the number of elements in the container.
+     * @return an iterator to the inserted element, or to the element that
+     * prevented the insertion.
      */
-    size_type size() const noexcept { return m_.size(); }
+    template<class P> iterator insert(const_iterator hint, P&& value)
+    {
+        return this->tree_.insert(hint, std::forward<P>(value));
+    }
 
     /**
-     * @brief Returns the maximum possible number of elements.
+     * @brief Inserts elements from range [first, last), which is sorted by key
+     * and free of duplicates.
      *
-     * @brief maximum number of elements.
-     */
-    size_type max_size() const noexcept { return m_.max_size(); }
-
-    /**
-     * @brief Erases all elements from the container.
+     * Every element is inserted right behind the previous one, which costs
+     * amortized constant time instead of a search from the root. Appending to
+     * an empty map, or behind its last element, is therefore linear overall.
      *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
      */
-    void clear() noexcept { m_.clear(); }
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        this->append_sorted(first, last);
+    }
 
     /**
-     * @brief Inserts element(s) into the container
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * the element nor the node is constructed otherwise, and args are not
+     * moved from.
      *
-     * @param value element value to insert.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
      *
      * @return a pair consisting of an iterator to the inserted element (or to
      * the element that prevented the insertion) and a bool denoting whether the
      * insertion took place.
      */
-    std::pair<iterator, bool> insert(const value_type& value)
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
     {
-        return m_.insert(value);
+        return this->tree_.try_emplace(key, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Inserts element(s) into the container
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from otherwise.
      *
-     * @param value element value to insert.
-     *
-     * @tparam P value type.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
      *
      * @return a pair consisting of an iterator to the inserted element (or to
      * the element that prevented the insertion) and a bool denoting whether the
      * insertion took place.
      */
-    template<class P> std::pair<iterator, bool> insert(const P&& value)
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
     {
-        return m_.insert(value);
+        return this->tree_.try_emplace(
+          std::move(key), std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Inserts value in the position as close as possible to hint.
+     * @brief Inserts a new element with key key as close as possible to the
+     * position just prior to hint, if there is no element with the key in the
+     * container.
      *
-     * @param hint iterator to the position before which the new element will be
-     * inserted.
-     * @param value element value to insert.
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
      *
-     * @return an iterator to the inserted element, or to the element that
+     * @return iterator to the inserted element, or to the element that
      * prevented the insertion.
      */
-    iterator insert(const_iterator hint, const value_type& value)
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, const K& key, Args&&... args)
     {
-        return m_.insert(hint, value);
+        return this->tree_.try_emplace(hint, key, std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Inserts value in the position as close as possible to hint.
-     *
-     * @param hint iterator to the position before which the new element will be
-     * inserted.
-     * @param value element value to insert.
+     * @brief Inserts a new element with key key as close as possible to the
+     * position just prior to hint, if there is no element with the key in the
+     * container.
      *
-     * @tparam P value_type.
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
      *
-     * @return an iterator to the inserted element, or to the element that
+     * @return iterator to the inserted element, or to the element that
      * prevented the insertion.
      */
-    template<class P> iterator insert(const_iterator hint, P&& value)
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
     {
-        m_.insert(hint, value);
+        return this->tree_.try_emplace(
+          hint, std::move(key), std::forward<Args>(args)...);
     }
 
     /**
-     * @brief Inserts elements from range [first, last).
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element if there is none.
      *
-     * @param first range of elements to insert.
-     * @param last range of elements to insert.
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
      *
-     * @tparam InputIt iterator type.
+     * @return a pair consisting of an iterator to the element and a bool that
+     * is true if the insertion took place and false if the assignment took
+     * place.
      */
-    template<class InputIt> void insert(InputIt first, InputIt last)
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
     {
-        m_.insert(first, last);
+        return this->tree_.insert_or_assign(key, std::forward<M>(obj));
     }
 
     /**
-     * @brief Inserts elements from initializer list ilist.
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element if there is none.
+     *
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
      *
-     * @param ilist initializer list to insert the values from.
+     * @return a pair consisting of an iterator to the element and a bool that
+     * is true if the insertion took place and false if the assignment took
+     * place.
      */
-    void insert(std::initializer_list<value_type> ilist) { m_.insert(ilist); }
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        return this->tree_.insert_or_assign(
+          std::move(key), std::forward<M>(obj));
+    }
 
     /**
-     * @brief Inserts a new element into the container constructed in-place with
-     * the given args if there is no element with the key in the container.
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element as close as possible to the position just prior
+     * to hint.
      *
-     * @param args arguments to forward to the constructor of the element.
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
      *
-     * @tparam Args arguments type.
-     *
-     * @return a pair consisting of an iterator to the inserted element, or the
-     * already-existing element if no insertion happened, and a bool denoting
-     * whether the insertion took place (true if insertion happened, false if it
-     * did not).
+     * @return iterator to the element that was inserted or assigned to.
      */
-    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const K& key, M&& obj)
     {
-        return m_.emplace(std::forward<Args>(args)...);
+        return this->tree_.insert_or_assign(hint, key, std::forward<M>(obj));
     }
 
     /**
-     * @brief Inserts a new element to the container as close as possible to the
-     * position just before hint.
+     * @brief Assigns obj to the mapped value of the element with key key, or
+     * inserts a new element as close as possible to the position just prior
+     * to hint.
      *
-     * @param hint iterator to the position before which the new element will be
-     * inserted.
-     * @param args arguments to forward to the constructor of the element.
-     *
-     * @tparam Args arguments type.
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to assign or insert.
      *
-     * @return an iterator to the newly inserted element.
+     * @return iterator to the element that was inserted or assigned to.
      */
-    template<class... Args> iterator
-    emplace_hint(const_iterator hint, Args&&... args)
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
     {
-        return m_.emplace_hint(hint, std::forward<Args>(args)...);
+        return this->tree_.insert_or_assign(
+          hint, std::move(key), std::forward<M>(obj));
     }
 
     /**
-     * @brief Removes specified elements from the container.
-     *
-     * @param pos iterator to the element to remove.
+     * @brief Exchanges the contents of the container with those of other.
      *
-     * @return iterator following the last removed element.
+     * @param other container to exchange the contents with.
      */
-    iterator erase(const_iterator pos) { return m_.erase(pos); }
+    void swap(Map& other) { this->tree_.swap(other.tree_); }
 
     /**
-     * @brief Removes specified elements from the container.
-     *
-     * @param first range of elements to remove.
-     * @param last range of elements to remove.
+     * @brief Moves the nodes of all elements of source whose keys are not in
+     * this container yet into this container. Elements are neither copied
+     * nor reallocated; elements with a duplicate key remain in source.
      *
-     * @return iterator following the last removed element.
+     * @param source map to transfer the nodes from.
      */
-    iterator erase(const_iterator first, const_iterator last)
+    template<class C2> void merge(Map<K, V, C2, Allocator>& source)
     {
-        return m_.erase(first, last);
+        this->tree_.merge(source.tree_);
     }
 
     /**
-     * @brief Removes specified elements from the container.
+     * @brief Moves the nodes of all elements of source whose keys are not in
+     * this container yet into this container.
      *
-     * @param key key value of the elements to remove.
-     *
-     * @return number of elements removed.
+     * @param source map to transfer the nodes from.
      */
-    size_type erase(const key_type& key) { return m_.erase(key); }
+    template<class C2> void merge(Map<K, V, C2, Allocator>&& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
+
+ private:
+    template<class, class, class, class> friend class Map;
+};
+
+/**
+ * @brief Exchanges content between maps.
+ *
+ * @param lhs first argument of swap invocation.
+ * @param rhs second argument of swap invocation.
+ *
+ * @tparam K vey type.
+ * @tparam V value type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ *
+ * @req {SWS_CORE_01496}
+ */
+template<class K, class V, class C, class Allocator> void
+swap(Map<K, V, C, Allocator>& lhs, Map<K, V, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief Sorted associative container that contains key-value pairs, where
+ * several keys may be equivalent. Elements with equivalent keys are kept in
+ * the order they were inserted.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class MultiMap
+  : public detail::TreeContainer<std::multimap<K, V, C, Allocator>>
+{
+    using Base = detail::TreeContainer<std::multimap<K, V, C, Allocator>>;
+
+ public:
+    using typename Base::value_type;
+    using mapped_type = V;
 
     /**
-     * @brief Exchanges the contents of the container with those of other.
-     *
-     * @param other container to exchange the contents with.
+     * @brief Constructs an empty container.
      */
-    void swap(Map& other) { m_.swap(other.m_); }
+    MultiMap() = default;
 
     /**
-     * @brief Returns the number of elements matching specific key.
-     *
-     * @param key key value of the elements to count.
+     * @brief Constructs an empty container.
      *
-     * @return number of elements with key that compares equivalent to key or x,
-     * which is either 1 or 0 for (1).
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
      */
-    size_type count(const K& key) const { return m_.count(key); }
+    explicit MultiMap(const C& comp, const Allocator& alloc = Allocator())
+      : Base(std::multimap<K, V, C, Allocator>(comp, alloc))
+    {}
 
     /**
-     * @brief Finds an element with key that compares equivalent to the value x.
-     *
-     * @param key key value of the element to search for.
+     * @brief Constructs an empty container.
      *
-     * @return iterator to an element with key equivalent to key.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
      */
-    iterator find(const K& key) { return m_.find(key); }
+    explicit MultiMap(const Allocator& alloc)
+      : Base(std::multimap<K, V, C, Allocator>(alloc))
+    {}
 
     /**
-     * @brief Finds an element with key that compares equivalent to the value x.
-     *
-     * @param key key value of the element to search for.
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
      *
-     * @return iterator to an element with key equivalent to key.
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
      */
-    const_iterator find(const K& key) const { return m_.find(key); }
+    template<std::input_iterator InputIt>
+    MultiMap(InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : Base(std::multimap<K, V, C, Allocator>(first, last, comp, alloc))
+    {}
 
     /**
-     * @brief Returns a range containing all elements with the given key in the
-     * container.
-     *
-     * @param key key value to compare the elements to.
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted by key, in linear time.
      *
-     * @return std::pair containing a pair of iterators defining the wanted
-     * range: the first pointing to the first element that is not less than key
-     * and the second pointing to the first element greater than key.
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
      */
-    std::pair<iterator, iterator> equal_range(const K& key)
+    template<std::input_iterator InputIt>
+    MultiMap(sorted_equivalent_t,
+             InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : MultiMap(comp, alloc)
     {
-        return m_.equal_range(key);
+        this->append_sorted(first, last);
     }
 
     /**
-     * @brief Returns a range containing all elements with the given key in the
-     * container.
+     * @brief Constructs the container with the contents of the initializer
+     * list init.
      *
-     * @param key key value to compare the elements to.
+     * @param init initializer list to initialize the elements of the
+     * container with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    MultiMap(std::initializer_list<value_type> init,
+             const C&                          comp  = C(),
+             const Allocator&                  alloc = Allocator())
+      : MultiMap(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Compares the contents of two maps.
      *
-     * @return std::pair containing a pair of iterators defining the wanted
-     * range: the first pointing to the first element that is not less than key
-     * and the second pointing to the first element greater than key.
+     * @return true if the contents of the maps are equal, false otherwise.
      */
-    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    friend bool operator==(const MultiMap& lhs, const MultiMap& rhs)
     {
-        return m_.equal_range(key);
+        return lhs.tree_ == rhs.tree_;
     }
 
     /**
-     * @brief Returns an iterator pointing to the first element that is not less
-     * than (i.e. greater or equal to) key.
-     *
-     * @param key key value to compare the elements to.
+     * @brief Compares the contents of two maps lexicographically.
      *
-     * @return iterator pointing to the first element that is not less than key.
+     * @return ordering of the contents of lhs relative to rhs.
      */
-    iterator lower_bound(const K& key) { return m_.lower_bound(key); }
+    friend auto operator<=>(const MultiMap& lhs, const MultiMap& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    using Base::insert;
 
     /**
-     * @brief Returns an iterator pointing to the first element that is not less
-     * than (i.e. greater or equal to) key.
-     *
-     * @param key key value to compare the elements to.
+     * @brief Inserts the elements of the range [first, last), which is sorted
+     * by key. Every element is inserted right behind the previous one, so
+     * appending to an empty map, or behind its last element, is linear.
      *
-     * @return iterator pointing to the first element that is not less than key.
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
      */
-    const_iterator lower_bound(const K& key) const
+    template<std::input_iterator InputIt>
+    void insert(sorted_equivalent_t, InputIt first, InputIt last)
     {
-        return m_.lower_bound(key);
+        this->append_sorted(first, last);
     }
 
     /**
-     * @brief Returns an iterator pointing to the first element that is greater
-     * than key.
-     *
-     * @param key key value to compare the elements to.
+     * @brief Exchanges the contents of the container with those of other.
      *
-     * @return iterator pointing to the first element that is greater than key.
+     * @param other container to exchange the contents with.
      */
-    iterator upper_bound(const K& key) { return m_.upper_bound(key); }
+    void swap(MultiMap& other) noexcept { this->tree_.swap(other.tree_); }
 
     /**
-     * @brief Returns an iterator pointing to the first element that is greater
-     * than key.
-     *
-     * @param key key value to compare the elements to.
+     * @brief Moves the nodes of all elements of source into this container,
+     * without copying or reallocating.
      *
-     * @return iterator pointing to the first element that is greater than key.
+     * @param source map to transfer the nodes from.
      */
-    const_iterator upper_bound(const K& key) const
+    template<class C2> void merge(MultiMap<K, V, C2, Allocator>& source)
     {
-        return m_.upper_bound(key);
+        this->tree_.merge(source.tree_);
     }
 
     /**
-     * @brief Returns the function object that compares the keys, which is a
-     * copy of this container's constructor argument comp.
-     *
-     * @return the key comparison function object.
-     */
-    key_compare key_comp() const { return m_.key_comp(); }
-
-    /**
-     * @brief Returns a function object that compares objects of type
-     * std::map::value_type (key-value pairs) by using key_comp to compare the
-     * first components of the pairs.
-     *
-     * @return the value comparison function object.
+     * @copydoc merge(MultiMap<K, V, C2, Allocator>&)
      */
-    value_compare value_comp() const { return m_.value_comp(); }
+    template<class C2> void merge(MultiMap<K, V, C2, Allocator>&& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
 
  private:
-    std::map<K, V, C, Allocator> m_;
+    template<class, class, class, class> friend class MultiMap;
 };
 
 /**
@@ -710,16 +790,10 @@ class Map
  *
  * @param lhs first argument of swap invocation.
  * @param rhs second argument of swap invocation.
- *
- * @tparam K vey type.
- * @tparam V value type.
- * @tparam C key_compare function.
- * @tparam Allocator allocator type.
- *
- * @req {SWS_CORE_01496}
  */
-template<class K, class V, class C, class Allocator> void
-swap(Map<K, V, C, Allocator>& lhs, Map<K, V, C, Allocator>& rhs) noexcept
+template<class K, class V, class C, class Allocator>
+void swap(MultiMap<K, V, C, Allocator>& lhs,
+          MultiMap<K, V, C, Allocator>& rhs) noexcept
 {
     lhs.swap(rhs);
 }
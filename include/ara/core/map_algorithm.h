@@ -0,0 +1,269 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_MAP_ALGORITHM_H_
+#define ARA_CORE_MAP_ALGORITHM_H_
+
+#include "ara/core/map.h"
+#include "ara/core/vector.h"
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+/**
+ * Merge-based algorithms over an ara::core::Map and a second sequence of
+ * key-value pairs sorted by the key_comp() of the map and free of duplicate
+ * keys, such as another Map or a sorted Vector of pairs. Instead of looking
+ * up every key of one side in the other, which costs O(n log m) random
+ * accesses, they walk both sides once in key order in O(n + m).
+ */
+namespace ara::core {
+
+/**
+ * @brief Differences that turn one map into another, as computed by diff()
+ * and applied by apply_diff(). All sequences are sorted by key.
+ */
+template<class K, class V> struct MapDiff
+{
+    /** elements whose keys are only in the target */
+    Vector<std::pair<K, V>> added;
+    /** keys that are only in the source */
+    Vector<K> removed;
+    /** elements of the target whose keys are in both, with different values */
+    Vector<std::pair<K, V>> changed;
+
+    /**
+     * @brief Checks if the source and the target are equal.
+     *
+     * @return true if there are no differences.
+     */
+    bool empty() const noexcept
+    {
+        return added.empty() && removed.empty() && changed.empty();
+    }
+
+    /**
+     * @brief Returns the number of differences.
+     *
+     * @return number of added, removed and changed elements.
+     */
+    std::size_t size() const noexcept
+    {
+        return added.size() + removed.size() + changed.size();
+    }
+};
+
+/**
+ * @brief Walks lhs and rhs in a single pass in key order and reports every
+ * key to one of three functions, depending on the side it is found on.
+ *
+ * @param lhs map to walk.
+ * @param rhs key-value pairs sorted by lhs.key_comp() with unique keys.
+ * @param onlyLhs called with each element of lhs whose key is not in rhs.
+ * @param both called with the elements of lhs and rhs with equivalent keys.
+ * @param onlyRhs called with each element of rhs whose key is not in lhs.
+ *
+ * @tparam Range type of rhs, with begin() and end().
+ */
+template<class K,
+         class V,
+         class C,
+         class Allocator,
+         class Range,
+         class OnlyLhs,
+         class Both,
+         class OnlyRhs>
+void merge_join(const Map<K, V, C, Allocator>& lhs,
+                const Range&                   rhs,
+                OnlyLhs                        onlyLhs,
+                Both                           both,
+                OnlyRhs                        onlyRhs)
+{
+    auto const comp = lhs.key_comp();
+    auto       l    = lhs.begin();
+    auto       r    = std::begin(rhs);
+    while (l != lhs.end() && r != std::end(rhs))
+    {
+        const auto& right = *r;
+        if (comp(l->first, right.first))
+        { onlyLhs(*l++); }
+        else if (comp(right.first, l->first))
+        {
+            onlyRhs(right);
+            ++r;
+        }
+        else
+        {
+            both(*l++, right);
+            ++r;
+        }
+    }
+    for (; l != lhs.end(); ++l) { onlyLhs(*l); }
+    for (; r != std::end(rhs); ++r) { onlyRhs(*r); }
+}
+
+/**
+ * @brief Computes the differences that turn from into to.
+ *
+ * @param from source map.
+ * @param to target key-value pairs sorted by from.key_comp() with unique keys.
+ * @param equal compares the values of elements with equivalent keys.
+ *
+ * @return the elements added, the keys removed and the elements changed.
+ */
+template<class K,
+         class V,
+         class C,
+         class Allocator,
+         class Range,
+         class Equal = std::equal_to<>>
+MapDiff<K, V> diff(const Map<K, V, C, Allocator>& from,
+                   const Range&                   to,
+                   Equal                          equal = Equal())
+{
+    MapDiff<K, V> result;
+    merge_join(
+      from,
+      to,
+      [&result](const auto& lhs) { result.removed.push_back(lhs.first); },
+      [&result, &equal](const auto& lhs, const auto& rhs) {
+          if (! equal(lhs.second, rhs.second))
+          { result.changed.emplace_back(rhs.first, rhs.second); }
+      },
+      [&result](const auto& rhs) {
+          result.added.emplace_back(rhs.first, rhs.second);
+      });
+
+    return result;
+}
+
+/**
+ * @brief Returns the elements of lhs whose keys are also in rhs.
+ *
+ * @param lhs map to take the elements from.
+ * @param rhs key-value pairs sorted by lhs.key_comp() with unique keys.
+ *
+ * @return map of the common keys with the values of lhs.
+ */
+template<class K, class V, class C, class Allocator, class Range>
+Map<K, V, C, Allocator> intersect(const Map<K, V, C, Allocator>& lhs,
+                                  const Range&                   rhs)
+{
+    Map<K, V, C, Allocator> result(lhs.key_comp(), lhs.get_allocator());
+    merge_join(
+      lhs,
+      rhs,
+      [](const auto&) {},
+      [&result](const auto& element, const auto&) {
+          result.emplace_hint(result.end(), element);
+      },
+      [](const auto&) {});
+
+    return result;
+}
+
+/**
+ * @brief Returns the elements of both lhs and rhs. The value of a key that
+ * is in both is combined from the two values.
+ *
+ * @param lhs first map.
+ * @param rhs key-value pairs sorted by lhs.key_comp() with unique keys.
+ * @param fn called as fn(lhs value, rhs value) for keys in both, returns the
+ * value of the key in the result.
+ *
+ * @return map of all keys.
+ */
+template<class K, class V, class C, class Allocator, class Range, class Fn>
+Map<K, V, C, Allocator> union_with(const Map<K, V, C, Allocator>& lhs,
+                                   const Range&                   rhs,
+                                   Fn                             fn)
+{
+    Map<K, V, C, Allocator> result(lhs.key_comp(), lhs.get_allocator());
+    merge_join(
+      lhs,
+      rhs,
+      [&result](const auto& element) {
+          result.emplace_hint(result.end(), element);
+      },
+      [&result, &fn](const auto& left, const auto& right) {
+          result.emplace_hint(
+            result.end(), left.first, fn(left.second, right.second));
+      },
+      [&result](const auto& element) {
+          result.emplace_hint(result.end(), element.first, element.second);
+      });
+
+    return result;
+}
+
+/**
+ * @brief Applies the differences computed by diff() to map: inserts or
+ * assigns the added and changed elements and erases the removed keys.
+ *
+ * The differences are applied in key order. If they touch a large part of
+ * the map, a single walk over the map finds their positions; otherwise each
+ * position is looked up, which is cheaper than visiting every element.
+ *
+ * @param map map to modify.
+ * @param diff differences sorted by map.key_comp().
+ */
+template<class K, class V, class C, class Allocator>
+void apply_diff(Map<K, V, C, Allocator>& map, const MapDiff<K, V>& diff)
+{
+    auto const comp = map.key_comp();
+    bool const walk =
+      diff.size() * static_cast<std::size_t>(std::bit_width(map.size()))
+      >= map.size();
+
+    auto       it   = map.begin();
+    auto const seek = [&](const K& key) {
+        if (walk)
+        {
+            while (it != map.end() && comp(it->first, key)) { ++it; }
+        }
+        else
+        { it = map.lower_bound(key); }
+
+        return it != map.end() && ! comp(key, it->first);
+    };
+
+    auto added   = diff.added.begin();
+    auto removed = diff.removed.begin();
+    auto changed = diff.changed.begin();
+    while (added != diff.added.end() || removed != diff.removed.end()
+           || changed != diff.changed.end())
+    {
+        // Added and changed elements are both assigned; take the smaller.
+        bool const fromAdded =
+          added != diff.added.end()
+          && (changed == diff.changed.end()
+              || comp(added->first, changed->first));
+        auto const upsert = fromAdded ? added : changed;
+        bool const hasUpsert = fromAdded || changed != diff.changed.end();
+
+        if (removed != diff.removed.end()
+            && (! hasUpsert || comp(*removed, upsert->first)))
+        {
+            if (seek(*removed))
+            { it = map.erase(it); }
+            ++removed;
+            continue;
+        }
+
+        if (seek(upsert->first))
+        { (it++)->second = upsert->second; }
+        else
+        { map.emplace_hint(it, upsert->first, upsert->second); }
+        ++(fromAdded ? added : changed);
+    }
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_MAP_ALGORITHM_H_
@@ -0,0 +1,525 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_MAP_IMAGE_H_
+#define ARA_CORE_MAP_IMAGE_H_
+
+#include "ara/core/flat_map.h"
+#include "ara/core/functional.h"
+#include "ara/core/span.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Version of the image layout written by MakeMapImage(). MapImage
+ * only accepts images of this version.
+ */
+inline constexpr std::uint32_t kMapImageVersion = 1;
+
+/**
+ * @brief Header at the start of every map image.
+ *
+ * All offsets are relative to the start of the image, so the image can be
+ * mapped at any address. The keys and the mapped values follow as two
+ * arrays sorted by key, like the containers of a FlatMap.
+ */
+struct MapImageHeader
+{
+    /** kMagic, which also tells apart images of the other byte order */
+    std::uint64_t magic;
+    /** kMapImageVersion of the writer */
+    std::uint32_t version;
+    /** size and alignment of the key and value types */
+    std::uint32_t key_size;
+    std::uint32_t key_align;
+    std::uint32_t value_size;
+    std::uint32_t value_align;
+    std::uint32_t reserved;
+    /** number of elements */
+    std::uint64_t size;
+    /** offsets of the key and value arrays */
+    std::uint64_t keys_offset;
+    std::uint64_t values_offset;
+    /** size of the whole image in bytes */
+    std::uint64_t image_size;
+    /** ImageChecksum() of the image, taken with this field set to zero */
+    std::uint64_t checksum;
+
+    /** the bytes "AMAPIMG1" as written on a little-endian machine */
+    static constexpr std::uint64_t kMagic = 0x31474D4950414D41ull;
+};
+
+/**
+ * @brief How much of an image MapImage verifies when it is opened.
+ */
+enum class ImageCheck
+{
+    /** header and checksum, which reads the whole image once */
+    kChecksum,
+    /** header only, in O(1); for images whose integrity is ensured otherwise */
+    kHeader
+};
+
+namespace detail {
+/**
+ * @brief 64 bit checksum of size bytes, hashing four interleaved lanes of
+ * eight byte words in the style of xxHash64, so it runs at memory speed.
+ */
+inline std::uint64_t
+ImageChecksum(const Byte* data, std::size_t size, std::uint64_t seed = 0)
+{
+    constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4Full;
+
+    auto const word = [data](std::size_t offset) {
+        std::uint64_t value;
+        std::memcpy(&value, data + offset, sizeof(value));
+        return value;
+    };
+    auto const round = [](std::uint64_t lane, std::uint64_t value) {
+        return std::rotl(lane + value * kPrime2, 31) * kPrime1;
+    };
+
+    std::uint64_t lanes[4] = {
+      seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+    std::size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32)
+    {
+        lanes[0] = round(lanes[0], word(offset));
+        lanes[1] = round(lanes[1], word(offset + 8));
+        lanes[2] = round(lanes[2], word(offset + 16));
+        lanes[3] = round(lanes[3], word(offset + 24));
+    }
+
+    std::uint64_t hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7)
+                         + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18)
+                         + size;
+    for (; offset + 8 <= size; offset += 8)
+    { hash = std::rotl(hash ^ round(0, word(offset)), 27) * kPrime1; }
+    for (; offset < size; ++offset)
+    {
+        hash ^= static_cast<Byte::ByteType>(data[offset]) * kPrime2;
+        hash = std::rotl(hash, 11) * kPrime1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime2;
+    hash ^= hash >> 29;
+
+    return hash ^ (hash >> 32);
+}
+
+/**
+ * @brief Rounds offset up to a multiple of align.
+ */
+constexpr std::uint64_t AlignUp(std::uint64_t offset, std::uint64_t align)
+{
+    return (offset + align - 1) / align * align;
+}
+
+/**
+ * @brief Checksum of image, with the checksum field of its header taken as
+ * zero.
+ */
+inline std::uint64_t ImageChecksum(Span<const Byte> image)
+{
+    constexpr std::size_t kField = offsetof(MapImageHeader, checksum);
+    constexpr std::size_t kRest  = kField + sizeof(std::uint64_t);
+
+    std::uint64_t const zero = 0;
+    std::uint64_t       hash = ImageChecksum(image.data(), kField);
+    hash = ImageChecksum(reinterpret_cast<const Byte*>(&zero), 8, hash);
+
+    return ImageChecksum(image.data() + kRest, image.size() - kRest, hash);
+}
+}  // namespace detail
+
+/**
+ * @brief Serializes a sorted map into a position independent image, to be
+ * written to a file with SaveMapImage() and opened with MapImage.
+ *
+ * The image stores the keys and the mapped values as two arrays in the order
+ * of the map, so MapImage must use the comparison function of the map.
+ * The padding of the header and between the arrays is zero. Keys and values
+ * are copied byte by byte, including any padding inside them, so equal maps
+ * give byte-identical images only if K and V have unique object
+ * representations (std::has_unique_object_representations_v).
+ *
+ * @param map Map or FlatMap with trivially copyable keys and values.
+ *
+ * @return the image, its header first.
+ */
+template<class SortedMap>
+    requires std::is_trivially_copyable_v<typename SortedMap::key_type>
+             && std::is_trivially_copyable_v<typename SortedMap::mapped_type>
+Vector<Byte> MakeMapImage(const SortedMap& map)
+{
+    using K = typename SortedMap::key_type;
+    using V = typename SortedMap::mapped_type;
+
+    MapImageHeader header{};
+    header.magic       = MapImageHeader::kMagic;
+    header.version     = kMapImageVersion;
+    header.key_size    = sizeof(K);
+    header.key_align   = alignof(K);
+    header.value_size  = sizeof(V);
+    header.value_align = alignof(V);
+    header.size        = map.size();
+    header.keys_offset = detail::AlignUp(sizeof(MapImageHeader), alignof(K));
+    header.values_offset =
+      detail::AlignUp(header.keys_offset + header.size * sizeof(K), alignof(V));
+    header.image_size = header.values_offset + header.size * sizeof(V);
+
+    Vector<Byte> image(header.image_size);
+    auto*        keys   = image.data() + header.keys_offset;
+    auto*        values = image.data() + header.values_offset;
+    for (const auto& [key, value] : map)
+    {
+        std::memcpy(static_cast<void*>(keys), &key, sizeof(K));
+        std::memcpy(static_cast<void*>(values), &value, sizeof(V));
+        keys += sizeof(K);
+        values += sizeof(V);
+    }
+
+    std::memcpy(static_cast<void*>(image.data()), &header, sizeof(header));
+    header.checksum = detail::ImageChecksum(image);
+    std::memcpy(static_cast<void*>(image.data()), &header, sizeof(header));
+
+    return image;
+}
+
+/**
+ * @brief Writes image to the file at path.
+ *
+ * The image is written to a temporary file with a unique name next to path,
+ * which then replaces the file at path, so processes which have mapped the
+ * old file keep seeing it intact. If writing fails, the temporary file is
+ * removed.
+ *
+ * @param path file to write.
+ * @param image bytes to write, usually from MakeMapImage().
+ *
+ * @throws std::system_error if the file cannot be written.
+ */
+void SaveMapImage(const std::filesystem::path& path,
+                  Span<const Byte>             image);
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ *
+ * The mapping is private, so changes to the file by other processes are not
+ * guaranteed to be visible; replace files with SaveMapImage() rather than
+ * rewriting them in place.
+ */
+class MappedFile
+{
+ public:
+    /**
+     * @brief Maps the file at path.
+     *
+     * @param path file to map.
+     *
+     * @throws std::system_error if the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::filesystem::path& path);
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    /**
+     * @brief Returns the contents of the file, aligned to a page.
+     *
+     * @return the mapped bytes, valid as long as this object.
+     */
+    Span<const Byte> bytes() const noexcept { return {data_, size_}; }
+
+ private:
+    const Byte* data_{nullptr};
+    std::size_t size_{0};
+};
+
+/**
+ * @brief Read-only view of a map image, queried in place.
+ *
+ * Opening an image only verifies its header and, unless ImageCheck::kHeader
+ * is given, its checksum; nothing is copied or allocated, and the keys are
+ * searched where they lie. With a MappedFile, loading a large static map
+ * thus costs one mmap() instead of rebuilding the map:
+ * @code
+ * SaveMapImage("table.img", MakeMapImage(map));
+ * ...
+ * MappedFile                   file("table.img");
+ * MapImage<std::uint32_t, Row> table(file.bytes());
+ * auto const it = table.find(42);
+ * @endcode
+ *
+ * The lookup functions are those of a const FlatMap. The view does not own
+ * the bytes, which must outlive it.
+ *
+ * @tparam K key type, as in the map the image was made of.
+ * @tparam V value type, as in the map the image was made of.
+ * @tparam C key_compare function the map was sorted by.
+ */
+template<typename K, typename V, typename C = std::less<K>>
+    requires std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>
+class MapImage
+{
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<K, V>;
+    using key_compare     = C;
+    using const_reference = std::pair<const K&, const V&>;
+    using reference       = const_reference;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using const_iterator  = detail::FlatMapIterator<const K*, const V*>;
+    using iterator        = const_iterator;
+
+    /**
+     * @brief Opens the image in bytes.
+     *
+     * @param bytes the image, aligned to the alignment of the header, K and
+     * V. Trailing bytes after the image are ignored.
+     * @param check how much of the image to verify.
+     * @param comp comparison function object the map was sorted by.
+     *
+     * @throws std::invalid_argument if bytes is not a valid image of this
+     * version with keys K and values V, or fails the checksum.
+     */
+    explicit MapImage(Span<const Byte> bytes,
+                      ImageCheck       check = ImageCheck::kChecksum,
+                      const C&         comp  = C())
+      : compare_(comp)
+    {
+        MapImageHeader header;
+        if (bytes.size() < sizeof(header))
+        { throw std::invalid_argument("MapImage: truncated header"); }
+        if (reinterpret_cast<std::uintptr_t>(bytes.data())
+              % std::max({alignof(MapImageHeader), alignof(K), alignof(V)})
+            != 0)
+        { throw std::invalid_argument("MapImage: misaligned image"); }
+
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        if (header.magic != MapImageHeader::kMagic)
+        { throw std::invalid_argument("MapImage: not a map image"); }
+        if (header.version != kMapImageVersion)
+        { throw std::invalid_argument("MapImage: unsupported version"); }
+        if (header.key_size != sizeof(K) || header.key_align != alignof(K)
+            || header.value_size != sizeof(V)
+            || header.value_align != alignof(V))
+        { throw std::invalid_argument("MapImage: element type mismatch"); }
+
+        // Checked with divisions, so a corrupt size cannot overflow.
+        if (header.image_size > bytes.size()
+            || header.keys_offset < sizeof(header)
+            || header.keys_offset % alignof(K) != 0
+            || header.values_offset % alignof(V) != 0
+            || header.values_offset < header.keys_offset
+            || (header.values_offset - header.keys_offset) / sizeof(K)
+                 < header.size
+            || header.image_size < header.values_offset
+            || (header.image_size - header.values_offset) / sizeof(V)
+                 < header.size)
+        { throw std::invalid_argument("MapImage: truncated image"); }
+
+        if (check == ImageCheck::kChecksum
+            && detail::ImageChecksum(bytes.first(header.image_size))
+                 != header.checksum)
+        { throw std::invalid_argument("MapImage: checksum mismatch"); }
+
+        size_   = header.size;
+        keys_   = reinterpret_cast<const K*>(bytes.data() + header.keys_offset);
+        values_ = reinterpret_cast<const V*>(bytes.data()
+                                             + header.values_offset);
+    }
+
+    const_iterator begin() const noexcept { return {keys_, values_}; }
+    const_iterator end() const noexcept
+    {
+        return {keys_ + size_, values_ + size_};
+    }
+
+    /**
+     * @brief Checks if the image has no elements.
+     *
+     * @return true if the image is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the image.
+     */
+    size_type size() const noexcept { return size_; }
+
+    /**
+     * @brief Returns the sorted keys.
+     *
+     * @return the keys, in place in the image.
+     */
+    Span<const K> keys() const noexcept { return {keys_, size_}; }
+
+    /**
+     * @brief Returns the mapped values, in the order of keys().
+     *
+     * @return the mapped values, in place in the image.
+     */
+    Span<const V> values() const noexcept { return {values_, size_}; }
+
+    /**
+     * @brief Returns the function that compares the keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return compare_; }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if there is no such element.
+     */
+    const V& at(const K& key) const
+    {
+        auto const index = find_index(key);
+        if (index == size_)
+        { throw std::out_of_range("MapImage::at"); }
+
+        return values_[index];
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const
+    {
+        return make_iterator(find_index(key));
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key, without constructing
+     * a key_type. Requires a transparent C.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return make_iterator(find_index(key));
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(const K& key) const { return find_index(key) != size_; }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key key, that is either 1 or 0.
+     */
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief Returns an iterator to the first element not less than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return make_iterator(lower_bound_index(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return make_iterator(static_cast<size_type>(
+          std::upper_bound(keys_, keys_ + size_, key, compare_) - keys_));
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+ private:
+    template<class Key> size_type lower_bound_index(const Key& key) const
+    {
+        return static_cast<size_type>(
+          std::lower_bound(keys_, keys_ + size_, key, compare_) - keys_);
+    }
+
+    template<class Key> size_type find_index(const Key& key) const
+    {
+        auto const index = lower_bound_index(key);
+        if (index == size_ || compare_(key, keys_[index]))
+        { return size_; }
+
+        return index;
+    }
+
+    const_iterator make_iterator(size_type index) const noexcept
+    {
+        return {keys_ + index, values_ + index};
+    }
+
+    const K*                keys_{nullptr};
+    const V*                values_{nullptr};
+    size_type               size_{0};
+    [[no_unique_address]] C compare_;
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_MAP_IMAGE_H_
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_MAP_SLOT_H_
+#define ARA_CORE_MAP_SLOT_H_
+
+#include "ara/core/allocator.h"
+
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+/**
+ * Element storage shared by the maps that keep their elements in place and
+ * move them when they reorganize.
+ */
+namespace detail {
+/**
+ * @brief Storage for one element of a map.
+ *
+ * Users see the element as value, a std::pair<const K, V>. Where that pair is
+ * layout-compatible with std::pair<K, V>, the element is created as
+ * mutable_value instead, so that moving it to another slot can move the key
+ * rather than copy it. Otherwise the key is copied.
+ *
+ * Slots are raw storage: the container constructs and destroys the element
+ * with the static members, the union itself never does.
+ */
+template<class K, class V> union MapSlot
+{
+    using value_type   = std::pair<const K, V>;
+    using mutable_type = std::pair<K, V>;
+
+    /** true if the key of an element can be moved from */
+    static constexpr bool kMutableKey =
+      std::is_layout_compatible_v<value_type, mutable_type>;
+
+    /** true if moving an element to another slot cannot throw */
+    static constexpr bool kNothrowMove =
+      (kMutableKey ? std::is_nothrow_move_constructible_v<K>
+                   : std::is_nothrow_copy_constructible_v<K>)
+      && std::is_nothrow_move_constructible_v<V>;
+
+    MapSlot() noexcept {}
+    MapSlot(const MapSlot&) = delete;
+    MapSlot& operator=(const MapSlot&) = delete;
+    ~MapSlot() {}
+
+    /**
+     * @brief Returns the slot whose element is at value.
+     */
+    static MapSlot* of(value_type* value) noexcept
+    {
+        return reinterpret_cast<MapSlot*>(value);
+    }
+
+    /**
+     * @brief Constructs the element of the uninitialized slot from args.
+     */
+    template<class Alloc, class... Args>
+    static void construct(Alloc& alloc, MapSlot* slot, Args&&... args)
+    {
+        if constexpr (kMutableKey)
+        {
+            AllocatorTraits<Alloc>::construct(
+              alloc, &slot->mutable_value, std::forward<Args>(args)...);
+        }
+        else
+        {
+            AllocatorTraits<Alloc>::construct(
+              alloc, &slot->value, std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     * @brief Destroys the element of the slot.
+     */
+    template<class Alloc>
+    static void destroy(Alloc& alloc, MapSlot* slot) noexcept
+    {
+        if constexpr (kMutableKey)
+        { AllocatorTraits<Alloc>::destroy(alloc, &slot->mutable_value); }
+        else
+        { AllocatorTraits<Alloc>::destroy(alloc, &slot->value); }
+    }
+
+    /**
+     * @brief Returns the element of the slot to move from. The key is copied
+     * if it cannot be moved.
+     */
+    static decltype(auto) rvalue(MapSlot* slot) noexcept(kMutableKey)
+    {
+        if constexpr (kMutableKey)
+        { return std::move(slot->mutable_value); }
+        else
+        {
+            return mutable_type(slot->value.first,
+                                std::move(slot->value.second));
+        }
+    }
+
+    /**
+     * @brief Moves the element of from into the uninitialized slot to and
+     * destroys the source element.
+     */
+    template<class Alloc>
+    static void relocate(Alloc& alloc, MapSlot* to, MapSlot* from) noexcept
+    {
+        construct(alloc, to, rvalue(from));
+        destroy(alloc, from);
+    }
+
+    value_type   value;
+    mutable_type mutable_value;
+};
+}  // namespace detail
+}  // namespace ara::core
+
+#endif  // ARA_CORE_MAP_SLOT_H_
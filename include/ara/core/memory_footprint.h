@@ -0,0 +1,253 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_MEMORY_FOOTPRINT_H_
+#define ARA_CORE_MEMORY_FOOTPRINT_H_
+
+#include "ara/core/array.h"
+#include "ara/core/map.h"
+#include "ara/core/vector.h"
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Heap memory owned by an object, excluding the object itself.
+ */
+struct MemoryFootprint
+{
+    /** bytes occupied by live elements, including per-node overhead */
+    std::size_t bytes_used{0};
+    /** bytes requested from the allocator, bytes_used plus slack capacity */
+    std::size_t bytes_reserved{0};
+    /** number of live heap allocations */
+    std::size_t allocations{0};
+
+    MemoryFootprint& operator+=(const MemoryFootprint& other) noexcept
+    {
+        bytes_used += other.bytes_used;
+        bytes_reserved += other.bytes_reserved;
+        allocations += other.allocations;
+
+        return *this;
+    }
+
+    friend MemoryFootprint
+    operator+(MemoryFootprint lhs, const MemoryFootprint& rhs) noexcept
+    {
+        return lhs += rhs;
+    }
+
+    friend bool operator==(const MemoryFootprint&,
+                           const MemoryFootprint&) = default;
+};
+
+/**
+ * @brief Customization point describing the heap memory owned by a type.
+ *
+ * The primary template describes types that own no heap memory. Types owning
+ * heap memory specialize the template with
+ * - a constant kOwnsHeap set to true, and
+ * - a static function heap(const T&) returning the MemoryFootprint.
+ *
+ * Containers call heap() of their elements only if kOwnsHeap is true for the
+ * element type, so a container of plain values is measured in O(1).
+ *
+ * This header describes the basic types, Vector, Array and Map. Every other
+ * container specializes the template in its own header.
+ *
+ * @tparam T type to describe.
+ */
+template<class T> struct MemoryFootprintTraits
+{
+    static constexpr bool kOwnsHeap = false;
+
+    static MemoryFootprint heap(const T&) noexcept { return {}; }
+};
+
+/**
+ * @brief Returns the heap memory owned by @c value.
+ *
+ * @param value object to measure.
+ *
+ * @return heap bytes used, reserved and number of allocations.
+ */
+template<class T> MemoryFootprint memory_footprint(const T& value)
+{
+    return MemoryFootprintTraits<T>::heap(value);
+}
+
+namespace detail {
+/**
+ * @brief Estimated bookkeeping bytes of a red-black tree node: three links
+ * plus the colour, padded to pointer size.
+ */
+constexpr std::size_t kTreeNodeOverhead = 4 * sizeof(void*);
+
+/**
+ * @brief Sums the heap memory owned by the elements of a range, if the
+ * element type owns heap memory at all.
+ */
+template<class Range> MemoryFootprint elements_footprint(const Range& range)
+{
+    using Element = std::decay_t<decltype(*std::begin(range))>;
+
+    MemoryFootprint footprint;
+    if constexpr (MemoryFootprintTraits<Element>::kOwnsHeap)
+    {
+        for (const auto& element : range)
+        { footprint += MemoryFootprintTraits<Element>::heap(element); }
+    }
+
+    return footprint;
+}
+
+/**
+ * @brief Footprint of one contiguous buffer of @c capacity slots holding
+ * @c size elements of type T.
+ */
+template<class T>
+constexpr MemoryFootprint buffer_footprint(std::size_t size,
+                                           std::size_t capacity) noexcept
+{
+    return {size * sizeof(T), capacity * sizeof(T), capacity > 0 ? 1u : 0u};
+}
+
+/**
+ * @brief Footprint of the nodes of a red-black tree holding @c size values of
+ * type Value, excluding heap memory owned by the values.
+ */
+template<class Value>
+constexpr MemoryFootprint tree_footprint(std::size_t size) noexcept
+{
+    constexpr std::size_t node = kTreeNodeOverhead + sizeof(Value);
+    constexpr std::size_t padding =
+      (alignof(Value) - node % alignof(Value)) % alignof(Value);
+
+    std::size_t const bytes = size * (node + padding);
+
+    return {bytes, bytes, size};
+}
+}  // namespace detail
+
+/**
+ * @brief Strings own heap memory once they outgrow the small string buffer.
+ */
+template<class CharT, class Traits, class Alloc>
+struct MemoryFootprintTraits<std::basic_string<CharT, Traits, Alloc>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint
+    heap(const std::basic_string<CharT, Traits, Alloc>& value) noexcept
+    {
+        static std::size_t const inlineCapacity =
+          std::basic_string<CharT, Traits, Alloc>().capacity();
+        if (value.capacity() <= inlineCapacity)
+        { return {}; }
+
+        return detail::buffer_footprint<CharT>(value.size() + 1,
+                                               value.capacity() + 1);
+    }
+};
+
+/**
+ * @brief Pairs own the heap memory of both members. The members may be const,
+ * like the key in the value_type of a map.
+ */
+template<class T1, class T2> struct MemoryFootprintTraits<std::pair<T1, T2>>
+{
+    static constexpr bool kOwnsHeap =
+      MemoryFootprintTraits<std::remove_cv_t<T1>>::kOwnsHeap
+      || MemoryFootprintTraits<std::remove_cv_t<T2>>::kOwnsHeap;
+
+    static MemoryFootprint heap(const std::pair<T1, T2>& value)
+    {
+        return memory_footprint(value.first) + memory_footprint(value.second);
+    }
+};
+
+/**
+ * @brief Vector owns one buffer of capacity() elements.
+ */
+template<class T, class Allocator>
+struct MemoryFootprintTraits<Vector<T, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const Vector<T, Allocator>& value)
+    {
+        return detail::buffer_footprint<T>(value.size(), value.capacity())
+               + detail::elements_footprint(value);
+    }
+};
+
+/**
+ * @brief Array stores its elements inline, only the elements may own heap
+ * memory.
+ */
+template<class T, std::size_t N> struct MemoryFootprintTraits<Array<T, N>>
+{
+    static constexpr bool kOwnsHeap = MemoryFootprintTraits<T>::kOwnsHeap;
+
+    static MemoryFootprint heap(const Array<T, N>& value)
+    {
+        return detail::elements_footprint(value);
+    }
+};
+
+/**
+ * @brief Map allocates one tree node per element.
+ */
+template<class K, class V, class C, class Allocator>
+struct MemoryFootprintTraits<Map<K, V, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const Map<K, V, C, Allocator>& value)
+    {
+        MemoryFootprint footprint =
+          detail::tree_footprint<std::pair<const K, V>>(value.size());
+
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [k, v] : value)
+            { footprint += memory_footprint(k) + memory_footprint(v); }
+        }
+
+        return footprint;
+    }
+};
+
+/**
+ * @brief MultiMap allocates one tree node per element.
+ */
+template<class K, class V, class C, class Allocator>
+struct MemoryFootprintTraits<MultiMap<K, V, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const MultiMap<K, V, C, Allocator>& value)
+    {
+        MemoryFootprint footprint =
+          detail::tree_footprint<std::pair<const K, V>>(value.size());
+
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [k, v] : value)
+            { footprint += memory_footprint(k) + memory_footprint(v); }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_MEMORY_FOOTPRINT_H_
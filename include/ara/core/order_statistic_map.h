@@ -0,0 +1,1982 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_ORDER_STATISTIC_MAP_H_
+#define ARA_CORE_ORDER_STATISTIC_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Sorted associative container that contains key-value pairs with unique
+ * keys, and finds elements by their position in key order in O(log n).
+ *
+ * Every node of the binary search tree counts the elements of its subtree.
+ * This answers rank(), the number of keys less than a key, select(), the
+ * element at a position, and count_range() in O(log n), where advancing a Map
+ * iterator takes O(n). Percentiles and medians of a sorted sample thus cost
+ * a single tree descent.
+ *
+ * The subtree sizes double as balance information: the tree is weight
+ * balanced, no subtree holds more than three times as many elements as its
+ * sibling, so the height stays logarithmic. Updating the sizes makes every
+ * insertion and erasure walk the full path to the root, which costs a little
+ * more than in a Map.
+ *
+ * The interface and the iterator guarantees match ara::core::Map, without
+ * node handles: insertion invalidates no iterators, erasure only those to
+ * the erased elements.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class OrderStatisticMap
+{
+    template<bool Const> class Iterator;
+
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<const K, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = C;
+    using allocator_type  = Allocator;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename AllocatorTraits<Allocator>::pointer;
+    using const_pointer   = typename AllocatorTraits<Allocator>::const_pointer;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Compares elements by their keys.
+     */
+    class value_compare
+    {
+     public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return comp_(lhs.first, rhs.first);
+        }
+
+     private:
+        friend class OrderStatisticMap;
+
+        explicit value_compare(C comp) : comp_(std::move(comp)) {}
+
+        C comp_;
+    };
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     */
+    OrderStatisticMap() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit OrderStatisticMap(const C&         comp,
+                               const Allocator& alloc = Allocator())
+      : comp_(comp), alloc_(alloc)
+    {}
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit OrderStatisticMap(const Allocator& alloc) : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last). If multiple elements in the range have keys that compare
+     * equivalent, only the first one is inserted.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    OrderStatisticMap(InputIt          first,
+                      InputIt          last,
+                      const C&         comp  = C(),
+                      const Allocator& alloc = Allocator())
+      : OrderStatisticMap(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which must be sorted by key and free of duplicates. Runs
+     * in linear time and builds a perfectly balanced tree.
+     *
+     * @param first start of the sorted range to copy the elements from.
+     * @param last end of the sorted range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    OrderStatisticMap(sorted_unique_t,
+                      InputIt          first,
+                      InputIt          last,
+                      const C&         comp  = C(),
+                      const Allocator& alloc = Allocator())
+      : OrderStatisticMap(comp, alloc)
+    {
+        insert(sorted_unique, first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    OrderStatisticMap(std::initializer_list<value_type> init,
+                      const C&                          comp  = C(),
+                      const Allocator&                  alloc = Allocator())
+      : OrderStatisticMap(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Copy constructor. Constructs the container with the copy of the
+     * contents of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    OrderStatisticMap(const OrderStatisticMap& other)
+      : OrderStatisticMap(other.comp_,
+                          AllocatorTraits<Allocator>::
+                            select_on_container_copy_construction(other.alloc_))
+    {
+        build(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Constructs the container with the copy of the contents of other,
+     * using alloc as allocator.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    OrderStatisticMap(const OrderStatisticMap& other, const Allocator& alloc)
+      : OrderStatisticMap(other.comp_, alloc)
+    {
+        build(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Move constructor. Constructs the container with the contents of
+     * other using move semantics, other is left empty.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    OrderStatisticMap(OrderStatisticMap&& other) noexcept
+      : comp_(other.comp_), alloc_(std::move(other.alloc_))
+    {
+        swap_tree(other);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of other using move
+     * semantics and alloc as allocator. The elements are moved one by one if
+     * alloc differs from the allocator of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    OrderStatisticMap(OrderStatisticMap&& other, const Allocator& alloc)
+      : OrderStatisticMap(other.comp_, alloc)
+    {
+        if (alloc_ == other.alloc_)
+        {
+            swap_tree(other);
+            return;
+        }
+
+        build(std::make_move_iterator(other.begin()),
+              std::make_move_iterator(other.end()));
+        other.clear();
+    }
+
+    ~OrderStatisticMap() { clear(); }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to OrderStatisticMap instance.
+     */
+    OrderStatisticMap& operator=(const OrderStatisticMap& other)
+    {
+        if (this != &other)
+        {
+            OrderStatisticMap copy{other};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container using move semantics.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to OrderStatisticMap instance.
+     */
+    OrderStatisticMap& operator=(OrderStatisticMap&& other) noexcept
+    {
+        OrderStatisticMap moved{std::move(other)};
+        swap(moved);
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to OrderStatisticMap instance.
+     */
+    OrderStatisticMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if both maps contain the same key-value pairs.
+     */
+    friend bool operator==(const OrderStatisticMap& lhs,
+                           const OrderStatisticMap& rhs)
+    {
+        return lhs.size() == rhs.size()
+               && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    /**
+     * @brief Compares the contents of two maps lexicographically.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const OrderStatisticMap& lhs,
+                            const OrderStatisticMap& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    mapped_type& at(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("OrderStatisticMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    const mapped_type& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("OrderStatisticMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to a key
+     * equivalent to key, inserting a value-initialized one if it doesn't
+     * exist.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element.
+     */
+    mapped_type& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to a key
+     * equivalent to key, inserting a value-initialized one if it doesn't
+     * exist.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element.
+     */
+    mapped_type& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns an iterator to the first element of the container.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept { return iterator(leftmost()); }
+
+    /**
+     * @brief Returns an iterator to the first element of the container.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator begin() const noexcept { return const_iterator(leftmost()); }
+
+    /**
+     * @brief Returns an iterator to the first element of the container.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the element following the last element of
+     * the container.
+     *
+     * @return iterator to the element following the last element.
+     */
+    iterator end() noexcept { return iterator(header()); }
+
+    /**
+     * @brief Returns an iterator to the element following the last element of
+     * the container.
+     *
+     * @return iterator to the element following the last element.
+     */
+    const_iterator end() const noexcept { return const_iterator(header()); }
+
+    /**
+     * @brief Returns an iterator to the element following the last element of
+     * the container.
+     *
+     * @return iterator to the element following the last element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the first element of the reversed
+     * container.
+     *
+     * @return reverse iterator to the first element.
+     */
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator to the first element of the reversed
+     * container.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the first element of the reversed
+     * container.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+     * @brief Returns a reverse iterator to the element following the last
+     * element of the reversed container.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+    /**
+     * @brief Returns a reverse iterator to the element following the last
+     * element of the reversed container.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the element following the last
+     * element of the reversed container.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return root() == nullptr; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return Size(root()); }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept
+    {
+        NodeAllocator const alloc{alloc_};
+
+        return AllocatorTraits<NodeAllocator>::max_size(alloc);
+    }
+
+    /**
+     * @brief Erases all elements from the container.
+     */
+    void clear() noexcept
+    {
+        destroy_subtree(root());
+        header_.left = nullptr;
+        leftmost_    = nullptr;
+    }
+
+    /**
+     * @brief Returns the number of elements with a key less than key, which
+     * is the position of lower_bound(key) in the container.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return number of elements with a key less than key.
+     */
+    size_type rank(const K& key) const { return rank_of<false>(key); }
+
+    /**
+     * @brief Returns the number of elements with a key less than key, without
+     * constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with a key less than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type rank(const Key& key) const
+    {
+        return rank_of<false>(key);
+    }
+
+    /**
+     * @brief Returns the element at position index in key order.
+     *
+     * @param index zero-based position of the element.
+     *
+     * @return iterator to the element, or end() if index is not less than
+     * size().
+     */
+    iterator select(size_type index) { return iterator(select_node(index)); }
+
+    /**
+     * @brief Returns the element at position index in key order.
+     *
+     * @param index zero-based position of the element.
+     *
+     * @return iterator to the element, or end() if index is not less than
+     * size().
+     */
+    const_iterator select(size_type index) const
+    {
+        return const_iterator(select_node(index));
+    }
+
+    /**
+     * @brief Returns the position of the element at pos in key order, the
+     * inverse of select().
+     *
+     * @param pos iterator to an element of the container, or end().
+     *
+     * @return number of elements before pos, size() for end().
+     */
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        NodeBase* node = pos.node_;
+        if (node == header())
+        { return size(); }
+
+        size_type index = Size(node->left);
+        for (; node->parent != header(); node = node->parent)
+        {
+            if (node == node->parent->right)
+            { index += Size(node->parent->left) + 1; }
+        }
+
+        return index;
+    }
+
+    /**
+     * @brief Returns the number of elements with keys in [lower, upper).
+     *
+     * @param lower smallest key of the range.
+     * @param upper key following the range.
+     *
+     * @return number of elements in the range, zero if upper is not greater
+     * than lower.
+     */
+    size_type count_range(const K& lower, const K& upper) const
+    {
+        return count_range_of(lower, upper);
+    }
+
+    /**
+     * @brief Returns the number of elements with keys in [lower, upper),
+     * without constructing key_types. Requires a transparent key_compare.
+     *
+     * @param lower value comparable to the keys, smallest key of the range.
+     * @param upper value comparable to the keys, key following the range.
+     *
+     * @return number of elements in the range, zero if upper is not greater
+     * than lower.
+     */
+    template<class Lower, class Upper>
+        requires detail::TransparentFunction<C>
+    size_type count_range(const Lower& lower, const Upper& upper) const
+    {
+        return count_range_of(lower, upper);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace_key(value.first, value);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts value unless an element with an equivalent key exists.
+     * The hint is not needed, since the sizes along the path to the root are
+     * updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        static_cast<void>(hint);
+
+        return insert(value).first;
+    }
+
+    /**
+     * @brief Inserts value unless an element with an equivalent key exists.
+     * The hint is not needed, since the sizes along the path to the root are
+     * updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last). If multiple elements in
+     * the range have keys that compare equivalent, only the first one is
+     * inserted.
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) { emplace(*first); }
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last), which must be sorted by
+     * key and free of duplicates.
+     *
+     * An empty container is built as a perfectly balanced tree in linear time,
+     * otherwise every element is inserted in O(log n).
+     *
+     * @param first start of the sorted range of elements to insert.
+     * @param last end of the sorted range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        if (empty())
+        { build(first, last); }
+        else
+        { insert(first, last); }
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new element into the container constructed in-place
+     * with the given args if there is no element with the key in the
+     * container.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        Node* const node  = new_node(std::forward<Args>(args)...);
+        auto const  place = find_place(node->value()->first);
+        if (place.match != nullptr)
+        {
+            delete_node(node);
+            return {iterator(place.match), false};
+        }
+
+        link(node, place);
+
+        return {iterator(node), true};
+    }
+
+    /**
+     * @brief Inserts a new element into the container unless an element with
+     * an equivalent key exists. The hint is not needed, since the sizes along
+     * the path to the root are updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        static_cast<void>(hint);
+
+        return emplace(std::forward<Args>(args)...).first;
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(std::move(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Like try_emplace(key, args...). The hint is not needed, since the
+     * sizes along the path to the root are updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, const K& key, Args&&... args)
+    {
+        static_cast<void>(hint);
+
+        return try_emplace(key, std::forward<Args>(args)...).first;
+    }
+
+    /**
+     * @brief Like try_emplace(key, args...). The hint is not needed, since the
+     * sizes along the path to the root are updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        static_cast<void>(hint);
+
+        return try_emplace(std::move(key), std::forward<Args>(args)...).first;
+    }
+
+    /**
+     * @brief Inserts obj under key, or assigns it to the mapped value if the
+     * key already exists.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the inserted or updated element and a
+     * bool that is true if the element was inserted.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
+    {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Inserts obj under key, or assigns it to the mapped value if the
+     * key already exists.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the inserted or updated element and a
+     * bool that is true if the element was inserted.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        auto result = try_emplace(std::move(key), std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Like insert_or_assign(key, obj). The hint is not needed, since
+     * the sizes along the path to the root are updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const K& key, M&& obj)
+    {
+        static_cast<void>(hint);
+
+        return insert_or_assign(key, std::forward<M>(obj)).first;
+    }
+
+    /**
+     * @brief Like insert_or_assign(key, obj). The hint is not needed, since
+     * the sizes along the path to the root are updated anyway.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        static_cast<void>(hint);
+
+        return insert_or_assign(std::move(key), std::forward<M>(obj)).first;
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos)
+    {
+        NodeBase* const next = Next(pos.node_);
+        unlink(pos.node_);
+        delete_node(static_cast<Node*>(pos.node_));
+
+        return iterator(next);
+    }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first == begin() && last == end())
+        {
+            clear();
+            return end();
+        }
+
+        while (first != last) { first = erase(first); }
+
+        return iterator(last.node_);
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { return 0; }
+
+        erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(OrderStatisticMap& other) noexcept
+    {
+        using std::swap;
+        swap_tree(other);
+        swap(comp_, other.comp_);
+        if constexpr (AllocatorTraits<
+                        Allocator>::propagate_on_container_swap::value)
+        { swap(alloc_, other.alloc_); }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<class C2>
+    void merge(OrderStatisticMap<K, V, C2, Allocator>& source)
+    {
+        for (auto it = source.begin(); it != source.end();)
+        {
+            if (try_emplace(it->first, std::move(it->second)).second)
+            { it = source.erase(it); }
+            else
+            { ++it; }
+        }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<class C2>
+    void merge(OrderStatisticMap<K, V, C2, Allocator>&& source)
+    {
+        merge(source);
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type count(const Key& key) const
+    {
+        return rank_of<true>(key) - rank_of<false>(key);
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    iterator find(const K& key) { return iterator(find_node(key)); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const
+    {
+        return const_iterator(find_node(key));
+    }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator find(const Key& key)
+    {
+        return iterator(find_node(key));
+    }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return const_iterator(find_node(key));
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    bool contains(const K& key) const { return find_node(key) != header(); }
+
+    /**
+     * @brief Checks if there is an element with key that compares equivalent
+     * to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    bool contains(const Key& key) const
+    {
+        return find_node(key) != header();
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    iterator lower_bound(const K& key)
+    {
+        return iterator(bound_node<false>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return const_iterator(bound_node<false>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator lower_bound(const Key& key)
+    {
+        return iterator(bound_node<false>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element not less than the given
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is not less than
+     * key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return const_iterator(bound_node<false>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    iterator upper_bound(const K& key)
+    {
+        return iterator(bound_node<true>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return const_iterator(bound_node<true>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator upper_bound(const Key& key)
+    {
+        return iterator(bound_node<true>(key));
+    }
+
+    /**
+     * @brief Returns an iterator to the first element greater than the given
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator pointing to the first element that is greater than key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return const_iterator(bound_node<true>(key));
+    }
+
+    /**
+     * @brief Returns the function that compares keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return comp_; }
+
+    /**
+     * @brief Returns the function that compares keys in objects of type
+     * value_type.
+     *
+     * @return the value comparison function object.
+     */
+    value_compare value_comp() const { return value_compare(comp_); }
+
+ private:
+    using ValueAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<value_type>;
+    using ValueTraits = AllocatorTraits<ValueAllocator>;
+
+    /**
+     * @brief Weight-balance parameters: a subtree may weigh at most kDelta
+     * times as much as its sibling, where the weight is the size plus one. A
+     * rebalance rotates twice if the inner grandchild weighs at least kGamma
+     * times as much as the outer one. (3, 2) is the one integer pair that
+     * keeps the tree balanced after every insertion and erasure.
+     */
+    static constexpr size_type kDelta = 3;
+    static constexpr size_type kGamma = 2;
+
+    /**
+     * @brief Links and subtree size of a node. The header of the tree is a
+     * bare NodeBase whose left child is the root; it doubles as end().
+     */
+    struct NodeBase
+    {
+        NodeBase* parent;
+        NodeBase* left;
+        NodeBase* right;
+        size_type size;
+    };
+
+    /**
+     * @brief Tree node with storage for one element, which is constructed and
+     * destroyed separately.
+     */
+    struct Node : NodeBase
+    {
+        alignas(value_type) unsigned char storage[sizeof(value_type)];
+
+        value_type* value() noexcept
+        {
+            return std::launder(reinterpret_cast<value_type*>(storage));
+        }
+
+        const value_type* value() const noexcept
+        {
+            return std::launder(reinterpret_cast<const value_type*>(storage));
+        }
+    };
+
+    using NodeAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<Node>;
+
+    template<bool Const> class Iterator
+    {
+        using Slot = std::conditional_t<Const,
+                                        const typename OrderStatisticMap::
+                                          value_type,
+                                        typename OrderStatisticMap::value_type>;
+
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename OrderStatisticMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Slot*;
+        using reference         = Slot&;
+
+        Iterator() = default;
+
+        /**
+         * @brief Converts an iterator to a const_iterator.
+         */
+        template<bool OtherConst>
+            requires(Const && ! OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept
+          : node_(other.node_)
+        {}
+
+        reference operator*() const noexcept
+        {
+            return *static_cast<Node*>(node_)->value();
+        }
+
+        pointer operator->() const noexcept
+        {
+            return static_cast<Node*>(node_)->value();
+        }
+
+        Iterator& operator++() noexcept
+        {
+            node_ = Next(node_);
+
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            ++(*this);
+
+            return previous;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            node_ = Prev(node_);
+
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator previous = *this;
+            --(*this);
+
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.node_ == rhs.node_;
+        }
+
+     private:
+        friend class OrderStatisticMap;
+        template<bool> friend class Iterator;
+
+        explicit Iterator(NodeBase* node) noexcept : node_(node) {}
+
+        NodeBase* node_{nullptr};
+    };
+
+    /**
+     * @brief Insertion point of a key: the parent and side of the new node,
+     * or the node that already holds an equivalent key.
+     */
+    struct Place
+    {
+        NodeBase* parent;
+        bool      left;
+        NodeBase* match;
+    };
+
+    static size_type Size(const NodeBase* node) noexcept
+    {
+        return node == nullptr ? 0 : node->size;
+    }
+
+    static const K& KeyOf(const NodeBase* node) noexcept
+    {
+        return static_cast<const Node*>(node)->value()->first;
+    }
+
+    /**
+     * @brief In-order successor of node. The successor of the last node is the
+     * header, whose left child is the root.
+     */
+    static NodeBase* Next(NodeBase* node) noexcept
+    {
+        if (node->right != nullptr)
+        {
+            node = node->right;
+            while (node->left != nullptr) { node = node->left; }
+
+            return node;
+        }
+
+        NodeBase* parent = node->parent;
+        while (node == parent->right)
+        {
+            node   = parent;
+            parent = parent->parent;
+        }
+
+        return parent;
+    }
+
+    /**
+     * @brief In-order predecessor of node. The predecessor of the header is the
+     * last node, the rightmost node below the root.
+     */
+    static NodeBase* Prev(NodeBase* node) noexcept
+    {
+        if (node->left != nullptr)
+        {
+            node = node->left;
+            while (node->right != nullptr) { node = node->right; }
+
+            return node;
+        }
+
+        NodeBase* parent = node->parent;
+        while (node == parent->left)
+        {
+            node   = parent;
+            parent = parent->parent;
+        }
+
+        return parent;
+    }
+
+    NodeBase* header() const noexcept
+    {
+        return const_cast<NodeBase*>(&header_);
+    }
+
+    NodeBase* root() const noexcept { return header_.left; }
+
+    NodeBase* leftmost() const noexcept
+    {
+        return leftmost_ == nullptr ? header() : leftmost_;
+    }
+
+    template<class Key> NodeBase* find_node(const Key& key) const
+    {
+        NodeBase* const node = bound_node<false>(key);
+        if (node == header() || comp_(key, KeyOf(node)))
+        { return header(); }
+
+        return node;
+    }
+
+    /**
+     * @brief First node with a key not less than key, or greater than key if
+     * Upper is set; the header if there is none.
+     */
+    template<bool Upper, class Key> NodeBase* bound_node(const Key& key) const
+    {
+        NodeBase* bound = header();
+        for (NodeBase* node = root(); node != nullptr;)
+        {
+            bool const before =
+              Upper ? ! comp_(key, KeyOf(node)) : comp_(KeyOf(node), key);
+            if (before)
+            { node = node->right; }
+            else
+            {
+                bound = node;
+                node  = node->left;
+            }
+        }
+
+        return bound;
+    }
+
+    /**
+     * @brief Number of keys less than key, or not greater than key if Upper is
+     * set.
+     */
+    template<bool Upper, class Key> size_type rank_of(const Key& key) const
+    {
+        size_type rank = 0;
+        for (NodeBase* node = root(); node != nullptr;)
+        {
+            bool const before =
+              Upper ? ! comp_(key, KeyOf(node)) : comp_(KeyOf(node), key);
+            if (before)
+            {
+                rank += Size(node->left) + 1;
+                node = node->right;
+            }
+            else
+            { node = node->left; }
+        }
+
+        return rank;
+    }
+
+    template<class Lower, class Upper>
+    size_type count_range_of(const Lower& lower, const Upper& upper) const
+    {
+        size_type const first = rank_of<false>(lower);
+        size_type const last  = rank_of<false>(upper);
+
+        return last > first ? last - first : 0;
+    }
+
+    NodeBase* select_node(size_type index) const noexcept
+    {
+        if (index >= size())
+        { return header(); }
+
+        NodeBase* node = root();
+        for (;;)
+        {
+            size_type const left = Size(node->left);
+            if (index < left)
+            { node = node->left; }
+            else if (index == left)
+            { return node; }
+            else
+            {
+                index -= left + 1;
+                node = node->right;
+            }
+        }
+    }
+
+    template<class Key> Place find_place(const Key& key) const
+    {
+        Place     place{header(), true, nullptr};
+        NodeBase* bound = nullptr;
+        for (NodeBase* node = root(); node != nullptr;)
+        {
+            place.parent = node;
+            place.left   = ! comp_(KeyOf(node), key);
+            if (place.left)
+            {
+                bound = node;
+                node  = node->left;
+            }
+            else
+            { node = node->right; }
+        }
+        if (bound != nullptr && ! comp_(key, KeyOf(bound)))
+        { place.match = bound; }
+
+        return place;
+    }
+
+    /**
+     * @brief Inserts the element constructed from args unless an element with
+     * key key exists. args are only used if the element is inserted.
+     */
+    template<class Key, class... Args>
+    std::pair<iterator, bool> emplace_key(const Key& key, Args&&... args)
+    {
+        auto const place = find_place(key);
+        if (place.match != nullptr)
+        { return {iterator(place.match), false}; }
+
+        Node* const node = new_node(std::forward<Args>(args)...);
+        link(node, place);
+
+        return {iterator(node), true};
+    }
+
+    /**
+     * @brief Attaches node as a leaf at place and rebalances the path to the
+     * root.
+     */
+    void link(NodeBase* node, const Place& place) noexcept
+    {
+        node->parent = place.parent;
+        node->left   = nullptr;
+        node->right  = nullptr;
+        node->size   = 1;
+        if (place.left)
+        {
+            place.parent->left = node;
+            if (place.parent == leftmost())
+            { leftmost_ = node; }
+        }
+        else
+        { place.parent->right = node; }
+
+        for (NodeBase* ancestor = place.parent; ancestor != header();)
+        {
+            ++ancestor->size;
+            ancestor = rebalance(ancestor)->parent;
+        }
+    }
+
+    /**
+     * @brief Detaches node from the tree and rebalances the path to the root.
+     * A node with two children is replaced by its successor node, so no
+     * element moves and iterators to other elements stay valid.
+     */
+    void unlink(NodeBase* node) noexcept
+    {
+        if (node == leftmost_)
+        {
+            NodeBase* const next = Next(node);
+            leftmost_            = next == header() ? nullptr : next;
+        }
+
+        NodeBase* shrunk = node->parent;
+        if (node->left != nullptr && node->right != nullptr)
+        {
+            NodeBase* successor = node->right;
+            while (successor->left != nullptr) { successor = successor->left; }
+
+            if (successor->parent == node)
+            { shrunk = successor; }
+            else
+            {
+                shrunk       = successor->parent;
+                shrunk->left = successor->right;
+                if (successor->right != nullptr)
+                { successor->right->parent = shrunk; }
+                successor->right     = node->right;
+                node->right->parent = successor;
+            }
+            successor->left     = node->left;
+            node->left->parent = successor;
+            successor->size     = node->size;
+            replace_child(node, successor);
+        }
+        else
+        {
+            replace_child(node,
+                          node->left != nullptr ? node->left : node->right);
+        }
+
+        for (NodeBase* ancestor = shrunk; ancestor != header();)
+        {
+            --ancestor->size;
+            ancestor = rebalance(ancestor)->parent;
+        }
+    }
+
+    /**
+     * @brief Puts replacement, which may be null, in the place of node below
+     * the parent of node.
+     */
+    static void replace_child(NodeBase* node, NodeBase* replacement) noexcept
+    {
+        NodeBase* const parent = node->parent;
+        if (parent->left == node)
+        { parent->left = replacement; }
+        else
+        { parent->right = replacement; }
+        if (replacement != nullptr)
+        { replacement->parent = parent; }
+    }
+
+    /**
+     * @brief Restores the weight balance at node, whose subtrees are balanced
+     * and at most one element away from it.
+     *
+     * @return the node now at the position of node.
+     */
+    static NodeBase* rebalance(NodeBase* node) noexcept
+    {
+        size_type const left  = Size(node->left) + 1;
+        size_type const right = Size(node->right) + 1;
+        if (right > kDelta * left)
+        {
+            NodeBase* const child = node->right;
+            if (Size(child->left) + 1 >= kGamma * (Size(child->right) + 1))
+            { rotate_right(child); }
+
+            return rotate_left(node);
+        }
+        if (left > kDelta * right)
+        {
+            NodeBase* const child = node->left;
+            if (Size(child->right) + 1 >= kGamma * (Size(child->left) + 1))
+            { rotate_left(child); }
+
+            return rotate_right(node);
+        }
+
+        return node;
+    }
+
+    static NodeBase* rotate_left(NodeBase* node) noexcept
+    {
+        NodeBase* const child = node->right;
+        node->right           = child->left;
+        if (child->left != nullptr)
+        { child->left->parent = node; }
+        replace_child(node, child);
+        child->left  = node;
+        node->parent = child;
+        child->size  = node->size;
+        node->size   = Size(node->left) + Size(node->right) + 1;
+
+        return child;
+    }
+
+    static NodeBase* rotate_right(NodeBase* node) noexcept
+    {
+        NodeBase* const child = node->left;
+        node->left            = child->right;
+        if (child->right != nullptr)
+        { child->right->parent = node; }
+        replace_child(node, child);
+        child->right = node;
+        node->parent = child;
+        child->size  = node->size;
+        node->size   = Size(node->left) + Size(node->right) + 1;
+
+        return child;
+    }
+
+    /**
+     * @brief Builds a perfectly balanced tree from the sorted range
+     * [first, last) in place of the empty tree. If an element constructor
+     * throws, the container stays empty.
+     */
+    template<class InputIt> void build(InputIt first, InputIt last)
+    {
+        Vector<NodeBase*> nodes;
+        if constexpr (std::forward_iterator<InputIt>)
+        { nodes.reserve(static_cast<size_type>(std::distance(first, last))); }
+
+        try
+        {
+            for (; first != last; ++first)
+            {
+                nodes.push_back(nullptr);
+                nodes.back() = new_node(*first);
+            }
+        }
+        catch (...)
+        {
+            for (NodeBase* const node : nodes)
+            {
+                if (node != nullptr)
+                { delete_node(static_cast<Node*>(node)); }
+            }
+            throw;
+        }
+
+        header_.left = Build(nodes.data(), nodes.size(), header());
+        leftmost_    = nodes.empty() ? nullptr : nodes.front();
+    }
+
+    static NodeBase*
+    Build(NodeBase* const* nodes, size_type count, NodeBase* parent) noexcept
+    {
+        if (count == 0)
+        { return nullptr; }
+
+        size_type const middle = count / 2;
+        NodeBase* const node   = nodes[middle];
+        node->parent           = parent;
+        node->size             = count;
+        node->left             = Build(nodes, middle, node);
+        node->right = Build(nodes + middle + 1, count - middle - 1, node);
+
+        return node;
+    }
+
+    template<class... Args> Node* new_node(Args&&... args)
+    {
+        NodeAllocator alloc{alloc_};
+        Node* const   node = ::new (static_cast<void*>(
+          AllocatorTraits<NodeAllocator>::allocate(alloc, 1))) Node;
+        try
+        {
+            ValueTraits::construct(
+              alloc_, node->value(), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            AllocatorTraits<NodeAllocator>::deallocate(alloc, node, 1);
+            throw;
+        }
+
+        return node;
+    }
+
+    void delete_node(Node* node) noexcept
+    {
+        ValueTraits::destroy(alloc_, node->value());
+        NodeAllocator alloc{alloc_};
+        AllocatorTraits<NodeAllocator>::deallocate(alloc, node, 1);
+    }
+
+    void destroy_subtree(NodeBase* node) noexcept
+    {
+        while (node != nullptr)
+        {
+            destroy_subtree(node->right);
+            NodeBase* const left = node->left;
+            delete_node(static_cast<Node*>(node));
+            node = left;
+        }
+    }
+
+    /**
+     * @brief Exchanges the trees, and points the roots at their new headers.
+     */
+    void swap_tree(OrderStatisticMap& other) noexcept
+    {
+        std::swap(header_.left, other.header_.left);
+        std::swap(leftmost_, other.leftmost_);
+        if (header_.left != nullptr)
+        { header_.left->parent = header(); }
+        if (other.header_.left != nullptr)
+        { other.header_.left->parent = other.header(); }
+    }
+
+    NodeBase                             header_{nullptr, nullptr, nullptr, 0};
+    NodeBase*                            leftmost_{nullptr};
+    [[no_unique_address]] C              comp_;
+    [[no_unique_address]] ValueAllocator alloc_;
+};
+
+/**
+ * @brief Exchanges the contents of two maps.
+ *
+ * @param lhs first map.
+ * @param rhs second map.
+ */
+template<class K, class V, class C, class Allocator> void
+swap(OrderStatisticMap<K, V, C, Allocator>& lhs,
+     OrderStatisticMap<K, V, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief OrderStatisticMap allocates one tree node per element; the subtree
+ * size takes the place of the color of a red-black node.
+ */
+template<class K, class V, class C, class Allocator>
+struct MemoryFootprintTraits<OrderStatisticMap<K, V, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint
+    heap(const OrderStatisticMap<K, V, C, Allocator>& value)
+    {
+        MemoryFootprint footprint =
+          detail::tree_footprint<std::pair<const K, V>>(value.size());
+
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [k, v] : value)
+            { footprint += memory_footprint(k) + memory_footprint(v); }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_ORDER_STATISTIC_MAP_H_
@@ -0,0 +1,529 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_PARALLEL_H_
+#define ARA_CORE_PARALLEL_H_
+
+#include "ara/core/map.h"
+#include "ara/core/thread_pool.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+/**
+ * Parallel versions of the standard algorithms running on an
+ * ara::core::ThreadPool. Every algorithm accepts a contiguous range such as
+ * ara::core::Vector, ara::core::Array or a built-in array, and is offered with
+ * and without an explicit pool. Without a pool DefaultThreadPool() is used.
+ *
+ * Ranges smaller than a few thousand elements, or pools with concurrency of 1,
+ * are processed sequentially on the calling thread.
+ */
+namespace ara::core::parallel {
+
+namespace detail {
+/**
+ * @brief Minimal number of elements handed to a single task.
+ */
+constexpr std::size_t kGrainSize = 4096;
+
+/**
+ * @brief Number of chunks per thread, gives the stealing some slack.
+ */
+constexpr std::size_t kChunksPerThread = 4;
+
+/**
+ * @brief Returns the number of chunks a range of @c n elements is split into.
+ *
+ * @param pool pool the work is distributed on.
+ * @param n number of elements.
+ * @param chunksPerThread upper bound of chunks per thread.
+ *
+ * @return number of chunks, at least 1.
+ */
+inline std::size_t
+chunk_count(const ThreadPool& pool, std::size_t n, std::size_t chunksPerThread)
+{
+    std::size_t const byGrain  = n / kGrainSize;
+    std::size_t const byThread = pool.concurrency() * chunksPerThread;
+
+    return std::max<std::size_t>(1, std::min(byGrain, byThread));
+}
+
+/**
+ * @brief Returns the first index of chunk @c i out of @c chunks over @c n
+ * elements.
+ */
+constexpr std::size_t
+chunk_begin(std::size_t i, std::size_t chunks, std::size_t n) noexcept
+{
+    return n / chunks * i + std::min(i, n % chunks);
+}
+
+/**
+ * @brief Invokes @c f(first, last, chunk) for every chunk of [0, n) and waits
+ * for completion.
+ *
+ * @param pool pool the work is distributed on.
+ * @param n number of elements.
+ * @param chunks number of chunks.
+ * @param f callable invoked for every chunk.
+ */
+template<class F>
+void run_chunks(ThreadPool& pool, std::size_t n, std::size_t chunks, F&& f)
+{
+    if (chunks == 1)
+    {
+        f(std::size_t{0}, n, std::size_t{0});
+        return;
+    }
+
+    TaskGroup group{pool};
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        std::size_t const first = chunk_begin(i, chunks, n);
+        std::size_t const last  = chunk_begin(i + 1, chunks, n);
+        group.run([&f, first, last, i] { f(first, last, i); });
+    }
+    group.wait();
+}
+
+/**
+ * @brief Sorts [first, last) by sorting chunks in parallel and merging
+ * neighbouring chunks in parallel rounds.
+ */
+template<class RandomIt, class Compare, class SortFn>
+void chunked_sort(ThreadPool& pool,
+                  RandomIt    first,
+                  RandomIt    last,
+                  Compare     comp,
+                  SortFn      sortFn)
+{
+    auto const        n      = static_cast<std::size_t>(last - first);
+    std::size_t const chunks = chunk_count(pool, n, 1);
+
+    Vector<std::size_t> bounds;
+    for (std::size_t i = 0; i <= chunks; ++i)
+    { bounds.push_back(chunk_begin(i, chunks, n)); }
+
+    auto at = [first](std::size_t i) {
+        return first + static_cast<std::ptrdiff_t>(i);
+    };
+
+    run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t) {
+          sortFn(at(b), at(e), comp);
+      });
+
+    while (bounds.size() > 2)
+    {
+        std::size_t const pairs = (bounds.size() - 1) / 2;
+
+        TaskGroup group{pool};
+        for (std::size_t p = 0; p < pairs; ++p)
+        {
+            std::size_t const b = bounds[2 * p];
+            std::size_t const m = bounds[2 * p + 1];
+            std::size_t const e = bounds[2 * p + 2];
+            group.run([&, b, m, e] {
+                std::inplace_merge(at(b), at(m), at(e), comp);
+            });
+        }
+        group.wait();
+
+        Vector<std::size_t> merged;
+        for (std::size_t i = 0; i < bounds.size(); i += 2)
+        { merged.push_back(bounds[i]); }
+        if (merged.back() != bounds.back())
+        { merged.push_back(bounds.back()); }
+        bounds.swap(merged);
+    }
+}
+}  // namespace detail
+
+/**
+ * @brief Sorts the elements of a range in non-descending order.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range range to sort.
+ * @param comp comparison function object.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam Compare comparison function type.
+ */
+template<class Range, class Compare = std::less<>>
+void sort(ThreadPool& pool, Range& range, Compare comp = Compare())
+{
+    detail::chunked_sort(pool,
+                         std::begin(range),
+                         std::end(range),
+                         comp,
+                         [](auto first, auto last, Compare& c) {
+                             std::sort(first, last, c);
+                         });
+}
+
+/**
+ * @brief Sorts the elements of a range in non-descending order using
+ * DefaultThreadPool().
+ *
+ * @param range range to sort.
+ * @param comp comparison function object.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam Compare comparison function type.
+ */
+template<class Range, class Compare = std::less<>>
+void sort(Range& range, Compare comp = Compare())
+{
+    parallel::sort(DefaultThreadPool(), range, comp);
+}
+
+/**
+ * @brief Sorts the elements of a range preserving the order of equivalent
+ * elements.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range range to sort.
+ * @param comp comparison function object.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam Compare comparison function type.
+ */
+template<class Range, class Compare = std::less<>>
+void stable_sort(ThreadPool& pool, Range& range, Compare comp = Compare())
+{
+    detail::chunked_sort(pool,
+                         std::begin(range),
+                         std::end(range),
+                         comp,
+                         [](auto first, auto last, Compare& c) {
+                             std::stable_sort(first, last, c);
+                         });
+}
+
+/**
+ * @brief Sorts the elements of a range preserving the order of equivalent
+ * elements using DefaultThreadPool().
+ *
+ * @param range range to sort.
+ * @param comp comparison function object.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam Compare comparison function type.
+ */
+template<class Range, class Compare = std::less<>>
+void stable_sort(Range& range, Compare comp = Compare())
+{
+    parallel::stable_sort(DefaultThreadPool(), range, comp);
+}
+
+/**
+ * @brief Applies @c op to every element of a range and stores the results
+ * starting at @c out.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range source range.
+ * @param out beginning of the destination range, may be equal to the
+ * beginning of the source range.
+ * @param op unary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam RandomIt random access output iterator type.
+ * @tparam UnaryOp unary operation type.
+ *
+ * @return iterator to the element past the last element transformed.
+ */
+template<class Range, class RandomIt, class UnaryOp> RandomIt
+transform(ThreadPool& pool, const Range& range, RandomIt out, UnaryOp op)
+{
+    auto const        first  = std::begin(range);
+    auto const        n      = static_cast<std::size_t>(std::size(range));
+    std::size_t const chunks =
+      detail::chunk_count(pool, n, detail::kChunksPerThread);
+
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t) {
+          auto const db = static_cast<std::ptrdiff_t>(b);
+          auto const de = static_cast<std::ptrdiff_t>(e);
+          std::transform(first + db, first + de, out + db, op);
+      });
+
+    return out + static_cast<std::ptrdiff_t>(n);
+}
+
+/**
+ * @brief Applies @c op to every element of a range using DefaultThreadPool().
+ *
+ * @param range source range.
+ * @param out beginning of the destination range.
+ * @param op unary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam RandomIt random access output iterator type.
+ * @tparam UnaryOp unary operation type.
+ *
+ * @return iterator to the element past the last element transformed.
+ */
+template<class Range, class RandomIt, class UnaryOp>
+RandomIt transform(const Range& range, RandomIt out, UnaryOp op)
+{
+    return parallel::transform(DefaultThreadPool(), range, out, op);
+}
+
+/**
+ * @brief Reduces a range using @c op. The operation has to be associative,
+ * the order of evaluation is unspecified.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range range to reduce.
+ * @param init initial value.
+ * @param op binary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam T type of the result.
+ * @tparam BinaryOp binary operation type.
+ *
+ * @return the reduced value.
+ */
+template<class Range, class T, class BinaryOp = std::plus<>> T
+reduce(ThreadPool& pool, const Range& range, T init, BinaryOp op = BinaryOp())
+{
+    auto const        first  = std::begin(range);
+    auto const        n      = static_cast<std::size_t>(std::size(range));
+    std::size_t const chunks =
+      detail::chunk_count(pool, n, detail::kChunksPerThread);
+
+    if (n == 0)
+    { return init; }
+
+    Vector<T> partial(chunks, init);
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t i) {
+          auto const db = static_cast<std::ptrdiff_t>(b);
+          auto const de = static_cast<std::ptrdiff_t>(e);
+          partial[i] = std::accumulate(
+            first + db + 1, first + de, static_cast<T>(first[db]), op);
+      });
+
+    return std::accumulate(partial.begin(), partial.end(), init, op);
+}
+
+/**
+ * @brief Reduces a range using @c op and DefaultThreadPool().
+ *
+ * @param range range to reduce.
+ * @param init initial value.
+ * @param op binary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam T type of the result.
+ * @tparam BinaryOp binary operation type.
+ *
+ * @return the reduced value.
+ */
+template<class Range, class T, class BinaryOp = std::plus<>>
+T reduce(const Range& range, T init, BinaryOp op = BinaryOp())
+{
+    return parallel::reduce(DefaultThreadPool(), range, init, op);
+}
+
+/**
+ * @brief Applies @c f to every element of a range.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range range to iterate.
+ * @param f function to apply, may be invoked concurrently.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam UnaryFn function type.
+ */
+template<class Range, class UnaryFn>
+void for_each(ThreadPool& pool, Range& range, UnaryFn f)
+{
+    auto const        first  = std::begin(range);
+    auto const        n      = static_cast<std::size_t>(std::size(range));
+    std::size_t const chunks =
+      detail::chunk_count(pool, n, detail::kChunksPerThread);
+
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t) {
+          std::for_each(first + static_cast<std::ptrdiff_t>(b),
+                        first + static_cast<std::ptrdiff_t>(e),
+                        f);
+      });
+}
+
+/**
+ * @brief Applies @c f to every element of a range using DefaultThreadPool().
+ *
+ * @param range range to iterate.
+ * @param f function to apply, may be invoked concurrently.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam UnaryFn function type.
+ */
+template<class Range, class UnaryFn> void for_each(Range& range, UnaryFn f)
+{
+    parallel::for_each(DefaultThreadPool(), range, f);
+}
+
+/**
+ * @brief Computes the inclusive prefix sums of a range using @c op and stores
+ * them starting at @c out. The operation has to be associative.
+ *
+ * @param pool pool the work is distributed on.
+ * @param range source range.
+ * @param out beginning of the destination range, may be equal to the
+ * beginning of the source range.
+ * @param op binary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam RandomIt random access output iterator type.
+ * @tparam BinaryOp binary operation type.
+ *
+ * @return iterator to the element past the last element written.
+ */
+template<class Range, class RandomIt, class BinaryOp = std::plus<>>
+RandomIt inclusive_scan(ThreadPool&  pool,
+                        const Range& range,
+                        RandomIt     out,
+                        BinaryOp     op = BinaryOp())
+{
+    using T = std::decay_t<decltype(*std::begin(range))>;
+
+    auto const        first  = std::begin(range);
+    auto const        n      = static_cast<std::size_t>(std::size(range));
+    std::size_t const chunks =
+      detail::chunk_count(pool, n, detail::kChunksPerThread);
+
+    if (chunks == 1)
+    { return std::inclusive_scan(first, std::end(range), out, op); }
+
+    // First pass: totals of every chunk but the last one.
+    Vector<T> totals(chunks);
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t i) {
+          if (i + 1 == chunks)
+          { return; }
+          auto const db = static_cast<std::ptrdiff_t>(b);
+          auto const de = static_cast<std::ptrdiff_t>(e);
+          totals[i] =
+            std::accumulate(first + db + 1, first + de, T(first[db]), op);
+      });
+
+    for (std::size_t i = 1; i + 1 < chunks; ++i)
+    { totals[i] = op(totals[i - 1], totals[i]); }
+
+    // Second pass: scan every chunk seeded with the total of its predecessors.
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t i) {
+          auto const db = static_cast<std::ptrdiff_t>(b);
+          auto const de = static_cast<std::ptrdiff_t>(e);
+          if (i == 0)
+          {
+              std::inclusive_scan(first + db, first + de, out + db, op);
+              return;
+          }
+          std::inclusive_scan(
+            first + db, first + de, out + db, op, totals[i - 1]);
+      });
+
+    return out + static_cast<std::ptrdiff_t>(n);
+}
+
+/**
+ * @brief Computes the inclusive prefix sums of a range using @c op and
+ * DefaultThreadPool().
+ *
+ * @param range source range.
+ * @param out beginning of the destination range.
+ * @param op binary operation.
+ *
+ * @tparam Range contiguous range type.
+ * @tparam RandomIt random access output iterator type.
+ * @tparam BinaryOp binary operation type.
+ *
+ * @return iterator to the element past the last element written.
+ */
+template<class Range, class RandomIt, class BinaryOp = std::plus<>> RandomIt
+inclusive_scan(const Range& range, RandomIt out, BinaryOp op = BinaryOp())
+{
+    return parallel::inclusive_scan(DefaultThreadPool(), range, out, op);
+}
+
+/**
+ * @brief Inserts the elements of a range that is sorted by key and free of
+ * duplicates into @c map.
+ *
+ * Chunks of the range are built into separate maps in parallel, which spreads
+ * node allocation and element construction over the pool. The nodes are then
+ * relinked into @c map in order, in linear time and without copying.
+ *
+ * @param pool pool the work is distributed on.
+ * @param map map to insert the elements into.
+ * @param range contiguous range of key-value pairs sorted by key.
+ *
+ * @tparam Range contiguous range type.
+ */
+template<class Range, class K, class V, class C, class Allocator>
+void insert(ThreadPool&              pool,
+            Map<K, V, C, Allocator>& map,
+            sorted_unique_t,
+            const Range& range)
+{
+    auto const        first  = std::begin(range);
+    auto const        n      = static_cast<std::size_t>(std::size(range));
+    std::size_t const chunks = detail::chunk_count(pool, n, 1);
+
+    if (chunks == 1)
+    {
+        map.insert(sorted_unique, first, std::end(range));
+        return;
+    }
+
+    Vector<Map<K, V, C, Allocator>> parts(
+      chunks, Map<K, V, C, Allocator>(map.key_comp(), map.get_allocator()));
+    detail::run_chunks(
+      pool, n, chunks, [&](std::size_t b, std::size_t e, std::size_t i) {
+          parts[i].insert(sorted_unique,
+                          first + static_cast<std::ptrdiff_t>(b),
+                          first + static_cast<std::ptrdiff_t>(e));
+      });
+
+    auto hint = map.empty() ? map.end() : map.lower_bound(first->first);
+    for (auto& part : parts)
+    {
+        while (! part.empty())
+        { hint = std::next(map.insert(hint, part.extract(part.begin()))); }
+    }
+}
+
+/**
+ * @brief Inserts the elements of a range that is sorted by key and free of
+ * duplicates into @c map using DefaultThreadPool().
+ *
+ * @param map map to insert the elements into.
+ * @param tag sorted_unique.
+ * @param range contiguous range of key-value pairs sorted by key.
+ *
+ * @tparam Range contiguous range type.
+ */
+template<class Range, class K, class V, class C, class Allocator>
+void insert(Map<K, V, C, Allocator>& map,
+            sorted_unique_t          tag,
+            const Range&             range)
+{
+    parallel::insert(DefaultThreadPool(), map, tag, range);
+}
+
+}  // namespace ara::core::parallel
+
+#endif  // ARA_CORE_PARALLEL_H_
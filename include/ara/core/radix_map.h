@@ -0,0 +1,1649 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_RADIX_MAP_H_
+#define ARA_CORE_RADIX_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/string_view.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ara::core {
+/**
+ * @brief Associative container that maps string keys to values, stored in an
+ * adaptive radix tree.
+ *
+ * Keys that share a prefix, like the slash-separated paths of meta-model
+ * elements, share the nodes on the path to it: every inner node stores the
+ * bytes its subtree has in common (path compression), and every element
+ * stores only the part of its key below its parent. Inner nodes come in four
+ * sizes for 4, 16, 48 and 256 children and grow and shrink with their number
+ * of children, so that sparse and dense branches both stay compact. Lookup
+ * compares each key byte at most once and takes time proportional to the
+ * length of the key, independent of the number of elements.
+ *
+ * The elements are ordered by the bytes of their keys, as std::string orders
+ * them. Since no element stores its full key, the iterators reconstruct the
+ * key on access: key() and dereferencing return it by value, while value()
+ * accesses the mapped value alone. Besides the usual lookup, the map finds
+ * all elements whose keys start with a prefix (prefix_range()) and the
+ * element whose key is the longest byte prefix of a string
+ * (longest_prefix_match()). Both compare bytes and know nothing of path
+ * components: "/a/b" is a prefix of "/a/bc".
+ *
+ * Elements never move: insertion and erasure invalidate only iterators,
+ * pointers and references to erased elements.
+ *
+ * @tparam V value type.
+ * @tparam Allocator allocator type, rebound to the storage of the nodes.
+ */
+template<typename V,
+         typename Allocator = Allocator<std::pair<const std::string, V>>>
+class RadixMap
+{
+    struct Node;
+    struct Leaf;
+    struct Inner;
+    template<bool Const> class Iterator;
+
+ public:
+    using key_type        = std::string;
+    using mapped_type     = V;
+    using value_type      = std::pair<const std::string, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type  = Allocator;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    RadixMap() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit RadixMap(const Allocator& alloc) : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last). If multiple elements in the range have keys that compare
+     * equivalent, only the first of them is inserted.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    RadixMap(InputIt first, InputIt last, const Allocator& alloc = Allocator())
+      : RadixMap(alloc)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer
+     * list init.
+     *
+     * @param init initializer list to initialize the elements of the
+     * container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    RadixMap(std::initializer_list<value_type> init,
+             const Allocator&                  alloc = Allocator())
+      : RadixMap(init.begin(), init.end(), alloc)
+    {}
+
+    /**
+     * @brief Copy constructor. Constructs the container with the copy of the
+     * contents of other, in the same tree shape.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    RadixMap(const RadixMap& other)
+      : alloc_(AllocatorTraits<UnitAllocator>::
+                 select_on_container_copy_construction(other.alloc_))
+    {
+        if (other.root_ != nullptr)
+        { root_ = clone(other.root_, nullptr); }
+        size_ = other.size_;
+    }
+
+    /**
+     * @brief Move constructor. Constructs the container with the contents of
+     * other using move semantics, other is left empty.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    RadixMap(RadixMap&& other) noexcept
+      : root_(std::exchange(other.root_, nullptr)),
+        size_(std::exchange(other.size_, 0)),
+        alloc_(std::move(other.alloc_))
+    {}
+
+    ~RadixMap() { clear(); }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to RadixMap instance.
+     */
+    RadixMap& operator=(const RadixMap& other)
+    {
+        if (this != &other)
+        {
+            RadixMap copy{other};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to RadixMap instance.
+     */
+    RadixMap& operator=(RadixMap&& other) noexcept
+    {
+        RadixMap moved{std::move(other)};
+        swap(moved);
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to RadixMap instance.
+     */
+    RadixMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if the maps hold equal keys mapped to equal values.
+     */
+    friend bool operator==(const RadixMap& lhs, const RadixMap& rhs)
+    {
+        if (lhs.size_ != rhs.size_)
+        { return false; }
+
+        for (auto l = lhs.begin(), r = rhs.begin(); l != lhs.end(); ++l, ++r)
+        {
+            if (! (l.value() == r.value()) || l.key() != r.key())
+            { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(alloc_);
+    }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container does not have an element
+     * with the specified key.
+     */
+    V& at(StringView key)
+    {
+        Leaf* const leaf = find_leaf(key);
+        if (leaf == nullptr)
+        { throw std::out_of_range("RadixMap::at"); }
+
+        return leaf->value;
+    }
+
+    /**
+     * @copydoc at(StringView)
+     */
+    const V& at(StringView key) const
+    {
+        return const_cast<RadixMap&>(*this).at(key);
+    }
+
+    /**
+     * @brief Returns a reference to the value that is mapped to a key
+     * equivalent to key, performing an insertion if such key does not already
+     * exist.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the new element if no element
+     * with key key existed. Otherwise a reference to the mapped value of the
+     * existing element whose key is equivalent to key.
+     */
+    V& operator[](StringView key) { return emplace_key(key).first->value; }
+
+    /**
+     * @brief Returns an iterator to the first element of the container, the
+     * element with the smallest key.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept
+    {
+        return iterator(root_ != nullptr ? Leftmost(root_) : nullptr);
+    }
+
+    /**
+     * @copydoc begin()
+     */
+    const_iterator begin() const noexcept
+    {
+        return const_cast<RadixMap&>(*this).begin();
+    }
+
+    /**
+     * @copydoc begin()
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the element following the last element of
+     * the container.
+     *
+     * @return iterator to the element following the last element.
+     */
+    iterator end() noexcept { return iterator(); }
+
+    /**
+     * @copydoc end()
+     */
+    const_iterator end() const noexcept { return const_iterator(); }
+
+    /**
+     * @copydoc end()
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Checks if the container has no elements.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Returns the number of elements in the container.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return size_; }
+
+    /**
+     * @brief Erases all elements from the container.
+     */
+    void clear() noexcept
+    {
+        if (root_ != nullptr)
+        { destroy_subtree(std::exchange(root_, nullptr)); }
+        size_ = 0;
+    }
+
+    /**
+     * @brief Inserts a copy of value if the container doesn't already contain
+     * an element with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether
+     * the insertion took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return try_emplace(value.first, value.second);
+    }
+
+    /**
+     * @copydoc insert(const value_type&)
+     */
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return try_emplace(value.first, std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last). If multiple elements
+     * in the range have keys that compare equivalent, only the first of them
+     * is inserted.
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            auto&& value = *first;
+            try_emplace(value.first, value.second);
+        }
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts an element with key key and a value constructed from
+     * args if the container doesn't already contain an element with an
+     * equivalent key. Otherwise args are left untouched.
+     *
+     * @param key the key of the element to insert.
+     * @param args arguments to forward to the constructor of the value.
+     *
+     * @return pair consisting of an iterator to the inserted element (or to
+     * the element that prevented the insertion) and a bool denoting whether
+     * the insertion took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(StringView key, Args&&... args)
+    {
+        auto const [leaf, inserted] =
+          emplace_key(key, std::forward<Args>(args)...);
+
+        return {iterator(leaf), inserted};
+    }
+
+    /**
+     * @brief Assigns obj to the value mapped to key, inserting a new element
+     * if the key does not exist yet.
+     *
+     * @param key the key of the element to insert or assign.
+     * @param obj the value to insert or assign.
+     *
+     * @return pair consisting of an iterator to the element and a bool that
+     * is true if the insertion took place and false if the assignment took
+     * place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(StringView key, M&& obj)
+    {
+        auto const [leaf, inserted] = emplace_key(key, std::forward<M>(obj));
+        if (! inserted)
+        { leaf->value = std::forward<M>(obj); }
+
+        return {iterator(leaf), inserted};
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) noexcept
+    {
+        Leaf* const next = NextAfter(pos.leaf_);
+        erase_leaf(pos.leaf_);
+
+        return iterator(next);
+    }
+
+    /**
+     * @copydoc erase(const_iterator)
+     */
+    iterator erase(iterator pos) noexcept { return erase(const_iterator(pos)); }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if one
+     * exists.
+     *
+     * @param key key value of the elements to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(StringView key) noexcept
+    {
+        Leaf* const leaf = find_leaf(key);
+        if (leaf == nullptr)
+        { return 0; }
+
+        erase_leaf(leaf);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(RadixMap& other) noexcept
+    {
+        using std::swap;
+        swap(root_, other.root_);
+        swap(size_, other.size_);
+        if constexpr (AllocatorTraits<
+                        UnitAllocator>::propagate_on_container_swap::value)
+        { swap(alloc_, other.alloc_); }
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key, either 1 or 0.
+     */
+    size_type count(StringView key) const noexcept
+    {
+        return find_leaf(key) != nullptr ? 1 : 0;
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to the element, or end() if no such element is found.
+     */
+    iterator find(StringView key) noexcept { return iterator(find_leaf(key)); }
+
+    /**
+     * @copydoc find(StringView)
+     */
+    const_iterator find(StringView key) const noexcept
+    {
+        return const_iterator(find_leaf(key));
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key in the
+     * container.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(StringView key) const noexcept
+    {
+        return find_leaf(key) != nullptr;
+    }
+
+    /**
+     * @brief Returns the range of all elements whose keys start with prefix,
+     * in key order. The elements are the ones of a single subtree, so the
+     * range is found in time proportional to the length of prefix.
+     *
+     * @param prefix the prefix of the keys of the elements.
+     *
+     * @return pair of iterators to the first element whose key starts with
+     * prefix and to the element following the last such element.
+     */
+    std::pair<iterator, iterator> prefix_range(StringView prefix) noexcept
+    {
+        Node* const subtree = find_subtree(prefix);
+        if (subtree == nullptr)
+        { return {end(), end()}; }
+
+        return {iterator(Leftmost(subtree)), iterator(NextAfter(subtree))};
+    }
+
+    /**
+     * @copydoc prefix_range(StringView)
+     */
+    std::pair<const_iterator, const_iterator>
+    prefix_range(StringView prefix) const noexcept
+    {
+        auto const [first, last] = const_cast<RadixMap&>(*this).prefix_range(
+          prefix);
+
+        return {first, last};
+    }
+
+    /**
+     * @brief Finds the element whose key is the longest prefix of key,
+     * including key itself. The keys are compared byte by byte, not by path
+     * component, so the element "/a/b" matches the key "/a/bc" although it
+     * is not its ancestor.
+     *
+     * @param key the string to match the keys of the elements against.
+     *
+     * @return iterator to the element with the longest matching key, or end()
+     * if no key is a prefix of key.
+     */
+    iterator longest_prefix_match(StringView key) noexcept
+    {
+        return iterator(longest_prefix(key));
+    }
+
+    /**
+     * @copydoc longest_prefix_match(StringView)
+     */
+    const_iterator longest_prefix_match(StringView key) const noexcept
+    {
+        return const_iterator(longest_prefix(key));
+    }
+
+ private:
+    friend struct MemoryFootprintTraits<RadixMap>;
+
+    enum class Kind : std::uint8_t
+    {
+        kLeaf,
+        kNode4,
+        kNode16,
+        kNode48,
+        kNode256
+    };
+
+    /** Edge of an element whose key ends with the path of its parent. */
+    static constexpr std::uint16_t kTerminal = 256;
+
+    /**
+     * @brief Header of all nodes. The bytes of the node follow the concrete
+     * node in the same allocation: the path an inner node compresses, or the
+     * rest of the key of an element.
+     */
+    struct Node
+    {
+        Inner*        parent{nullptr};
+        std::uint32_t length{0};
+        std::uint32_t capacity{0};
+        std::uint16_t edge{kTerminal};
+        std::uint16_t count{0};
+        Kind          kind{Kind::kLeaf};
+    };
+
+    struct Leaf : Node
+    {
+        template<class... Args>
+        explicit Leaf(std::in_place_t, Args&&... args)
+          : value(std::forward<Args>(args)...)
+        {}
+
+        V value;
+    };
+
+    struct Inner : Node
+    {
+        Leaf* terminal{nullptr};
+    };
+
+    /** Up to 4 children, sorted by their edge byte. */
+    struct Node4 : Inner
+    {
+        std::uint8_t keys[4]{};
+        Node*        children[4]{};
+    };
+
+    /** Up to 16 children, sorted by their edge byte. */
+    struct Node16 : Inner
+    {
+        std::uint8_t keys[16]{};
+        Node*        children[16]{};
+    };
+
+    /** Up to 48 children, indexed by edge byte, plus one. */
+    struct Node48 : Inner
+    {
+        std::uint8_t index[256]{};
+        Node*        children[48]{};
+    };
+
+    /** Up to 256 children, directly indexed by edge byte. */
+    struct Node256 : Inner
+    {
+        Node* children[256]{};
+    };
+
+    static constexpr std::size_t kUnit =
+      std::max({alignof(Leaf), alignof(Node256), sizeof(void*)});
+
+    struct alignas(kUnit) Unit
+    {
+        unsigned char bytes[kUnit];
+    };
+
+    using UnitAllocator =
+      typename AllocatorTraits<Allocator>::template rebind_alloc<Unit>;
+    using UnitTraits = AllocatorTraits<UnitAllocator>;
+
+    template<class Fn> static decltype(auto) Visit(Node* node, Fn&& fn)
+    {
+        switch (node->kind)
+        {
+        case Kind::kLeaf: return fn(static_cast<Leaf*>(node));
+        case Kind::kNode4: return fn(static_cast<Node4*>(node));
+        case Kind::kNode16: return fn(static_cast<Node16*>(node));
+        case Kind::kNode48: return fn(static_cast<Node48*>(node));
+        default: return fn(static_cast<Node256*>(node));
+        }
+    }
+
+    template<class T> static constexpr Kind KindOf() noexcept
+    {
+        if constexpr (std::is_same_v<T, Leaf>)
+        { return Kind::kLeaf; }
+        else if constexpr (std::is_same_v<T, Node4>)
+        { return Kind::kNode4; }
+        else if constexpr (std::is_same_v<T, Node16>)
+        { return Kind::kNode16; }
+        else if constexpr (std::is_same_v<T, Node48>)
+        { return Kind::kNode48; }
+        else
+        { return Kind::kNode256; }
+    }
+
+    template<class T> static std::size_t Units(std::size_t capacity) noexcept
+    {
+        return (sizeof(T) + capacity + kUnit - 1) / kUnit;
+    }
+
+    static unsigned char* Bytes(Node* node) noexcept
+    {
+        return Visit(node, [](auto* concrete) {
+            return reinterpret_cast<unsigned char*>(concrete + 1);
+        });
+    }
+
+    static StringView Path(const Node* node) noexcept
+    {
+        return {reinterpret_cast<const char*>(Bytes(const_cast<Node*>(node))),
+                node->length};
+    }
+
+    static std::size_t CommonPrefix(StringView lhs, StringView rhs) noexcept
+    {
+        auto const mismatch =
+          std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+
+        return static_cast<std::size_t>(mismatch.first - lhs.begin());
+    }
+
+    static constexpr std::uint8_t ToByte(char c) noexcept
+    {
+        return static_cast<std::uint8_t>(c);
+    }
+
+    /**
+     * @brief The slot of the child of node with the edge byte, or nullptr.
+     */
+    static Node** FindChild(Inner* node, std::uint8_t byte) noexcept
+    {
+        switch (node->kind)
+        {
+        case Kind::kNode4:
+        {
+            auto* const n = static_cast<Node4*>(node);
+            for (std::size_t i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] == byte)
+                { return &n->children[i]; }
+            }
+            return nullptr;
+        }
+        case Kind::kNode16:
+        {
+            auto* const n = static_cast<Node16*>(node);
+#if defined(__SSE2__)
+            __m128i const keys =
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(n->keys));
+            __m128i const needle = _mm_set1_epi8(static_cast<char>(byte));
+            unsigned const mask =
+              static_cast<unsigned>(
+                _mm_movemask_epi8(_mm_cmpeq_epi8(keys, needle)))
+              & ((1u << n->count) - 1);
+            return mask != 0 ? &n->children[std::countr_zero(mask)] : nullptr;
+#else
+            for (std::size_t i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] == byte)
+                { return &n->children[i]; }
+            }
+            return nullptr;
+#endif
+        }
+        case Kind::kNode48:
+        {
+            auto* const n = static_cast<Node48*>(node);
+            return n->index[byte] != 0 ? &n->children[n->index[byte] - 1]
+                                       : nullptr;
+        }
+        default:
+        {
+            auto* const n = static_cast<Node256*>(node);
+            return n->children[byte] != nullptr ? &n->children[byte] : nullptr;
+        }
+        }
+    }
+
+    /**
+     * @brief The child of node with the smallest edge byte above byte, or
+     * nullptr. A byte of -1 yields the first child.
+     */
+    static Node* ChildAfter(const Inner* node, int byte) noexcept
+    {
+        switch (node->kind)
+        {
+        case Kind::kNode4:
+        {
+            auto* const n = static_cast<const Node4*>(node);
+            for (std::size_t i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] > byte)
+                { return n->children[i]; }
+            }
+            return nullptr;
+        }
+        case Kind::kNode16:
+        {
+            auto* const n = static_cast<const Node16*>(node);
+            for (std::size_t i = 0; i < n->count; ++i)
+            {
+                if (n->keys[i] > byte)
+                { return n->children[i]; }
+            }
+            return nullptr;
+        }
+        case Kind::kNode48:
+        {
+            auto* const n = static_cast<const Node48*>(node);
+            for (int b = byte + 1; b < 256; ++b)
+            {
+                if (n->index[b] != 0)
+                { return n->children[n->index[b] - 1]; }
+            }
+            return nullptr;
+        }
+        default:
+        {
+            auto* const n = static_cast<const Node256*>(node);
+            for (int b = byte + 1; b < 256; ++b)
+            {
+                if (n->children[b] != nullptr)
+                { return n->children[b]; }
+            }
+            return nullptr;
+        }
+        }
+    }
+
+    /**
+     * @brief Calls fn(byte, child) for all children of node in byte order.
+     */
+    template<class Fn> static void ForEachChild(const Inner* node, Fn&& fn)
+    {
+        // Looks up the next child first, as fn may destroy the child.
+        for (Node* child = ChildAfter(node, -1); child != nullptr;)
+        {
+            Node* const next = ChildAfter(node, child->edge);
+            fn(static_cast<std::uint8_t>(child->edge), child);
+            child = next;
+        }
+    }
+
+    static constexpr std::size_t Capacity(Kind kind) noexcept
+    {
+        switch (kind)
+        {
+        case Kind::kNode4: return 4;
+        case Kind::kNode16: return 16;
+        case Kind::kNode48: return 48;
+        default: return 256;
+        }
+    }
+
+    /**
+     * @brief Number of children at which a node is replaced by the next
+     * smaller kind, which then still has room for a few more children.
+     */
+    static constexpr std::size_t ShrinkAt(Kind kind) noexcept
+    {
+        switch (kind)
+        {
+        case Kind::kNode16: return 3;
+        case Kind::kNode48: return 12;
+        case Kind::kNode256: return 36;
+        default: return 0;
+        }
+    }
+
+    /**
+     * @brief Adds child to node, which must have room for it.
+     */
+    static void
+    InsertChild(Inner* node, std::uint8_t byte, Node* child) noexcept
+    {
+        child->parent = node;
+        child->edge   = byte;
+        switch (node->kind)
+        {
+        case Kind::kNode4:
+            InsertSorted(static_cast<Node4*>(node), byte, child);
+            break;
+        case Kind::kNode16:
+            InsertSorted(static_cast<Node16*>(node), byte, child);
+            break;
+        case Kind::kNode48:
+        {
+            auto* const n    = static_cast<Node48*>(node);
+            std::size_t slot = 0;
+            while (n->children[slot] != nullptr) { ++slot; }
+            n->children[slot] = child;
+            n->index[byte]    = static_cast<std::uint8_t>(slot + 1);
+            break;
+        }
+        default: static_cast<Node256*>(node)->children[byte] = child; break;
+        }
+        ++node->count;
+    }
+
+    template<class N>
+    static void InsertSorted(N* node, std::uint8_t byte, Node* child) noexcept
+    {
+        std::size_t i = node->count;
+        for (; i > 0 && node->keys[i - 1] > byte; --i)
+        {
+            node->keys[i]     = node->keys[i - 1];
+            node->children[i] = node->children[i - 1];
+        }
+        node->keys[i]     = byte;
+        node->children[i] = child;
+    }
+
+    /**
+     * @brief Removes the child with the edge byte from node.
+     */
+    static void EraseChild(Inner* node, std::uint8_t byte) noexcept
+    {
+        switch (node->kind)
+        {
+        case Kind::kNode4:
+            EraseSorted(static_cast<Node4*>(node), byte);
+            break;
+        case Kind::kNode16:
+            EraseSorted(static_cast<Node16*>(node), byte);
+            break;
+        case Kind::kNode48:
+        {
+            auto* const n                 = static_cast<Node48*>(node);
+            n->children[n->index[byte] - 1] = nullptr;
+            n->index[byte]                  = 0;
+            break;
+        }
+        default: static_cast<Node256*>(node)->children[byte] = nullptr; break;
+        }
+        --node->count;
+    }
+
+    template<class N>
+    static void EraseSorted(N* node, std::uint8_t byte) noexcept
+    {
+        std::size_t i = 0;
+        while (node->keys[i] != byte) { ++i; }
+        for (; i + 1 < node->count; ++i)
+        {
+            node->keys[i]     = node->keys[i + 1];
+            node->children[i] = node->children[i + 1];
+        }
+    }
+
+    /**
+     * @brief The first element in the subtree of node, which is not empty.
+     * An element ending at an inner node precedes its children.
+     */
+    static Leaf* Leftmost(Node* node) noexcept
+    {
+        while (node->kind != Kind::kLeaf)
+        {
+            auto* const inner = static_cast<Inner*>(node);
+            if (inner->terminal != nullptr)
+            { return inner->terminal; }
+            node = ChildAfter(inner, -1);
+            // An inner node without an element always has a child.
+            if (node == nullptr)
+            { return nullptr; }
+        }
+
+        return static_cast<Leaf*>(node);
+    }
+
+    /**
+     * @brief The first element following the subtree of node, or nullptr.
+     */
+    static Leaf* NextAfter(Node* node) noexcept
+    {
+        for (; node->parent != nullptr; node = node->parent)
+        {
+            int const after = node->edge == kTerminal ? -1 : node->edge;
+            if (Node* const next = ChildAfter(node->parent, after))
+            { return Leftmost(next); }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Concatenates the paths and edges from the root to leaf.
+     */
+    static std::string KeyOf(const Leaf* leaf)
+    {
+        std::size_t length = 0;
+        for (const Node* node = leaf; node != nullptr; node = node->parent)
+        { length += node->length + (node->edge != kTerminal ? 1 : 0); }
+
+        std::string key(length, '\0');
+        for (const Node* node = leaf; node != nullptr; node = node->parent)
+        {
+            length -= node->length;
+            Path(node).copy(key.data() + length, node->length);
+            if (node->edge != kTerminal)
+            { key[--length] = static_cast<char>(node->edge); }
+        }
+
+        return key;
+    }
+
+    template<class T, class... Args>
+    T* new_node(StringView bytes, std::size_t capacity, Args&&... args)
+    {
+        std::size_t const units  = Units<T>(capacity);
+        Unit* const       memory = UnitTraits::allocate(alloc_, units);
+        T*                node   = nullptr;
+        try
+        {
+            node = ::new (static_cast<void*>(std::to_address(memory)))
+              T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            UnitTraits::deallocate(alloc_, memory, units);
+            throw;
+        }
+        node->kind     = KindOf<T>();
+        node->length   = static_cast<std::uint32_t>(bytes.size());
+        node->capacity = static_cast<std::uint32_t>(capacity);
+        bytes.copy(reinterpret_cast<char*>(node + 1), bytes.size());
+
+        return node;
+    }
+
+    template<class... Args> Leaf* new_leaf(StringView rest, Args&&... args)
+    {
+        return new_node<Leaf>(
+          rest, rest.size(), std::in_place, std::forward<Args>(args)...);
+    }
+
+    Inner* new_inner(Kind kind, StringView path, std::size_t capacity)
+    {
+        switch (kind)
+        {
+        case Kind::kNode4: return new_node<Node4>(path, capacity);
+        case Kind::kNode16: return new_node<Node16>(path, capacity);
+        case Kind::kNode48: return new_node<Node48>(path, capacity);
+        default: return new_node<Node256>(path, capacity);
+        }
+    }
+
+    void delete_node(Node* node) noexcept
+    {
+        Visit(node, [this](auto* concrete) {
+            using T = std::remove_pointer_t<decltype(concrete)>;
+            std::size_t const units = Units<T>(concrete->capacity);
+            std::destroy_at(concrete);
+            UnitTraits::deallocate(
+              alloc_, reinterpret_cast<Unit*>(concrete), units);
+        });
+    }
+
+    void destroy_subtree(Node* node) noexcept
+    {
+        if (node->kind != Kind::kLeaf)
+        {
+            auto* const inner = static_cast<Inner*>(node);
+            if (inner->terminal != nullptr)
+            { delete_node(inner->terminal); }
+            ForEachChild(inner, [this](std::uint8_t, Node* child) {
+                destroy_subtree(child);
+            });
+        }
+        delete_node(node);
+    }
+
+    Node* clone(const Node* node, Inner* parent)
+    {
+        if (node->kind == Kind::kLeaf)
+        {
+            Leaf* const copy = new_leaf(
+              Path(node), static_cast<const Leaf*>(node)->value);
+            copy->parent = parent;
+            copy->edge   = node->edge;
+            return copy;
+        }
+
+        auto* const  inner = static_cast<const Inner*>(node);
+        Inner* const copy  = new_inner(node->kind, Path(node), node->length);
+        copy->parent       = parent;
+        copy->edge         = node->edge;
+        try
+        {
+            if (inner->terminal != nullptr)
+            {
+                copy->terminal =
+                  static_cast<Leaf*>(clone(inner->terminal, copy));
+            }
+            ForEachChild(inner, [this, copy](std::uint8_t byte, Node* child) {
+                InsertChild(copy, byte, clone(child, copy));
+            });
+        }
+        catch (...)
+        {
+            destroy_subtree(copy);
+            throw;
+        }
+
+        return copy;
+    }
+
+    /**
+     * @brief Points the slot of the parent, or the root, that points to node,
+     * which is no terminal element, to replacement instead.
+     */
+    void replace_node(Node* node, Node* replacement) noexcept
+    {
+        if (node->parent == nullptr)
+        {
+            root_ = replacement;
+            return;
+        }
+
+        // A node always hangs from its parent by its edge byte.
+        if (Node** const slot = FindChild(
+              node->parent, static_cast<std::uint8_t>(node->edge)))
+        { *slot = replacement; }
+    }
+
+    /**
+     * @brief Replaces node by a node of the given kind with the same path,
+     * terminal element and children, and returns the replacement.
+     */
+    Inner* rebuild(Inner* node, Kind kind, std::size_t capacity)
+    {
+        Inner* const fresh = new_inner(kind, Path(node), capacity);
+        fresh->parent      = node->parent;
+        fresh->edge        = node->edge;
+        fresh->terminal    = node->terminal;
+        if (fresh->terminal != nullptr)
+        { fresh->terminal->parent = fresh; }
+        ForEachChild(node, [fresh](std::uint8_t byte, Node* child) {
+            InsertChild(fresh, byte, child);
+        });
+        replace_node(node, fresh);
+        delete_node(node);
+
+        return fresh;
+    }
+
+    Leaf* find_leaf(StringView key) const noexcept
+    {
+        Node*       node  = root_;
+        std::size_t depth = 0;
+        while (node != nullptr)
+        {
+            StringView const path = Path(node);
+            if (key.size() - depth < path.size()
+                || key.substr(depth, path.size()) != path)
+            { return nullptr; }
+            depth += path.size();
+
+            if (node->kind == Kind::kLeaf)
+            { return depth == key.size() ? static_cast<Leaf*>(node) : nullptr; }
+
+            auto* const inner = static_cast<Inner*>(node);
+            if (depth == key.size())
+            { return inner->terminal; }
+
+            Node** const child = FindChild(inner, ToByte(key[depth]));
+            if (child == nullptr)
+            { return nullptr; }
+            node = *child;
+            ++depth;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief The root of the subtree holding exactly the keys that start with
+     * prefix, or nullptr.
+     */
+    Node* find_subtree(StringView prefix) const noexcept
+    {
+        Node*       node  = root_;
+        std::size_t depth = 0;
+        while (node != nullptr)
+        {
+            StringView const path = Path(node);
+            StringView const rest = prefix.substr(depth);
+            if (rest.size() <= path.size())
+            { return path.starts_with(rest) ? node : nullptr; }
+            if (! rest.starts_with(path) || node->kind == Kind::kLeaf)
+            { return nullptr; }
+            depth += path.size();
+
+            Node** const child =
+              FindChild(static_cast<Inner*>(node), ToByte(prefix[depth]));
+            if (child == nullptr)
+            { return nullptr; }
+            node = *child;
+            ++depth;
+        }
+
+        return nullptr;
+    }
+
+    Leaf* longest_prefix(StringView key) const noexcept
+    {
+        Leaf*       best  = nullptr;
+        Node*       node  = root_;
+        std::size_t depth = 0;
+        while (node != nullptr)
+        {
+            StringView const path = Path(node);
+            if (key.size() - depth < path.size()
+                || key.substr(depth, path.size()) != path)
+            { break; }
+            depth += path.size();
+
+            if (node->kind == Kind::kLeaf)
+            { return static_cast<Leaf*>(node); }
+
+            auto* const inner = static_cast<Inner*>(node);
+            if (inner->terminal != nullptr)
+            { best = inner->terminal; }
+            if (depth == key.size())
+            { break; }
+
+            Node** const child = FindChild(inner, ToByte(key[depth]));
+            if (child == nullptr)
+            { break; }
+            node = *child;
+            ++depth;
+        }
+
+        return best;
+    }
+
+    /**
+     * @brief Finds the element with key, or inserts one with a value
+     * constructed from args. The new element is created after any node that
+     * has to grow, so that a throwing constructor leaves the map unchanged.
+     */
+    template<class... Args>
+    std::pair<Leaf*, bool> emplace_key(StringView key, Args&&... args)
+    {
+        if (root_ == nullptr)
+        {
+            Leaf* const leaf = new_leaf(key, std::forward<Args>(args)...);
+            root_            = leaf;
+            ++size_;
+            return {leaf, true};
+        }
+
+        Node*       node  = root_;
+        std::size_t depth = 0;
+        while (true)
+        {
+            StringView const  path   = Path(node);
+            std::size_t const common = CommonPrefix(path, key.substr(depth));
+            if (common < path.size())
+            {
+                return {split(node,
+                              common,
+                              key,
+                              depth + common,
+                              std::forward<Args>(args)...),
+                        true};
+            }
+            depth += common;
+
+            if (node->kind == Kind::kLeaf)
+            {
+                if (depth == key.size())
+                { return {static_cast<Leaf*>(node), false}; }
+                return {extend(static_cast<Leaf*>(node),
+                               key,
+                               depth,
+                               std::forward<Args>(args)...),
+                        true};
+            }
+
+            auto* inner = static_cast<Inner*>(node);
+            if (depth == key.size())
+            {
+                if (inner->terminal != nullptr)
+                { return {inner->terminal, false}; }
+
+                Leaf* const leaf = new_leaf({}, std::forward<Args>(args)...);
+                leaf->parent     = inner;
+                inner->terminal  = leaf;
+                ++size_;
+                return {leaf, true};
+            }
+
+            std::uint8_t const byte = ToByte(key[depth]);
+            if (Node** const child = FindChild(inner, byte))
+            {
+                node = *child;
+                ++depth;
+                continue;
+            }
+
+            if (inner->count == Capacity(inner->kind))
+            {
+                auto const kind = static_cast<Kind>(
+                  static_cast<std::uint8_t>(inner->kind) + 1);
+                inner = rebuild(inner, kind, inner->length);
+            }
+            Leaf* const leaf =
+              new_leaf(key.substr(depth + 1), std::forward<Args>(args)...);
+            InsertChild(inner, byte, leaf);
+            ++size_;
+            return {leaf, true};
+        }
+    }
+
+    /**
+     * @brief Inserts the element with key below a new inner node that takes
+     * the place of node and holds the first common bytes of its path. The key
+     * continues at depth, or ends there.
+     */
+    template<class... Args>
+    Leaf* split(Node*       node,
+                std::size_t common,
+                StringView  key,
+                std::size_t depth,
+                Args&&... args)
+    {
+        StringView const path   = Path(node);
+        Node4* const branch = new_node<Node4>(path.substr(0, common), common);
+        Leaf*        leaf   = nullptr;
+        try
+        {
+            leaf = new_leaf(depth < key.size() ? key.substr(depth + 1)
+                                               : StringView{},
+                            std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            delete_node(branch);
+            throw;
+        }
+
+        branch->parent = node->parent;
+        branch->edge   = node->edge;
+        replace_node(node, branch);
+
+        // The node keeps the bytes after the one it now hangs from.
+        std::uint8_t const byte = ToByte(path[common]);
+        unsigned char*     bytes = Bytes(node);
+        std::memmove(bytes, bytes + common + 1, node->length - common - 1);
+        node->length -= static_cast<std::uint32_t>(common + 1);
+        InsertChild(branch, byte, node);
+
+        if (depth < key.size())
+        { InsertChild(branch, ToByte(key[depth]), leaf); }
+        else
+        {
+            leaf->parent     = branch;
+            branch->terminal = leaf;
+        }
+        ++size_;
+
+        return leaf;
+    }
+
+    /**
+     * @brief Inserts the element with key, which continues at depth past the
+     * full key of leaf. The leaf becomes the terminal element of a new inner
+     * node with its path, so that it keeps its address.
+     */
+    template<class... Args>
+    Leaf* extend(Leaf* leaf, StringView key, std::size_t depth, Args&&... args)
+    {
+        Node4* const branch = new_node<Node4>(Path(leaf), leaf->length);
+        Leaf*        fresh  = nullptr;
+        try
+        {
+            fresh =
+              new_leaf(key.substr(depth + 1), std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            delete_node(branch);
+            throw;
+        }
+
+        branch->parent = leaf->parent;
+        branch->edge   = leaf->edge;
+        replace_node(leaf, branch);
+
+        leaf->length     = 0;
+        leaf->parent     = branch;
+        leaf->edge       = kTerminal;
+        branch->terminal = leaf;
+        InsertChild(branch, ToByte(key[depth]), fresh);
+        ++size_;
+
+        return fresh;
+    }
+
+    void erase_leaf(Leaf* leaf) noexcept
+    {
+        Inner* const parent = leaf->parent;
+        if (parent == nullptr)
+        { root_ = nullptr; }
+        else if (leaf->edge == kTerminal)
+        { parent->terminal = nullptr; }
+        else
+        { EraseChild(parent, static_cast<std::uint8_t>(leaf->edge)); }
+        delete_node(leaf);
+        --size_;
+
+        if (parent != nullptr)
+        { compact(parent); }
+    }
+
+    /**
+     * @brief Restores the shape of the tree after node lost an element or a
+     * child: removes empty nodes, merges a node with its only child and
+     * shrinks nodes that hold few children. Elements are merged only if their
+     * storage has room for the longer path, so that they keep their address.
+     */
+    void compact(Inner* node) noexcept
+    {
+        while (node->count == 0 && node->terminal == nullptr)
+        {
+            Inner* const parent = node->parent;
+            if (parent == nullptr)
+            { root_ = nullptr; }
+            else
+            { EraseChild(parent, static_cast<std::uint8_t>(node->edge)); }
+            delete_node(node);
+            if (parent == nullptr)
+            { return; }
+            node = parent;
+        }
+
+        if (node->count == 0)
+        {
+            Leaf* const leaf = node->terminal;
+            if (leaf->capacity >= node->length)
+            {
+                Path(node).copy(reinterpret_cast<char*>(Bytes(leaf)),
+                                node->length);
+                leaf->length = node->length;
+                leaf->parent = node->parent;
+                leaf->edge   = node->edge;
+                replace_node(node, leaf);
+                delete_node(node);
+            }
+            return;
+        }
+
+        // Compaction saves memory but is not required; if it cannot
+        // allocate, the node stays as it is.
+        try
+        {
+            if (node->count == 1 && node->terminal == nullptr)
+            { merge_child(node); }
+            else if (node->count <= ShrinkAt(node->kind))
+            {
+                auto const kind = static_cast<Kind>(
+                  static_cast<std::uint8_t>(node->kind) - 1);
+                rebuild(node, kind, node->length);
+            }
+        }
+        catch (...)
+        {}
+    }
+
+    /**
+     * @brief Replaces node, which holds one child and no element, by the
+     * child, prepending the path of node and the edge byte to its path.
+     */
+    void merge_child(Inner* node)
+    {
+        Node* child = ChildAfter(node, -1);
+        // The caller checked that node has a child.
+        if (child == nullptr)
+        { return; }
+
+        std::size_t const length = node->length + 1 + child->length;
+        if (child->capacity < length)
+        {
+            if (child->kind == Kind::kLeaf)
+            { return; }
+            child = rebuild(static_cast<Inner*>(child), child->kind, length);
+        }
+
+        unsigned char* const bytes = Bytes(child);
+        std::memmove(bytes + node->length + 1, bytes, child->length);
+        Path(node).copy(reinterpret_cast<char*>(bytes), node->length);
+        bytes[node->length] = static_cast<unsigned char>(child->edge);
+        child->length       = static_cast<std::uint32_t>(length);
+        child->parent       = node->parent;
+        child->edge         = node->edge;
+        replace_node(node, child);
+        delete_node(node);
+    }
+
+    /**
+     * @brief Calls fn(node, bytes used, bytes reserved) for every node.
+     */
+    template<class Fn> void visit_nodes(const Node* node, Fn& fn) const
+    {
+        Visit(const_cast<Node*>(node), [&fn](auto* concrete) {
+            using T = std::remove_pointer_t<decltype(concrete)>;
+            fn(sizeof(T) + concrete->length,
+               Units<T>(concrete->capacity) * kUnit);
+        });
+        if (node->kind != Kind::kLeaf)
+        {
+            auto* const inner = static_cast<const Inner*>(node);
+            if (inner->terminal != nullptr)
+            { visit_nodes(inner->terminal, fn); }
+            ForEachChild(inner, [this, &fn](std::uint8_t, Node* child) {
+                visit_nodes(child, fn);
+            });
+        }
+    }
+
+    Node*                                root_{nullptr};
+    size_type                            size_{0};
+    [[no_unique_address]] UnitAllocator alloc_;
+};
+
+/**
+ * @brief Forward iterator over the elements of a RadixMap in key order.
+ */
+template<typename V, typename Allocator>
+template<bool Const>
+class RadixMap<V, Allocator>::Iterator
+{
+    using Value = std::conditional_t<Const, const V, V>;
+
+ public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = typename RadixMap::value_type;
+    using difference_type   = std::ptrdiff_t;
+    using reference         = std::pair<const std::string, Value&>;
+
+    /**
+     * @brief Holds the element a member access refers to.
+     */
+    struct Arrow
+    {
+        reference element;
+
+        const reference* operator->() const noexcept { return &element; }
+    };
+
+    using pointer = Arrow;
+
+    Iterator() = default;
+
+    template<bool OtherConst>
+        requires(Const && ! OtherConst)
+    Iterator(const Iterator<OtherConst>& other) noexcept : leaf_(other.leaf_)
+    {}
+
+    /**
+     * @brief Reconstructs the key of the element from the path to it.
+     *
+     * @return the key of the element.
+     */
+    std::string key() const { return KeyOf(leaf_); }
+
+    /**
+     * @brief Accesses the mapped value, without reconstructing the key.
+     *
+     * @return reference to the mapped value of the element.
+     */
+    Value& value() const noexcept { return leaf_->value; }
+
+    reference operator*() const { return {key(), leaf_->value}; }
+
+    pointer operator->() const { return pointer{**this}; }
+
+    Iterator& operator++() noexcept
+    {
+        leaf_ = NextAfter(leaf_);
+        return *this;
+    }
+
+    Iterator operator++(int) noexcept
+    {
+        Iterator const previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+    {
+        return lhs.leaf_ == rhs.leaf_;
+    }
+
+ private:
+    friend class RadixMap;
+    template<bool> friend class Iterator;
+
+    explicit Iterator(Leaf* leaf) noexcept : leaf_(leaf) {}
+
+    Leaf* leaf_{nullptr};
+};
+
+/**
+ * @brief Exchanges the contents of lhs and rhs.
+ *
+ * @param lhs container whose contents to swap.
+ * @param rhs container whose contents to swap.
+ */
+template<class V, class Allocator>
+void swap(RadixMap<V, Allocator>& lhs,
+          RadixMap<V, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief RadixMap owns its nodes, each allocated together with its bytes of
+ * the keys.
+ */
+template<class V, class Allocator>
+struct MemoryFootprintTraits<RadixMap<V, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const RadixMap<V, Allocator>& value)
+    {
+        MemoryFootprint footprint;
+        if (value.root_ == nullptr)
+        { return footprint; }
+
+        auto count = [&footprint](std::size_t used, std::size_t reserved) {
+            footprint += MemoryFootprint{used, reserved, 1};
+        };
+        value.visit_nodes(value.root_, count);
+
+        if constexpr (MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (auto it = value.begin(); it != value.end(); ++it)
+            { footprint += memory_footprint(it.value()); }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_RADIX_MAP_H_
@@ -0,0 +1,1052 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_RING_BUFFER_H_
+#define ARA_CORE_RING_BUFFER_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/span.h"
+#include <algorithm>
+#include <bit>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+
+namespace detail {
+/**
+ * @brief Random access iterator over the elements of a ring buffer.
+ *
+ * The position is an unbounded counter, it is masked only on access.
+ *
+ * @tparam T element type, const qualified for const iterators.
+ */
+template<class T> class RingBufferIterator
+{
+ public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = std::remove_cv_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    RingBufferIterator() = default;
+
+    RingBufferIterator(T* data, std::size_t mask, std::size_t pos) noexcept
+      : data_{data}
+      , mask_{mask}
+      , pos_{pos}
+    {}
+
+    /**
+     * @brief Converts an iterator into a const iterator.
+     */
+    operator RingBufferIterator<const T>() const noexcept
+    {
+        return {data_, mask_, pos_};
+    }
+
+    reference operator*() const noexcept { return data_[pos_ & mask_]; }
+    pointer   operator->() const noexcept { return data_ + (pos_ & mask_); }
+    reference operator[](difference_type n) const noexcept
+    {
+        return *(*this + n);
+    }
+
+    RingBufferIterator& operator++() noexcept
+    {
+        ++pos_;
+        return *this;
+    }
+
+    RingBufferIterator operator++(int) noexcept
+    {
+        auto tmp = *this;
+        ++pos_;
+        return tmp;
+    }
+
+    RingBufferIterator& operator--() noexcept
+    {
+        --pos_;
+        return *this;
+    }
+
+    RingBufferIterator operator--(int) noexcept
+    {
+        auto tmp = *this;
+        --pos_;
+        return tmp;
+    }
+
+    RingBufferIterator& operator+=(difference_type n) noexcept
+    {
+        pos_ += static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    RingBufferIterator& operator-=(difference_type n) noexcept
+    {
+        pos_ -= static_cast<std::size_t>(n);
+        return *this;
+    }
+
+    friend RingBufferIterator
+    operator+(RingBufferIterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend RingBufferIterator
+    operator+(difference_type n, RingBufferIterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend RingBufferIterator
+    operator-(RingBufferIterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const RingBufferIterator& lhs,
+                                     const RingBufferIterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.pos_ - rhs.pos_);
+    }
+
+    friend bool operator==(const RingBufferIterator& lhs,
+                           const RingBufferIterator& rhs) noexcept
+    {
+        return lhs.pos_ == rhs.pos_;
+    }
+
+    friend auto operator<=>(const RingBufferIterator& lhs,
+                            const RingBufferIterator& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.pos_ - rhs.pos_) <=> 0;
+    }
+
+ private:
+    T*          data_{nullptr};
+    std::size_t mask_{0};
+    std::size_t pos_{0};
+};
+
+/**
+ * @brief Common implementation of RingBuffer and StaticRingBuffer.
+ *
+ * The capacity is always a power of two, so that a slot is found by masking
+ * an unbounded read or write counter. Derived classes provide the storage and
+ * the member function grow(size_type, Construct), which either enlarges the
+ * storage or throws std::length_error. The functor constructs the appended
+ * elements at their final place in the new storage, before the old one is
+ * released, so that they may be copied from elements of the container.
+ *
+ * @tparam T element type.
+ * @tparam Derived the derived container type.
+ */
+template<class T, class Derived> class RingBufferBase
+{
+ public:
+    using value_type             = T;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = value_type*;
+    using const_pointer          = const value_type*;
+    using iterator               = RingBufferIterator<T>;
+    using const_iterator         = RingBufferIterator<const T>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using span_type              = Span<T>;
+    using const_span_type        = Span<const T>;
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return tail_ - head_; }
+
+    /**
+     * @brief Returns the number of elements that can be held without growing.
+     *
+     * @return the capacity, always zero or a power of two.
+     */
+    size_type capacity() const noexcept { return data_ ? mask_ + 1 : 0; }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return tail_ == head_; }
+
+    /**
+     * @brief Checks whether the container is full.
+     *
+     * @return true if the next push requires growing, false otherwise.
+     */
+    bool full() const noexcept { return size() == capacity(); }
+
+    /**
+     * @brief Access the oldest element.
+     *
+     * @return reference to the oldest element.
+     */
+    reference front() { return *slot(head_); }
+
+    /**
+     * @brief Access the oldest element.
+     *
+     * @return const reference to the oldest element.
+     */
+    const_reference front() const { return *slot(head_); }
+
+    /**
+     * @brief Access the newest element.
+     *
+     * @return reference to the newest element.
+     */
+    reference back() { return *slot(tail_ - 1); }
+
+    /**
+     * @brief Access the newest element.
+     *
+     * @return const reference to the newest element.
+     */
+    const_reference back() const { return *slot(tail_ - 1); }
+
+    /**
+     * @brief Access specified element, counted from the oldest one.
+     *
+     * @param pos position of the element to return.
+     *
+     * @return reference to the requested element.
+     */
+    reference operator[](size_type pos) { return *slot(head_ + pos); }
+
+    /**
+     * @brief Access specified element, counted from the oldest one.
+     *
+     * @param pos position of the element to return.
+     *
+     * @return const reference to the requested element.
+     */
+    const_reference operator[](size_type pos) const
+    {
+        return *slot(head_ + pos);
+    }
+
+    /**
+     * @brief Access specified element with bounds checking.
+     *
+     * @param pos position of the element to return.
+     *
+     * @return reference to the requested element.
+     */
+    reference at(size_type pos)
+    {
+        check_position(pos);
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Access specified element with bounds checking.
+     *
+     * @param pos position of the element to return.
+     *
+     * @return const reference to the requested element.
+     */
+    const_reference at(size_type pos) const
+    {
+        check_position(pos);
+        return (*this)[pos];
+    }
+
+    /**
+     * @brief Returns an iterator to the oldest element.
+     */
+    iterator begin() noexcept { return {data_, mask_, head_}; }
+
+    /**
+     * @brief Returns an iterator to the oldest element.
+     */
+    const_iterator begin() const noexcept { return {data_, mask_, head_}; }
+
+    /**
+     * @brief Returns an iterator to the oldest element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator past the newest element.
+     */
+    iterator end() noexcept { return {data_, mask_, tail_}; }
+
+    /**
+     * @brief Returns an iterator past the newest element.
+     */
+    const_iterator end() const noexcept { return {data_, mask_, tail_}; }
+
+    /**
+     * @brief Returns an iterator past the newest element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the newest element.
+     */
+    reverse_iterator rbegin() noexcept { return reverse_iterator{end()}; }
+
+    /**
+     * @brief Returns a reverse iterator to the newest element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator{end()};
+    }
+
+    /**
+     * @brief Returns a reverse iterator past the oldest element.
+     */
+    reverse_iterator rend() noexcept { return reverse_iterator{begin()}; }
+
+    /**
+     * @brief Returns a reverse iterator past the oldest element.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator{begin()};
+    }
+
+    /**
+     * @brief Appends an element, growing the storage if the container is
+     * full.
+     *
+     * @param value element value to append.
+     */
+    void push_back(const T& value) { emplace_back(value); }
+
+    /**
+     * @brief Appends an element, growing the storage if the container is
+     * full.
+     *
+     * @param value element value to append.
+     */
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    /**
+     * @brief Appends a new element constructed in-place, growing the storage
+     * if the container is full.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @tparam Args arguments type.
+     *
+     * @return reference to the inserted element.
+     */
+    template<class... Args> reference emplace_back(Args&&... args)
+    {
+        if (full())
+        {
+            derived().grow(size() + 1, [&](T* p) {
+                std::construct_at(p, std::forward<Args>(args)...);
+                return size_type{1};
+            });
+
+            return back();
+        }
+
+        T* p = std::construct_at(slot(tail_), std::forward<Args>(args)...);
+        ++tail_;
+
+        return *p;
+    }
+
+    /**
+     * @brief Appends an element if there is free capacity. Never allocates.
+     *
+     * @param value element value to append.
+     *
+     * @return true if the element was appended, false if the container is
+     * full.
+     */
+    template<class U> bool try_push_back(U&& value)
+    {
+        if (full())
+        { return false; }
+
+        std::construct_at(slot(tail_), std::forward<U>(value));
+        ++tail_;
+
+        return true;
+    }
+
+    /**
+     * @brief Appends all elements of [first, last), growing the storage at
+     * most once for forward iterators.
+     *
+     * @param first range of elements to append.
+     * @param last range of elements to append.
+     *
+     * @tparam InputIt iterator type.
+     */
+    template<class InputIt> void push(InputIt first, InputIt last)
+    {
+        using Category =
+          typename std::iterator_traits<InputIt>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+        {
+            auto const n = static_cast<size_type>(std::distance(first, last));
+            if (n > capacity() - size())
+            {
+                derived().grow(size() + n, [&](T* p) {
+                    std::uninitialized_copy_n(first, n, p);
+                    return n;
+                });
+            }
+            else
+            {
+                append(first, n);
+            }
+        }
+        else
+        {
+            for (; first != last; ++first) { emplace_back(*first); }
+        }
+    }
+
+    /**
+     * @brief Appends as many elements of [first, last) as fit into the free
+     * capacity. Never allocates.
+     *
+     * @param first range of elements to append.
+     * @param last range of elements to append.
+     *
+     * @tparam ForwardIt iterator type.
+     *
+     * @return number of elements appended.
+     */
+    template<class ForwardIt> size_type
+    try_push(ForwardIt first, ForwardIt last)
+    {
+        auto const n = std::min(
+          static_cast<size_type>(std::distance(first, last)),
+          capacity() - size());
+        append(first, n);
+
+        return n;
+    }
+
+    /**
+     * @brief Removes the oldest element.
+     */
+    void pop_front()
+    {
+        std::destroy_at(slot(head_));
+        ++head_;
+    }
+
+    /**
+     * @brief Moves the oldest element into @c value and removes it.
+     *
+     * @param value destination of the element.
+     *
+     * @return true if an element was removed, false if the container is
+     * empty.
+     */
+    bool try_pop_front(T& value)
+    {
+        if (empty())
+        { return false; }
+
+        value = std::move(front());
+        pop_front();
+
+        return true;
+    }
+
+    /**
+     * @brief Moves up to @c n of the oldest elements to @c out and removes
+     * them.
+     *
+     * @param out beginning of the destination range.
+     * @param n maximal number of elements to remove.
+     *
+     * @tparam OutputIt iterator type.
+     *
+     * @return number of elements removed.
+     */
+    template<class OutputIt> size_type pop(OutputIt out, size_type n)
+    {
+        n                    = std::min(n, size());
+        auto [first, second] = readable();
+        auto const a         = first.first(std::min(n, first.size()));
+        auto const b         = second.first(n - a.size());
+
+        out = std::move(a.begin(), a.end(), out);
+        std::move(b.begin(), b.end(), out);
+        consume(n);
+
+        return n;
+    }
+
+    /**
+     * @brief Removes the @c n oldest elements, e.g. after they were read
+     * through readable().
+     *
+     * @param n number of elements to remove, at most size().
+     */
+    void consume(size_type n) noexcept
+    {
+        if constexpr (std::is_trivially_destructible_v<T>)
+        { head_ += n; }
+        else
+        {
+            for (; n > 0; --n) { pop_front(); }
+        }
+    }
+
+    /**
+     * @brief Returns the stored elements as at most two contiguous spans, the
+     * oldest elements first. The second span is empty unless the elements
+     * wrap around the end of the storage.
+     *
+     * @return pair of spans covering all elements in order.
+     */
+    std::pair<span_type, span_type> readable() noexcept
+    {
+        return segments<T>(head_, size());
+    }
+
+    /**
+     * @brief Returns the stored elements as at most two contiguous spans, the
+     * oldest elements first.
+     *
+     * @return pair of spans covering all elements in order.
+     */
+    std::pair<const_span_type, const_span_type> readable() const noexcept
+    {
+        return segments<const T>(head_, size());
+    }
+
+    /**
+     * @brief Returns the free capacity as at most two contiguous spans, so
+     * that data can be written in place, e.g. by a read system call. The
+     * written elements become visible with commit(). Only available for
+     * trivially copyable element types.
+     *
+     * @return pair of spans covering the free capacity in order.
+     */
+    std::pair<span_type, span_type> writable() noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "writable() requires a trivially copyable value_type");
+
+        return segments<T>(tail_, capacity() - size());
+    }
+
+    /**
+     * @brief Appends @c n elements previously written through writable().
+     *
+     * @param n number of elements written, at most capacity() - size().
+     */
+    void commit(size_type n) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "commit() requires a trivially copyable value_type");
+
+        tail_ += n;
+    }
+
+    /**
+     * @brief Erases all elements from the container. The capacity is kept.
+     */
+    void clear() noexcept
+    {
+        consume(size());
+        head_ = 0;
+        tail_ = 0;
+    }
+
+ protected:
+    RingBufferBase() = default;
+
+    RingBufferBase(T* data, size_type capacity) noexcept
+      : data_{data}
+      , mask_{capacity - 1}
+    {}
+
+    ~RingBufferBase() = default;
+
+    T* slot(size_type counter) const noexcept
+    {
+        return data_ + (counter & mask_);
+    }
+
+    /**
+     * @brief Moves all elements to @c data in order, starting at slot 0,
+     * and makes it the new storage.
+     */
+    void relocate(T* data, size_type capacity)
+    {
+        size_type const n    = size();
+        auto [first, second] = readable();
+        std::uninitialized_move(first.begin(), first.end(), data);
+        std::uninitialized_move(
+          second.begin(), second.end(), data + first.size());
+        consume(n);
+
+        data_ = data;
+        mask_ = capacity - 1;
+        head_ = 0;
+        tail_ = n;
+    }
+
+    /**
+     * @brief Copies @c n elements starting at @c first behind the newest
+     * element. The free capacity has to be sufficient.
+     */
+    template<class ForwardIt> void append(ForwardIt first, size_type n)
+    {
+        auto [a, b] = segments<T>(tail_, n);
+        std::uninitialized_copy_n(first, a.size(), a.begin());
+        tail_ += a.size();
+        auto const skip = static_cast<difference_type>(a.size());
+        std::uninitialized_copy_n(std::next(first, skip), b.size(), b.begin());
+        tail_ += b.size();
+    }
+
+    /**
+     * @brief Returns the smallest valid capacity that holds @c n elements.
+     */
+    static size_type round_capacity(size_type n) noexcept
+    {
+        return std::bit_ceil(std::max<size_type>(n, 1));
+    }
+
+    T*        data_{nullptr};
+    size_type mask_{0};
+    size_type head_{0};
+    size_type tail_{0};
+
+ private:
+    Derived& derived() noexcept { return static_cast<Derived&>(*this); }
+
+    template<class U>
+    std::pair<Span<U>, Span<U>>
+    segments(size_type counter, size_type n) const noexcept
+    {
+        if (n == 0)
+        { return {}; }
+
+        size_type const offset = counter & mask_;
+        size_type const first  = std::min(n, capacity() - offset);
+
+        return {Span<U>{data_ + offset, first}, Span<U>{data_, n - first}};
+    }
+
+    void check_position(size_type pos) const
+    {
+        if (pos >= size())
+        { throw std::out_of_range("ara::core::RingBuffer::at"); }
+    }
+};
+}  // namespace detail
+
+/**
+ * @brief FIFO container on a circular buffer with power-of-two capacity.
+ *
+ * The buffer grows by doubling when an element is pushed into a full
+ * container. try_push_back() and try_push() never grow, which gives fixed
+ * capacity behaviour on a buffer sized with reserve().
+ *
+ * @tparam T element type.
+ * @tparam Allocator allocator type.
+ */
+template<class T, class Allocator = Allocator<T>> class RingBuffer
+  : public detail::RingBufferBase<T, RingBuffer<T, Allocator>>
+{
+    using Base   = detail::RingBufferBase<T, RingBuffer<T, Allocator>>;
+    using Traits = AllocatorTraits<Allocator>;
+
+    friend Base;
+
+ public:
+    using typename Base::size_type;
+    using allocator_type = Allocator;
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     *
+     * @param alloc allocator to use for all memory allocations.
+     */
+    explicit RingBuffer(const Allocator& alloc = Allocator()) noexcept
+      : alloc_{alloc}
+    {}
+
+    /**
+     * @brief Constructs an empty container able to hold @c capacity elements.
+     *
+     * @param capacity minimal capacity, rounded up to a power of two.
+     * @param alloc allocator to use for all memory allocations.
+     */
+    explicit RingBuffer(size_type        capacity,
+                        const Allocator& alloc = Allocator())
+      : alloc_{alloc}
+    {
+        reserve(capacity);
+    }
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param other container to copy.
+     */
+    RingBuffer(const RingBuffer& other)
+      : Base()
+      , alloc_{Traits::select_on_container_copy_construction(other.alloc_)}
+    {
+        reserve(other.size());
+        this->push(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Move constructor. Steals the storage of @c other.
+     *
+     * @param other container to move from.
+     */
+    RingBuffer(RingBuffer&& other) noexcept : alloc_{std::move(other.alloc_)}
+    {
+        steal(other);
+    }
+
+    /**
+     * @brief Destroys the elements and releases the storage.
+     */
+    ~RingBuffer() { release(); }
+
+    /**
+     * @brief Replaces the contents with a copy of @c other.
+     *
+     * @param other container to copy.
+     *
+     * @return reference to this container.
+     */
+    RingBuffer& operator=(const RingBuffer& other)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            reserve(other.size());
+            this->push(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents with those of @c other using move
+     * semantics.
+     *
+     * @param other container to move from.
+     *
+     * @return reference to this container.
+     */
+    RingBuffer& operator=(RingBuffer&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            alloc_ = std::move(other.alloc_);
+            steal(other);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Increases the capacity to at least @c capacity elements.
+     *
+     * @param capacity minimal capacity, rounded up to a power of two.
+     */
+    void reserve(size_type capacity)
+    {
+        if (capacity > this->capacity())
+        { reallocate(Base::round_capacity(capacity)); }
+    }
+
+    /**
+     * @brief Reduces the capacity to the smallest power of two holding all
+     * elements.
+     */
+    void shrink_to_fit()
+    {
+        if (this->empty())
+        {
+            release();
+            return;
+        }
+
+        size_type const capacity = Base::round_capacity(this->size());
+        if (capacity < this->capacity())
+        { reallocate(capacity); }
+    }
+
+    /**
+     * @brief Exchanges the contents with those of @c other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(RingBuffer& other) noexcept
+    {
+        using std::swap;
+        swap(alloc_, other.alloc_);
+        swap(this->data_, other.data_);
+        swap(this->mask_, other.mask_);
+        swap(this->head_, other.head_);
+        swap(this->tail_, other.tail_);
+    }
+
+ private:
+    template<class Construct>
+    void grow(size_type required, Construct&& construct)
+    {
+        reallocate(
+          Base::round_capacity(std::max(required, 2 * this->capacity())),
+          std::forward<Construct>(construct));
+    }
+
+    void reallocate(size_type capacity)
+    {
+        reallocate(capacity, [](T*) noexcept { return size_type{0}; });
+    }
+
+    /**
+     * @brief Moves the elements to a new buffer of @c capacity elements.
+     * The elements appended by @c construct behind the existing ones are
+     * built first, while the old buffer is still alive.
+     */
+    template<class Construct>
+    void reallocate(size_type capacity, Construct&& construct)
+    {
+        T*         data        = Traits::allocate(alloc_, capacity);
+        T*         old         = this->data_;
+        auto const oldCapacity = this->capacity();
+        size_type  added       = 0;
+        try
+        {
+            added = construct(data + this->size());
+            try
+            {
+                this->relocate(data, capacity);
+            }
+            catch (...)
+            {
+                std::destroy_n(data + this->size(), added);
+                throw;
+            }
+        }
+        catch (...)
+        {
+            Traits::deallocate(alloc_, data, capacity);
+            throw;
+        }
+
+        this->tail_ += added;
+        if (old)
+        { Traits::deallocate(alloc_, old, oldCapacity); }
+    }
+
+    void release() noexcept
+    {
+        if (this->data_)
+        {
+            this->clear();
+            Traits::deallocate(alloc_, this->data_, this->capacity());
+            this->data_ = nullptr;
+            this->mask_ = 0;
+        }
+    }
+
+    void steal(RingBuffer& other) noexcept
+    {
+        this->data_ = std::exchange(other.data_, nullptr);
+        this->mask_ = std::exchange(other.mask_, 0);
+        this->head_ = std::exchange(other.head_, 0);
+        this->tail_ = std::exchange(other.tail_, 0);
+    }
+
+    Allocator alloc_;
+};
+
+/**
+ * @brief Exchanges content between ring buffers.
+ *
+ * @param lhs first argument of swap invocation.
+ * @param rhs second argument of swap invocation.
+ */
+template<class T, class Allocator> void
+swap(RingBuffer<T, Allocator>& lhs, RingBuffer<T, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief FIFO container with fixed capacity stored inside the object. Never
+ * allocates.
+ *
+ * Pushing into a full container with push_back(), emplace_back() or push()
+ * throws std::length_error, try_push_back() and try_push() report it instead.
+ *
+ * @tparam T element type.
+ * @tparam N capacity, has to be a power of two.
+ */
+template<class T, std::size_t N> class StaticRingBuffer
+  : public detail::RingBufferBase<T, StaticRingBuffer<T, N>>
+{
+    static_assert(std::has_single_bit(N),
+                  "StaticRingBuffer capacity has to be a power of two");
+
+    using Base = detail::RingBufferBase<T, StaticRingBuffer<T, N>>;
+
+    friend Base;
+
+ public:
+    using typename Base::size_type;
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    StaticRingBuffer() noexcept : Base{storage(), N} {}
+
+    /**
+     * @brief Copy constructor.
+     *
+     * @param other container to copy.
+     */
+    StaticRingBuffer(const StaticRingBuffer& other) : StaticRingBuffer()
+    {
+        this->push(other.begin(), other.end());
+    }
+
+    /**
+     * @brief Move constructor. Moves the elements one by one.
+     *
+     * @param other container to move from.
+     */
+    StaticRingBuffer(StaticRingBuffer&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+      : StaticRingBuffer()
+    {
+        this->push(std::make_move_iterator(other.begin()),
+                   std::make_move_iterator(other.end()));
+    }
+
+    /**
+     * @brief Destroys the elements.
+     */
+    ~StaticRingBuffer() { this->clear(); }
+
+    /**
+     * @brief Replaces the contents with a copy of @c other.
+     *
+     * @param other container to copy.
+     *
+     * @return reference to this container.
+     */
+    StaticRingBuffer& operator=(const StaticRingBuffer& other)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            this->push(other.begin(), other.end());
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents with those of @c other using move
+     * semantics.
+     *
+     * @param other container to move from.
+     *
+     * @return reference to this container.
+     */
+    StaticRingBuffer& operator=(StaticRingBuffer&& other) noexcept(
+      std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this != &other)
+        {
+            this->clear();
+            this->push(std::make_move_iterator(other.begin()),
+                       std::make_move_iterator(other.end()));
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     */
+    static constexpr size_type max_size() noexcept { return N; }
+
+ private:
+    template<class Construct> [[noreturn]] void grow(size_type, Construct&&)
+    {
+        throw std::length_error("ara::core::StaticRingBuffer is full");
+    }
+
+    T* storage() noexcept { return reinterpret_cast<T*>(storage_); }
+
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+/**
+ * @brief RingBuffer owns one buffer of capacity() elements.
+ */
+template<class T, class Allocator>
+struct MemoryFootprintTraits<RingBuffer<T, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const RingBuffer<T, Allocator>& value)
+    {
+        return detail::buffer_footprint<T>(value.size(), value.capacity())
+               + detail::elements_footprint(value);
+    }
+};
+
+/**
+ * @brief StaticRingBuffer stores its elements inline.
+ */
+template<class T, std::size_t N>
+struct MemoryFootprintTraits<StaticRingBuffer<T, N>>
+{
+    static constexpr bool kOwnsHeap = MemoryFootprintTraits<T>::kOwnsHeap;
+
+    static MemoryFootprint heap(const StaticRingBuffer<T, N>& value)
+    {
+        return detail::elements_footprint(value);
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_RING_BUFFER_H_
@@ -0,0 +1,442 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SET_H_
+#define ARA_CORE_SET_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/tree_container.h"
+#include "ara/core/utility.h"
+#include <algorithm>
+#include <compare>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <set>
+#include <utility>
+
+namespace ara::core {
+/**
+ * @brief Sorted associative container of unique keys.
+ *
+ * Like Map, but every node stores just the key; use it instead of a Map with
+ * a dummy value. Lookups accept any type comparable to the keys if C is
+ * transparent, such as std::less<> or StringLess.
+ *
+ * @tparam K key type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<K>>
+class Set : public detail::TreeContainer<std::set<K, C, Allocator>>
+{
+    using Base = detail::TreeContainer<std::set<K, C, Allocator>>;
+
+ public:
+    using typename Base::value_type;
+    using insert_return_type =
+      typename std::set<K, C, Allocator>::insert_return_type;
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    Set() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit Set(const C& comp, const Allocator& alloc = Allocator())
+      : Base(std::set<K, C, Allocator>(comp, alloc))
+    {}
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit Set(const Allocator& alloc)
+      : Base(std::set<K, C, Allocator>(alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last). Of several equivalent keys only the first is inserted.
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    Set(InputIt          first,
+        InputIt          last,
+        const C&         comp  = C(),
+        const Allocator& alloc = Allocator())
+      : Base(std::set<K, C, Allocator>(first, last, comp, alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted and free of duplicates, in linear time.
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    Set(sorted_unique_t,
+        InputIt          first,
+        InputIt          last,
+        const C&         comp  = C(),
+        const Allocator& alloc = Allocator())
+      : Set(comp, alloc)
+    {
+        this->append_sorted(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer
+     * list init.
+     *
+     * @param init initializer list to initialize the keys of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    Set(std::initializer_list<value_type> init,
+        const C&                          comp  = C(),
+        const Allocator&                  alloc = Allocator())
+      : Set(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the initializer
+     * list init, which is sorted and free of duplicates, in linear time.
+     *
+     * @param init initializer list to initialize the keys of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    Set(sorted_unique_t                   tag,
+        std::initializer_list<value_type> init,
+        const C&                          comp  = C(),
+        const Allocator&                  alloc = Allocator())
+      : Set(tag, init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Compares the contents of two sets.
+     *
+     * @return true if the contents of the sets are equal, false otherwise.
+     */
+    friend bool operator==(const Set& lhs, const Set& rhs)
+    {
+        return lhs.tree_ == rhs.tree_;
+    }
+
+    /**
+     * @brief Compares the contents of two sets lexicographically.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const Set& lhs, const Set& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    using Base::insert;
+
+    /**
+     * @brief Inserts the keys of the range [first, last), which is sorted and
+     * free of duplicates. Every key is inserted right behind the previous
+     * one, so appending to an empty set, or behind its last key, is linear.
+     *
+     * @param first start of the range of keys to insert.
+     * @param last end of the range of keys to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        this->append_sorted(first, last);
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(Set& other) noexcept { this->tree_.swap(other.tree_); }
+
+    /**
+     * @brief Moves the nodes of all keys of source that are not in this
+     * container yet into this container, without copying or reallocating.
+     *
+     * @param source set to transfer the nodes from.
+     */
+    template<class C2> void merge(Set<K, C2, Allocator>& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
+
+    /**
+     * @copydoc merge(Set<K, C2, Allocator>&)
+     */
+    template<class C2> void merge(Set<K, C2, Allocator>&& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
+
+ private:
+    template<class, class, class> friend class Set;
+};
+
+/**
+ * @brief Sorted associative container of keys, where several keys may be
+ * equivalent. Equivalent keys are kept in the order they were inserted.
+ *
+ * @tparam K key type.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<K>>
+class MultiSet : public detail::TreeContainer<std::multiset<K, C, Allocator>>
+{
+    using Base = detail::TreeContainer<std::multiset<K, C, Allocator>>;
+
+ public:
+    using typename Base::value_type;
+
+    /**
+     * @brief Constructs an empty container.
+     */
+    MultiSet() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit MultiSet(const C& comp, const Allocator& alloc = Allocator())
+      : Base(std::multiset<K, C, Allocator>(comp, alloc))
+    {}
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit MultiSet(const Allocator& alloc)
+      : Base(std::multiset<K, C, Allocator>(alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    MultiSet(InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : Base(std::multiset<K, C, Allocator>(first, last, comp, alloc))
+    {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which is sorted, in linear time.
+     *
+     * @param first start of the range to copy the keys from.
+     * @param last end of the range to copy the keys from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    MultiSet(sorted_equivalent_t,
+             InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : MultiSet(comp, alloc)
+    {
+        this->append_sorted(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer
+     * list init.
+     *
+     * @param init initializer list to initialize the keys of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    MultiSet(std::initializer_list<value_type> init,
+             const C&                          comp  = C(),
+             const Allocator&                  alloc = Allocator())
+      : MultiSet(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Compares the contents of two sets.
+     *
+     * @return true if the contents of the sets are equal, false otherwise.
+     */
+    friend bool operator==(const MultiSet& lhs, const MultiSet& rhs)
+    {
+        return lhs.tree_ == rhs.tree_;
+    }
+
+    /**
+     * @brief Compares the contents of two sets lexicographically.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const MultiSet& lhs, const MultiSet& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    using Base::insert;
+
+    /**
+     * @brief Inserts the keys of the range [first, last), which is sorted.
+     * Every key is inserted right behind the previous one, so appending to
+     * an empty set, or behind its last key, is linear.
+     *
+     * @param first start of the range of keys to insert.
+     * @param last end of the range of keys to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        this->append_sorted(first, last);
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(MultiSet& other) noexcept { this->tree_.swap(other.tree_); }
+
+    /**
+     * @brief Moves the nodes of all keys of source into this container,
+     * without copying or reallocating.
+     *
+     * @param source set to transfer the nodes from.
+     */
+    template<class C2> void merge(MultiSet<K, C2, Allocator>& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
+
+    /**
+     * @copydoc merge(MultiSet<K, C2, Allocator>&)
+     */
+    template<class C2> void merge(MultiSet<K, C2, Allocator>&& source)
+    {
+        this->tree_.merge(source.tree_);
+    }
+
+ private:
+    template<class, class, class> friend class MultiSet;
+};
+
+/**
+ * @brief Exchanges content between sets.
+ *
+ * @param lhs first argument of swap invocation.
+ * @param rhs second argument of swap invocation.
+ */
+template<class K, class C, class Allocator> void
+swap(Set<K, C, Allocator>& lhs, Set<K, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief Exchanges content between sets.
+ *
+ * @param lhs first argument of swap invocation.
+ * @param rhs second argument of swap invocation.
+ */
+template<class K, class C, class Allocator> void
+swap(MultiSet<K, C, Allocator>& lhs, MultiSet<K, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief Set allocates one tree node per key.
+ */
+template<class K, class C, class Allocator>
+struct MemoryFootprintTraits<Set<K, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const Set<K, C, Allocator>& value)
+    {
+        return detail::tree_footprint<K>(value.size())
+               + detail::elements_footprint(value);
+    }
+};
+
+/**
+ * @brief MultiSet allocates one tree node per key.
+ */
+template<class K, class C, class Allocator>
+struct MemoryFootprintTraits<MultiSet<K, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const MultiSet<K, C, Allocator>& value)
+    {
+        return detail::tree_footprint<K>(value.size())
+               + detail::elements_footprint(value);
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SET_H_
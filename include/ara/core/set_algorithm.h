@@ -0,0 +1,384 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SET_ALGORITHM_H_
+#define ARA_CORE_SET_ALGORITHM_H_
+
+#include "ara/core/flat_set.h"
+#include "ara/core/set.h"
+#include "ara/core/simd_key.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Intersection and union of sorted sets. Both walk the two sets once in key
+ * order. FlatSets of numbers in their natural order are combined a 16 byte
+ * block at a time with SIMD comparisons instead of one branch per key.
+ */
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Vector equality of the keys in two 16 byte blocks. The primary
+ * template describes key types without vectorized comparison.
+ */
+template<class K> struct SimdSetOps
+{
+    static constexpr bool kSupported = false;
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief Keys are loaded as raw bits and compared lane by lane. Every key of
+ * one block is compared with every key of the other by rotating the other
+ * block through all lane positions.
+ */
+template<class K>
+    requires(std::is_arithmetic_v<K> && ! std::is_same_v<K, bool>)
+struct SimdSetOps<K>
+{
+    static constexpr bool        kSupported = true;
+    static constexpr std::size_t kWidth     = 16 / sizeof(K);
+
+    static __m128i load(const K* keys) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys));
+    }
+
+    static void store(K* keys, __m128i block) noexcept
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(keys), block);
+    }
+
+    /**
+     * @brief Bit i of the result is set if key i of lhs is equal to any key
+     * of rhs.
+     */
+    static unsigned matches(__m128i lhs, __m128i rhs) noexcept
+    {
+        return matches(lhs, rhs, std::make_index_sequence<kWidth - 1>());
+    }
+
+ private:
+    template<std::size_t... Rotation>
+    static unsigned
+    matches(__m128i lhs, __m128i rhs, std::index_sequence<Rotation...>)
+    {
+        __m128i any = equal(lhs, rhs);
+        ((any = _mm_or_si128(any, equal(lhs, rotate<Rotation + 1>(rhs)))),
+         ...);
+
+        return lanes(any);
+    }
+
+    template<std::size_t Lanes> static __m128i rotate(__m128i keys) noexcept
+    {
+        constexpr int kBytes = static_cast<int>(Lanes * sizeof(K));
+
+        return _mm_or_si128(_mm_srli_si128(keys, kBytes),
+                            _mm_slli_si128(keys, 16 - kBytes));
+    }
+
+    /**
+     * @brief Sets every lane of the result to all ones if the lanes of lhs
+     * and rhs are equal. Floating point keys compare as numbers, so 0.0 and
+     * -0.0 are equal as they are equivalent under std::less.
+     */
+    static __m128i equal(__m128i lhs, __m128i rhs) noexcept
+    {
+        if constexpr (std::is_same_v<K, float>)
+        {
+            return _mm_castps_si128(
+              _mm_cmpeq_ps(_mm_castsi128_ps(lhs), _mm_castsi128_ps(rhs)));
+        }
+        else if constexpr (std::is_same_v<K, double>)
+        {
+            return _mm_castpd_si128(
+              _mm_cmpeq_pd(_mm_castsi128_pd(lhs), _mm_castsi128_pd(rhs)));
+        }
+        else if constexpr (sizeof(K) == 1)
+        { return _mm_cmpeq_epi8(lhs, rhs); }
+        else if constexpr (sizeof(K) == 2)
+        { return _mm_cmpeq_epi16(lhs, rhs); }
+        else if constexpr (sizeof(K) == 4)
+        { return _mm_cmpeq_epi32(lhs, rhs); }
+        else
+        {
+            // Both 32 bit halves of a lane must be equal.
+            __m128i const halves = _mm_cmpeq_epi32(lhs, rhs);
+            return _mm_and_si128(
+              halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    static unsigned lanes(__m128i mask) noexcept
+    {
+        int bits = 0;
+        if constexpr (sizeof(K) == 1)
+        { bits = _mm_movemask_epi8(mask); }
+        else if constexpr (sizeof(K) == 2)
+        {
+            bits =
+              _mm_movemask_epi8(_mm_packs_epi16(mask, _mm_setzero_si128()));
+        }
+        else if constexpr (sizeof(K) == 4)
+        { bits = _mm_movemask_ps(_mm_castsi128_ps(mask)); }
+        else
+        { bits = _mm_movemask_pd(_mm_castsi128_pd(mask)); }
+
+        return static_cast<unsigned>(bits);
+    }
+};
+#endif
+
+/**
+ * @brief True if FlatSets of keys K ordered by C and stored in KeyContainer
+ * are combined with SIMD comparisons.
+ */
+template<class K, class C, class KeyContainer>
+inline constexpr bool kSimdSetKey =
+  kSimdSearchableKey<K, C> && SimdSetOps<K>::kSupported
+  && std::contiguous_iterator<typename KeyContainer::const_iterator>;
+
+/**
+ * @brief Writes the keys that are in both of the sorted unique arrays
+ * lhs[0, lhsSize) and rhs[0, rhsSize) to out, in order.
+ *
+ * Whole blocks of keys are compared all against all; the block with the
+ * smaller last key is then done, since all its later matches would have to be
+ * in the next block of the other array.
+ *
+ * @return number of keys written, at most min(lhsSize, rhsSize).
+ */
+template<class K>
+std::size_t IntersectSorted(const K*    lhs,
+                            std::size_t lhsSize,
+                            const K*    rhs,
+                            std::size_t rhsSize,
+                            K*          out) noexcept
+{
+    using Ops = SimdSetOps<K>;
+
+    std::size_t i = 0;
+    std::size_t j = 0;
+    std::size_t n = 0;
+    if constexpr (Ops::kSupported)
+    {
+        constexpr std::size_t kWidth = Ops::kWidth;
+        while (i + kWidth <= lhsSize && j + kWidth <= rhsSize)
+        {
+            unsigned mask =
+              Ops::matches(Ops::load(lhs + i), Ops::load(rhs + j));
+            for (; mask != 0; mask &= mask - 1)
+            {
+                auto const lane = std::countr_zero(mask);
+                out[n++]        = lhs[i + static_cast<std::size_t>(lane)];
+            }
+
+            K const lhsLast = lhs[i + kWidth - 1];
+            K const rhsLast = rhs[j + kWidth - 1];
+            i += ! (rhsLast < lhsLast) ? kWidth : 0;
+            j += ! (lhsLast < rhsLast) ? kWidth : 0;
+        }
+    }
+
+    return static_cast<std::size_t>(std::set_intersection(lhs + i,
+                                                          lhs + lhsSize,
+                                                          rhs + j,
+                                                          rhs + rhsSize,
+                                                          out + n)
+                                    - out);
+}
+
+/**
+ * @brief Writes the keys that are in any of the sorted unique arrays
+ * lhs[0, lhsSize) and rhs[0, rhsSize) to out, in order.
+ *
+ * A block of keys of one array that precedes the next key of the other is
+ * copied as a whole. Otherwise a block of keys is merged without branches,
+ * so interleaved keys cost no mispredictions.
+ *
+ * @return number of keys written, at most lhsSize + rhsSize.
+ */
+template<class K>
+std::size_t UniteSorted(const K*    lhs,
+                        std::size_t lhsSize,
+                        const K*    rhs,
+                        std::size_t rhsSize,
+                        K*          out) noexcept
+{
+    std::size_t i = 0;
+    std::size_t j = 0;
+    std::size_t n = 0;
+    if constexpr (SimdSetOps<K>::kSupported)
+    {
+        constexpr std::size_t kWidth = SimdSetOps<K>::kWidth;
+        while (i + kWidth <= lhsSize && j + kWidth <= rhsSize)
+        {
+            if (lhs[i + kWidth - 1] < rhs[j])
+            {
+                SimdSetOps<K>::store(out + n, SimdSetOps<K>::load(lhs + i));
+                i += kWidth;
+                n += kWidth;
+            }
+            else if (rhs[j + kWidth - 1] < lhs[i])
+            {
+                SimdSetOps<K>::store(out + n, SimdSetOps<K>::load(rhs + j));
+                j += kWidth;
+                n += kWidth;
+            }
+            else
+            {
+                // Every step consumes at most one key of each array, so
+                // kWidth steps stay within the blocks checked above.
+                for (std::size_t step = 0; step < kWidth; ++step)
+                {
+                    K const    left      = lhs[i];
+                    K const    right     = rhs[j];
+                    bool const takeLeft  = ! (right < left);
+                    bool const takeRight = ! (left < right);
+                    out[n++]             = takeLeft ? left : right;
+                    i += takeLeft;
+                    j += takeRight;
+                }
+            }
+        }
+    }
+
+    return static_cast<std::size_t>(std::set_union(lhs + i,
+                                                   lhs + lhsSize,
+                                                   rhs + j,
+                                                   rhs + rhsSize,
+                                                   out + n)
+                                    - out);
+}
+}  // namespace detail
+
+/**
+ * @brief Returns the keys that are in both lhs and rhs.
+ *
+ * @param lhs first set.
+ * @param rhs second set, ordered like lhs.
+ *
+ * @return set of the common keys.
+ */
+template<class K, class C, class KeyContainer>
+FlatSet<K, C, KeyContainer> intersect(const FlatSet<K, C, KeyContainer>& lhs,
+                                      const FlatSet<K, C, KeyContainer>& rhs)
+{
+    KeyContainer keys;
+    if constexpr (detail::kSimdSetKey<K, C, KeyContainer>)
+    {
+        keys.resize(std::min(lhs.size(), rhs.size()));
+        keys.resize(detail::IntersectSorted(std::to_address(lhs.begin()),
+                                            lhs.size(),
+                                            std::to_address(rhs.begin()),
+                                            rhs.size(),
+                                            keys.data()));
+    }
+    else
+    {
+        std::set_intersection(lhs.begin(),
+                              lhs.end(),
+                              rhs.begin(),
+                              rhs.end(),
+                              std::back_inserter(keys),
+                              lhs.key_comp());
+    }
+
+    return {sorted_unique, std::move(keys), lhs.key_comp()};
+}
+
+/**
+ * @brief Returns the keys that are in lhs or rhs.
+ *
+ * @param lhs first set.
+ * @param rhs second set, ordered like lhs.
+ *
+ * @return set of all keys.
+ */
+template<class K, class C, class KeyContainer>
+FlatSet<K, C, KeyContainer> unite(const FlatSet<K, C, KeyContainer>& lhs,
+                                  const FlatSet<K, C, KeyContainer>& rhs)
+{
+    KeyContainer keys;
+    if constexpr (detail::kSimdSetKey<K, C, KeyContainer>)
+    {
+        keys.resize(lhs.size() + rhs.size());
+        keys.resize(detail::UniteSorted(std::to_address(lhs.begin()),
+                                        lhs.size(),
+                                        std::to_address(rhs.begin()),
+                                        rhs.size(),
+                                        keys.data()));
+    }
+    else
+    {
+        keys.reserve(lhs.size() + rhs.size());
+        std::set_union(lhs.begin(),
+                       lhs.end(),
+                       rhs.begin(),
+                       rhs.end(),
+                       std::back_inserter(keys),
+                       lhs.key_comp());
+    }
+
+    return {sorted_unique, std::move(keys), lhs.key_comp()};
+}
+
+/**
+ * @brief Returns the keys that are in both lhs and rhs.
+ *
+ * @param lhs first set.
+ * @param rhs second set, ordered like lhs.
+ *
+ * @return set of the common keys.
+ */
+template<class K, class C, class Allocator>
+Set<K, C, Allocator> intersect(const Set<K, C, Allocator>& lhs,
+                               const Set<K, C, Allocator>& rhs)
+{
+    Set<K, C, Allocator> result(lhs.key_comp(), lhs.get_allocator());
+    std::set_intersection(lhs.begin(),
+                          lhs.end(),
+                          rhs.begin(),
+                          rhs.end(),
+                          std::inserter(result, result.end()),
+                          lhs.key_comp());
+
+    return result;
+}
+
+/**
+ * @brief Returns the keys that are in lhs or rhs.
+ *
+ * @param lhs first set.
+ * @param rhs second set, ordered like lhs.
+ *
+ * @return set of all keys.
+ */
+template<class K, class C, class Allocator>
+Set<K, C, Allocator> unite(const Set<K, C, Allocator>& lhs,
+                           const Set<K, C, Allocator>& rhs)
+{
+    Set<K, C, Allocator> result(lhs.key_comp(), lhs.get_allocator());
+    std::set_union(lhs.begin(),
+                   lhs.end(),
+                   rhs.begin(),
+                   rhs.end(),
+                   std::inserter(result, result.end()),
+                   lhs.key_comp());
+
+    return result;
+}
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SET_ALGORITHM_H_
@@ -0,0 +1,222 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SIMD_KEY_H_
+#define ARA_CORE_SIMD_KEY_H_
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+namespace ara::core {
+/**
+ * Vectorized comparison of numeric keys, shared by the containers that keep
+ * keys in packed arrays.
+ */
+namespace detail {
+/**
+ * @brief True if keys of type K ordered by C are numbers in their natural
+ * order. B-tree nodes keep a packed copy of such keys and search it with a
+ * vectorized linear scan instead of a binary search.
+ */
+template<class K, class C>
+inline constexpr bool kSimdSearchableKey =
+  std::is_arithmetic_v<K> && ! std::is_same_v<K, bool>
+  && (std::is_same_v<C, std::less<K>> || std::is_same_v<C, std::less<>>);
+
+/**
+ * @brief Vector comparison of the keys in one 16 byte block. The primary
+ * template describes key types without vectorized comparison.
+ */
+template<class K> struct SimdKeyOps
+{
+    static constexpr bool        kSupported = false;
+    static constexpr std::size_t kWidth     = 1;
+};
+
+#if defined(__SSE2__)
+/**
+ * @brief Integer keys are compared as signed lanes; unsigned keys get their
+ * sign bit flipped on load, which maps their order onto the signed order.
+ */
+template<class K>
+    requires(std::is_integral_v<K> && ! std::is_same_v<K, bool>)
+struct SimdKeyOps<K>
+{
+    static constexpr bool        kSupported = true;
+    static constexpr std::size_t kWidth     = 16 / sizeof(K);
+
+    static __m128i load(const K* keys) noexcept
+    {
+        return bias(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys)));
+    }
+
+    static __m128i splat(K key) noexcept
+    {
+        return bias(set1(std::bit_cast<std::make_signed_t<K>>(key)));
+    }
+
+    /**
+     * @brief Bit i of the result is set if lane i of lhs is greater than lane
+     * i of rhs.
+     */
+    static unsigned greater(__m128i lhs, __m128i rhs) noexcept
+    {
+        if constexpr (sizeof(K) == 1)
+        { return to_mask(_mm_movemask_epi8(_mm_cmpgt_epi8(lhs, rhs))); }
+        else if constexpr (sizeof(K) == 2)
+        {
+            __m128i const lanes = _mm_cmpgt_epi16(lhs, rhs);
+            return to_mask(
+              _mm_movemask_epi8(_mm_packs_epi16(lanes, _mm_setzero_si128())));
+        }
+        else if constexpr (sizeof(K) == 4)
+        {
+            return to_mask(
+              _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lhs, rhs))));
+        }
+        else
+        {
+#if defined(__SSE4_2__)
+            __m128i const lanes = _mm_cmpgt_epi64(lhs, rhs);
+#else
+            // Signed high halves decide, unsigned low halves break ties.
+            __m128i const lowSign = _mm_set_epi32(0, INT32_MIN, 0, INT32_MIN);
+            __m128i const l       = _mm_xor_si128(lhs, lowSign);
+            __m128i const r       = _mm_xor_si128(rhs, lowSign);
+            __m128i const gt      = _mm_cmpgt_epi32(l, r);
+            __m128i const eq      = _mm_cmpeq_epi32(l, r);
+            __m128i const lanes   = _mm_or_si128(
+              _mm_shuffle_epi32(gt, _MM_SHUFFLE(3, 3, 1, 1)),
+              _mm_and_si128(_mm_shuffle_epi32(eq, _MM_SHUFFLE(3, 3, 1, 1)),
+                            _mm_shuffle_epi32(gt, _MM_SHUFFLE(2, 2, 0, 0))));
+#endif
+            return to_mask(_mm_movemask_pd(_mm_castsi128_pd(lanes)));
+        }
+    }
+
+ private:
+    using Signed = std::make_signed_t<K>;
+
+    static __m128i set1(Signed value) noexcept
+    {
+        if constexpr (sizeof(K) == 1)
+        { return _mm_set1_epi8(static_cast<char>(value)); }
+        else if constexpr (sizeof(K) == 2)
+        { return _mm_set1_epi16(value); }
+        else if constexpr (sizeof(K) == 4)
+        { return _mm_set1_epi32(value); }
+        else
+        { return _mm_set1_epi64x(value); }
+    }
+
+    static __m128i bias(__m128i lanes) noexcept
+    {
+        if constexpr (std::is_signed_v<K>)
+        { return lanes; }
+        else
+        {
+            return _mm_xor_si128(lanes,
+                                 set1(std::numeric_limits<Signed>::min()));
+        }
+    }
+
+    static unsigned to_mask(int mask) noexcept
+    {
+        return static_cast<unsigned>(mask);
+    }
+};
+
+template<> struct SimdKeyOps<float>
+{
+    static constexpr bool        kSupported = true;
+    static constexpr std::size_t kWidth     = 4;
+
+    static __m128 load(const float* keys) noexcept
+    {
+        return _mm_loadu_ps(keys);
+    }
+
+    static __m128 splat(float key) noexcept { return _mm_set1_ps(key); }
+
+    static unsigned greater(__m128 lhs, __m128 rhs) noexcept
+    {
+        return static_cast<unsigned>(_mm_movemask_ps(_mm_cmpgt_ps(lhs, rhs)));
+    }
+};
+
+template<> struct SimdKeyOps<double>
+{
+    static constexpr bool        kSupported = true;
+    static constexpr std::size_t kWidth     = 2;
+
+    static __m128d load(const double* keys) noexcept
+    {
+        return _mm_loadu_pd(keys);
+    }
+
+    static __m128d splat(double key) noexcept { return _mm_set1_pd(key); }
+
+    static unsigned greater(__m128d lhs, __m128d rhs) noexcept
+    {
+        return static_cast<unsigned>(_mm_movemask_pd(_mm_cmpgt_pd(lhs, rhs)));
+    }
+};
+#endif
+
+/**
+ * @brief Returns the number of keys in the sorted array keys[0, count) that
+ * are less than key, or not greater than key if Upper is set. This is the
+ * index of the lower or upper bound of key.
+ *
+ * With vectorized comparison, keys is read in whole 16 byte blocks, so it must
+ * be readable up to count rounded up to SimdKeyOps<K>::kWidth.
+ */
+template<bool Upper, class K>
+std::size_t CountBelow(const K* keys, std::size_t count, K key) noexcept
+{
+    using Ops = SimdKeyOps<K>;
+
+    std::size_t below = 0;
+    if constexpr (Ops::kSupported)
+    {
+        auto const     needle = Ops::splat(key);
+        unsigned const full   = (1u << Ops::kWidth) - 1;
+        for (std::size_t i = 0; i < count; i += Ops::kWidth)
+        {
+            auto const     lanes = Ops::load(keys + i);
+            unsigned const valid =
+              count - i >= Ops::kWidth ? full : (1u << (count - i)) - 1;
+            unsigned const mask = Upper ? ~Ops::greater(lanes, needle) & valid
+                                        : Ops::greater(needle, lanes) & valid;
+            below += static_cast<std::size_t>(std::popcount(mask));
+            if (mask != full)
+            { break; }
+        }
+    }
+    else
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        { below += Upper ? ! (key < keys[i]) : keys[i] < key; }
+    }
+
+    return below;
+}
+}  // namespace detail
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SIMD_KEY_H_
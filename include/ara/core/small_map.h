@@ -0,0 +1,1895 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SMALL_MAP_H_
+#define ARA_CORE_SMALL_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/btree_map.h"
+#include "ara/core/functional.h"
+#include "ara/core/map.h"
+#include "ara/core/map_slot.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/simd_key.h"
+#include "ara/core/utility.h"
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief CountBelow() for a key array of capacity elements padded to whole
+ * SIMD blocks, of which the first count are valid. Compares all blocks and
+ * masks the result, so that the search takes no branch that depends on the
+ * keys.
+ */
+template<bool Upper, std::size_t Capacity, class K>
+std::size_t CountBelowAll(const K* keys, std::size_t count, K key) noexcept
+{
+    using Ops = SimdKeyOps<K>;
+
+    if constexpr (Ops::kSupported && Capacity <= 64)
+    {
+        auto const    needle = Ops::splat(key);
+        std::uint64_t below  = 0;
+        for (std::size_t i = 0; i < Capacity; i += Ops::kWidth)
+        {
+            auto const     lanes = Ops::load(keys + i);
+            unsigned const mask  = Upper ? ~Ops::greater(lanes, needle)
+                                         : Ops::greater(needle, lanes);
+            below |= std::uint64_t{mask & ((1u << Ops::kWidth) - 1)} << i;
+        }
+        std::uint64_t const valid =
+          count < 64 ? (std::uint64_t{1} << count) - 1 : ~std::uint64_t{0};
+
+        return static_cast<std::size_t>(std::popcount(below & valid));
+    }
+    else
+    {
+        return CountBelow<Upper>(keys, count, key);
+    }
+}
+}  // namespace detail
+
+/**
+ * @brief Sorted associative container that contains key-value pairs with unique
+ * keys, stored inline while there are few of them.
+ *
+ * Most maps in practice hold a handful of entries. SmallMap keeps up to N
+ * elements sorted in storage inside the object itself, so such maps need no
+ * allocation and a lookup scans a single contiguous block. Numeric keys in
+ * their natural order are additionally kept packed and compared with SIMD
+ * instructions. Inserting the (N + 1)th element moves all elements into an
+ * ara::core::Map, which holds them from then on; clear() and shrink_to_fit()
+ * return to inline storage.
+ *
+ * The interface matches ara::core::Map, without node handles. While the
+ * elements are stored inline, insertion and erasure relocate the elements
+ * after the affected position and invalidate iterators, pointers and
+ * references to them. Moving the elements into the Map invalidates all
+ * iterators, pointers and references into the container. Once in the Map,
+ * iterators stay valid as they do for Map. Relocation moves the elements,
+ * and the keys where they can be moved from, otherwise it copies the keys;
+ * if a copy or move constructor throws while elements are relocated, the
+ * program is terminated.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam N number of elements stored inline.
+ * @tparam C key_compare function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         std::size_t N      = 8,
+         typename C         = std::less<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class SmallMap
+{
+    static_assert(N > 0, "SmallMap needs room for at least one element");
+
+    template<bool Const> class Iterator;
+
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<const K, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = C;
+    using allocator_type  = Allocator;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename AllocatorTraits<Allocator>::pointer;
+    using const_pointer   = typename AllocatorTraits<Allocator>::const_pointer;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     * @brief Number of elements stored without allocating.
+     */
+    static constexpr size_type kInlineCapacity = N;
+
+    /**
+     * @brief Compares elements by their keys.
+     */
+    class value_compare
+    {
+     public:
+        bool operator()(const value_type& lhs, const value_type& rhs) const
+        {
+            return comp_(lhs.first, rhs.first);
+        }
+
+     private:
+        friend class SmallMap;
+
+        explicit value_compare(C comp) : comp_(std::move(comp)) {}
+
+        C comp_;
+    };
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     */
+    SmallMap() = default;
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit SmallMap(const C& comp, const Allocator& alloc = Allocator())
+      : comp_(comp), alloc_(alloc)
+    {}
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit SmallMap(const Allocator& alloc) : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last). If multiple elements in the range have keys that compare
+     * equivalent, only the first one is inserted.
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    SmallMap(InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : SmallMap(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last), which must be sorted by key and free of duplicates. Runs
+     * in linear time.
+     *
+     * @param first start of the sorted range to copy the elements from.
+     * @param last end of the sorted range to copy the elements from.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    SmallMap(sorted_unique_t,
+             InputIt          first,
+             InputIt          last,
+             const C&         comp  = C(),
+             const Allocator& alloc = Allocator())
+      : SmallMap(comp, alloc)
+    {
+        insert(sorted_unique, first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    SmallMap(std::initializer_list<value_type> init,
+             const C&                          comp  = C(),
+             const Allocator&                  alloc = Allocator())
+      : SmallMap(init.begin(), init.end(), comp, alloc)
+    {}
+
+    /**
+     * @brief Copy constructor. Constructs the container with the copy of the
+     * contents of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    SmallMap(const SmallMap& other)
+      : SmallMap(other.comp_,
+                 AllocatorTraits<Allocator>::
+                   select_on_container_copy_construction(other.alloc_))
+    {
+        append(other);
+    }
+
+    /**
+     * @brief Constructs the container with the copy of the contents of other,
+     * using alloc as allocator.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    SmallMap(const SmallMap& other, const Allocator& alloc)
+      : SmallMap(other.comp_, alloc)
+    {
+        append(other);
+    }
+
+    /**
+     * @brief Move constructor. Constructs the container with the contents of
+     * other using move semantics, other is left empty.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    SmallMap(SmallMap&& other) noexcept
+      : comp_(other.comp_), alloc_(std::move(other.alloc_))
+    {
+        take(other);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of other using move
+     * semantics and alloc as allocator. The elements are moved one by one if
+     * alloc differs from the allocator of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    SmallMap(SmallMap&& other, const Allocator& alloc)
+      : SmallMap(other.comp_, alloc)
+    {
+        if (alloc_ == other.alloc_)
+        {
+            take(other);
+            return;
+        }
+
+        if (other.large_)
+        {
+            Large& large = other.storage_.large;
+            while (! large.empty())
+            {
+                ExtractNode(large, large.begin(), [this](K&& key, V&& value) {
+                    append_element(std::move(key), std::move(value));
+                });
+            }
+        }
+        else
+        {
+            for (size_type i = 0; i < other.size_; ++i)
+            { append_element(Slot::rvalue(Slot::of(other.slot(i)))); }
+        }
+        other.clear();
+    }
+
+    ~SmallMap() { clear(); }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to SmallMap instance.
+     */
+    SmallMap& operator=(const SmallMap& other)
+    {
+        if (this != &other)
+        {
+            SmallMap copy{other};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container using move semantics.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to SmallMap instance.
+     */
+    SmallMap& operator=(SmallMap&& other) noexcept
+    {
+        SmallMap moved{std::move(other)};
+        swap(moved);
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to SmallMap instance.
+     */
+    SmallMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if both maps contain the same key-value pairs.
+     */
+    friend bool operator==(const SmallMap& lhs, const SmallMap& rhs)
+    {
+        return lhs.size() == rhs.size()
+               && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    /**
+     * @brief Compares the contents of two maps lexicographically.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return ordering of the contents of lhs relative to rhs.
+     */
+    friend auto operator<=>(const SmallMap& lhs, const SmallMap& rhs)
+    {
+        return std::lexicographical_compare_three_way(
+          lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    mapped_type& at(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("SmallMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a const reference to the mapped value of the element with
+     * key equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    const mapped_type& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("SmallMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept { return begin_position(); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator begin() const noexcept { return begin_position(); }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    iterator end() noexcept { return end_position(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator end() const noexcept { return end_position(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the beginning.
+     *
+     * @return reverse iterator to the first element.
+     */
+    const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the end.
+     *
+     * @return reverse iterator to the element following the last element.
+     */
+    const_reverse_iterator crend() const noexcept { return rend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept
+    {
+        return large_ ? storage_.large.size() : size_;
+    }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept
+    {
+        return AllocatorTraits<Allocator>::max_size(alloc_);
+    }
+
+    /**
+     * @brief Checks whether the elements are stored inline.
+     *
+     * @return true if the container holds its elements without allocating.
+     */
+    bool is_inline() const noexcept { return ! large_; }
+
+    /**
+     * @brief Erases all elements from the container. Releases the Map holding
+     * the elements if there is one, so the container is inline afterwards.
+     */
+    void clear() noexcept
+    {
+        if (large_)
+        {
+            std::destroy_at(&storage_.large);
+            ::new (static_cast<void*>(&storage_.small)) Small();
+            large_ = false;
+        }
+        else
+        {
+            for (size_type i = 0; i < size_; ++i)
+            { Slot::destroy(alloc_, Slot::of(slot(i))); }
+        }
+        size_ = 0;
+    }
+
+    /**
+     * @brief Moves the elements back into inline storage if they fit and are
+     * held by a Map, releasing its memory. Invalidates all iterators,
+     * pointers and references into the container if it moves the elements.
+     */
+    void shrink_to_fit()
+    {
+        if (! large_ || storage_.large.size() > N)
+        { return; }
+
+        SmallMap shrunk(comp_, alloc_);
+        if constexpr (kNothrowMove)
+        {
+            // Nothing can throw, so the elements can leave their nodes.
+            Large& large = storage_.large;
+            while (! large.empty())
+            {
+                ExtractNode(
+                  large, large.begin(), [&shrunk](K&& key, V&& value) {
+                      shrunk.insert_at(
+                        shrunk.size_, std::move(key), std::move(value));
+                  });
+            }
+        }
+        else
+        {
+            for (const auto& value : storage_.large)
+            { shrunk.insert_at(shrunk.size_, value); }
+        }
+        take(shrunk);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace_key(value.first, value);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    std::pair<iterator, bool> insert(P&& value)
+    {
+        return emplace(std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return emplace_hint_key(hint, value.first, value);
+    }
+
+    /**
+     * @brief Inserts value in the position as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class P>
+        requires std::is_constructible_v<value_type, P&&>
+    iterator insert(const_iterator hint, P&& value)
+    {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last). If multiple elements in
+     * the range have keys that compare equivalent, only the first one is
+     * inserted.
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) { emplace(*first); }
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last), which must be sorted by
+     * key and free of duplicates.
+     *
+     * Each element is inserted with a hint that follows the previous one, which
+     * costs amortized constant time per element. Appending to the end of the
+     * map fills the nodes densely.
+     *
+     * @param first start of the sorted range of elements to insert.
+     * @param last end of the sorted range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(sorted_unique_t, InputIt first, InputIt last)
+    {
+        if (first == last)
+        { return; }
+
+        const_iterator hint = lower_bound((*first).first);
+        for (; first != last; ++first)
+        { hint = std::next(insert(hint, *first)); }
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new element into the container constructed in-place
+     * with the given args if there is no element with the key in the
+     * container.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+
+        return emplace_key(
+          value.first, std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element into the container as close as possible to
+     * the position just before hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+
+        return emplace_hint_key(
+          hint, value.first, std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. args
+     * are not moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(key),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return emplace_key(key,
+                           std::piecewise_construct,
+                           std::forward_as_tuple(std::move(key)),
+                           std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args as close as possible to the position just before hint, if
+     * there is no element with the key in the container.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, const K& key, Args&&... args)
+    {
+        return emplace_hint_key(
+          hint,
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(key),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args as close as possible to the position just before hint, if
+     * there is no element with the key in the container.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator try_emplace(const_iterator hint, K&& key, Args&&... args)
+    {
+        return emplace_hint_key(
+          hint,
+          key,
+          std::piecewise_construct,
+          std::forward_as_tuple(std::move(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the element and a bool denoting whether
+     * an insertion took place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
+    {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the element and a bool denoting whether
+     * an insertion took place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(K&& key, M&& obj)
+    {
+        auto result = try_emplace(std::move(key), std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Inserts a new element as close as possible to the position just
+     * before hint, or assigns to the mapped value of the existing element with
+     * key key.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, const K& key, M&& obj)
+    {
+        auto const sizeBefore = size();
+        auto       it         = try_emplace(hint, key, std::forward<M>(obj));
+        if (size() == sizeBefore)
+        { it->second = std::forward<M>(obj); }
+
+        return it;
+    }
+
+    /**
+     * @brief Inserts a new element as close as possible to the position just
+     * before hint, or assigns to the mapped value of the existing element with
+     * key key.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return iterator to the inserted or updated element.
+     */
+    template<class M>
+    iterator insert_or_assign(const_iterator hint, K&& key, M&& obj)
+    {
+        auto const sizeBefore = size();
+        auto it = try_emplace(hint, std::move(key), std::forward<M>(obj));
+        if (size() == sizeBefore)
+        { it->second = std::forward<M>(obj); }
+
+        return it;
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (large_)
+        { return iterator(storage_.large.erase(first.tree_, last.tree_)); }
+
+        return erase_slots(index_of(first), index_of(last));
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const K& key)
+    {
+        if (large_)
+        { return storage_.large.erase(key); }
+
+        auto const it = find(key);
+        if (it == end())
+        { return 0; }
+
+        erase(it);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(SmallMap& other) noexcept
+    {
+        using std::swap;
+        if (large_ && other.large_)
+        { storage_.large.swap(other.storage_.large); }
+        else
+        {
+            SmallMap moved{std::move(other)};
+            other.take(*this);
+            take(moved);
+        }
+        swap(comp_, other.comp_);
+        if constexpr (AllocatorTraits<
+                        Allocator>::propagate_on_container_swap::value)
+        { swap(alloc_, other.alloc_); }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<std::size_t N2, class C2>
+    void merge(SmallMap<K, V, N2, C2, Allocator>& source)
+    {
+        for (auto it = source.begin(); it != source.end();)
+        {
+            if (emplace_key(it->first, it->first, std::move(it->second)).second)
+            { it = source.erase(it); }
+            else
+            { ++it; }
+        }
+    }
+
+    /**
+     * @brief Moves the elements of source whose keys are not in the container
+     * yet. Elements with a key that already exists are left in source.
+     *
+     * @param source compatible container to transfer the elements from.
+     */
+    template<std::size_t N2, class C2>
+    void merge(SmallMap<K, V, N2, C2, Allocator>&& source)
+    {
+        merge(source);
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to key, which is either 1 or 0. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    size_type count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    iterator find(const K& key) { return find_position(key); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const { return find_position(key); }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator find(const Key& key)
+    {
+        return find_position(key);
+    }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator find(const Key& key) const
+    {
+        return find_position(key);
+    }
+
+    /**
+     * @brief Checks whether there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    /**
+     * @brief Checks whether there is an element with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return equal_range_position(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    iterator lower_bound(const K& key) { return bound_position<false>(key); }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    const_iterator lower_bound(const K& key) const
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator lower_bound(const Key& key)
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is not
+     * less than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return bound_position<false>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    iterator upper_bound(const K& key) { return bound_position<true>(key); }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    const_iterator upper_bound(const K& key) const
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    iterator upper_bound(const Key& key)
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns an iterator pointing to the first element that is greater
+     * than key. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key, or end()
+     * if there is none.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<C>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return bound_position<true>(key);
+    }
+
+    /**
+     * @brief Returns the function object that compares the keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return comp_; }
+
+    /**
+     * @brief Returns a function object that compares objects of type
+     * value_type by their keys.
+     *
+     * @return the value comparison function object.
+     */
+    value_compare value_comp() const { return value_compare(comp_); }
+
+ private:
+    friend struct MemoryFootprintTraits<SmallMap>;
+
+    using Large = Map<K, V, C, Allocator>;
+    using Slot  = detail::MapSlot<K, V>;
+
+    static_assert(sizeof(Slot) == sizeof(value_type));
+
+    static constexpr bool kSimdSearch = detail::kSimdSearchableKey<K, C>;
+
+    static constexpr size_type kKeyLanes = detail::SimdKeyOps<K>::kWidth;
+
+    static constexpr size_type kMirrorKeys =
+      (N + kKeyLanes - 1) / kKeyLanes * kKeyLanes;
+
+    /**
+     * @brief Moving into the Map moves the elements if that cannot throw, and
+     * copies them otherwise, so that a failure leaves them in place.
+     */
+    static constexpr bool kNothrowMove =
+      std::is_nothrow_move_constructible_v<K>
+      && std::is_nothrow_move_constructible_v<V>;
+
+    /**
+     * @brief Packed copy of the inline keys, padded to whole SIMD blocks.
+     */
+    struct KeyMirror
+    {
+        K keys[kMirrorKeys]{};
+    };
+
+    struct NoKeyMirror
+    {};
+
+    /**
+     * @brief Inline storage. The element storage is left uninitialized, only
+     * the first size_ slots hold elements.
+     */
+    struct Small
+    {
+        Small() noexcept {}
+
+        [[no_unique_address]] std::
+          conditional_t<kSimdSearch, KeyMirror, NoKeyMirror> mirror;
+        alignas(value_type) unsigned char storage[N * sizeof(value_type)];
+    };
+
+    static_assert(std::is_trivially_destructible_v<Small>);
+
+    /**
+     * @brief Holds the inline storage while large_ is false, and the Map
+     * holding the elements otherwise.
+     */
+    union Storage
+    {
+        Storage() noexcept : small() {}
+        ~Storage() {}
+
+        Small small;
+        Large large;
+    };
+
+    template<bool Const> class Iterator
+    {
+        using Slot = std::conditional_t<Const,
+                                        const typename SmallMap::value_type,
+                                        typename SmallMap::value_type>;
+        using Tree = std::conditional_t<Const,
+                                        typename Large::const_iterator,
+                                        typename Large::iterator>;
+
+     public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename SmallMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Slot*;
+        using reference         = Slot&;
+
+        Iterator() = default;
+
+        /**
+         * @brief Converts an iterator to a const_iterator.
+         */
+        template<bool OtherConst>
+            requires(Const && ! OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept
+          : slot_(other.slot_), tree_(other.tree_)
+        {}
+
+        reference operator*() const noexcept { return *operator->(); }
+
+        pointer operator->() const noexcept
+        {
+            return slot_ != nullptr ? slot_ : std::addressof(*tree_);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            if (slot_ != nullptr)
+            { ++slot_; }
+            else
+            { ++tree_; }
+
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator previous = *this;
+            ++(*this);
+
+            return previous;
+        }
+
+        Iterator& operator--() noexcept
+        {
+            if (slot_ != nullptr)
+            { --slot_; }
+            else
+            { --tree_; }
+
+            return *this;
+        }
+
+        Iterator operator--(int) noexcept
+        {
+            Iterator previous = *this;
+            --(*this);
+
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.slot_ == rhs.slot_ && lhs.tree_ == rhs.tree_;
+        }
+
+     private:
+        friend class SmallMap;
+        template<bool> friend class Iterator;
+
+        explicit Iterator(Slot* slot) noexcept : slot_(slot) {}
+
+        explicit Iterator(Tree tree) noexcept : tree_(tree) {}
+
+        /** inline element, or nullptr while the elements are in the Map */
+        Slot* slot_{nullptr};
+        Tree  tree_{};
+    };
+
+    // The const lookups share these helpers with the non-const ones; the
+    // public const overloads only hand out const_iterators.
+
+    value_type* raw_slot(size_type i) const noexcept
+    {
+        return reinterpret_cast<value_type*>(
+          const_cast<unsigned char*>(storage_.small.storage)
+          + i * sizeof(value_type));
+    }
+
+    value_type* slot(size_type i) const noexcept
+    {
+        return std::launder(raw_slot(i));
+    }
+
+    const K& key(size_type i) const noexcept { return slot(i)->first; }
+
+    Large& large() const noexcept { return const_cast<Large&>(storage_.large); }
+
+    size_type index_of(const_iterator position) const noexcept
+    {
+        return static_cast<size_type>(position.slot_ - raw_slot(0));
+    }
+
+    iterator mutable_position(const_iterator position) const
+    {
+        if (large_)
+        { return iterator(large().erase(position.tree_, position.tree_)); }
+
+        return iterator(raw_slot(index_of(position)));
+    }
+
+    iterator begin_position() const noexcept
+    {
+        return large_ ? iterator(large().begin()) : iterator(raw_slot(0));
+    }
+
+    iterator end_position() const noexcept
+    {
+        return large_ ? iterator(large().end()) : iterator(raw_slot(size_));
+    }
+
+    /**
+     * @brief Index of the first inline element that is not less than key, or
+     * greater than key if Upper is set.
+     */
+    template<bool Upper, class Key> size_type search(const Key& key) const
+    {
+        if constexpr (kSimdSearch && std::is_same_v<Key, K>)
+        {
+            return detail::CountBelowAll<Upper, kMirrorKeys>(
+              storage_.small.mirror.keys, size_, key);
+        }
+        else
+        {
+            size_type first = 0;
+            size_type last  = size_;
+            while (first < last)
+            {
+                size_type const middle = first + (last - first) / 2;
+                bool const      below  = Upper ? ! comp_(key, this->key(middle))
+                                               : comp_(this->key(middle), key);
+                if (below)
+                { first = middle + 1; }
+                else
+                { last = middle; }
+            }
+
+            return first;
+        }
+    }
+
+    template<class Key> iterator find_position(const Key& key) const
+    {
+        if (large_)
+        { return iterator(large().find(key)); }
+
+        size_type const i = search<false>(key);
+        if (i < size_ && ! comp_(key, this->key(i)))
+        { return iterator(slot(i)); }
+
+        return end_position();
+    }
+
+    /**
+     * @brief Lower bound, or upper bound if Upper is set.
+     */
+    template<bool Upper, class Key>
+    iterator bound_position(const Key& key) const
+    {
+        if (large_)
+        {
+            return iterator(Upper ? large().upper_bound(key)
+                                  : large().lower_bound(key));
+        }
+
+        return iterator(raw_slot(search<Upper>(key)));
+    }
+
+    template<class Key>
+    std::pair<iterator, iterator> equal_range_position(const Key& key) const
+    {
+        iterator const first = bound_position<false>(key);
+        if (first == end_position() || comp_(key, first->first))
+        { return {first, first}; }
+
+        return {first, std::next(first)};
+    }
+
+    /**
+     * @brief Inserts the element constructed from args unless an element with
+     * key key exists. args are only used if the element is inserted.
+     */
+    template<class Key, class... Args>
+    std::pair<iterator, bool> emplace_key(const Key& key, Args&&... args)
+    {
+        iterator const position = bound_position<false>(key);
+        if (position != end_position() && ! comp_(key, position->first))
+        { return {position, false}; }
+
+        return {insert_before(position, std::forward<Args>(args)...), true};
+    }
+
+    /**
+     * @brief Inserts the element constructed from args right before hint if
+     * key belongs there, otherwise falls back to emplace_key().
+     */
+    template<class Key, class... Args>
+    iterator
+    emplace_hint_key(const_iterator hint, const Key& key, Args&&... args)
+    {
+        iterator const position = mutable_position(hint);
+        iterator const last     = end_position();
+        if (position == last || comp_(key, position->first))
+        {
+            if (position == begin_position()
+                || comp_(std::prev(position)->first, key))
+            { return insert_before(position, std::forward<Args>(args)...); }
+        }
+        else if (comp_(position->first, key))
+        {
+            iterator const next = std::next(position);
+            if (next == last || comp_(key, next->first))
+            { return insert_before(next, std::forward<Args>(args)...); }
+        }
+        else
+        {
+            return position;
+        }
+
+        return emplace_key(key, std::forward<Args>(args)...).first;
+    }
+
+    /**
+     * @brief Appends copies of the elements of other, which sort after all
+     * elements of the container.
+     */
+    void append(const SmallMap& other)
+    {
+        for (const auto& value : other) { append_element(value); }
+    }
+
+    template<class... Args> void append_element(Args&&... args)
+    {
+        insert_before(end_position(), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs an element from args before position.
+     */
+    template<class... Args>
+    iterator insert_before(iterator position, Args&&... args)
+    {
+        if (large_)
+        {
+            return iterator(large().emplace_hint(
+              position.tree_, std::forward<Args>(args)...));
+        }
+
+        return insert_at(index_of(position), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs an element from args in inline slot index, or moves
+     * all elements into a Map first if the inline storage is full.
+     */
+    template<class... Args> iterator insert_at(size_type index, Args&&... args)
+    {
+        if (size_ == N)
+        { return grow(index, std::forward<Args>(args)...); }
+
+        if (index == size_)
+        {
+            Slot::construct(
+              alloc_, Slot::of(raw_slot(index)), std::forward<Args>(args)...);
+        }
+        else
+        {
+            // Construct the element first, so that a throwing constructor
+            // leaves the container untouched.
+            std::pair<K, V> value(std::forward<Args>(args)...);
+            for (size_type i = size_; i > index; --i) { relocate(i, i - 1); }
+            Slot::construct(
+              alloc_, Slot::of(raw_slot(index)), std::move(value));
+        }
+        set_mirror(index);
+        ++size_;
+
+        return iterator(slot(index));
+    }
+
+    /**
+     * @brief Moves the full inline storage into a new Map together with the
+     * element constructed from args, which belongs before inline slot index.
+     * The new element is constructed first, so args may refer to elements of
+     * the container. A failure leaves the container unchanged.
+     */
+    template<class... Args> iterator grow(size_type index, Args&&... args)
+    {
+        Large      map(comp_, alloc_);
+        auto const inserted = map.emplace(std::forward<Args>(args)...).first;
+
+        size_type moved = 0;
+        try
+        {
+            for (; moved < size_; ++moved)
+            {
+                Slot* const value = Slot::of(slot(moved));
+                if constexpr (kNothrowMove)
+                {
+                    map.emplace_hint(moved < index ? inserted : map.end(),
+                                     Slot::rvalue(value));
+                }
+                else
+                {
+                    map.emplace_hint(moved < index ? inserted : map.end(),
+                                     std::as_const(value->value));
+                }
+            }
+        }
+        catch (...)
+        {
+            if constexpr (kNothrowMove)
+            {
+                // Allocating a node failed. The elements moved so far are the
+                // smallest ones in the Map, apart from the new element.
+                auto it = map.begin();
+                for (size_type i = 0; i < moved; ++i)
+                {
+                    if (it == inserted)
+                    { ++it; }
+
+                    Slot* const element = Slot::of(slot(i));
+                    Slot::destroy(alloc_, element);
+                    ExtractNode(map, it++, [this, element](K&& key, V&& value) {
+                        Slot::construct(
+                          alloc_, element, std::move(key), std::move(value));
+                    });
+                }
+            }
+            throw;
+        }
+
+        clear();
+        become_large();
+        storage_.large.swap(map);
+
+        return iterator(inserted);
+    }
+
+    /**
+     * @brief Removes the element at it from map and passes its key and value
+     * to fn to be moved from.
+     */
+    template<class Fn>
+    static void ExtractNode(Large& map, typename Large::iterator it, Fn&& fn)
+    {
+        auto node = map.extract(it);
+        // A valid iterator never yields an empty node, the check only tells
+        // the compiler so.
+        if (! node.empty())
+        { fn(std::move(node.key()), std::move(node.mapped())); }
+    }
+
+    /**
+     * @brief Switches the empty inline storage to an empty Map.
+     */
+    void become_large() noexcept
+    {
+        ::new (static_cast<void*>(&storage_.large)) Large(key_comp(), alloc_);
+        large_ = true;
+    }
+
+    /**
+     * @brief Replaces the contents with those of source, which is left empty.
+     * Takes over the Map of source, or relocates its inline elements.
+     */
+    void take(SmallMap& source) noexcept
+    {
+        clear();
+        if (source.large_)
+        {
+            become_large();
+            storage_.large.swap(source.storage_.large);
+            return;
+        }
+
+        for (size_type i = 0; i < source.size_; ++i)
+        {
+            Slot::relocate(
+              alloc_, Slot::of(raw_slot(i)), Slot::of(source.slot(i)));
+        }
+        storage_.small.mirror = source.storage_.small.mirror;
+        size_                 = std::exchange(source.size_, 0);
+    }
+
+    iterator erase_slots(size_type first, size_type last)
+    {
+        // Relocating the following elements onto themselves would leave them
+        // moved from.
+        if (first == last)
+        { return iterator(raw_slot(first)); }
+
+        for (size_type i = first; i < last; ++i)
+        { Slot::destroy(alloc_, Slot::of(slot(i))); }
+
+        size_type const count = last - first;
+        for (size_type i = last; i < size_; ++i) { relocate(i - count, i); }
+        size_ -= count;
+
+        return iterator(raw_slot(first));
+    }
+
+    void relocate(size_type to, size_type from) noexcept
+    {
+        Slot::relocate(alloc_, Slot::of(raw_slot(to)), Slot::of(slot(from)));
+        set_mirror(to);
+    }
+
+    void set_mirror(size_type i) noexcept
+    {
+        if constexpr (kSimdSearch)
+        { storage_.small.mirror.keys[i] = key(i); }
+    }
+
+    // The header comes first, so that it shares a cache line with the inline
+    // keys.
+    size_type                       size_{0};
+    bool                            large_{false};
+    [[no_unique_address]] C         comp_;
+    [[no_unique_address]] Allocator alloc_;
+    Storage                         storage_;
+};
+
+/**
+ * @brief Exchanges the contents of two maps.
+ *
+ * @param lhs first map.
+ * @param rhs second map.
+ */
+template<class K, class V, std::size_t N, class C, class Allocator> void
+swap(SmallMap<K, V, N, C, Allocator>& lhs,
+     SmallMap<K, V, N, C, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief SmallMap owns no memory of its own while its elements are inline, and
+ * the nodes of its Map once it has grown.
+ */
+template<class K, class V, std::size_t N, class C, class Allocator>
+struct MemoryFootprintTraits<SmallMap<K, V, N, C, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const SmallMap<K, V, N, C, Allocator>& value)
+    {
+        if (value.large_)
+        { return memory_footprint(value.storage_.large); }
+
+        MemoryFootprint footprint;
+        if constexpr (MemoryFootprintTraits<K>::kOwnsHeap
+                      || MemoryFootprintTraits<V>::kOwnsHeap)
+        {
+            for (const auto& [k, v] : value)
+            { footprint += memory_footprint(k) + memory_footprint(v); }
+        }
+
+        return footprint;
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SMALL_MAP_H_
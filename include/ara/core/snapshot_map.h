@@ -0,0 +1,378 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SNAPSHOT_MAP_H_
+#define ARA_CORE_SNAPSHOT_MAP_H_
+
+#include "ara/core/flat_map.h"
+#include "ara/core/vector.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Returns a small number identifying the calling thread, assigned in
+ * the order in which threads first ask for it.
+ */
+inline std::size_t ThisThreadIndex() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    thread_local std::size_t const  index =
+      next.fetch_add(1, std::memory_order_relaxed);
+
+    return index;
+}
+}  // namespace detail
+
+/**
+ * @brief Map for read-mostly data, published as a sequence of immutable
+ * snapshots.
+ *
+ * Readers pin the current snapshot with snapshot() and may use it for as long
+ * as they hold it, no matter how many updates are published meanwhile. Pinning
+ * never blocks: it loads the epoch and the snapshot pointer and bumps a counter
+ * in a cache line owned by the calling thread, so concurrent readers never
+ * write to a shared cache line.
+ *
+ * Writers are serialized. update() copies the current snapshot, applies a
+ * batch of changes to the copy and publishes it with a single atomic exchange,
+ * so a batch costs one copy of the map no matter how many changes it holds.
+ *
+ * Replaced snapshots are reclaimed through epoch-based reclamation. Every
+ * reader counts itself into one of two per-thread counters selected by the
+ * parity of the global epoch. A writer advances the epoch once all readers of
+ * the previous epoch are gone, and destroys a snapshot two epochs after it
+ * was replaced, when no reader can still hold it. Reclamation never waits for
+ * readers; snapshots still pinned are retried on the next update or
+ * reclaim().
+ *
+ * Threads beyond the number of reader slots share slots, which stays correct
+ * but lets those threads write to the same cache line.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam C key comparison function.
+ */
+template<typename K, typename V, typename C = std::less<K>> class SnapshotMap
+{
+    struct Version;
+    struct Slot;
+
+ public:
+    using key_type      = K;
+    using mapped_type   = V;
+    using key_compare   = C;
+    using size_type     = std::size_t;
+    using snapshot_type = FlatMap<K, V, C>;
+
+    /**
+     * @brief A pinned, immutable snapshot of the map.
+     *
+     * The snapshot stays valid until the Snapshot object is destroyed. It
+     * should be held briefly: a pinned snapshot delays the reclamation of all
+     * snapshots published after it.
+     */
+    class Snapshot
+    {
+     public:
+        Snapshot(Snapshot&& other) noexcept
+          : readers_{std::exchange(other.readers_, nullptr)}
+          , version_{other.version_}
+        {}
+
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        Snapshot& operator=(Snapshot&&) = delete;
+
+        ~Snapshot()
+        {
+            if (readers_)
+            { readers_->fetch_sub(1, std::memory_order_release); }
+        }
+
+        /**
+         * @brief Returns the pinned map.
+         *
+         * @return const reference to the map.
+         */
+        const snapshot_type& operator*() const noexcept
+        {
+            return version_->map;
+        }
+
+        /**
+         * @brief Accesses the pinned map.
+         *
+         * @return const pointer to the map.
+         */
+        const snapshot_type* operator->() const noexcept
+        {
+            return &version_->map;
+        }
+
+        /**
+         * @brief Returns the number of updates published before this snapshot.
+         *
+         * @return version number of the snapshot, 0 for the initial one.
+         */
+        std::uint64_t version() const noexcept { return version_->number; }
+
+     private:
+        friend class SnapshotMap;
+
+        Snapshot(std::atomic<std::uint32_t>* readers,
+                 const Version*              version) noexcept
+          : readers_{readers}, version_{version}
+        {}
+
+        std::atomic<std::uint32_t>* readers_;
+        const Version*              version_;
+    };
+
+    /**
+     * @brief Constructs a map holding an empty snapshot.
+     *
+     * @param comp comparison function object to use for all comparisons of
+     * keys.
+     */
+    explicit SnapshotMap(const C& comp = C())
+      : SnapshotMap(snapshot_type(comp))
+    {}
+
+    /**
+     * @brief Constructs a map whose initial snapshot is map.
+     *
+     * @param map the initial content.
+     */
+    explicit SnapshotMap(snapshot_type map)
+      : slot_count_{std::bit_ceil(std::max<std::size_t>(
+        std::thread::hardware_concurrency(), 1))}
+      , slots_{std::make_unique<Slot[]>(slot_count_)}
+      , current_{new Version{std::move(map), 0}}
+    {}
+
+    /**
+     * @brief Destroys all snapshots. No reader may hold a snapshot any more.
+     */
+    ~SnapshotMap()
+    {
+        delete current_.load(std::memory_order_relaxed);
+        for (auto& retired : retired_) { delete retired.version; }
+    }
+
+    SnapshotMap(const SnapshotMap&) = delete;
+    SnapshotMap& operator=(const SnapshotMap&) = delete;
+
+    /**
+     * @brief Pins the current snapshot. Wait-free.
+     *
+     * @return the pinned snapshot.
+     */
+    Snapshot snapshot() const noexcept
+    {
+        Slot& slot = slots_[detail::ThisThreadIndex() & (slot_count_ - 1)];
+        auto& readers =
+          slot.readers[epoch_.load(std::memory_order_relaxed) & 1];
+
+        // Sequentially consistent, so that a writer that misses this reader
+        // when advancing the epoch is ordered before the load of current_.
+        readers.fetch_add(1, std::memory_order_seq_cst);
+
+        return {&readers, current_.load(std::memory_order_seq_cst)};
+    }
+
+    /**
+     * @brief Calls fn with the current snapshot and returns its result.
+     *
+     * @param fn function called with a const reference to the snapshot_type.
+     *
+     * @return the result of fn.
+     */
+    template<class Fn> decltype(auto) read(Fn&& fn) const
+    {
+        auto const pinned = snapshot();
+        return std::forward<Fn>(fn)(*pinned);
+    }
+
+    /**
+     * @brief Publishes a new snapshot made by applying fn to a copy of the
+     * current one. Concurrent updates are serialized. If fn throws, nothing is
+     * published.
+     *
+     * @param fn function called with a reference to the copy.
+     *
+     * @return version number of the published snapshot.
+     */
+    template<class Fn> std::uint64_t update(Fn&& fn)
+    {
+        std::lock_guard<std::mutex> lock{writer_};
+
+        auto const current = current_.load(std::memory_order_relaxed);
+        auto next =
+          std::make_unique<Version>(current->map, current->number + 1);
+        std::forward<Fn>(fn)(next->map);
+
+        return publish(std::move(next));
+    }
+
+    /**
+     * @brief Publishes map as the new snapshot.
+     *
+     * @param map the new content.
+     *
+     * @return version number of the published snapshot.
+     */
+    std::uint64_t assign(snapshot_type map)
+    {
+        std::lock_guard<std::mutex> lock{writer_};
+
+        auto const number = current_.load(std::memory_order_relaxed)->number;
+
+        return publish(std::make_unique<Version>(std::move(map), number + 1));
+    }
+
+    /**
+     * @brief Inserts or assigns a single element and publishes the result.
+     * Prefer update() for several changes, every call copies the map.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return version number of the published snapshot.
+     */
+    template<class M> std::uint64_t insert_or_assign(const K& key, M&& obj)
+    {
+        return update([&key, &obj](snapshot_type& map) {
+            auto const result = map.try_emplace(key, std::forward<M>(obj));
+            if (! result.second)
+            { result.first->second = std::forward<M>(obj); }
+        });
+    }
+
+    /**
+     * @brief Removes a single element and publishes the result. Prefer
+     * update() for several changes, every call copies the map.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return version number of the published snapshot.
+     */
+    std::uint64_t erase(const K& key)
+    {
+        return update([&key](snapshot_type& map) { map.erase(key); });
+    }
+
+    /**
+     * @brief Destroys the replaced snapshots no reader can hold any more.
+     * Called by every update; call it to release memory when no further
+     * update is coming.
+     *
+     * @return number of replaced snapshots still waiting for readers.
+     */
+    size_type reclaim()
+    {
+        std::lock_guard<std::mutex> lock{writer_};
+
+        return collect();
+    }
+
+ private:
+    struct Version
+    {
+        Version(snapshot_type m, std::uint64_t n)
+          : map{std::move(m)}, number{n}
+        {}
+
+        snapshot_type map;
+        std::uint64_t number;
+    };
+
+    /**
+     * @brief Reader counters of the threads mapped to one slot, one per epoch
+     * parity, on a cache line of their own.
+     */
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint32_t> readers[2]{};
+    };
+
+    struct Retired
+    {
+        const Version* version;
+        std::uint64_t  epoch;
+    };
+
+    std::uint64_t publish(std::unique_ptr<Version> next)
+    {
+        std::uint64_t const number = next->number;
+
+        retired_.reserve(retired_.size() + 1);
+        const Version* const previous =
+          current_.exchange(next.release(), std::memory_order_seq_cst);
+        retired_.push_back({previous, epoch_.load(std::memory_order_relaxed)});
+
+        collect();
+        return number;
+    }
+
+    /**
+     * @brief Advances the epoch up to twice and destroys the snapshots retired
+     * at least two epochs ago. Called with writer_ held.
+     */
+    size_type collect() noexcept
+    {
+        for (int i = 0; i < 2 && try_advance(); ++i) {}
+
+        std::uint64_t const epoch = epoch_.load(std::memory_order_relaxed);
+        auto const          alive = std::partition(
+          retired_.begin(), retired_.end(), [epoch](const Retired& retired) {
+              return retired.epoch + 2 > epoch;
+          });
+        for (auto it = alive; it != retired_.end(); ++it)
+        { delete it->version; }
+        retired_.erase(alive, retired_.end());
+
+        return retired_.size();
+    }
+
+    /**
+     * @brief Moves from epoch e to e + 1 if no reader counted under the parity
+     * of e - 1, which is the parity of e + 1, is left. Readers of epoch e can
+     * only hold snapshots retired in e or later.
+     */
+    bool try_advance() noexcept
+    {
+        std::uint64_t const epoch  = epoch_.load(std::memory_order_relaxed);
+        std::size_t const   parity = (epoch + 1) & 1;
+        for (std::size_t i = 0; i < slot_count_; ++i)
+        {
+            if (slots_[i].readers[parity].load(std::memory_order_seq_cst) != 0)
+            { return false; }
+        }
+        epoch_.store(epoch + 1, std::memory_order_seq_cst);
+
+        return true;
+    }
+
+    std::size_t                 slot_count_;
+    std::unique_ptr<Slot[]>     slots_;
+    std::atomic<const Version*> current_;
+    std::atomic<std::uint64_t>  epoch_{0};
+    std::mutex                  writer_;
+    Vector<Retired>             retired_;
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_SNAPSHOT_MAP_H_
@@ -0,0 +1,502 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_SPAN_H_
+#define ARA_CORE_SPAN_H_
+
+#include "ara/core/array.h"
+#include "ara/core/utility.h"
+#include "ara/core/vector.h"
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+namespace ara::core {
+/**
+ * @brief Extent of a Span whose size is only known at runtime.
+ */
+inline constexpr std::size_t dynamic_extent =
+  std::numeric_limits<std::size_t>::max();
+
+template<typename T, std::size_t Extent = dynamic_extent> class Span;
+
+namespace detail {
+/**
+ * @brief Pointer and size of a Span. A static extent is part of the type, so
+ * the span holds nothing but the pointer.
+ */
+template<class T, std::size_t Extent> class SpanStorage
+{
+ public:
+    constexpr SpanStorage() noexcept = default;
+    constexpr SpanStorage(T* data, std::size_t) noexcept : data_(data) {}
+
+    constexpr T*          data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return Extent; }
+
+ private:
+    T* data_{nullptr};
+};
+
+template<class T> class SpanStorage<T, dynamic_extent>
+{
+ public:
+    constexpr SpanStorage() noexcept = default;
+    constexpr SpanStorage(T* data, std::size_t size) noexcept
+      : data_(data), size_(size)
+    {}
+
+    constexpr T*          data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+
+ private:
+    T*          data_{nullptr};
+    std::size_t size_{0};
+};
+
+template<class T> struct IsSpanOrArray : std::false_type
+{};
+
+template<class T, std::size_t N>
+struct IsSpanOrArray<Span<T, N>> : std::true_type
+{};
+
+template<class T, std::size_t N>
+struct IsSpanOrArray<Array<T, N>> : std::true_type
+{};
+
+/**
+ * @brief Whether a span of From can be viewed as a span of To, which only
+ * allows adding const or volatile.
+ */
+template<class From, class To>
+concept SpanConvertible = std::is_convertible_v<From (*)[], To (*)[]>;
+
+/**
+ * @brief Ranges a Span views without the dedicated constructors for spans and
+ * arrays: contiguous, sized and, unless the span is const, not a temporary.
+ */
+template<class R, class T>
+concept SpanCompatibleRange =
+  std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+  && (std::ranges::borrowed_range<R> || std::is_const_v<T>)
+  && ! IsSpanOrArray<std::remove_cvref_t<R>>::value
+  && ! std::is_array_v<std::remove_cvref_t<R>>
+  && SpanConvertible<std::remove_reference_t<std::ranges::range_reference_t<R>>,
+                     T>;
+}  // namespace detail
+
+/**
+ * @brief Non-owning view of a contiguous sequence of objects.
+ *
+ * A Span takes a Vector, an Array, a C array or a pointer and a length, so a
+ * function that reads or fills a buffer works with any of them without
+ * copying or being tied to one container type. With a static extent the size
+ * is part of the type and the span is a single pointer; with dynamic_extent it
+ * is a pointer and a size.
+ *
+ * Like indexing a Vector, operator[], front(), back(), first(), last() and
+ * subspan() don't check their arguments; at() throws on a bad index.
+ *
+ * @tparam T element type, const for a read-only view.
+ * @tparam Extent number of elements, or dynamic_extent.
+ */
+template<typename T, std::size_t Extent> class Span
+{
+ public:
+    using element_type     = T;
+    using value_type       = std::remove_cv_t<T>;
+    using size_type        = std::size_t;
+    using difference_type  = std::ptrdiff_t;
+    using pointer          = T*;
+    using const_pointer    = const T*;
+    using reference        = T&;
+    using const_reference  = const T&;
+    using iterator         = T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    static constexpr size_type extent = Extent;
+
+    /**
+     * @brief Constructs an empty span.
+     */
+    constexpr Span() noexcept
+        requires(Extent == dynamic_extent || Extent == 0)
+    = default;
+
+    /**
+     * @brief Constructs a span of the count elements starting at first. For a
+     * static extent, count must equal Extent.
+     *
+     * @param first iterator to the first element.
+     * @param count number of elements.
+     */
+    template<std::contiguous_iterator It>
+        requires detail::SpanConvertible<
+          std::remove_reference_t<std::iter_reference_t<It>>,
+          T>
+    constexpr explicit(Extent != dynamic_extent)
+      Span(It first, size_type count) noexcept
+      : storage_(std::to_address(first), count)
+    {}
+
+    /**
+     * @brief Constructs a span of the elements in [first, last). For a static
+     * extent, the range must hold Extent elements.
+     *
+     * @param first iterator to the first element.
+     * @param last end of the range.
+     */
+    template<std::contiguous_iterator It, std::sized_sentinel_for<It> End>
+        requires detail::SpanConvertible<
+                   std::remove_reference_t<std::iter_reference_t<It>>,
+                   T>
+                 && (! std::is_convertible_v<End, size_type>)
+    constexpr explicit(Extent != dynamic_extent)
+      Span(It first, End last) noexcept
+      : storage_(std::to_address(first), static_cast<size_type>(last - first))
+    {}
+
+    /**
+     * @brief Constructs a span of a C array.
+     *
+     * @param arr array to view.
+     */
+    template<std::size_t N>
+        requires(Extent == dynamic_extent || Extent == N)
+    constexpr Span(std::type_identity_t<element_type> (&arr)[N]) noexcept
+      : storage_(arr, N)
+    {}
+
+    /**
+     * @brief Constructs a span of an Array.
+     *
+     * @param arr array to view.
+     */
+    template<class U, std::size_t N>
+        requires(Extent == dynamic_extent || Extent == N)
+                && detail::SpanConvertible<U, T>
+    constexpr Span(Array<U, N>& arr) noexcept : storage_(arr.data(), N)
+    {}
+
+    /**
+     * @brief Constructs a span of a const Array.
+     *
+     * @param arr array to view.
+     */
+    template<class U, std::size_t N>
+        requires(Extent == dynamic_extent || Extent == N)
+                && detail::SpanConvertible<const U, T>
+    constexpr Span(const Array<U, N>& arr) noexcept : storage_(arr.data(), N)
+    {}
+
+    /**
+     * @brief Constructs a span of a contiguous range such as a Vector. A span
+     * of mutable elements cannot view a temporary container. For a static
+     * extent, the range must hold Extent elements.
+     *
+     * @param range range to view.
+     */
+    template<class R>
+        requires detail::SpanCompatibleRange<R, T>
+    constexpr explicit(Extent != dynamic_extent) Span(R&& range)
+      : storage_(std::ranges::data(range), std::ranges::size(range))
+    {}
+
+    /**
+     * @brief Converts a span of U, adding const or fixing the extent. From a
+     * dynamic extent to a static one, the size must equal Extent.
+     *
+     * @param other span to view the elements of.
+     */
+    template<class U, std::size_t N>
+        requires(Extent == dynamic_extent || N == dynamic_extent || N == Extent)
+                && detail::SpanConvertible<U, T>
+    constexpr explicit(Extent != dynamic_extent && N == dynamic_extent)
+      Span(const Span<U, N>& other) noexcept
+      : storage_(other.data(), other.size())
+    {}
+
+    constexpr Span(const Span& other) noexcept            = default;
+    constexpr Span& operator=(const Span& other) noexcept = default;
+
+    /**
+     * @brief Returns a span of the first Count elements.
+     *
+     * @return span with static extent Count.
+     */
+    template<std::size_t Count> constexpr Span<T, Count> first() const noexcept
+    {
+        static_assert(Extent == dynamic_extent || Count <= Extent,
+                      "Count exceeds the extent");
+
+        return Span<T, Count>(data(), Count);
+    }
+
+    /**
+     * @brief Returns a span of the first count elements.
+     *
+     * @param count number of elements, at most size().
+     *
+     * @return span with dynamic extent.
+     */
+    constexpr Span<T> first(size_type count) const noexcept
+    {
+        return {data(), count};
+    }
+
+    /**
+     * @brief Returns a span of the last Count elements.
+     *
+     * @return span with static extent Count.
+     */
+    template<std::size_t Count> constexpr Span<T, Count> last() const noexcept
+    {
+        static_assert(Extent == dynamic_extent || Count <= Extent,
+                      "Count exceeds the extent");
+
+        return Span<T, Count>(data() + (size() - Count), Count);
+    }
+
+    /**
+     * @brief Returns a span of the last count elements.
+     *
+     * @param count number of elements, at most size().
+     *
+     * @return span with dynamic extent.
+     */
+    constexpr Span<T> last(size_type count) const noexcept
+    {
+        return {data() + (size() - count), count};
+    }
+
+    /**
+     * @brief Returns a span of Count elements starting at Offset, or of all
+     * elements from Offset on if Count is dynamic_extent.
+     *
+     * @return span that has a static extent if Count or Extent is static.
+     */
+    template<std::size_t Offset, std::size_t Count = dynamic_extent>
+    constexpr auto subspan() const noexcept
+    {
+        static_assert(Extent == dynamic_extent || Offset <= Extent,
+                      "Offset exceeds the extent");
+        static_assert(Extent == dynamic_extent || Count == dynamic_extent
+                        || Count <= Extent - Offset,
+                      "Count exceeds the extent");
+
+        constexpr size_type kExtent =
+          Count != dynamic_extent
+            ? Count
+            : (Extent != dynamic_extent ? Extent - Offset : dynamic_extent);
+        size_type const count = Count != dynamic_extent ? Count
+                                                        : size() - Offset;
+
+        return Span<T, kExtent>(data() + Offset, count);
+    }
+
+    /**
+     * @brief Returns a span of count elements starting at offset, or of all
+     * elements from offset on if count is dynamic_extent.
+     *
+     * @param offset position of the first element, at most size().
+     * @param count number of elements, at most size() - offset.
+     *
+     * @return span with dynamic extent.
+     */
+    constexpr Span<T> subspan(size_type offset,
+                              size_type count = dynamic_extent) const noexcept
+    {
+        return {data() + offset,
+                count == dynamic_extent ? size() - offset : count};
+    }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the span.
+     */
+    constexpr size_type size() const noexcept { return storage_.size(); }
+
+    /**
+     * @brief Returns the size of the elements in bytes.
+     *
+     * @return size() times the size of an element.
+     */
+    constexpr size_type size_bytes() const noexcept
+    {
+        return size() * sizeof(element_type);
+    }
+
+    /**
+     * @brief Checks whether the span is empty.
+     *
+     * @return true if the span is empty, false otherwise.
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Access specified element without bounds checking.
+     *
+     * @param i position of the element, less than size().
+     *
+     * @return reference to the element.
+     */
+    constexpr reference operator[](size_type i) const noexcept
+    {
+        return data()[i];
+    }
+
+    /**
+     * @brief Access specified element with bounds checking.
+     *
+     * @param i position of the element to return.
+     *
+     * @return reference to the element.
+     *
+     * @throws std::out_of_range if i is not less than size().
+     */
+    constexpr reference at(size_type i) const
+    {
+        if (i >= size())
+        { throw std::out_of_range("Span::at"); }
+
+        return data()[i];
+    }
+
+    /**
+     * @brief Access the first element of a non-empty span.
+     *
+     * @return reference to the first element.
+     */
+    constexpr reference front() const noexcept { return data()[0]; }
+
+    /**
+     * @brief Access the last element of a non-empty span.
+     *
+     * @return reference to the last element.
+     */
+    constexpr reference back() const noexcept { return data()[size() - 1]; }
+
+    /**
+     * @brief Direct access to the underlying array.
+     *
+     * @return pointer to the first element.
+     */
+    constexpr pointer data() const noexcept { return storage_.data(); }
+
+    /**
+     * @brief Returns an iterator to the first element.
+     *
+     * @return iterator to the first element.
+     */
+    constexpr iterator begin() const noexcept { return data(); }
+
+    /**
+     * @brief Returns an iterator to the element following the last element.
+     *
+     * @return iterator to the element following the last element.
+     */
+    constexpr iterator end() const noexcept { return data() + size(); }
+
+    /**
+     * @brief Returns a reverse iterator to the last element.
+     *
+     * @return reverse iterator to the first element of the reversed span.
+     */
+    constexpr reverse_iterator rbegin() const noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    /**
+     * @brief Returns a reverse iterator to the element preceding the first
+     * element.
+     *
+     * @return reverse iterator to the element following the last element of
+     * the reversed span.
+     */
+    constexpr reverse_iterator rend() const noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+ private:
+    detail::SpanStorage<T, Extent> storage_;
+};
+
+template<class T, std::size_t N> Span(T (&)[N]) -> Span<T, N>;
+
+template<class T, std::size_t N> Span(Array<T, N>&) -> Span<T, N>;
+
+template<class T, std::size_t N> Span(const Array<T, N>&) -> Span<const T, N>;
+
+template<class T, class Allocator> Span(Vector<T, Allocator>&) -> Span<T>;
+
+template<class T, class Allocator>
+Span(const Vector<T, Allocator>&) -> Span<const T>;
+
+template<std::contiguous_iterator It, class EndOrSize>
+Span(It, EndOrSize) -> Span<std::remove_reference_t<std::iter_reference_t<It>>>;
+
+template<std::ranges::contiguous_range R>
+Span(R&&) -> Span<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+/**
+ * @brief Views the object representation of the elements of span.
+ *
+ * @param span span to view.
+ *
+ * @return span of the bytes of the elements.
+ */
+template<class T, std::size_t N>
+auto as_bytes(Span<T, N> span) noexcept
+  -> Span<const Byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+{
+    using Bytes =
+      Span<const Byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>;
+
+    return Bytes(reinterpret_cast<const Byte*>(span.data()), span.size_bytes());
+}
+
+/**
+ * @brief Views the object representation of the elements of span for writing.
+ *
+ * @param span span of mutable elements to view.
+ *
+ * @return span of the bytes of the elements.
+ */
+template<class T, std::size_t N>
+    requires(! std::is_const_v<T>)
+auto as_writable_bytes(Span<T, N> span) noexcept
+  -> Span<Byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>
+{
+    using Bytes =
+      Span<Byte, N == dynamic_extent ? dynamic_extent : N * sizeof(T)>;
+
+    return Bytes(reinterpret_cast<Byte*>(span.data()), span.size_bytes());
+}
+
+}  // namespace ara::core
+
+namespace std::ranges {
+/**
+ * @brief A Span doesn't own its elements, so iterators into it outlive it and
+ * copies are cheap.
+ */
+template<class T, std::size_t Extent>
+inline constexpr bool enable_borrowed_range<ara::core::Span<T, Extent>> = true;
+
+template<class T, std::size_t Extent>
+inline constexpr bool enable_view<ara::core::Span<T, Extent>> = true;
+}  // namespace std::ranges
+
+#endif  // ARA_CORE_SPAN_H_
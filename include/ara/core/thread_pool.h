@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_THREAD_POOL_H_
+#define ARA_CORE_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ara::core {
+/**
+ * @brief Self-contained work-stealing thread pool.
+ *
+ * Every worker owns a task queue. A worker pops tasks from the back of its own
+ * queue and, once it runs dry, steals from the front of the other queues.
+ * Threads that wait for a TaskGroup help executing pending tasks, so nested
+ * parallelism never deadlocks.
+ *
+ * The concurrency of a pool counts the calling thread: a pool with concurrency
+ * of 1 starts no worker threads and runs every task on the thread that waits
+ * for it.
+ */
+class ThreadPool
+{
+ public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Constructs a pool.
+     *
+     * @param concurrency number of threads taking part in the computation,
+     * including the waiting thread. Zero is treated as one.
+     */
+    explicit ThreadPool(std::size_t concurrency = DefaultConcurrency());
+
+    /**
+     * @brief Finishes all pending tasks and joins the worker threads.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief Returns the number of threads taking part in the computation.
+     *
+     * @return number of worker threads plus the waiting thread.
+     */
+    std::size_t concurrency() const noexcept { return queues_.size(); }
+
+    /**
+     * @brief Schedules a task for execution.
+     *
+     * @param task callable to run on one of the pool threads.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Runs one pending task on the calling thread, if there is any.
+     *
+     * @return true if a task was executed, false otherwise.
+     */
+    bool try_run_one();
+
+    /**
+     * @brief Returns the concurrency used by default constructed pools.
+     *
+     * @return number of hardware threads, at least 1.
+     */
+    static std::size_t DefaultConcurrency() noexcept;
+
+ private:
+    struct Queue;
+
+    void worker_loop(std::size_t index);
+    bool try_pop(std::size_t index, Task& task);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread>            threads_;
+    std::atomic<std::size_t>            next_queue_{0};
+    std::atomic<std::size_t>            pending_{0};
+    std::mutex                          sleep_mutex_;
+    std::condition_variable             wake_;
+    bool                                stop_{false};
+};
+
+/**
+ * @brief Returns the process wide pool used when no pool is given explicitly.
+ *
+ * The pool is created on first use with ThreadPool::DefaultConcurrency()
+ * threads.
+ *
+ * @return reference to the default pool.
+ */
+ThreadPool& DefaultThreadPool();
+
+/**
+ * @brief Set of tasks that can be waited for as a whole.
+ *
+ * The first exception thrown by any task of the group is rethrown by wait().
+ */
+class TaskGroup
+{
+ public:
+    /**
+     * @brief Constructs an empty group bound to a pool.
+     *
+     * @param pool pool executing the tasks.
+     */
+    explicit TaskGroup(ThreadPool& pool) noexcept : pool_{pool} {}
+
+    /**
+     * @brief Waits for all outstanding tasks. Exceptions are discarded.
+     */
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    /**
+     * @brief Schedules a task as part of this group.
+     *
+     * @param f callable to run.
+     *
+     * @tparam F callable type.
+     */
+    template<class F> void run(F&& f)
+    {
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        pool_.submit([this, f = std::forward<F>(f)]() mutable {
+            try
+            {
+                f();
+            }
+            catch (...)
+            {
+                set_exception(std::current_exception());
+            }
+            finish_one();
+        });
+    }
+
+    /**
+     * @brief Waits for all tasks of the group, helping with pending work.
+     * Once no work is left to help with, blocks until the tasks running on
+     * other threads finish.
+     *
+     * Rethrows the first exception thrown by a task of the group.
+     */
+    void wait();
+
+ private:
+    void set_exception(std::exception_ptr e) noexcept;
+    void finish_one() noexcept;
+
+    ThreadPool&              pool_;
+    std::atomic<std::size_t> pending_{0};
+    std::mutex               done_mutex_;
+    std::condition_variable  done_;
+    std::mutex               exception_mutex_;
+    std::exception_ptr       exception_;
+};
+
+}  // namespace ara::core
+
+#endif  // ARA_CORE_THREAD_POOL_H_
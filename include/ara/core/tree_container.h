@@ -0,0 +1,608 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_TREE_CONTAINER_H_
+#define ARA_CORE_TREE_CONTAINER_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/utility.h"
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace ara::core {
+/**
+ * An instance of this type can be passed to certain constructors and insert
+ * functions of sorted associative containers with equivalent keys to denote
+ * that the given elements are already sorted by key.
+ */
+struct sorted_equivalent_t
+{
+    explicit sorted_equivalent_t() = default;
+};
+
+/**
+ * Instance of ara::core::sorted_equivalent_t
+ */
+inline constexpr sorted_equivalent_t sorted_equivalent{};
+
+namespace detail {
+/**
+ * @brief Members common to the node based sorted containers Map, MultiMap, Set
+ * and MultiSet, forwarding to the standard tree container Tree.
+ *
+ * The derived containers add their constructors, comparisons and the
+ * functions that differ between unique and equivalent keys. Insertion
+ * functions return what Tree returns: a pair of iterator and bool for unique
+ * keys, an iterator for equivalent keys.
+ *
+ * @tparam Tree std::map, std::multimap, std::set or std::multiset.
+ */
+template<class Tree> class TreeContainer
+{
+ public:
+    using key_type        = typename Tree::key_type;
+    using value_type      = typename Tree::value_type;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using key_compare     = typename Tree::key_compare;
+    using value_compare   = typename Tree::value_compare;
+    using allocator_type  = typename Tree::allocator_type;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename AllocatorTraits<allocator_type>::pointer;
+    using const_pointer =
+      typename AllocatorTraits<allocator_type>::const_pointer;
+    using iterator               = typename Tree::iterator;
+    using const_iterator         = typename Tree::const_iterator;
+    using reverse_iterator       = typename Tree::reverse_iterator;
+    using const_reverse_iterator = typename Tree::const_reverse_iterator;
+    using node_type              = typename Tree::node_type;
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept
+    {
+        return tree_.get_allocator();
+    }
+
+    iterator               begin() noexcept { return tree_.begin(); }
+    const_iterator         begin() const noexcept { return tree_.begin(); }
+    const_iterator         cbegin() const noexcept { return tree_.cbegin(); }
+    iterator               end() noexcept { return tree_.end(); }
+    const_iterator         end() const noexcept { return tree_.end(); }
+    const_iterator         cend() const noexcept { return tree_.cend(); }
+    reverse_iterator       rbegin() noexcept { return tree_.rbegin(); }
+    const_reverse_iterator rbegin() const noexcept { return tree_.rbegin(); }
+    const_reverse_iterator crbegin() const noexcept { return tree_.crbegin(); }
+    reverse_iterator       rend() noexcept { return tree_.rend(); }
+    const_reverse_iterator rend() const noexcept { return tree_.rend(); }
+    const_reverse_iterator crend() const noexcept { return tree_.crend(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    [[nodiscard]] bool empty() const noexcept { return tree_.empty(); }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return tree_.size(); }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept { return tree_.max_size(); }
+
+    /**
+     * @brief Erases all elements from the container.
+     */
+    void clear() noexcept { tree_.clear(); }
+
+    /**
+     * @brief Inserts value.
+     *
+     * @param value element value to insert.
+     *
+     * @return for unique keys, a pair of an iterator to the inserted element
+     * or the element that prevented the insertion and a bool denoting whether
+     * the insertion took place; for equivalent keys, an iterator to the
+     * inserted element.
+     */
+    auto insert(const value_type& value) { return tree_.insert(value); }
+
+    /**
+     * @brief Inserts value, moving from it.
+     *
+     * @param value element value to insert.
+     *
+     * @return as insert(const value_type&).
+     */
+    auto insert(value_type&& value) { return tree_.insert(std::move(value)); }
+
+    /**
+     * @brief Inserts value as close as possible to the position just prior to
+     * hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param value element value to insert.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return tree_.insert(hint, value);
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last).
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        tree_.insert(first, last);
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        tree_.insert(ilist);
+    }
+
+    /**
+     * @brief Inserts the element owned by node, reusing the node. For unique
+     * keys nothing is inserted if an element with an equivalent key exists.
+     *
+     * @param node node handle obtained from extract(), may be empty.
+     *
+     * @return for unique keys an insert_return_type, for equivalent keys an
+     * iterator to the inserted element.
+     */
+    auto insert(node_type&& node) { return tree_.insert(std::move(node)); }
+
+    /**
+     * @brief Inserts the element owned by node as close as possible to the
+     * position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param node node handle obtained from extract(), may be empty.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion, or end() if node was empty.
+     */
+    iterator insert(const_iterator hint, node_type&& node)
+    {
+        return tree_.insert(hint, std::move(node));
+    }
+
+    /**
+     * @brief Inserts an element constructed in-place from args.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return as insert(const value_type&).
+     */
+    template<class... Args> auto emplace(Args&&... args)
+    {
+        return tree_.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts an element constructed in-place from args as close as
+     * possible to the position just prior to hint.
+     *
+     * @param hint iterator to the position before which the new element will
+     * be inserted.
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return iterator to the inserted element, or to the element that
+     * prevented the insertion.
+     */
+    template<class... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        return tree_.emplace_hint(hint, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos) { return tree_.erase(pos); }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return tree_.erase(first, last);
+    }
+
+    /**
+     * @brief Removes all elements with key equivalent to key.
+     *
+     * @param key key value of the elements to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const key_type& key) { return tree_.erase(key); }
+
+    /**
+     * @brief Unlinks the node of the element at pos and returns a node handle
+     * that owns it. Nothing is copied or deallocated.
+     *
+     * @param pos iterator to the element to extract.
+     *
+     * @return node handle that owns the extracted element.
+     */
+    node_type extract(const_iterator pos) { return tree_.extract(pos); }
+
+    /**
+     * @brief Unlinks the node of the first element with key equivalent to
+     * key, if any, and returns a node handle that owns it.
+     *
+     * @param key key value of the element to extract.
+     *
+     * @return node handle that owns the extracted element, or an empty node
+     * handle if there is no such element.
+     */
+    node_type extract(const key_type& key) { return tree_.extract(key); }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    size_type count(const key_type& key) const { return tree_.count(key); }
+
+    /**
+     * @brief Returns the number of elements with key that compares equivalent
+     * to key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key that compares equivalent to key.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    size_type count(const Key& key) const
+    {
+        return tree_.count(key);
+    }
+
+    /**
+     * @brief Checks if there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    bool contains(const key_type& key) const { return tree_.contains(key); }
+
+    /**
+     * @brief Checks if there is an element with key that compares equivalent
+     * to key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, otherwise false.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    bool contains(const Key& key) const
+    {
+        return tree_.contains(key);
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end().
+     */
+    iterator find(const key_type& key) { return tree_.find(key); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end().
+     */
+    const_iterator find(const key_type& key) const { return tree_.find(key); }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end().
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    iterator find(const Key& key)
+    {
+        return tree_.find(key);
+    }
+
+    /**
+     * @brief Finds an element with key that compares equivalent to key,
+     * without constructing a key_type. Requires a transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end().
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    const_iterator find(const Key& key) const
+    {
+        return tree_.find(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key equivalent to
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+        return tree_.equal_range(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key equivalent to
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator>
+    equal_range(const key_type& key) const
+    {
+        return tree_.equal_range(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key, without constructing a key_type. Requires a
+     * transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return tree_.equal_range(key);
+    }
+
+    /**
+     * @brief Returns a range containing all elements with key that compares
+     * equivalent to key, without constructing a key_type. Requires a
+     * transparent key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    std::pair<const_iterator, const_iterator>
+    equal_range(const Key& key) const
+    {
+        return tree_.equal_range(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is not less than
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key.
+     */
+    iterator lower_bound(const key_type& key) { return tree_.lower_bound(key); }
+
+    /**
+     * @brief Returns an iterator to the first element that is not less than
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is not less than key.
+     */
+    const_iterator lower_bound(const key_type& key) const
+    {
+        return tree_.lower_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is not less than
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    iterator lower_bound(const Key& key)
+    {
+        return tree_.lower_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is not less than
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is not less than key.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    const_iterator lower_bound(const Key& key) const
+    {
+        return tree_.lower_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is greater than
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key.
+     */
+    iterator upper_bound(const key_type& key) { return tree_.upper_bound(key); }
+
+    /**
+     * @brief Returns an iterator to the first element that is greater than
+     * key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return iterator to the first element that is greater than key.
+     */
+    const_iterator upper_bound(const key_type& key) const
+    {
+        return tree_.upper_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is greater than
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    iterator upper_bound(const Key& key)
+    {
+        return tree_.upper_bound(key);
+    }
+
+    /**
+     * @brief Returns an iterator to the first element that is greater than
+     * key, without constructing a key_type. Requires a transparent
+     * key_compare.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to the first element that is greater than key.
+     */
+    template<class Key>
+        requires TransparentFunction<key_compare>
+    const_iterator upper_bound(const Key& key) const
+    {
+        return tree_.upper_bound(key);
+    }
+
+    /**
+     * @brief Returns the function object that compares the keys.
+     *
+     * @return the key comparison function object.
+     */
+    key_compare key_comp() const { return tree_.key_comp(); }
+
+    /**
+     * @brief Returns the function object that compares elements by their
+     * keys.
+     *
+     * @return the value comparison function object.
+     */
+    value_compare value_comp() const { return tree_.value_comp(); }
+
+ protected:
+    TreeContainer() = default;
+
+    explicit TreeContainer(Tree tree) : tree_(std::move(tree)) {}
+
+    /**
+     * @brief Inserts the elements of the sorted range [first, last), each one
+     * right behind the previous, in amortized constant time per element.
+     * Appending to an empty container is therefore linear overall.
+     */
+    template<class InputIt> void append_sorted(InputIt first, InputIt last)
+    {
+        if (first == last)
+        { return; }
+
+        auto hint = tree_.upper_bound(KeyOf(*first));
+        for (; first != last; ++first)
+        {
+            auto const inserted = tree_.emplace_hint(hint, *first);
+            // hint stays the successor if the key went right before it, which
+            // saves the walk from the new leaf up the tree.
+            if (hint != tree_.end()
+                && ! tree_.key_comp()(KeyOf(*inserted), KeyOf(*hint)))
+            { hint = std::next(inserted); }
+        }
+    }
+
+    Tree tree_;
+
+ private:
+    template<class Value> static const auto& KeyOf(const Value& value)
+    {
+        if constexpr (std::is_same_v<key_type, value_type>)
+        { return value; }
+        else
+        { return value.first; }
+    }
+};
+}  // namespace detail
+}  // namespace ara::core
+
+#endif  // ARA_CORE_TREE_CONTAINER_H_
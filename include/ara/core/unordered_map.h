@@ -0,0 +1,1402 @@
+/**
+ * Copyright (c) 2020
+ * umlaut Software Development and contributors
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef ARA_CORE_UNORDERED_MAP_H_
+#define ARA_CORE_UNORDERED_MAP_H_
+
+#include "ara/core/allocator.h"
+#include "ara/core/functional.h"
+#include "ara/core/map_slot.h"
+#include "ara/core/memory_footprint.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace ara::core {
+namespace detail {
+/**
+ * @brief Control byte describing one slot of a Swiss table: either kEmpty,
+ * kDeleted, or the 7 low bits of the hash of a full slot.
+ */
+using Ctrl = signed char;
+
+constexpr Ctrl kCtrlEmpty   = -128;
+constexpr Ctrl kCtrlDeleted = -2;
+
+constexpr bool IsFull(Ctrl ctrl) noexcept { return ctrl >= 0; }
+
+/**
+ * @brief Bit i of a match result is set if control byte i of the group
+ * matched.
+ */
+using GroupMask = std::uint32_t;
+
+/**
+ * @brief Sixteen consecutive control bytes, compared in parallel.
+ */
+class Group
+{
+ public:
+    static constexpr std::size_t kWidth = 16;
+
+#if defined(__SSE2__)
+    explicit Group(const Ctrl* pos) noexcept
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))
+    {}
+
+    GroupMask match(Ctrl h2) const noexcept
+    {
+        return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+    }
+
+    GroupMask match_empty() const noexcept { return match(kCtrlEmpty); }
+
+    GroupMask match_empty_or_deleted() const noexcept
+    {
+        // kEmpty and kDeleted are the only values below -1.
+        return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_));
+    }
+
+    GroupMask match_full() const noexcept
+    {
+        return to_mask(ctrl_) ^ GroupMask{0xFFFF};
+    }
+
+ private:
+    static GroupMask to_mask(__m128i bytes) noexcept
+    {
+        return static_cast<GroupMask>(_mm_movemask_epi8(bytes));
+    }
+
+    __m128i ctrl_;
+#else
+    explicit Group(const Ctrl* pos) noexcept
+    {
+        std::memcpy(ctrl_, pos, kWidth);
+    }
+
+    GroupMask match(Ctrl h2) const noexcept
+    {
+        return match_if([h2](Ctrl ctrl) { return ctrl == h2; });
+    }
+
+    GroupMask match_empty() const noexcept { return match(kCtrlEmpty); }
+
+    GroupMask match_empty_or_deleted() const noexcept
+    {
+        return match_if([](Ctrl ctrl) { return ctrl < -1; });
+    }
+
+    GroupMask match_full() const noexcept { return match_if(IsFull); }
+
+ private:
+    template<class Predicate>
+    GroupMask match_if(Predicate predicate) const noexcept
+    {
+        GroupMask mask = 0;
+        for (std::size_t i = 0; i < kWidth; ++i)
+        {
+            if (predicate(ctrl_[i]))
+            { mask |= GroupMask{1} << i; }
+        }
+
+        return mask;
+    }
+
+    Ctrl ctrl_[kWidth];
+#endif
+};
+
+/**
+ * @brief Index of the lowest set bit of a non-zero match result.
+ */
+inline std::size_t LowestMatch(GroupMask mask) noexcept
+{
+    return static_cast<std::size_t>(std::countr_zero(mask));
+}
+
+/**
+ * @brief Triangular probing over the groups of a table whose capacity is a
+ * power of two, visits every group exactly once.
+ */
+class ProbeSequence
+{
+ public:
+    ProbeSequence(std::size_t hash, std::size_t mask) noexcept
+      : mask_(mask), offset_(hash & mask)
+    {}
+
+    std::size_t offset() const noexcept { return offset_; }
+
+    std::size_t offset(std::size_t i) const noexcept
+    {
+        return (offset_ + i) & mask_;
+    }
+
+    void next() noexcept
+    {
+        index_ += Group::kWidth;
+        offset_ = (offset_ + index_) & mask_;
+    }
+
+ private:
+    std::size_t mask_;
+    std::size_t offset_;
+    std::size_t index_{0};
+};
+
+/**
+ * @brief Spreads the entropy of a hash over all bits. std::hash of integers
+ * is the identity, which would put consecutive keys into the same group and
+ * give them the same 7 bit tag.
+ */
+inline std::size_t MixHash(std::size_t hash) noexcept
+{
+    constexpr std::size_t kMultiplier =
+      static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+    constexpr int kHalf = std::numeric_limits<std::size_t>::digits / 2;
+
+    hash ^= hash >> kHalf;
+    hash *= kMultiplier;
+
+    return hash ^ (hash >> (kHalf - 3));
+}
+}  // namespace detail
+
+/**
+ * @brief Unordered associative container that contains key-value pairs with
+ * unique keys.
+ *
+ * Elements are stored in place in a single open addressing table (Swiss
+ * table). Every slot has a one byte control word holding 7 bits of the key's
+ * hash; lookups compare 16 control words at once and only touch slots whose
+ * tag matches. The table grows at a load factor of 7/8.
+ *
+ * Rehashing invalidates all iterators, references and pointers. Erasure
+ * invalidates iterators and references to the erased element only.
+ *
+ * If both Hash and Eq define is_transparent, the lookup functions accept any
+ * type the functors accept, e.g. a StringView for String keys, without
+ * constructing a key.
+ *
+ * @tparam K key type.
+ * @tparam V value type.
+ * @tparam Hash hash function.
+ * @tparam Eq key equality function.
+ * @tparam Allocator allocator type.
+ */
+template<typename K,
+         typename V,
+         typename Hash      = std::hash<K>,
+         typename Eq        = std::equal_to<K>,
+         typename Allocator = Allocator<std::pair<const K, V>>>
+class UnorderedMap
+{
+    template<bool Const> class Iterator;
+
+ public:
+    using key_type        = K;
+    using mapped_type     = V;
+    using value_type      = std::pair<const K, V>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = Eq;
+    using allocator_type  = Allocator;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename AllocatorTraits<Allocator>::pointer;
+    using const_pointer   = typename AllocatorTraits<Allocator>::const_pointer;
+    using iterator        = Iterator<false>;
+    using const_iterator  = Iterator<true>;
+
+    /**
+     * @brief Constructs an empty container without allocating.
+     */
+    UnorderedMap() = default;
+
+    /**
+     * @brief Constructs an empty container with room for at least
+     * bucket_count elements.
+     *
+     * @param bucket_count minimal number of elements to reserve room for.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit UnorderedMap(size_type        bucket_count,
+                          const Hash&      hash  = Hash(),
+                          const Eq&        equal = Eq(),
+                          const Allocator& alloc = Allocator())
+      : hash_(hash), equal_(equal), alloc_(alloc)
+    {
+        reserve(bucket_count);
+    }
+
+    /**
+     * @brief Constructs an empty container.
+     *
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    explicit UnorderedMap(const Allocator& alloc) : alloc_(alloc) {}
+
+    /**
+     * @brief Constructs the container with the contents of the range
+     * [first, last).
+     *
+     * @param first start of the range to copy the elements from.
+     * @param last end of the range to copy the elements from.
+     * @param bucket_count minimal number of elements to reserve room for.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    template<std::input_iterator InputIt>
+    UnorderedMap(InputIt          first,
+                 InputIt          last,
+                 size_type        bucket_count = 0,
+                 const Hash&      hash         = Hash(),
+                 const Eq&        equal        = Eq(),
+                 const Allocator& alloc        = Allocator())
+      : UnorderedMap(bucket_count, hash, equal, alloc)
+    {
+        insert(first, last);
+    }
+
+    /**
+     * @brief Constructs the container with the contents of the initializer list
+     * init.
+     *
+     * @param init initializer list to initialize the elements of the container
+     * with.
+     * @param bucket_count minimal number of elements to reserve room for.
+     * @param hash hash function to use.
+     * @param equal key equality function to use.
+     * @param alloc allocator to use for all memory allocations of this
+     * container.
+     */
+    UnorderedMap(std::initializer_list<value_type> init,
+                 size_type                         bucket_count = 0,
+                 const Hash&                       hash         = Hash(),
+                 const Eq&                         equal        = Eq(),
+                 const Allocator&                  alloc        = Allocator())
+      : UnorderedMap(init.begin(), init.end(), bucket_count, hash, equal, alloc)
+    {}
+
+    /**
+     * @brief Copy constructor. Constructs the container with the copy of the
+     * contents of other.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    UnorderedMap(const UnorderedMap& other)
+      : UnorderedMap(other.size(),
+                     other.hash_,
+                     other.equal_,
+                     AllocatorTraits<Allocator>::
+                       select_on_container_copy_construction(other.alloc_))
+    {
+        for (const auto& value : other) { emplace_unique(value); }
+    }
+
+    /**
+     * @brief Move constructor. Constructs the container with the contents of
+     * other using move semantics, other is left empty.
+     *
+     * @param other another container to be used as source to initialize the
+     * elements of the container with.
+     */
+    UnorderedMap(UnorderedMap&& other) noexcept
+      : ctrl_(std::exchange(other.ctrl_, nullptr)),
+        slots_(std::exchange(other.slots_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        growth_left_(std::exchange(other.growth_left_, 0)),
+        hash_(other.hash_),
+        equal_(other.equal_),
+        alloc_(std::move(other.alloc_))
+    {}
+
+    ~UnorderedMap() { release(); }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to UnorderedMap instance.
+     */
+    UnorderedMap& operator=(const UnorderedMap& other)
+    {
+        if (this != &other)
+        {
+            UnorderedMap copy{other};
+            swap(copy);
+        }
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container using move semantics.
+     *
+     * @param other another container to use as data source.
+     *
+     * @return reference to UnorderedMap instance.
+     */
+    UnorderedMap& operator=(UnorderedMap&& other) noexcept
+    {
+        UnorderedMap moved{std::move(other)};
+        swap(moved);
+
+        return *this;
+    }
+
+    /**
+     * @brief Replaces the contents of the container.
+     *
+     * @param ilist initializer list to use as data source.
+     *
+     * @return reference to UnorderedMap instance.
+     */
+    UnorderedMap& operator=(std::initializer_list<value_type> ilist)
+    {
+        clear();
+        insert(ilist);
+
+        return *this;
+    }
+
+    /**
+     * @brief Compares the contents of two maps.
+     *
+     * @param lhs first map.
+     * @param rhs second map.
+     *
+     * @return true if both maps contain the same key-value pairs.
+     */
+    friend bool operator==(const UnorderedMap& lhs, const UnorderedMap& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        { return false; }
+
+        for (const auto& value : lhs)
+        {
+            auto const it = rhs.find(value.first);
+            if (it == rhs.end() || ! (it->second == value.second))
+            { return false; }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Returns the allocator associated with the container.
+     *
+     * @return the associated allocator.
+     */
+    allocator_type get_allocator() const noexcept { return alloc_; }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    iterator begin() noexcept { return {ctrl_, slots_, ctrl_ + capacity_}; }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator begin() const noexcept
+    {
+        return {ctrl_, slots_, ctrl_ + capacity_};
+    }
+
+    /**
+     * @brief Returns an iterator to the beginning.
+     *
+     * @return iterator to the first element.
+     */
+    const_iterator cbegin() const noexcept { return begin(); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    iterator end() noexcept { return iterator_at(capacity_); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator end() const noexcept { return iterator_at(capacity_); }
+
+    /**
+     * @brief Returns an iterator to the end.
+     *
+     * @return iterator past the last element.
+     */
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * @brief Checks whether the container is empty.
+     *
+     * @return true if the container is empty, false otherwise.
+     */
+    bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Returns the number of elements.
+     *
+     * @return the number of elements in the container.
+     */
+    size_type size() const noexcept { return size_; }
+
+    /**
+     * @brief Returns the maximum possible number of elements.
+     *
+     * @return maximum number of elements.
+     */
+    size_type max_size() const noexcept
+    {
+        return std::bit_floor(
+                 AllocatorTraits<Allocator>::max_size(alloc_) / 2)
+               / 8 * 7;
+    }
+
+    /**
+     * @brief Erases all elements from the container. The capacity is kept.
+     */
+    void clear() noexcept
+    {
+        if (capacity_ == 0)
+        { return; }
+
+        for (size_type i = 0; i < capacity_; ++i)
+        {
+            if (detail::IsFull(ctrl_[i]))
+            { Slot::destroy(alloc_, slots_ + i); }
+        }
+        reset_ctrl();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return emplace_unique(value);
+    }
+
+    /**
+     * @brief Inserts value if the container doesn't already contain an element
+     * with an equivalent key.
+     *
+     * @param value element value to insert.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /**
+     * @brief Inserts elements from range [first, last).
+     *
+     * @param first start of the range of elements to insert.
+     * @param last end of the range of elements to insert.
+     */
+    template<std::input_iterator InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        if constexpr (std::forward_iterator<InputIt>)
+        {
+            reserve(size_
+                    + static_cast<size_type>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) { emplace(*first); }
+    }
+
+    /**
+     * @brief Inserts elements from initializer list ilist.
+     *
+     * @param ilist initializer list to insert the values from.
+     */
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    /**
+     * @brief Inserts a new element into the container constructed in-place
+     * with the given args if there is no element with the key in the
+     * container.
+     *
+     * @param args arguments to forward to the constructor of the element.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args> std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        std::pair<K, V> value(std::forward<Args>(args)...);
+
+        return try_emplace(std::move(value.first), std::move(value.second));
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. args
+     * are not moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts a new element with key key and a mapped value constructed
+     * from args, if there is no element with the key in the container. Neither
+     * key nor args are moved from if the key exists.
+     *
+     * @param key the key of the element.
+     * @param args arguments to forward to the constructor of the mapped value.
+     *
+     * @return pair of an iterator to the inserted element, or to the element
+     * that prevented the insertion, and a bool denoting whether the insertion
+     * took place.
+     */
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts a new element, or assigns to the mapped value of the
+     * existing element with key key.
+     *
+     * @param key the key of the element.
+     * @param obj value to insert or assign.
+     *
+     * @return pair of an iterator to the element and a bool denoting whether
+     * an insertion took place.
+     */
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& obj)
+    {
+        auto result = try_emplace(key, std::forward<M>(obj));
+        if (! result.second)
+        { result.first->second = std::forward<M>(obj); }
+
+        return result;
+    }
+
+    /**
+     * @brief Returns a reference to the mapped value of the element with key
+     * equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    mapped_type& at(const K& key)
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("UnorderedMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a const reference to the mapped value of the element with
+     * key equivalent to key.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the requested element.
+     *
+     * @throws std::out_of_range if the container has no such element.
+     */
+    const mapped_type& at(const K& key) const
+    {
+        auto const it = find(key);
+        if (it == end())
+        { throw std::out_of_range("UnorderedMap::at"); }
+
+        return it->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /**
+     * @brief Returns a reference to the value, inserting a value initialized
+     * element if no element with key key exists.
+     *
+     * @param key the key of the element to find.
+     *
+     * @return reference to the mapped value of the element with key key.
+     */
+    mapped_type& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /**
+     * @brief Removes the element at pos.
+     *
+     * @param pos iterator to the element to remove.
+     *
+     * @return iterator following the removed element.
+     */
+    iterator erase(const_iterator pos)
+    {
+        auto const index = static_cast<size_type>(pos.slot_ - slots_);
+        erase_at(index);
+
+        return iterator_at(index);
+    }
+
+    /**
+     * @brief Removes the elements in the range [first, last).
+     *
+     * @param first start of the range of elements to remove.
+     * @param last end of the range of elements to remove.
+     *
+     * @return iterator following the last removed element.
+     */
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        while (first != last) { first = erase(first); }
+
+        return iterator_at(static_cast<size_type>(last.slot_ - slots_));
+    }
+
+    /**
+     * @brief Removes the element with the key equivalent to key, if any.
+     *
+     * @param key key value of the element to remove.
+     *
+     * @return number of elements removed.
+     */
+    size_type erase(const K& key)
+    {
+        size_type const index = find_index(key);
+        if (index == capacity_)
+        { return 0; }
+
+        erase_at(index);
+
+        return 1;
+    }
+
+    /**
+     * @brief Exchanges the contents of the container with those of other.
+     *
+     * @param other container to exchange the contents with.
+     */
+    void swap(UnorderedMap& other) noexcept
+    {
+        using std::swap;
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+        swap(capacity_, other.capacity_);
+        swap(size_, other.size_);
+        swap(growth_left_, other.growth_left_);
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+        if constexpr (AllocatorTraits<
+                        Allocator>::propagate_on_container_swap::value)
+        { swap(alloc_, other.alloc_); }
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    iterator find(const K& key) { return iterator_at(find_index(key)); }
+
+    /**
+     * @brief Finds an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    const_iterator find(const K& key) const
+    {
+        return iterator_at(find_index(key));
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key, without
+     * constructing a key_type. Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    iterator find(const Key& key)
+    {
+        return iterator_at(find_index(key));
+    }
+
+    /**
+     * @brief Finds an element with key equivalent to key, without
+     * constructing a key_type. Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return iterator to an element with key equivalent to key, or end() if
+     * no such element is found.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    const_iterator find(const Key& key) const
+    {
+        return iterator_at(find_index(key));
+    }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0.
+     *
+     * @param key key value of the elements to count.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    /**
+     * @brief Returns the number of elements with key equivalent to key,
+     * which is either 1 or 0. Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return number of elements with key equivalent to key.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    size_type count(const Key& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /**
+     * @brief Checks whether there is an element with key equivalent to key.
+     *
+     * @param key key value of the element to search for.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    bool contains(const K& key) const { return find_index(key) != capacity_; }
+
+    /**
+     * @brief Checks whether there is an element with key equivalent to key.
+     * Requires transparent Hash and Eq.
+     *
+     * @param key value comparable to the keys of the elements.
+     *
+     * @return true if there is such an element, false otherwise.
+     */
+    template<class Key>
+        requires detail::TransparentFunction<Hash>
+                 && detail::TransparentFunction<Eq>
+    bool contains(const Key& key) const
+    {
+        return find_index(key) != capacity_;
+    }
+
+    /**
+     * @brief Returns a range containing the element with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        auto const first = find(key);
+
+        return {first, first == end() ? first : std::next(first)};
+    }
+
+    /**
+     * @brief Returns a range containing the element with the given key.
+     *
+     * @param key key value to compare the elements to.
+     *
+     * @return pair of iterators defining the wanted range.
+     */
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        auto const first = find(key);
+
+        return {first, first == end() ? first : std::next(first)};
+    }
+
+    /**
+     * @brief Returns the number of slots in the table.
+     *
+     * @return the capacity of the table, zero or a power of two.
+     */
+    size_type bucket_count() const noexcept { return capacity_; }
+
+    /**
+     * @brief Returns the average number of elements per slot.
+     *
+     * @return size() / bucket_count(), or 0 for an empty table.
+     */
+    float load_factor() const noexcept
+    {
+        return capacity_ == 0 ? 0.0f
+                              : static_cast<float>(size_)
+                                  / static_cast<float>(capacity_);
+    }
+
+    /**
+     * @brief Returns the load factor at which the table grows, which is fixed
+     * at 7/8.
+     *
+     * @return the maximum load factor.
+     */
+    float max_load_factor() const noexcept { return 0.875f; }
+
+    /**
+     * @brief Reserves room for at least count elements, so that inserting up
+     * to count elements does not rehash.
+     *
+     * @param count number of elements to reserve room for.
+     */
+    void reserve(size_type count)
+    {
+        if (count > growth_left_ + size_)
+        { resize(CapacityFor(count)); }
+    }
+
+    /**
+     * @brief Rebuilds the table with room for at least count elements, and at
+     * least size(). rehash(0) shrinks the table to fit and drops all erased
+     * slots.
+     *
+     * @param count number of elements to make room for.
+     */
+    void rehash(size_type count)
+    {
+        size_type const capacity = CapacityFor(std::max(count, size_));
+        if (capacity == 0)
+        {
+            release();
+            return;
+        }
+
+        resize(capacity);
+    }
+
+    /**
+     * @brief Returns the function that hashes the keys.
+     *
+     * @return the hash function object.
+     */
+    hasher hash_function() const { return hash_; }
+
+    /**
+     * @brief Returns the function that compares keys for equality.
+     *
+     * @return the key equality function object.
+     */
+    key_equal key_eq() const { return equal_; }
+
+ private:
+    using Ctrl          = detail::Ctrl;
+    using Group         = detail::Group;
+    using Slot          = detail::MapSlot<K, V>;
+    using SlotAllocator = typename AllocatorTraits<
+      Allocator>::template rebind_alloc<Slot>;
+    using SlotTraits = AllocatorTraits<SlotAllocator>;
+
+    /**
+     * @brief Iterator over the full slots of the table.
+     */
+    template<bool Const> class Iterator
+    {
+        using Slot = std::conditional_t<Const,
+                                        const typename UnorderedMap::Slot,
+                                        typename UnorderedMap::Slot>;
+
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename UnorderedMap::value_type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer =
+          std::conditional_t<Const, const value_type*, value_type*>;
+        using reference =
+          std::conditional_t<Const, const value_type&, value_type&>;
+
+        Iterator() = default;
+
+        /**
+         * @brief Converts an iterator to a const_iterator.
+         */
+        template<bool OtherConst>
+            requires(Const && ! OtherConst)
+        Iterator(const Iterator<OtherConst>& other) noexcept
+          : ctrl_(other.ctrl_), slot_(other.slot_), end_(other.end_)
+        {}
+
+        reference operator*() const noexcept { return slot_->value; }
+
+        pointer operator->() const noexcept { return &slot_->value; }
+
+        Iterator& operator++() noexcept
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_free();
+
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator copy{*this};
+            ++*this;
+
+            return copy;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs)
+        {
+            return lhs.slot_ == rhs.slot_;
+        }
+
+     private:
+        friend class UnorderedMap;
+
+        Iterator(const Ctrl* ctrl, Slot* slot, const Ctrl* end) noexcept
+          : ctrl_(ctrl), slot_(slot), end_(end)
+        {
+            skip_free();
+        }
+
+        void skip_free() noexcept
+        {
+            // Skips a whole group of free slots at a time. The mirrored
+            // control bytes behind the table keep the load in bounds.
+            while (ctrl_ != end_ && ! detail::IsFull(*ctrl_))
+            {
+                auto const skip = std::min<std::ptrdiff_t>(
+                  std::countr_zero(Group{ctrl_}.match_full()
+                                   | (detail::GroupMask{1} << Group::kWidth)),
+                  end_ - ctrl_);
+                ctrl_ += skip;
+                slot_ += skip;
+            }
+        }
+
+        const Ctrl* ctrl_{nullptr};
+        Slot*       slot_{nullptr};
+        const Ctrl* end_{nullptr};
+    };
+
+    /**
+     * @brief Smallest table capacity that holds count elements below the
+     * maximum load factor.
+     */
+    static size_type CapacityFor(size_type count) noexcept
+    {
+        if (count == 0)
+        { return 0; }
+
+        size_type const capacity = std::bit_ceil(count + (count + 6) / 7);
+
+        return std::max(capacity, Group::kWidth);
+    }
+
+    /** true if rebuilding the table cannot throw, so it may move elements */
+    static constexpr bool kNothrowRehash =
+      Slot::kNothrowMove && std::is_nothrow_invocable_v<const Hash&, const K&>;
+
+    static size_type GrowthFor(size_type capacity) noexcept
+    {
+        return capacity - capacity / 8;
+    }
+
+    /**
+     * @brief Number of slots allocated for a table: the element slots followed
+     * by the control bytes, which are padded to whole slots.
+     */
+    static size_type AllocatedSlots(size_type capacity) noexcept
+    {
+        return capacity
+               + (capacity + Group::kWidth + sizeof(Slot) - 1) / sizeof(Slot);
+    }
+
+    template<class Key> size_type hash_of(const Key& key) const
+    {
+        return detail::MixHash(hash_(key));
+    }
+
+    static Ctrl H2(size_type hash) noexcept
+    {
+        return static_cast<Ctrl>(hash & 0x7F);
+    }
+
+    iterator iterator_at(size_type index) noexcept
+    {
+        return {ctrl_ + index, slots_ + index, ctrl_ + capacity_};
+    }
+
+    const_iterator iterator_at(size_type index) const noexcept
+    {
+        return {ctrl_ + index, slots_ + index, ctrl_ + capacity_};
+    }
+
+    /**
+     * @brief Sets a control byte; the first group is mirrored behind the
+     * table so that groups starting near the end can be loaded in one go.
+     */
+    void set_ctrl(size_type index, Ctrl ctrl) noexcept
+    {
+        ctrl_[index] = ctrl;
+        if (index < Group::kWidth)
+        { ctrl_[capacity_ + index] = ctrl; }
+    }
+
+    void reset_ctrl() noexcept
+    {
+        std::memset(ctrl_, detail::kCtrlEmpty, capacity_ + Group::kWidth);
+        growth_left_ = GrowthFor(capacity_);
+    }
+
+    /**
+     * @brief Returns the slot index of the element with key key, or capacity_
+     * if there is none.
+     */
+    template<class Key> size_type find_index(const Key& key) const
+    {
+        if (capacity_ == 0)
+        { return capacity_; }
+
+        size_type const hash = hash_of(key);
+        return find_index(key, hash);
+    }
+
+    template<class Key>
+    size_type find_index(const Key& key, size_type hash) const
+    {
+        Ctrl const            h2 = H2(hash);
+        detail::ProbeSequence probe{hash >> 7, capacity_ - 1};
+        while (true)
+        {
+            Group const group{ctrl_ + probe.offset()};
+            for (auto match = group.match(h2); match != 0; match &= match - 1)
+            {
+                size_type const index =
+                  probe.offset(detail::LowestMatch(match));
+                if (equal_(slots_[index].value.first, key))
+                { return index; }
+            }
+
+            if (group.match_empty() != 0)
+            { return capacity_; }
+
+            probe.next();
+        }
+    }
+
+    /**
+     * @brief Returns the first empty or deleted slot on the probe sequence of
+     * hash.
+     */
+    size_type find_free(size_type hash) const noexcept
+    {
+        detail::ProbeSequence probe{hash >> 7, capacity_ - 1};
+        while (true)
+        {
+            auto const free = Group{ctrl_ + probe.offset()}
+                                .match_empty_or_deleted();
+            if (free != 0)
+            { return probe.offset(detail::LowestMatch(free)); }
+
+            probe.next();
+        }
+    }
+
+    template<class Key, class... Args>
+    std::pair<iterator, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        size_type const hash = hash_of(key);
+        if (capacity_ != 0)
+        {
+            size_type const index = find_index(key, hash);
+            if (index != capacity_)
+            { return {iterator_at(index), false}; }
+        }
+
+        size_type const index = prepare_insert(hash);
+        Slot::construct(
+          alloc_,
+          slots_ + index,
+          std::piecewise_construct,
+          std::forward_as_tuple(std::forward<Key>(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+        commit_insert(index, hash);
+
+        return {iterator_at(index), true};
+    }
+
+    std::pair<iterator, bool> emplace_unique(const value_type& value)
+    {
+        return try_emplace_key(value.first, value.second);
+    }
+
+    /**
+     * @brief Returns a free slot for an element with hash hash, growing or
+     * cleaning up the table if it has no room left.
+     */
+    size_type prepare_insert(size_type hash)
+    {
+        if (capacity_ != 0)
+        {
+            size_type const index = find_free(hash);
+            if (growth_left_ > 0 || ctrl_[index] == detail::kCtrlDeleted)
+            { return index; }
+        }
+
+        if (capacity_ != 0 && size_ * 32 <= capacity_ * 25)
+        {
+            // Mostly erased slots: rebuild in place instead of growing.
+            resize(capacity_);
+        }
+        else
+        {
+            resize(std::max(capacity_ * 2, Group::kWidth));
+        }
+
+        return find_free(hash);
+    }
+
+    void commit_insert(size_type index, size_type hash) noexcept
+    {
+        if (ctrl_[index] == detail::kCtrlEmpty)
+        { --growth_left_; }
+        set_ctrl(index, H2(hash));
+        ++size_;
+    }
+
+    /**
+     * @brief Destroys the element at index. The slot becomes empty again if no
+     * probe window can have seen it full without also seeing an empty slot,
+     * otherwise it becomes a tombstone. This keeps tombstones rare under
+     * churn.
+     */
+    void erase_at(size_type index) noexcept
+    {
+        Slot::destroy(alloc_, slots_ + index);
+        --size_;
+
+        size_type const before = (index - Group::kWidth) & (capacity_ - 1);
+        auto const emptyAfter  = Group{ctrl_ + index}.match_empty();
+        auto const emptyBefore = Group{ctrl_ + before}.match_empty();
+        bool const wasNeverFull =
+          emptyBefore != 0 && emptyAfter != 0
+          && static_cast<size_type>(
+               std::countr_zero(emptyAfter)
+               + std::countl_zero(static_cast<std::uint16_t>(emptyBefore)))
+               < Group::kWidth;
+
+        set_ctrl(index,
+                 wasNeverFull ? detail::kCtrlEmpty : detail::kCtrlDeleted);
+        if (wasNeverFull)
+        { ++growth_left_; }
+    }
+
+    /**
+     * @brief Moves all elements into a new table of the given capacity. The
+     * elements are moved if neither hashing nor moving can throw, otherwise
+     * they are copied, so that a throw leaves the container unchanged.
+     */
+    void resize(size_type capacity)
+    {
+        UnorderedMap grown(0, hash_, equal_, alloc_);
+        grown.allocate(capacity);
+
+        for (size_type i = 0; i < capacity_; ++i)
+        {
+            if (! detail::IsFull(ctrl_[i]))
+            { continue; }
+
+            Slot* const     old   = slots_ + i;
+            size_type const hash  = hash_of(old->value.first);
+            size_type const index = grown.find_free(hash);
+            if constexpr (kNothrowRehash)
+            { Slot::relocate(alloc_, grown.slots_ + index, old); }
+            else
+            { Slot::construct(alloc_, grown.slots_ + index, old->value); }
+            grown.commit_insert(index, hash);
+        }
+
+        if constexpr (! kNothrowRehash)
+        { clear(); }
+        else if (capacity_ != 0)
+        {
+            // The elements are relocated already.
+            reset_ctrl();
+            size_ = 0;
+        }
+        swap_table(grown);
+    }
+
+    /**
+     * @brief Allocates an empty table of the given capacity for an empty
+     * container without one.
+     */
+    void allocate(size_type capacity)
+    {
+        slots_    = SlotTraits::allocate(alloc_, AllocatedSlots(capacity));
+        ctrl_     = reinterpret_cast<Ctrl*>(slots_ + capacity);
+        capacity_ = capacity;
+        reset_ctrl();
+    }
+
+    void swap_table(UnorderedMap& other) noexcept
+    {
+        std::swap(ctrl_, other.ctrl_);
+        std::swap(slots_, other.slots_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+        std::swap(growth_left_, other.growth_left_);
+    }
+
+    void release() noexcept
+    {
+        if (slots_ == nullptr)
+        { return; }
+
+        clear();
+        SlotTraits::deallocate(alloc_, slots_, AllocatedSlots(capacity_));
+        ctrl_        = nullptr;
+        slots_       = nullptr;
+        capacity_    = 0;
+        growth_left_ = 0;
+    }
+
+    Ctrl*                               ctrl_{nullptr};
+    Slot*                               slots_{nullptr};
+    size_type                           capacity_{0};
+    size_type                           size_{0};
+    size_type                           growth_left_{0};
+    [[no_unique_address]] Hash          hash_;
+    [[no_unique_address]] Eq            equal_;
+    [[no_unique_address]] SlotAllocator alloc_;
+};
+
+/**
+ * @brief Exchanges the contents of two maps.
+ *
+ * @param lhs first map.
+ * @param rhs second map.
+ */
+template<class K, class V, class Hash, class Eq, class Allocator> void
+swap(UnorderedMap<K, V, Hash, Eq, Allocator>& lhs,
+     UnorderedMap<K, V, Hash, Eq, Allocator>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+/**
+ * @brief UnorderedMap owns one allocation holding the slots and the control
+ * bytes.
+ */
+template<class K, class V, class Hash, class Eq, class Allocator>
+struct MemoryFootprintTraits<UnorderedMap<K, V, Hash, Eq, Allocator>>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint
+    heap(const UnorderedMap<K, V, Hash, Eq, Allocator>& value)
+    {
+        using Value = std::pair<const K, V>;
+
+        std::size_t const buckets = value.bucket_count();
+        std::size_t const ctrl = buckets == 0 ? 0 : buckets + 16;
+
+        return MemoryFootprint{value.size() * sizeof(Value) + ctrl,
+                               buckets * sizeof(Value) + ctrl,
+                               buckets == 0 ? 0u : 1u}
+               + detail::elements_footprint(value);
+    }
+};
+}  // namespace ara::core
+
+#endif  // ARA_CORE_UNORDERED_MAP_H_
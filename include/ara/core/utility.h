@@ -63,6 +63,21 @@ template<std::size_t I> struct in_place_index_t
     explicit in_place_index_t() = default;
 };
 
+/**
+ * An instance of this type can be passed to certain constructors and insert
+ * functions of sorted associative containers to denote that the given elements
+ * are already sorted by key and free of duplicates.
+ */
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+
+/**
+ * Instance of ara::core::sorted_unique_t
+ */
+inline constexpr sorted_unique_t sorted_unique{};
+
 /**
  * These global functions allow uniform access to the data and size properties
  * of contiguous containers. They are eqavilents to functions from C++17
@@ -366,7 +366,7 @@ template<class T, class Allocator = Allocator<T>> class Vector
      *
      * @param[in] new_cap - new capacity of the vector.
      */
-    void reserve(size_type new_cap) { _impl.resize(new_cap); }
+    void reserve(size_type new_cap) { _impl.reserve(new_cap); }
 
     /**
      * @brief Requests the removal of unused capacity.
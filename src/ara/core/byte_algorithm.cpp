@@ -0,0 +1,641 @@
+#include "ara/core/byte_algorithm.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARA_CORE_BYTE_KERNELS_X86
+#include <immintrin.h>
+#endif
+
+namespace ara::core {
+
+namespace {
+using BinaryKernel = void (*)(const unsigned char*,
+                              const unsigned char*,
+                              unsigned char*,
+                              std::size_t) noexcept;
+using UnaryKernel  = void (*)(const unsigned char*,
+                             unsigned char*,
+                             std::size_t) noexcept;
+using CountKernel  = std::size_t (*)(const unsigned char*,
+                                    std::size_t) noexcept;
+using SearchKernel = std::size_t (*)(const unsigned char*,
+                                     std::size_t,
+                                     unsigned char) noexcept;
+
+/**
+ * @brief The kernels of one instruction set.
+ */
+struct ByteKernels
+{
+    detail::ByteKernelIsa isa;
+    BinaryKernel          bytes_xor;
+    BinaryKernel          bytes_and;
+    BinaryKernel          bytes_or;
+    UnaryKernel           bytes_not;
+    CountKernel           popcount;
+    SearchKernel          find_byte;
+    SearchKernel          count_byte;
+};
+
+enum class BitOp
+{
+    kXor,
+    kAnd,
+    kOr
+};
+
+template<BitOp Op> unsigned char Apply(unsigned char a, unsigned char b)
+{
+    if constexpr (Op == BitOp::kXor)
+    { return static_cast<unsigned char>(a ^ b); }
+    else if constexpr (Op == BitOp::kAnd)
+    { return static_cast<unsigned char>(a & b); }
+    else
+    { return static_cast<unsigned char>(a | b); }
+}
+
+// Scalar kernels, also used for the tails of the vector kernels.
+
+template<BitOp Op>
+void ScalarBinary(const unsigned char* lhs,
+                  const unsigned char* rhs,
+                  unsigned char*       out,
+                  std::size_t          n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i) { out[i] = Apply<Op>(lhs[i], rhs[i]); }
+}
+
+void
+ScalarNot(const unsigned char* in, unsigned char* out, std::size_t n) noexcept
+{
+    for (std::size_t i = 0; i < n; ++i)
+    { out[i] = static_cast<unsigned char>(~in[i]); }
+}
+
+std::size_t ScalarPopcount(const unsigned char* in, std::size_t n) noexcept
+{
+    std::size_t count = 0;
+    std::size_t i     = 0;
+    for (; i + 8 <= n; i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, in + i, sizeof(word));
+        count += static_cast<std::size_t>(std::popcount(word));
+    }
+    for (; i < n; ++i)
+    { count += static_cast<std::size_t>(std::popcount(in[i])); }
+
+    return count;
+}
+
+std::size_t
+ScalarFind(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    auto const* const match = n == 0 ? nullptr : std::memchr(in, value, n);
+
+    return match == nullptr
+             ? n
+             : static_cast<std::size_t>(static_cast<const unsigned char*>(match)
+                                        - in);
+}
+
+std::size_t ScalarCount(const unsigned char* in,
+                        std::size_t          n,
+                        unsigned char        value) noexcept
+{
+    return static_cast<std::size_t>(std::count(in, in + n, value));
+}
+
+constexpr ByteKernels kScalarKernels{detail::ByteKernelIsa::kScalar,
+                                     &ScalarBinary<BitOp::kXor>,
+                                     &ScalarBinary<BitOp::kAnd>,
+                                     &ScalarBinary<BitOp::kOr>,
+                                     &ScalarNot,
+                                     &ScalarPopcount,
+                                     &ScalarFind,
+                                     &ScalarCount};
+
+#if defined(ARA_CORE_BYTE_KERNELS_X86)
+
+// The vector kernels are compiled for their instruction set with target
+// attributes, so the library itself keeps the baseline flags and runs on any
+// x86 CPU. Each loop handles one register per iteration and leaves the tail
+// to the kernels of the next narrower instruction set. The AVX kernels clear
+// the upper register halves before they return or call SSE code, which would
+// otherwise pay for a state transition on every instruction.
+
+/**
+ * @brief Adds up the 64-bit lanes of a register.
+ */
+template<class Register> std::size_t SumLanes(const Register& sums) noexcept
+{
+    std::uint64_t lanes[sizeof(Register) / sizeof(std::uint64_t)];
+    std::memcpy(lanes, &sums, sizeof(lanes));
+    std::size_t total = 0;
+    for (auto const lane : lanes) { total += lane; }
+
+    return total;
+}
+
+template<BitOp Op>
+__attribute__((target("sse2"))) void Sse2Binary(const unsigned char* lhs,
+                                                const unsigned char* rhs,
+                                                unsigned char*       out,
+                                                std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const a =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i));
+        __m128i const b =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i));
+        __m128i result;
+        if constexpr (Op == BitOp::kXor)
+        { result = _mm_xor_si128(a, b); }
+        else if constexpr (Op == BitOp::kAnd)
+        { result = _mm_and_si128(a, b); }
+        else
+        { result = _mm_or_si128(a, b); }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), result);
+    }
+    ScalarBinary<Op>(lhs + i, rhs + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void
+Sse2Not(const unsigned char* in, unsigned char* out, std::size_t n) noexcept
+{
+    __m128i const ones = _mm_set1_epi8(-1);
+    std::size_t   i    = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const a =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                         _mm_xor_si128(a, ones));
+    }
+    ScalarNot(in + i, out + i, n - i);
+}
+
+/**
+ * @brief SSE2 has no byte shuffle, so the bits of each byte are summed with
+ * shifts and masks, and the byte sums of each half with psadbw.
+ */
+__attribute__((target("sse2"))) std::size_t
+Sse2Popcount(const unsigned char* in, std::size_t n) noexcept
+{
+    __m128i const m1   = _mm_set1_epi8(0x55);
+    __m128i const m2   = _mm_set1_epi8(0x33);
+    __m128i const m4   = _mm_set1_epi8(0x0f);
+    __m128i const zero = _mm_setzero_si128();
+    __m128i       sums = zero;
+    std::size_t   i    = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi16(v, 1), m1));
+        v = _mm_add_epi8(_mm_and_si128(v, m2),
+                         _mm_and_si128(_mm_srli_epi16(v, 2), m2));
+        v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi16(v, 4)), m4);
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(v, zero));
+    }
+
+    return SumLanes(sums) + ScalarPopcount(in + i, n - i);
+}
+
+__attribute__((target("sse2"))) std::size_t
+Sse2Find(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    __m128i const needle = _mm_set1_epi8(static_cast<char>(value));
+    std::size_t   i      = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        __m128i const v =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        auto const mask =
+          static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, needle)));
+        if (mask != 0)
+        { return i + static_cast<std::size_t>(std::countr_zero(mask)); }
+    }
+
+    return i + ScalarFind(in + i, n - i, value);
+}
+
+/**
+ * @brief Matches are counted per byte lane, by subtracting the all-ones
+ * result of the comparison, for at most 255 registers before the lanes are
+ * summed up.
+ */
+__attribute__((target("sse2"))) std::size_t
+Sse2Count(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    __m128i const needle = _mm_set1_epi8(static_cast<char>(value));
+    __m128i const zero   = _mm_setzero_si128();
+    std::size_t   count  = 0;
+    std::size_t   i      = 0;
+    while (n - i >= 16)
+    {
+        std::size_t const registers = std::min<std::size_t>((n - i) / 16, 255);
+        std::size_t const end       = i + registers * 16;
+        __m128i           counts    = zero;
+        for (; i < end; i += 16)
+        {
+            __m128i const v =
+              _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+            counts = _mm_sub_epi8(counts, _mm_cmpeq_epi8(v, needle));
+        }
+        count += SumLanes(_mm_sad_epu8(counts, zero));
+    }
+
+    return count + ScalarCount(in + i, n - i, value);
+}
+
+template<BitOp Op>
+__attribute__((target("avx2"))) void Avx2Binary(const unsigned char* lhs,
+                                                const unsigned char* rhs,
+                                                unsigned char*       out,
+                                                std::size_t n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + i));
+        __m256i const b =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + i));
+        __m256i result;
+        if constexpr (Op == BitOp::kXor)
+        { result = _mm256_xor_si256(a, b); }
+        else if constexpr (Op == BitOp::kAnd)
+        { result = _mm256_and_si256(a, b); }
+        else
+        { result = _mm256_or_si256(a, b); }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), result);
+    }
+    _mm256_zeroupper();
+    ScalarBinary<Op>(lhs + i, rhs + i, out + i, n - i);
+}
+
+__attribute__((target("avx2"))) void
+Avx2Not(const unsigned char* in, unsigned char* out, std::size_t n) noexcept
+{
+    __m256i const ones = _mm256_set1_epi8(-1);
+    std::size_t   i    = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const a =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                            _mm256_xor_si256(a, ones));
+    }
+    _mm256_zeroupper();
+    ScalarNot(in + i, out + i, n - i);
+}
+
+/**
+ * @brief Looks up the bit count of each nibble with a byte shuffle.
+ */
+__attribute__((target("avx2"))) std::size_t
+Avx2Popcount(const unsigned char* in, std::size_t n) noexcept
+{
+    __m256i const table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4,
+                                           0, 1, 1, 2, 1, 2, 2, 3,
+                                           1, 2, 2, 3, 2, 3, 3, 4);
+    __m256i const low  = _mm256_set1_epi8(0x0f);
+    __m256i const zero = _mm256_setzero_si256();
+    __m256i       sums = zero;
+    std::size_t   i    = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i const counts = _mm256_add_epi8(
+          _mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+          _mm256_shuffle_epi8(table,
+                              _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(counts, zero));
+    }
+    std::size_t const count = SumLanes(sums);
+    _mm256_zeroupper();
+
+    return count + ScalarPopcount(in + i, n - i);
+}
+
+__attribute__((target("avx2"))) std::size_t
+Avx2Find(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    __m256i const needle = _mm256_set1_epi8(static_cast<char>(value));
+    std::size_t   i      = 0;
+    for (; i + 32 <= n; i += 32)
+    {
+        __m256i const v =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        auto const mask = static_cast<unsigned>(
+          _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, needle)));
+        if (mask != 0)
+        {
+            _mm256_zeroupper();
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+    _mm256_zeroupper();
+
+    return i + Sse2Find(in + i, n - i, value);
+}
+
+__attribute__((target("avx2"))) std::size_t
+Avx2Count(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    __m256i const needle = _mm256_set1_epi8(static_cast<char>(value));
+    __m256i const zero   = _mm256_setzero_si256();
+    std::size_t   count  = 0;
+    std::size_t   i      = 0;
+    while (n - i >= 32)
+    {
+        std::size_t const registers = std::min<std::size_t>((n - i) / 32, 255);
+        std::size_t const end       = i + registers * 32;
+        __m256i           counts    = zero;
+        for (; i < end; i += 32)
+        {
+            __m256i const v =
+              _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            counts = _mm256_sub_epi8(counts, _mm256_cmpeq_epi8(v, needle));
+        }
+        count += SumLanes(_mm256_sad_epu8(counts, zero));
+    }
+    _mm256_zeroupper();
+
+    return count + Sse2Count(in + i, n - i, value);
+}
+
+template<BitOp Op>
+__attribute__((target("avx512f,avx512bw"))) void
+Avx512Binary(const unsigned char* lhs,
+             const unsigned char* rhs,
+             unsigned char*       out,
+             std::size_t          n) noexcept
+{
+    std::size_t i = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __m512i const a = _mm512_loadu_si512(lhs + i);
+        __m512i const b = _mm512_loadu_si512(rhs + i);
+        __m512i       result;
+        if constexpr (Op == BitOp::kXor)
+        { result = _mm512_xor_si512(a, b); }
+        else if constexpr (Op == BitOp::kAnd)
+        { result = _mm512_and_si512(a, b); }
+        else
+        { result = _mm512_or_si512(a, b); }
+        _mm512_storeu_si512(out + i, result);
+    }
+    Avx2Binary<Op>(lhs + i, rhs + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512bw"))) void
+Avx512Not(const unsigned char* in, unsigned char* out, std::size_t n) noexcept
+{
+    __m512i const ones = _mm512_set1_epi8(-1);
+    std::size_t   i    = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        _mm512_storeu_si512(out + i,
+                            _mm512_xor_si512(_mm512_loadu_si512(in + i), ones));
+    }
+    Avx2Not(in + i, out + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512bw"))) std::size_t
+Avx512Popcount(const unsigned char* in, std::size_t n) noexcept
+{
+    // The bit counts of 0 to 15 in each 128-bit lane.
+    __m512i const table = _mm512_set4_epi64(0x0403030203020201,
+                                            0x0302020102010100,
+                                            0x0403030203020201,
+                                            0x0302020102010100);
+    __m512i const low  = _mm512_set1_epi8(0x0f);
+    __m512i const zero = _mm512_setzero_si512();
+    __m512i       sums = zero;
+    std::size_t   i    = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __m512i const v      = _mm512_loadu_si512(in + i);
+        __m512i const counts = _mm512_add_epi8(
+          _mm512_shuffle_epi8(table, _mm512_and_si512(v, low)),
+          _mm512_shuffle_epi8(table,
+                              _mm512_and_si512(_mm512_srli_epi16(v, 4), low)));
+        sums = _mm512_add_epi64(sums, _mm512_sad_epu8(counts, zero));
+    }
+    std::size_t const count = SumLanes(sums);
+
+    return count + Avx2Popcount(in + i, n - i);
+}
+
+__attribute__((target("avx512f,avx512bw"))) std::size_t
+Avx512Find(const unsigned char* in, std::size_t n, unsigned char value) noexcept
+{
+    __m512i const needle = _mm512_set1_epi8(static_cast<char>(value));
+    std::size_t   i      = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        std::uint64_t const mask =
+          _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(in + i), needle);
+        if (mask != 0)
+        {
+            _mm256_zeroupper();
+            return i + static_cast<std::size_t>(std::countr_zero(mask));
+        }
+    }
+
+    return i + Avx2Find(in + i, n - i, value);
+}
+
+/**
+ * @brief The comparison yields a bit mask, so the matches are counted with
+ * popcnt rather than in byte lanes.
+ */
+__attribute__((target("avx512f,avx512bw,popcnt"))) std::size_t
+Avx512Count(const unsigned char* in,
+            std::size_t          n,
+            unsigned char        value) noexcept
+{
+    __m512i const needle = _mm512_set1_epi8(static_cast<char>(value));
+    std::size_t   count  = 0;
+    std::size_t   i      = 0;
+    for (; i + 64 <= n; i += 64)
+    {
+        __mmask64 const mask =
+          _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(in + i), needle);
+        count += static_cast<std::size_t>(__builtin_popcountll(mask));
+    }
+
+    return count + Avx2Count(in + i, n - i, value);
+}
+
+constexpr ByteKernels kSse2Kernels{detail::ByteKernelIsa::kSse2,
+                                   &Sse2Binary<BitOp::kXor>,
+                                   &Sse2Binary<BitOp::kAnd>,
+                                   &Sse2Binary<BitOp::kOr>,
+                                   &Sse2Not,
+                                   &Sse2Popcount,
+                                   &Sse2Find,
+                                   &Sse2Count};
+
+constexpr ByteKernels kAvx2Kernels{detail::ByteKernelIsa::kAvx2,
+                                   &Avx2Binary<BitOp::kXor>,
+                                   &Avx2Binary<BitOp::kAnd>,
+                                   &Avx2Binary<BitOp::kOr>,
+                                   &Avx2Not,
+                                   &Avx2Popcount,
+                                   &Avx2Find,
+                                   &Avx2Count};
+
+constexpr ByteKernels kAvx512Kernels{detail::ByteKernelIsa::kAvx512,
+                                     &Avx512Binary<BitOp::kXor>,
+                                     &Avx512Binary<BitOp::kAnd>,
+                                     &Avx512Binary<BitOp::kOr>,
+                                     &Avx512Not,
+                                     &Avx512Popcount,
+                                     &Avx512Find,
+                                     &Avx512Count};
+#endif
+
+/**
+ * @brief Returns the kernels for isa, or null if the CPU or the compiler
+ * doesn't support it.
+ */
+const ByteKernels* KernelsFor(detail::ByteKernelIsa isa) noexcept
+{
+    switch (isa)
+    {
+#if defined(ARA_CORE_BYTE_KERNELS_X86)
+        case detail::ByteKernelIsa::kAvx512:
+            return __builtin_cpu_supports("avx512f")
+                       && __builtin_cpu_supports("avx512bw")
+                     ? &kAvx512Kernels
+                     : nullptr;
+        case detail::ByteKernelIsa::kAvx2:
+            return __builtin_cpu_supports("avx2") ? &kAvx2Kernels : nullptr;
+        case detail::ByteKernelIsa::kSse2:
+            return __builtin_cpu_supports("sse2") ? &kSse2Kernels : nullptr;
+#endif
+        case detail::ByteKernelIsa::kScalar: return &kScalarKernels;
+        default: return nullptr;
+    }
+}
+
+const ByteKernels* DetectKernels() noexcept
+{
+#if defined(ARA_CORE_BYTE_KERNELS_X86)
+    __builtin_cpu_init();
+#endif
+    for (auto const isa : {detail::ByteKernelIsa::kAvx512,
+                           detail::ByteKernelIsa::kAvx2,
+                           detail::ByteKernelIsa::kSse2})
+    {
+        if (const ByteKernels* kernels = KernelsFor(isa))
+        { return kernels; }
+    }
+
+    return &kScalarKernels;
+}
+
+std::atomic<const ByteKernels*> activeKernels{nullptr};
+
+const ByteKernels& Kernels() noexcept
+{
+    // Detection is idempotent, so racing first calls may both run it.
+    const ByteKernels* kernels = activeKernels.load(std::memory_order_relaxed);
+    if (kernels == nullptr)
+    {
+        kernels = DetectKernels();
+        activeKernels.store(kernels, std::memory_order_relaxed);
+    }
+
+    return *kernels;
+}
+
+const unsigned char* BytesOf(Span<const Byte> bytes) noexcept
+{
+    return reinterpret_cast<const unsigned char*>(bytes.data());
+}
+
+unsigned char* BytesOf(Span<Byte> bytes) noexcept
+{
+    return reinterpret_cast<unsigned char*>(bytes.data());
+}
+
+void CheckSizes(const char*      what,
+                Span<const Byte> lhs,
+                Span<const Byte> rhs,
+                Span<Byte>       out)
+{
+    if (lhs.size() != rhs.size() || lhs.size() != out.size())
+    { throw std::invalid_argument(what); }
+}
+}  // namespace
+
+void bytes_xor(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out)
+{
+    CheckSizes("bytes_xor: sizes differ", lhs, rhs, out);
+    Kernels().bytes_xor(BytesOf(lhs), BytesOf(rhs), BytesOf(out), out.size());
+}
+
+void bytes_and(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out)
+{
+    CheckSizes("bytes_and: sizes differ", lhs, rhs, out);
+    Kernels().bytes_and(BytesOf(lhs), BytesOf(rhs), BytesOf(out), out.size());
+}
+
+void bytes_or(Span<const Byte> lhs, Span<const Byte> rhs, Span<Byte> out)
+{
+    CheckSizes("bytes_or: sizes differ", lhs, rhs, out);
+    Kernels().bytes_or(BytesOf(lhs), BytesOf(rhs), BytesOf(out), out.size());
+}
+
+void bytes_not(Span<const Byte> bytes, Span<Byte> out)
+{
+    CheckSizes("bytes_not: sizes differ", bytes, bytes, out);
+    Kernels().bytes_not(BytesOf(bytes), BytesOf(out), out.size());
+}
+
+std::size_t popcount(Span<const Byte> bytes) noexcept
+{
+    return Kernels().popcount(BytesOf(bytes), bytes.size());
+}
+
+std::size_t find_byte(Span<const Byte> bytes, Byte value) noexcept
+{
+    return Kernels().find_byte(
+      BytesOf(bytes), bytes.size(), static_cast<unsigned char>(value));
+}
+
+std::size_t count_byte(Span<const Byte> bytes, Byte value) noexcept
+{
+    return Kernels().count_byte(
+      BytesOf(bytes), bytes.size(), static_cast<unsigned char>(value));
+}
+
+namespace detail {
+ByteKernelIsa ActiveByteKernels() noexcept { return Kernels().isa; }
+
+bool UseByteKernels(ByteKernelIsa isa) noexcept
+{
+    const ByteKernels* const kernels = KernelsFor(isa);
+    if (kernels == nullptr)
+    { return false; }
+
+    activeKernels.store(kernels, std::memory_order_relaxed);
+
+    return true;
+}
+}  // namespace detail
+
+}  // namespace ara::core
@@ -0,0 +1,152 @@
+#include "ara/core/map_image.h"
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace ara::core {
+
+namespace {
+[[noreturn]] void ThrowSystemError(const std::string&           what,
+                                   const std::filesystem::path& path)
+{
+    throw std::system_error(
+      errno, std::generic_category(), what + " " + path.string());
+}
+
+/**
+ * @brief Closes a file descriptor on scope exit.
+ */
+class FileDescriptor
+{
+ public:
+    explicit FileDescriptor(int fd) noexcept : fd_(fd) {}
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+    ~FileDescriptor()
+    {
+        if (fd_ >= 0)
+        { ::close(fd_); }
+    }
+
+    int get() const noexcept { return fd_; }
+
+ private:
+    int fd_;
+};
+
+/**
+ * @brief Removes a file on scope exit unless it was released.
+ */
+class FileRemover
+{
+ public:
+    explicit FileRemover(std::string path) noexcept : path_(std::move(path))
+    {}
+    FileRemover(const FileRemover&) = delete;
+    FileRemover& operator=(const FileRemover&) = delete;
+    ~FileRemover()
+    {
+        if (! path_.empty())
+        { ::unlink(path_.c_str()); }
+    }
+
+    void release() noexcept { path_.clear(); }
+
+ private:
+    std::string path_;
+};
+}  // namespace
+
+void SaveMapImage(const std::filesystem::path& path,
+                  Span<const Byte>             image)
+{
+    // Written next to the target, so the rename stays on one file system.
+    // mkstemp() gives every writer its own file.
+    std::string temporary = path.string() + ".XXXXXX";
+    {
+        FileDescriptor const file{::mkstemp(temporary.data())};
+        if (file.get() < 0)
+        { ThrowSystemError("SaveMapImage: cannot create", temporary); }
+        FileRemover remover{temporary};
+
+        // mkstemp() creates the file readable by its owner only.
+        if (::fchmod(file.get(), 0644) != 0)
+        { ThrowSystemError("SaveMapImage: cannot create", temporary); }
+
+        const Byte* data = image.data();
+        std::size_t left = image.size();
+        while (left > 0)
+        {
+            auto const written = ::write(file.get(), data, left);
+            if (written < 0 && errno == EINTR)
+            { continue; }
+            if (written < 0)
+            { ThrowSystemError("SaveMapImage: cannot write", temporary); }
+
+            data += written;
+            left -= static_cast<std::size_t>(written);
+        }
+
+        if (::fsync(file.get()) != 0)
+        { ThrowSystemError("SaveMapImage: cannot write", temporary); }
+
+        if (::rename(temporary.c_str(), path.c_str()) != 0)
+        { ThrowSystemError("SaveMapImage: cannot replace", path); }
+        remover.release();
+    }
+}
+
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    FileDescriptor const file{::open(path.c_str(), O_RDONLY)};
+    if (file.get() < 0)
+    { ThrowSystemError("MappedFile: cannot open", path); }
+
+    struct stat status;
+    if (::fstat(file.get(), &status) != 0)
+    { ThrowSystemError("MappedFile: cannot stat", path); }
+
+    // mmap() rejects empty mappings, an empty file maps to no bytes.
+    if (status.st_size == 0)
+    { return; }
+
+    auto const size = static_cast<std::size_t>(status.st_size);
+    void* const data =
+      ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file.get(), 0);
+    if (data == MAP_FAILED)
+    { ThrowSystemError("MappedFile: cannot map", path); }
+
+    data_ = static_cast<const Byte*>(data);
+    size_ = size;
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+  : data_(std::exchange(other.data_, nullptr))
+  , size_(std::exchange(other.size_, 0))
+{}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+    }
+
+    return *this;
+}
+
+MappedFile::~MappedFile()
+{
+    if (data_ != nullptr)
+    { ::munmap(const_cast<Byte*>(data_), size_); }
+}
+
+}  // namespace ara::core
@@ -0,0 +1,208 @@
+#include "ara/core/thread_pool.h"
+
+#include <deque>
+
+namespace ara::core {
+
+namespace {
+// Identifies the pool and queue owned by the current worker thread, so tasks
+// spawned from inside a task land on the local queue.
+thread_local const ThreadPool* currentPool  = nullptr;
+thread_local std::size_t       currentIndex = 0;
+}  // namespace
+
+struct alignas(64) ThreadPool::Queue
+{
+    std::mutex       mutex;
+    std::deque<Task> tasks;
+};
+
+ThreadPool::ThreadPool(std::size_t concurrency)
+{
+    if (concurrency == 0)
+    { concurrency = 1; }
+
+    // Queue 0 receives tasks submitted from outside of the pool, queues
+    // 1..concurrency-1 belong to the worker threads.
+    queues_.reserve(concurrency);
+    for (std::size_t i = 0; i < concurrency; ++i)
+    { queues_.push_back(std::make_unique<Queue>()); }
+
+    threads_.reserve(concurrency - 1);
+    for (std::size_t i = 1; i < concurrency; ++i)
+    { threads_.emplace_back([this, i] { worker_loop(i); }); }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex_};
+        stop_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto& thread : threads_) { thread.join(); }
+}
+
+void ThreadPool::submit(Task task)
+{
+    std::size_t index = 0;
+    if (currentPool == this)
+    { index = currentIndex; }
+    else if (queues_.size() > 1)
+    {
+        index = next_queue_.fetch_add(1, std::memory_order_relaxed)
+                % queues_.size();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{sleep_mutex_};
+        pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{queues_[index]->mutex};
+        queues_[index]->tasks.push_back(std::move(task));
+    }
+
+    wake_.notify_one();
+}
+
+bool ThreadPool::try_run_one()
+{
+    Task task;
+    if (! try_pop(currentPool == this ? currentIndex : 0, task))
+    { return false; }
+
+    task();
+
+    return true;
+}
+
+std::size_t ThreadPool::DefaultConcurrency() noexcept
+{
+    auto const hardware = std::thread::hardware_concurrency();
+
+    return hardware == 0 ? 1 : hardware;
+}
+
+void ThreadPool::worker_loop(std::size_t index)
+{
+    currentPool  = this;
+    currentIndex = index;
+
+    Task task;
+    while (true)
+    {
+        if (try_pop(index, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock{sleep_mutex_};
+        if (stop_ && pending_.load(std::memory_order_relaxed) == 0)
+        { return; }
+
+        wake_.wait(lock, [this] {
+            return stop_ || pending_.load(std::memory_order_relaxed) > 0;
+        });
+    }
+}
+
+bool ThreadPool::try_pop(std::size_t index, Task& task)
+{
+    // Own queue is consumed LIFO for locality, the others are robbed FIFO.
+    {
+        auto&                       own = *queues_[index];
+        std::lock_guard<std::mutex> lock{own.mutex};
+        if (! own.tasks.empty())
+        {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+
+    for (std::size_t i = 1; i < queues_.size(); ++i)
+    {
+        auto& victim = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock{victim.mutex};
+        if (! victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ThreadPool& DefaultThreadPool()
+{
+    static ThreadPool pool;
+
+    return pool;
+}
+
+TaskGroup::~TaskGroup()
+{
+    try
+    {
+        wait();
+    }
+    catch (...)
+    {}
+}
+
+void TaskGroup::wait()
+{
+    while (pending_.load(std::memory_order_acquire) > 0)
+    {
+        if (pool_.try_run_one())
+        { continue; }
+
+        // Nothing left to help with, the remaining tasks run on other threads.
+        std::unique_lock<std::mutex> lock{done_mutex_};
+        done_.wait(lock, [this] {
+            return pending_.load(std::memory_order_acquire) == 0;
+        });
+    }
+
+    // The last task notifies under the lock; taking it makes sure that task
+    // is done with the group before the group can be destroyed.
+    {
+        std::lock_guard<std::mutex> lock{done_mutex_};
+    }
+
+    std::exception_ptr e;
+    {
+        std::lock_guard<std::mutex> lock{exception_mutex_};
+        std::swap(e, exception_);
+    }
+
+    if (e)
+    { std::rethrow_exception(e); }
+}
+
+void TaskGroup::finish_one() noexcept
+{
+    std::lock_guard<std::mutex> lock{done_mutex_};
+    if (pending_.fetch_sub(1, std::memory_order_release) == 1)
+    { done_.notify_all(); }
+}
+
+void TaskGroup::set_exception(std::exception_ptr e) noexcept
+{
+    std::lock_guard<std::mutex> lock{exception_mutex_};
+    if (! exception_)
+    { exception_ = std::move(e); }
+}
+
+}  // namespace ara::core
@@ -0,0 +1,38 @@
+#include "allocation_counter.h"
+
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local std::size_t allocationCount = 0;
+
+void* Allocate(std::size_t size)
+{
+    ++allocationCount;
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    { return p; }
+
+    throw std::bad_alloc();
+}
+}  // namespace
+
+void* operator new(std::size_t size) { return Allocate(size); }
+
+void* operator new[](std::size_t size) { return Allocate(size); }
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete[](void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+namespace test {
+AllocationCounter::AllocationCounter() noexcept : start_(allocationCount) {}
+
+std::size_t AllocationCounter::allocations() const noexcept
+{
+    return allocationCount - start_;
+}
+}  // namespace test
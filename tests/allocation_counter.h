@@ -0,0 +1,27 @@
+#ifndef TESTS_ALLOCATION_COUNTER_H_
+#define TESTS_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace test {
+/**
+ * @brief Counts the calls of the global operator new made by the current
+ * thread since construction. The test executable replaces the global
+ * allocation functions to make this possible.
+ */
+class AllocationCounter
+{
+ public:
+    AllocationCounter() noexcept;
+
+    /**
+     * @brief Returns the number of allocations since construction.
+     */
+    std::size_t allocations() const noexcept;
+
+ private:
+    std::size_t start_;
+};
+}  // namespace test
+
+#endif  // TESTS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/bloom_filter.h"
+#include "ara/core/flat_map.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kEntries = 1 << 20;
+constexpr std::size_t kLookups = 1 << 16;
+
+using Tree = ara::core::Map<std::uint64_t, std::uint64_t>;
+using Flat = ara::core::FlatMap<std::uint64_t, std::uint64_t>;
+
+/**
+ * @brief Random odd keys, so that even keys are known misses.
+ */
+ara::core::Vector<std::uint64_t> Keys()
+{
+    std::mt19937_64                  gen{43};
+    ara::core::Vector<std::uint64_t> keys(kEntries);
+    for (auto& key : keys) { key = gen() | 1; }
+
+    return keys;
+}
+
+/**
+ * @brief Lookups of which missPercent percent are not in the map.
+ */
+ara::core::Vector<std::uint64_t>
+Probes(const ara::core::Vector<std::uint64_t>& keys, unsigned missPercent)
+{
+    std::mt19937_64                            gen{47};
+    std::uniform_int_distribution<std::size_t> pick{0, keys.size() - 1};
+    std::uniform_int_distribution<unsigned>    percent{0, 99};
+    ara::core::Vector<std::uint64_t>           probes;
+    for (std::size_t i = 0; i < kLookups; ++i)
+    {
+        probes.push_back(percent(gen) < missPercent ? gen() & ~std::uint64_t{1}
+                                                    : keys[pick(gen)]);
+    }
+
+    return probes;
+}
+
+Tree Build(const ara::core::Vector<std::uint64_t>& keys)
+{
+    Tree map;
+    for (auto key : keys) { map.try_emplace(key, key); }
+
+    return map;
+}
+
+template<class Container>
+std::uint64_t Lookup(const Container&                        map,
+                     const ara::core::Vector<std::uint64_t>& probes)
+{
+    std::uint64_t sum = 0;
+    for (auto key : probes)
+    {
+        auto const it = map.find(key);
+        if (it != map.end())
+        { sum += it->second; }
+    }
+
+    return sum;
+}
+}  // namespace
+
+TEST_CASE("FilteredMap vs Map vs FlatMap, negative lookups",
+          "[!benchmark][BloomFilter]")
+{
+    auto const keys = Keys();
+
+    Tree const tree = Build(keys);
+    Flat const flat(tree.begin(), tree.end());
+    ara::core::FilteredMap<Tree> const filteredTree(tree);
+    ara::core::FilteredMap<Flat> const filteredFlat(flat);
+
+    for (unsigned missPercent : {50u, 90u, 99u})
+    {
+        auto const probes = Probes(keys, missPercent);
+        auto const suffix = ", " + std::to_string(missPercent) + "% misses";
+        CHECK(Lookup(filteredTree, probes) == Lookup(tree, probes));
+        CHECK(Lookup(filteredFlat, probes) == Lookup(flat, probes));
+
+        BENCHMARK("Map::find" + suffix) { return Lookup(tree, probes); };
+
+        BENCHMARK("FilteredMap<Map>::find" + suffix)
+        {
+            return Lookup(filteredTree, probes);
+        };
+
+        BENCHMARK("FlatMap::find" + suffix) { return Lookup(flat, probes); };
+
+        BENCHMARK("FilteredMap<FlatMap>::find" + suffix)
+        {
+            return Lookup(filteredFlat, probes);
+        };
+    }
+
+    auto const  misses         = Probes(keys, 100);
+    std::size_t falsePositives = 0;
+    for (auto key : misses)
+    { falsePositives += filteredTree.filter().may_contain(key); }
+
+    auto const filterBytes = filteredTree.filter().size_in_bytes();
+    auto const treeBytes   = ara::core::memory_footprint(tree).bytes_reserved;
+    WARN(falsePositives << " false positives in " << misses.size()
+                        << " misses, heap bytes per element: filter "
+                        << filterBytes / kEntries << ", Map "
+                        << treeBytes / kEntries);
+    CHECK(falsePositives < misses.size() / 50);
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/btree_map.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kLookups   = 1 << 16;
+constexpr std::size_t kScans     = 1 << 10;
+constexpr std::size_t kScanWidth = 64;
+
+ara::core::Vector<std::uint64_t> RandomKeys(std::size_t size)
+{
+    std::mt19937_64                  gen{7};
+    ara::core::Vector<std::uint64_t> keys;
+    for (std::size_t i = 0; i < size; ++i) { keys.push_back(gen()); }
+
+    return keys;
+}
+
+ara::core::Vector<std::uint64_t>
+Probes(const ara::core::Vector<std::uint64_t>& keys, std::size_t count)
+{
+    std::mt19937_64                            gen{11};
+    std::uniform_int_distribution<std::size_t> pick{0, keys.size() - 1};
+    ara::core::Vector<std::uint64_t>           probes;
+    for (std::size_t i = 0; i < count; ++i)
+    { probes.push_back(keys[pick(gen)]); }
+
+    return probes;
+}
+
+template<class Container> std::uint64_t
+ScanFrom(const Container&                        map,
+         const ara::core::Vector<std::uint64_t>& starts)
+{
+    std::uint64_t sum = 0;
+    for (auto start : starts)
+    {
+        auto it = map.lower_bound(start);
+        for (std::size_t i = 0; i < kScanWidth && it != map.end(); ++i, ++it)
+        { sum += it->second; }
+    }
+
+    return sum;
+}
+}  // namespace
+
+TEST_CASE("BTreeMap vs Map", "[!benchmark][BTreeMap]")
+{
+    for (std::size_t size : {std::size_t{1} << 10, std::size_t{1} << 20})
+    {
+        std::string const suffix = " / entries " + std::to_string(size);
+        auto const        keys   = RandomKeys(size);
+        auto const        probes = Probes(keys, kLookups);
+        auto const        starts = Probes(keys, kScans);
+
+        ara::core::Map<std::uint64_t, std::uint64_t>      tree;
+        ara::core::BTreeMap<std::uint64_t, std::uint64_t> btree;
+        for (auto key : keys) { tree.emplace(key, key); }
+        btree.insert(tree.begin(), tree.end());
+
+        BENCHMARK("Map::emplace" + suffix)
+        {
+            ara::core::Map<std::uint64_t, std::uint64_t> map;
+            for (auto key : keys) { map.emplace(key, key); }
+            return map.size();
+        };
+
+        BENCHMARK("BTreeMap::emplace" + suffix)
+        {
+            ara::core::BTreeMap<std::uint64_t, std::uint64_t> map;
+            for (auto key : keys) { map.emplace(key, key); }
+            return map.size();
+        };
+
+        BENCHMARK("Map::find" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (auto key : probes) { sum += tree.find(key)->second; }
+            return sum;
+        };
+
+        BENCHMARK("BTreeMap::find" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (auto key : probes) { sum += btree.find(key)->second; }
+            return sum;
+        };
+
+        BENCHMARK("Map range scan" + suffix) { return ScanFrom(tree, starts); };
+
+        BENCHMARK("BTreeMap range scan" + suffix)
+        {
+            return ScanFrom(btree, starts);
+        };
+
+        BENCHMARK("Map iteration" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (const auto& [key, value] : tree) { sum += value; }
+            return sum;
+        };
+
+        BENCHMARK("BTreeMap iteration" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (const auto& [key, value] : btree) { sum += value; }
+            return sum;
+        };
+
+        auto const treeBytes  = ara::core::memory_footprint(tree);
+        auto const btreeBytes = ara::core::memory_footprint(btree);
+        WARN("heap bytes per entry" << suffix << ": Map "
+                                    << treeBytes.bytes_reserved / size
+                                    << ", BTreeMap "
+                                    << btreeBytes.bytes_reserved / size);
+        CHECK(btreeBytes.bytes_reserved < treeBytes.bytes_reserved);
+        CHECK(btreeBytes.allocations < treeBytes.allocations);
+    }
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "ara/core/byte_algorithm.h"
+#include "ara/core/vector.h"
+
+namespace {
+using ara::core::Byte;
+using ara::core::detail::ByteKernelIsa;
+
+ara::core::Vector<Byte> RandomBytes(std::size_t size, std::uint64_t seed)
+{
+    std::mt19937_64         gen{seed};
+    ara::core::Vector<Byte> bytes;
+    for (std::size_t i = 0; i < size; ++i)
+    { bytes.push_back(Byte(static_cast<std::uint8_t>(gen()))); }
+
+    return bytes;
+}
+
+/**
+ * @brief The kernels on every supported instruction set, against the loops
+ * over Byte they replace. The byte searched for is absent, so find_byte()
+ * scans the whole buffer.
+ */
+void BenchmarkKernels(std::size_t size)
+{
+    auto const              lhs = RandomBytes(size, 7);
+    auto const              rhs = RandomBytes(size, 11);
+    ara::core::Vector<Byte> out(size);
+    auto                    haystack = lhs;
+    for (auto& byte : haystack)
+    {
+        if (byte == Byte(0))
+        { byte = Byte(1); }
+    }
+
+    BENCHMARK("Byte loop, xor")
+    {
+        for (std::size_t i = 0; i < size; ++i) { out[i] = lhs[i] ^ rhs[i]; }
+        return out.data();
+    };
+
+    BENCHMARK("Byte loop, popcount")
+    {
+        std::size_t bits = 0;
+        for (auto const byte : lhs)
+        {
+            bits += static_cast<std::size_t>(
+              std::popcount(ara::core::to_integer<std::uint8_t>(byte)));
+        }
+        return bits;
+    };
+
+    BENCHMARK("Byte loop, count_byte")
+    {
+        std::size_t count = 0;
+        for (auto const byte : lhs) { count += byte == Byte(42); }
+        return count;
+    };
+
+    BENCHMARK("memchr")
+    {
+        return std::memchr(haystack.data(), 0, haystack.size());
+    };
+
+    auto const detected = ara::core::detail::ActiveByteKernels();
+    std::pair<ByteKernelIsa, const char*> const kernels[] = {
+      {ByteKernelIsa::kScalar, "scalar"},
+      {ByteKernelIsa::kSse2, "SSE2"},
+      {ByteKernelIsa::kAvx2, "AVX2"},
+      {ByteKernelIsa::kAvx512, "AVX-512"}};
+    for (auto const& [isa, name] : kernels)
+    {
+        if (! ara::core::detail::UseByteKernels(isa))
+        { continue; }
+
+        std::string const prefix(name);
+        BENCHMARK(prefix + ", bytes_xor")
+        {
+            ara::core::bytes_xor(lhs, rhs, out);
+            return out.data();
+        };
+
+        BENCHMARK(prefix + ", popcount") { return ara::core::popcount(lhs); };
+
+        BENCHMARK(prefix + ", count_byte")
+        {
+            return ara::core::count_byte(lhs, Byte(42));
+        };
+
+        BENCHMARK(prefix + ", find_byte")
+        {
+            return ara::core::find_byte(haystack, Byte(0));
+        };
+    }
+    ara::core::detail::UseByteKernels(detected);
+}
+}  // namespace
+
+TEST_CASE("Byte kernels on 4 KB", "[!benchmark][ByteAlgorithm]")
+{
+    BenchmarkKernels(4096);
+}
+
+TEST_CASE("Byte kernels on 1 MB", "[!benchmark][ByteAlgorithm]")
+{
+    BenchmarkKernels(1 << 20);
+}
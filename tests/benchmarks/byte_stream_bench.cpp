@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+
+#include "ara/core/byte_stream.h"
+#include "ara/core/vector.h"
+
+namespace {
+using ara::core::Byte;
+
+constexpr std::size_t kMessages = 1 << 16;
+constexpr std::size_t kWords    = 1 << 18;
+
+/**
+ * @brief Header of a protocol message, 14 bytes in big-endian order.
+ */
+struct Message
+{
+    std::uint16_t tag;
+    std::uint32_t length;
+    std::uint64_t id;
+};
+
+ara::core::Vector<Message> RandomMessages()
+{
+    std::mt19937_64            gen{29};
+    ara::core::Vector<Message> messages;
+    for (std::size_t i = 0; i < kMessages; ++i)
+    {
+        auto const bits = gen();
+        messages.push_back({static_cast<std::uint16_t>(bits),
+                            static_cast<std::uint32_t>(bits >> 16),
+                            gen()});
+    }
+
+    return messages;
+}
+
+/**
+ * @brief Appends value in big-endian order one Byte at a time, as encoders
+ * did before ByteWriter.
+ */
+template<class T> void PushBigEndian(ara::core::Vector<Byte>& out, T value)
+{
+    for (std::size_t shift = 8 * sizeof(T); shift != 0; shift -= 8)
+    { out.push_back(Byte(static_cast<std::uint8_t>(value >> (shift - 8)))); }
+}
+
+/**
+ * @brief Assembles a big-endian value from single Bytes at pos, checking the
+ * bounds for each value.
+ */
+template<class T>
+T PullBigEndian(const ara::core::Vector<Byte>& in, std::size_t& pos)
+{
+    if (in.size() - pos < sizeof(T))
+    { throw std::out_of_range("read past the end"); }
+
+    T value = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value = static_cast<T>(
+          (value << 8) | ara::core::to_integer<std::uint8_t>(in[pos++]));
+    }
+
+    return value;
+}
+}  // namespace
+
+TEST_CASE("Encoding and decoding message headers", "[!benchmark][ByteStream]")
+{
+    auto const              messages = RandomMessages();
+    ara::core::Vector<Byte> encoded;
+    {
+        ara::core::ByteWriter writer(encoded);
+        for (auto const& m : messages)
+        { writer.write_be(m.tag, m.length, m.id); }
+    }
+
+    // The output buffers are reused, so that no benchmark includes growing
+    // them.
+    ara::core::Vector<Byte> out;
+    BENCHMARK("Byte at a time, encode")
+    {
+        out.clear();
+        for (auto const& m : messages)
+        {
+            PushBigEndian(out, m.tag);
+            PushBigEndian(out, m.length);
+            PushBigEndian(out, m.id);
+        }
+        return out.size();
+    };
+
+    BENCHMARK("ByteWriter, encode field by field")
+    {
+        out.clear();
+        ara::core::ByteWriter writer(out);
+        for (auto const& m : messages)
+        {
+            writer.write_be(m.tag);
+            writer.write_be(m.length);
+            writer.write_be(m.id);
+        }
+        return writer.size();
+    };
+
+    BENCHMARK("ByteWriter, encode a batch per message")
+    {
+        out.clear();
+        ara::core::ByteWriter writer(out);
+        for (auto const& m : messages)
+        { writer.write_be(m.tag, m.length, m.id); }
+        return writer.size();
+    };
+
+    BENCHMARK("Byte at a time, decode")
+    {
+        std::uint64_t sum = 0;
+        std::size_t   pos = 0;
+        while (pos != encoded.size())
+        {
+            sum += PullBigEndian<std::uint16_t>(encoded, pos);
+            sum += PullBigEndian<std::uint32_t>(encoded, pos);
+            sum += PullBigEndian<std::uint64_t>(encoded, pos);
+        }
+        return sum;
+    };
+
+    BENCHMARK("ByteReader, decode field by field")
+    {
+        std::uint64_t         sum = 0;
+        ara::core::ByteReader reader(encoded);
+        while (! reader.empty())
+        {
+            sum += reader.read_be<std::uint16_t>();
+            sum += reader.read_be<std::uint32_t>();
+            sum += reader.read_be<std::uint64_t>();
+        }
+        return sum;
+    };
+
+    BENCHMARK("ByteReader, decode a batch per message")
+    {
+        std::uint64_t         sum = 0;
+        ara::core::ByteReader reader(encoded);
+        while (! reader.empty())
+        {
+            auto const [tag, length, id] =
+              reader.read_be<std::uint16_t, std::uint32_t, std::uint64_t>();
+            sum += tag + length + id;
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("Encoding and decoding arrays of words", "[!benchmark][ByteStream]")
+{
+    ara::core::Vector<std::uint32_t> words(kWords);
+    std::mt19937                     gen{31};
+    for (auto& word : words) { word = static_cast<std::uint32_t>(gen()); }
+    ara::core::Vector<Byte> encoded(4 * kWords);
+    ara::core::ByteWriter(ara::core::Span<Byte>(encoded)).write_be(words);
+
+    ara::core::Vector<Byte> out;
+    BENCHMARK("Byte at a time, encode")
+    {
+        out.clear();
+        for (auto const word : words) { PushBigEndian(out, word); }
+        return out.size();
+    };
+
+    BENCHMARK("ByteWriter, encode the range")
+    {
+        out.clear();
+        ara::core::ByteWriter writer(out);
+        writer.write_be(words);
+        return writer.size();
+    };
+
+    ara::core::Vector<std::uint32_t> decoded(kWords);
+    BENCHMARK("Byte at a time, decode")
+    {
+        std::size_t pos = 0;
+        for (auto& word : decoded)
+        { word = PullBigEndian<std::uint32_t>(encoded, pos); }
+        return decoded.back();
+    };
+
+    BENCHMARK("ByteReader, decode the range")
+    {
+        ara::core::ByteReader(encoded).read_be(decoded);
+        return decoded.back();
+    };
+}
@@ -0,0 +1,100 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "ara/core/concurrent_map.h"
+#include "ara/core/map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kKeys       = 1 << 16;
+constexpr std::size_t kOperations = 1 << 20;
+
+/**
+ * @brief Runs kOperations operations split over the given number of threads.
+ * Every thread draws random keys and performs a write for writePercent of
+ * them and a read for the rest.
+ */
+template<class Read, class Write> std::uint64_t
+RunMix(std::size_t threads, unsigned writePercent, Read read, Write write)
+{
+    std::atomic<std::uint64_t>     total{0};
+    ara::core::Vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t] {
+            std::mt19937_64                              gen{t};
+            std::uniform_int_distribution<std::uint64_t> key{0, kKeys - 1};
+            std::uniform_int_distribution<unsigned>      percent{0, 99};
+
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < kOperations / threads; ++i)
+            {
+                if (percent(gen) < writePercent)
+                { write(key(gen)); }
+                else
+                { sum += read(key(gen)); }
+            }
+            total += sum;
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    return total;
+}
+}  // namespace
+
+TEST_CASE("ConcurrentMap throughput", "[!benchmark][ConcurrentMap]")
+{
+    auto const hardware =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    for (unsigned writePercent : {5u, 50u})
+    {
+        for (std::size_t threads = 1; threads <= hardware; threads *= 2)
+        {
+            std::string const suffix =
+              " / writes " + std::to_string(writePercent) + "% / threads "
+              + std::to_string(threads);
+
+            ara::core::ConcurrentMap<std::uint64_t, std::uint64_t> sharded;
+            ara::core::Map<std::uint64_t, std::uint64_t>           locked;
+            std::mutex                                             mutex;
+            for (std::uint64_t key = 0; key < kKeys; ++key)
+            {
+                sharded.try_emplace(key, key);
+                locked.emplace(key, key);
+            }
+
+            BENCHMARK("ConcurrentMap" + suffix)
+            {
+                return RunMix(
+                  threads,
+                  writePercent,
+                  [&](std::uint64_t key) { return *sharded.find(key); },
+                  [&](std::uint64_t key) {
+                      sharded.update(key, [](std::uint64_t& v) { ++v; });
+                  });
+            };
+
+            BENCHMARK("std::mutex + Map" + suffix)
+            {
+                return RunMix(
+                  threads,
+                  writePercent,
+                  [&](std::uint64_t key) {
+                      std::lock_guard<std::mutex> lock{mutex};
+                      return locked.find(key)->second;
+                  },
+                  [&](std::uint64_t key) {
+                      std::lock_guard<std::mutex> lock{mutex};
+                      ++locked.find(key)->second;
+                  });
+            };
+        }
+    }
+}
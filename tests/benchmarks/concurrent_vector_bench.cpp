@@ -0,0 +1,52 @@
+#include <catch2/catch.hpp>
+
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "ara/core/concurrent_vector.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kEvents = 1 << 20;
+
+template<class Push> void RunProducers(std::size_t producers, Push push)
+{
+    ara::core::Vector<std::thread> threads;
+    for (std::size_t p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&push, producers] {
+            for (std::size_t i = 0; i < kEvents / producers; ++i) { push(i); }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+}
+}  // namespace
+
+TEST_CASE("ConcurrentVector producer throughput",
+          "[!benchmark][ConcurrentVector]")
+{
+    for (std::size_t producers : {1u, 2u, 4u, 8u, 16u, 32u})
+    {
+        std::string const suffix = " / producers " + std::to_string(producers);
+
+        BENCHMARK("ConcurrentVector::push_back" + suffix)
+        {
+            ara::core::ConcurrentVector<std::size_t> log;
+            RunProducers(producers,
+                         [&log](std::size_t i) { log.push_back(i); });
+            return log.size();
+        };
+
+        BENCHMARK("std::mutex + Vector::push_back" + suffix)
+        {
+            std::mutex                     mutex;
+            ara::core::Vector<std::size_t> log;
+            RunProducers(producers, [&](std::size_t i) {
+                std::lock_guard<std::mutex> lock{mutex};
+                log.push_back(i);
+            });
+            return log.size();
+        };
+    }
+}
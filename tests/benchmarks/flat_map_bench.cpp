@@ -0,0 +1,109 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/flat_map.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kLookups = 1 << 16;
+
+ara::core::Vector<std::uint64_t> RandomKeys(std::size_t size)
+{
+    std::mt19937_64                  gen{7};
+    ara::core::Vector<std::uint64_t> keys;
+    for (std::size_t i = 0; i < size; ++i) { keys.push_back(gen()); }
+
+    return keys;
+}
+
+ara::core::Vector<std::uint64_t>
+Probes(const ara::core::Vector<std::uint64_t>& keys)
+{
+    std::mt19937_64                            gen{11};
+    std::uniform_int_distribution<std::size_t> pick{0, keys.size() - 1};
+    ara::core::Vector<std::uint64_t>           probes;
+    for (std::size_t i = 0; i < kLookups; ++i)
+    { probes.push_back(keys[pick(gen)]); }
+
+    return probes;
+}
+}  // namespace
+
+TEST_CASE("FlatMap vs Map", "[!benchmark][FlatMap]")
+{
+    for (std::size_t size : {std::size_t{1} << 10, std::size_t{1} << 20})
+    {
+        std::string const suffix = " / entries " + std::to_string(size);
+        auto const        keys   = RandomKeys(size);
+        auto const        probes = Probes(keys);
+
+        ara::core::Map<std::uint64_t, std::uint64_t>     tree;
+        ara::core::FlatMap<std::uint64_t, std::uint64_t> flat;
+        for (auto key : keys) { tree.emplace(key, key); }
+        flat.insert(tree.begin(), tree.end());
+
+        BENCHMARK("Map::emplace" + suffix)
+        {
+            ara::core::Map<std::uint64_t, std::uint64_t> map;
+            for (auto key : keys) { map.emplace(key, key); }
+            return map.size();
+        };
+
+        BENCHMARK("FlatMap bulk insert" + suffix)
+        {
+            ara::core::FlatMap<std::uint64_t, std::uint64_t> map;
+            map.insert(tree.begin(), tree.end());
+            return map.size();
+        };
+
+        BENCHMARK("FlatMap adopt sorted" + suffix)
+        {
+            auto sorted = keys;
+            std::sort(sorted.begin(), sorted.end());
+            auto values = sorted;
+            ara::core::FlatMap<std::uint64_t, std::uint64_t> map{
+              ara::core::sorted_unique, std::move(sorted), std::move(values)};
+            return map.size();
+        };
+
+        BENCHMARK("Map::find" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (auto key : probes) { sum += tree.find(key)->second; }
+            return sum;
+        };
+
+        BENCHMARK("FlatMap::find" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (auto key : probes) { sum += flat.find(key)->second; }
+            return sum;
+        };
+
+        BENCHMARK("Map iteration" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (const auto& [key, value] : tree) { sum += value; }
+            return sum;
+        };
+
+        BENCHMARK("FlatMap iteration" + suffix)
+        {
+            std::uint64_t sum = 0;
+            for (const auto& [key, value] : flat) { sum += value; }
+            return sum;
+        };
+
+        auto const treeBytes = ara::core::memory_footprint(tree).bytes_reserved;
+        auto const flatBytes = ara::core::memory_footprint(flat).bytes_reserved;
+        WARN("heap bytes per entry" << suffix << ": Map " << treeBytes / size
+                                    << ", FlatMap " << flatBytes / size);
+        CHECK(flatBytes < treeBytes);
+    }
+}
@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/frozen_map.h"
+#include "ara/core/map.h"
+#include "ara/core/unordered_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+using CodeType = ara::core::ErrorDomain::CodeType;
+
+constexpr std::size_t kLookups = 1 << 16;
+
+/**
+ * @brief The switch of CoreErrorDomain::Message, inlined into the benchmark.
+ */
+const char* SwitchMessage(CodeType code) noexcept
+{
+    switch (static_cast<ara::core::CoreErrc>(code))
+    {
+    case ara::core::CoreErrc::kInvalidArgument:
+        return "an invalid argument was passed to a function";
+    case ara::core::CoreErrc::kInvalidMetaModelShortname:
+        return "given string is not a valid model element shortname";
+    case ara::core::CoreErrc::kInvalidMetaModelPath:
+        return "missing or invalid path to model element";
+    default:
+        return "Invalid code value";
+    }
+}
+
+constexpr auto kMessages = ara::core::MakeFrozenMap<CodeType, const char*>(
+  {{22, "an invalid argument was passed to a function"},
+   {137, "given string is not a valid model element shortname"},
+   {138, "missing or invalid path to model element"}});
+
+constexpr std::size_t kSignals = 256;
+
+constexpr std::array<std::pair<std::uint32_t, std::uint32_t>, kSignals>
+SignalTable()
+{
+    std::array<std::pair<std::uint32_t, std::uint32_t>, kSignals> items{};
+    for (std::uint32_t i = 0; i < kSignals; ++i)
+    { items[i] = {0x1000u + i * 0x9E37u, i}; }
+
+    return items;
+}
+
+constexpr ara::core::FrozenMap<std::uint32_t, std::uint32_t, kSignals>
+  kSignalMap{SignalTable()};
+
+template<class T>
+ara::core::Vector<T> Probes(std::initializer_list<T> values)
+{
+    ara::core::Vector<T>                       keys{values};
+    std::mt19937_64                            gen{3};
+    std::uniform_int_distribution<std::size_t> pick{0, keys.size() - 1};
+    ara::core::Vector<T>                       probes;
+    for (std::size_t i = 0; i < kLookups; ++i)
+    { probes.push_back(keys[pick(gen)]); }
+
+    return probes;
+}
+}  // namespace
+
+TEST_CASE("FrozenMap vs switch vs Map, error messages",
+          "[!benchmark][FrozenMap]")
+{
+    auto const probes = Probes<CodeType>({22, 137, 138, 0});
+
+    ara::core::Map<CodeType, const char*> map;
+    for (const auto& [code, message] : kMessages) { map[code] = message; }
+
+    BENCHMARK("switch")
+    {
+        std::size_t sum = 0;
+        for (auto code : probes)
+        { sum += reinterpret_cast<std::uintptr_t>(SwitchMessage(code)); }
+        return sum;
+    };
+
+    BENCHMARK("FrozenMap")
+    {
+        std::size_t sum = 0;
+        for (auto code : probes)
+        {
+            auto const it = kMessages.find(code);
+            sum += reinterpret_cast<std::uintptr_t>(
+              it == kMessages.end() ? "Invalid code value" : it->second);
+        }
+        return sum;
+    };
+
+    BENCHMARK("Map")
+    {
+        std::size_t sum = 0;
+        for (auto code : probes)
+        {
+            auto const it = map.find(code);
+            sum += reinterpret_cast<std::uintptr_t>(
+              it == map.end() ? "Invalid code value" : it->second);
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("FrozenMap vs Map vs UnorderedMap, signal table",
+          "[!benchmark][FrozenMap]")
+{
+    ara::core::Map<std::uint32_t, std::uint32_t>          map;
+    ara::core::UnorderedMap<std::uint32_t, std::uint32_t> hashMap;
+    ara::core::Vector<std::uint32_t>                      probes;
+    std::mt19937_64                                       gen{5};
+    std::uniform_int_distribution<std::size_t>            pick{0, kSignals - 1};
+    for (const auto& [id, handler] : kSignalMap)
+    {
+        map.emplace(id, handler);
+        hashMap.emplace(id, handler);
+    }
+    for (std::size_t i = 0; i < kLookups; ++i)
+    { probes.push_back(kSignalMap.begin()[pick(gen)].first); }
+
+    BENCHMARK("FrozenMap::find")
+    {
+        std::uint32_t sum = 0;
+        for (auto id : probes) { sum += kSignalMap.find(id)->second; }
+        return sum;
+    };
+
+    BENCHMARK("Map::find")
+    {
+        std::uint32_t sum = 0;
+        for (auto id : probes) { sum += map.find(id)->second; }
+        return sum;
+    };
+
+    BENCHMARK("UnorderedMap::find")
+    {
+        std::uint32_t sum = 0;
+        for (auto id : probes) { sum += hashMap.find(id)->second; }
+        return sum;
+    };
+}
@@ -0,0 +1,210 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+
+#include "ara/core/interval_map.h"
+#include "ara/core/map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::uint64_t kPage     = 4096;
+constexpr std::size_t   kMappings = 1 << 14;
+constexpr std::size_t   kUpdates  = 1 << 16;
+constexpr std::size_t   kLookups  = 1 << 20;
+
+/**
+ * @brief Protection of a range of pages, like the flags of a memory mapping.
+ */
+enum class Protection : std::uint8_t
+{
+    kRead,
+    kReadWrite,
+    kReadExecute
+};
+
+/**
+ * @brief Change to the address space of a process: a mapping or a change of
+ * protection of pages with the given protection, or an unmapping.
+ */
+struct Update
+{
+    std::uint64_t lower;
+    std::uint64_t upper;
+    Protection    protection;
+    bool          unmap;
+};
+
+/**
+ * @brief Updates in the style of mmap(), mprotect() and munmap(): mappings of
+ * 1 to 256 pages at random page-aligned addresses of a 48-bit address space,
+ * then protection changes and unmappings of parts of them. Most protection
+ * changes restore the protection the pages had, as in guard pages and JIT
+ * code, so neighbouring segments often coalesce again.
+ */
+ara::core::Vector<Update> MemoryMapTrace(std::uint64_t seed)
+{
+    std::mt19937_64                              gen{seed};
+    std::uniform_int_distribution<std::uint64_t> page{0, (1ull << 36) - 1};
+    std::uniform_int_distribution<std::uint64_t> pages{1, 256};
+    std::uniform_int_distribution<int>           action{0, 9};
+
+    ara::core::Vector<Update> trace;
+    ara::core::Vector<Update> mappings;
+    for (std::size_t i = 0; i < kMappings; ++i)
+    {
+        auto const lower = page(gen) * kPage;
+        mappings.push_back(
+          {lower, lower + pages(gen) * kPage, Protection::kReadWrite, false});
+        trace.push_back(mappings.back());
+    }
+
+    std::uniform_int_distribution<std::size_t> mapping{0, kMappings - 1};
+    for (std::size_t i = 0; i < kUpdates; ++i)
+    {
+        auto const& target = mappings[mapping(gen)];
+        auto const  span   = (target.upper - target.lower) / kPage;
+        std::uniform_int_distribution<std::uint64_t> offset{0, span - 1};
+
+        auto const    lower = target.lower + offset(gen) * kPage;
+        std::uint64_t upper = lower + (pages(gen) / 16 + 1) * kPage;
+        if (upper > target.upper)
+        { upper = target.upper; }
+
+        switch (action(gen))
+        {
+        case 0: trace.push_back({lower, upper, {}, true}); break;
+        case 1:
+        case 2:
+        case 3:
+            trace.push_back({lower, upper, Protection::kRead, false});
+            break;
+        case 4:
+            trace.push_back({lower, upper, Protection::kReadExecute, false});
+            break;
+        default:
+            trace.push_back({lower, upper, Protection::kReadWrite, false});
+            break;
+        }
+    }
+
+    return trace;
+}
+
+/**
+ * @brief Addresses to look up, within the mappings most of the time.
+ */
+ara::core::Vector<std::uint64_t>
+Lookups(const ara::core::Vector<Update>& trace, std::uint64_t seed)
+{
+    std::mt19937_64                            gen{seed};
+    std::uniform_int_distribution<std::size_t> mapping{0, kMappings - 1};
+
+    ara::core::Vector<std::uint64_t> addresses(kLookups);
+    for (auto& address : addresses)
+    {
+        auto const& target = trace[mapping(gen)];
+        std::uniform_int_distribution<std::uint64_t> offset{
+          0, target.upper - target.lower + kPage};
+        address = target.lower + offset(gen);
+    }
+
+    return addresses;
+}
+
+/**
+ * @brief Address space as it is written by hand: a Map from the address of
+ * every mapped page to its protection.
+ */
+class PageMap
+{
+ public:
+    void apply(const Update& update)
+    {
+        for (auto page = update.lower; page < update.upper; page += kPage)
+        {
+            if (update.unmap)
+            { pages_.erase(page); }
+            else
+            { pages_.insert_or_assign(page, update.protection); }
+        }
+    }
+
+    const Protection* find(std::uint64_t address) const
+    {
+        auto const it = pages_.find(address / kPage * kPage);
+        return it == pages_.end() ? nullptr : &it->second;
+    }
+
+    std::size_t size() const noexcept { return pages_.size(); }
+
+ private:
+    ara::core::Map<std::uint64_t, Protection> pages_;
+};
+
+using AddressSpace = ara::core::IntervalMap<std::uint64_t, Protection>;
+
+void Apply(AddressSpace& space, const Update& update)
+{
+    if (update.unmap)
+    { space.erase(update.lower, update.upper); }
+    else
+    { space.assign(update.lower, update.upper, update.protection); }
+}
+}  // namespace
+
+TEST_CASE("IntervalMap vs Map of pages, memory map trace",
+          "[!benchmark][IntervalMap]")
+{
+    auto const trace     = MemoryMapTrace(61);
+    auto const addresses = Lookups(trace, 67);
+
+    AddressSpace space;
+    PageMap      pages;
+    for (const auto& update : trace)
+    {
+        Apply(space, update);
+        pages.apply(update);
+    }
+
+    std::size_t divergence = 0;
+    for (auto address : addresses)
+    {
+        auto const  it    = space.find(address);
+        auto const* other = pages.find(address);
+        divergence += (it == space.end()) != (other == nullptr);
+        divergence += other != nullptr && it != space.end()
+                      && it->value != *other;
+    }
+    CHECK(divergence == 0);
+    WARN("segments " << space.size() << ", pages " << pages.size());
+
+    BENCHMARK("Map of pages, apply trace")
+    {
+        PageMap map;
+        for (const auto& update : trace) { map.apply(update); }
+        return map.size();
+    };
+
+    BENCHMARK("IntervalMap, apply trace")
+    {
+        AddressSpace map;
+        for (const auto& update : trace) { Apply(map, update); }
+        return map.size();
+    };
+
+    BENCHMARK("Map of pages, lookups")
+    {
+        std::size_t mapped = 0;
+        for (auto address : addresses)
+        { mapped += pages.find(address) != nullptr; }
+        return mapped;
+    };
+
+    BENCHMARK("IntervalMap, lookups")
+    {
+        std::size_t mapped = 0;
+        for (auto address : addresses) { mapped += space.contains(address); }
+        return mapped;
+    };
+}
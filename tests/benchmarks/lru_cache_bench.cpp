@@ -0,0 +1,193 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+
+#include "ara/core/lru_cache.h"
+#include "ara/core/map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kKeys    = 1 << 20;
+constexpr std::size_t kLookups = 1 << 20;
+
+/**
+ * @brief Keys drawn from a Zipfian distribution with exponent 0.99 over
+ * kKeys keys, the popularity of a key falling with its rank. Ranks are
+ * scattered over the key space so that popular keys are not neighbours.
+ */
+ara::core::Vector<std::uint64_t> ZipfianTrace(std::uint64_t seed)
+{
+    ara::core::Vector<double> cdf(kKeys);
+    double                    sum = 0;
+    for (std::size_t rank = 0; rank < kKeys; ++rank)
+    {
+        sum += 1.0 / std::pow(static_cast<double>(rank + 1), 0.99);
+        cdf[rank] = sum;
+    }
+
+    std::mt19937_64                        gen{seed};
+    std::uniform_real_distribution<double> uniform{0.0, sum};
+    ara::core::Vector<std::uint64_t>       trace(kLookups);
+    for (auto& key : trace)
+    {
+        auto const rank = static_cast<std::uint64_t>(
+          std::lower_bound(cdf.begin(), cdf.end(), uniform(gen)) - cdf.begin());
+        key = rank * 0x9E3779B97F4A7C15ull;
+    }
+
+    return trace;
+}
+
+/**
+ * @brief LRU cache as it is written by hand: a Map from keys to the nodes of
+ * a list in recency order. Every miss allocates a map node and a list node.
+ */
+class ListLru
+{
+ public:
+    explicit ListLru(std::size_t capacity) : capacity_(capacity) {}
+
+    const std::uint64_t* find(std::uint64_t key)
+    {
+        auto const it = index_.find(key);
+        if (it == index_.end())
+        { return nullptr; }
+
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void try_emplace(std::uint64_t key, std::uint64_t value)
+    {
+        if (order_.size() == capacity_)
+        {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(key, value);
+        index_.try_emplace(key, order_.begin());
+    }
+
+ private:
+    using Order = std::list<std::pair<std::uint64_t, std::uint64_t>>;
+
+    std::size_t                                     capacity_;
+    Order                                           order_;
+    ara::core::Map<std::uint64_t, Order::iterator> index_;
+};
+
+/**
+ * @brief Replays trace against cache, inserting every missed key, and
+ * returns the number of hits.
+ */
+template<class Cache> std::uint64_t
+Replay(Cache& cache, const ara::core::Vector<std::uint64_t>& trace)
+{
+    std::uint64_t hits = 0;
+    for (auto key : trace)
+    {
+        if (cache.find(key) != nullptr)
+        { ++hits; }
+        else
+        { cache.try_emplace(key, key); }
+    }
+
+    return hits;
+}
+}  // namespace
+
+TEST_CASE("LruCache vs SieveCache vs Map plus list, Zipfian trace",
+          "[!benchmark][LruCache]")
+{
+    auto const trace = ZipfianTrace(53);
+
+    for (std::size_t capacity : {kKeys / 100, kKeys / 10})
+    {
+        ListLru                                             list(capacity);
+        ara::core::LruCache<std::uint64_t, std::uint64_t>   lru(capacity);
+        ara::core::SieveCache<std::uint64_t, std::uint64_t> sieve(capacity);
+
+        auto const suffix    = ", capacity " + std::to_string(capacity);
+        auto const listHits  = Replay(list, trace);
+        auto const lruHits   = Replay(lru, trace);
+        auto const sieveHits = Replay(sieve, trace);
+        CHECK(lruHits == listHits);
+        WARN("hits per 1000 lookups" << suffix << ": LRU "
+                                     << lruHits * 1000 / kLookups << ", SIEVE "
+                                     << sieveHits * 1000 / kLookups);
+
+        BENCHMARK("Map plus std::list" + suffix)
+        {
+            return Replay(list, trace);
+        };
+
+        BENCHMARK("LruCache" + suffix) { return Replay(lru, trace); };
+
+        BENCHMARK("SieveCache" + suffix) { return Replay(sieve, trace); };
+    }
+}
+
+TEST_CASE("ShardedCache vs LruCache behind a mutex, Zipfian trace",
+          "[!benchmark][LruCache]")
+{
+    using Cache = ara::core::LruCache<std::uint64_t, std::uint64_t>;
+
+    auto const threads =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    ara::core::Vector<ara::core::Vector<std::uint64_t>> traces;
+    for (std::size_t t = 0; t < threads; ++t)
+    { traces.push_back(ZipfianTrace(t)); }
+
+    std::size_t const perThread = kLookups / threads;
+    auto const        run       = [&traces, perThread](auto lookup) {
+        std::atomic<std::uint64_t>     hits{0};
+        ara::core::Vector<std::thread> workers;
+        for (const auto& trace : traces)
+        {
+            workers.emplace_back([&hits, &trace, &lookup, perThread] {
+                std::uint64_t local = 0;
+                for (std::size_t i = 0; i < perThread; ++i)
+                { local += lookup(trace[i]); }
+                hits += local;
+            });
+        }
+        for (auto& worker : workers) { worker.join(); }
+
+        return hits.load();
+    };
+
+    std::mutex                     mutex;
+    Cache                          locked(kKeys / 10);
+    ara::core::ShardedCache<Cache> sharded(kKeys / 10);
+
+    std::string const suffix = ", " + std::to_string(threads) + " threads";
+
+    BENCHMARK("LruCache behind a mutex" + suffix)
+    {
+        return run([&](std::uint64_t key) {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (locked.find(key) != nullptr)
+            { return std::uint64_t{1}; }
+            locked.try_emplace(key, key);
+            return std::uint64_t{0};
+        });
+    };
+
+    BENCHMARK("ShardedCache" + suffix)
+    {
+        return run([&](std::uint64_t key) {
+            if (sharded.find(key))
+            { return std::uint64_t{1}; }
+            sharded.try_emplace(key, key);
+            return std::uint64_t{0};
+        });
+    };
+}
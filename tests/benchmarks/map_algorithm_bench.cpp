@@ -0,0 +1,148 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+
+#include "ara/core/map.h"
+#include "ara/core/map_algorithm.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kEntries = 1 << 20;
+
+using State = ara::core::Map<std::uint64_t, std::uint64_t>;
+using Diff  = ara::core::MapDiff<std::uint64_t, std::uint64_t>;
+
+/**
+ * @brief Actual and desired state of a reconciliation loop: the desired
+ * state adds, removes and changes about 1% of the entries each.
+ */
+std::pair<State, State> States()
+{
+    std::mt19937_64 gen{37};
+    State           actual;
+    while (actual.size() < kEntries) { actual.try_emplace(gen() >> 1, gen()); }
+
+    State                                   desired;
+    std::uniform_int_distribution<unsigned> percent{0, 99};
+    for (const auto& [key, value] : actual)
+    {
+        switch (percent(gen))
+        {
+        case 0: break;
+        case 1: desired.emplace_hint(desired.end(), key, value + 1); break;
+        case 2:
+            desired.emplace_hint(desired.end(), key, value);
+            desired.emplace(key + 1, value);
+            break;
+        default: desired.emplace_hint(desired.end(), key, value); break;
+        }
+    }
+
+    return {std::move(actual), std::move(desired)};
+}
+
+/**
+ * @brief diff() the way it is written without merge-join: every key of
+ * each map is looked up in the other.
+ */
+Diff FindDiff(const State& from, const State& to)
+{
+    Diff result;
+    for (const auto& [key, value] : to)
+    {
+        auto const it = from.find(key);
+        if (it == from.end())
+        { result.added.emplace_back(key, value); }
+        else if (it->second != value)
+        { result.changed.emplace_back(key, value); }
+    }
+    for (const auto& element : from)
+    {
+        if (to.count(element.first) == 0)
+        { result.removed.push_back(element.first); }
+    }
+
+    return result;
+}
+
+template<class Apply>
+void BenchmarkApply(Catch::Benchmark::Chronometer meter,
+                    const State&                  state,
+                    Apply                         apply)
+{
+    ara::core::Vector<State> states(static_cast<std::size_t>(meter.runs()),
+                                    state);
+    meter.measure([&](int run) {
+        auto& target = states[static_cast<std::size_t>(run)];
+        apply(target);
+        return target.size();
+    });
+}
+}  // namespace
+
+TEST_CASE("merge-join vs find, 1M entries", "[!benchmark][MapAlgorithm]")
+{
+    auto const [actual, desired] = States();
+    auto const changes           = ara::core::diff(actual, desired);
+    auto const expected          = FindDiff(actual, desired);
+    CHECK(changes.size() == expected.size());
+    CHECK(changes.changed == expected.changed);
+
+    BENCHMARK("diff by find") { return FindDiff(actual, desired).size(); };
+
+    BENCHMARK("diff") { return ara::core::diff(actual, desired).size(); };
+
+    BENCHMARK("intersect by find")
+    {
+        State result;
+        for (const auto& element : actual)
+        {
+            if (desired.count(element.first) != 0)
+            { result.emplace_hint(result.end(), element); }
+        }
+        return result.size();
+    };
+
+    BENCHMARK("intersect")
+    {
+        return ara::core::intersect(actual, desired).size();
+    };
+
+    BENCHMARK("union by find")
+    {
+        State result = actual;
+        for (const auto& [key, value] : desired)
+        {
+            auto const [it, inserted] = result.try_emplace(key, value);
+            if (! inserted)
+            { it->second += value; }
+        }
+        return result.size();
+    };
+
+    BENCHMARK("union_with")
+    {
+        return ara::core::union_with(actual, desired, std::plus<>()).size();
+    };
+
+    BENCHMARK_ADVANCED("apply by key")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        BenchmarkApply(meter, actual, [&changes](State& state) {
+            for (const auto& [key, value] : changes.added)
+            { state.insert_or_assign(key, value); }
+            for (const auto& [key, value] : changes.changed)
+            { state.insert_or_assign(key, value); }
+            for (auto key : changes.removed) { state.erase(key); }
+        });
+    };
+
+    BENCHMARK_ADVANCED("apply_diff")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        BenchmarkApply(meter, actual, [&changes](State& state) {
+            ara::core::apply_diff(state, changes);
+        });
+    };
+}
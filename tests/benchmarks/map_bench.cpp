@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "ara/core/array.h"
+#include "ara/core/map.h"
+#include "ara/core/parallel.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kEntries = 1 << 20;
+constexpr std::size_t kShards  = 16;
+
+using Table  = ara::core::Map<std::uint64_t, std::string>;
+using Shards = ara::core::Array<Table, kShards>;
+
+Table RandomTable()
+{
+    std::mt19937_64 gen{7};
+    Table           table;
+    while (table.size() < kEntries)
+    { table.try_emplace(gen(), "a value beyond the small buffer"); }
+
+    return table;
+}
+
+template<class Partition>
+void BenchmarkPartition(Catch::Benchmark::Chronometer meter,
+                        const Table&                  table,
+                        Partition                     partition)
+{
+    ara::core::Vector<Table> sources(static_cast<std::size_t>(meter.runs()),
+                                     table);
+    meter.measure([&](int run) {
+        Shards shards;
+        partition(sources[static_cast<std::size_t>(run)], shards);
+        return shards[0].size();
+    });
+}
+}  // namespace
+
+TEST_CASE("Map re-partitioning into shards", "[!benchmark][Map]")
+{
+    auto const table = RandomTable();
+
+    BENCHMARK_ADVANCED("copy insert + erase")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        BenchmarkPartition(meter, table, [](Table& source, Shards& shards) {
+            for (auto it = source.begin(); it != source.end();)
+            {
+                shards[it->first % kShards].insert(*it);
+                it = source.erase(it);
+            }
+        });
+    };
+
+    BENCHMARK_ADVANCED("extract + insert node")
+    (Catch::Benchmark::Chronometer meter)
+    {
+        BenchmarkPartition(meter, table, [](Table& source, Shards& shards) {
+            while (! source.empty())
+            {
+                auto  first = source.begin();
+                auto& shard = shards[first->first % kShards];
+                shard.insert(shard.end(), source.extract(first));
+            }
+        });
+    };
+}
+
+TEST_CASE("Map construction from sorted input", "[!benchmark][Map]")
+{
+    using Entries = ara::core::Vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+    Entries sorted;
+    sorted.reserve(kEntries);
+    for (std::uint64_t i = 0; i < kEntries; ++i)
+    { sorted.emplace_back(3 * i, i); }
+
+    BENCHMARK("insert one by one")
+    {
+        ara::core::Map<std::uint64_t, std::uint64_t> map;
+        for (const auto& entry : sorted) { map.insert(entry); }
+        return map.size();
+    };
+
+    BENCHMARK("range constructor")
+    {
+        return ara::core::Map<std::uint64_t, std::uint64_t>(sorted.begin(),
+                                                            sorted.end())
+          .size();
+    };
+
+    BENCHMARK("sorted_unique constructor")
+    {
+        return ara::core::Map<std::uint64_t, std::uint64_t>(
+                 ara::core::sorted_unique, sorted.begin(), sorted.end())
+          .size();
+    };
+
+    BENCHMARK("parallel::insert sorted_unique")
+    {
+        ara::core::Map<std::uint64_t, std::uint64_t> map;
+        ara::core::parallel::insert(map, ara::core::sorted_unique, sorted);
+        return map.size();
+    };
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <utility>
+
+#include "ara/core/map.h"
+#include "ara/core/map_image.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kElements = 1 << 20;
+constexpr std::size_t kLookups  = 1 << 16;
+
+/**
+ * @brief Row of a static table, as loaded at startup.
+ */
+struct Row
+{
+    std::uint32_t id;
+    std::uint32_t flags;
+    double        weight;
+};
+
+using Table = ara::core::Map<std::uint64_t, Row>;
+using Rows  = ara::core::Vector<std::pair<std::uint64_t, Row>>;
+
+/**
+ * @brief Source data of the table in arbitrary order, as parsed from a
+ * configuration file.
+ */
+Rows SourceRows()
+{
+    std::mt19937_64 gen{73};
+    Rows            rows;
+    for (std::uint32_t i = 0; i < kElements; ++i)
+    { rows.push_back({gen(), Row{i, i % 7, 0.5 * i}}); }
+
+    return rows;
+}
+
+Table Build(const Rows& rows)
+{
+    Table table;
+    for (const auto& [key, row] : rows) { table.try_emplace(key, row); }
+
+    return table;
+}
+
+/**
+ * @brief Looks up every kElements / kLookups-th key of rows in table.
+ */
+template<class Map> std::uint64_t Lookup(const Map& table, const Rows& rows)
+{
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < kElements; i += kElements / kLookups)
+    { sum += table.find(rows[i].first)->second.id; }
+
+    return sum;
+}
+}  // namespace
+
+TEST_CASE("MapImage startup vs rebuilding a Map", "[!benchmark][MapImage]")
+{
+    using View = ara::core::MapImage<std::uint64_t, Row>;
+
+    auto const rows  = SourceRows();
+    auto const table = Build(rows);
+    auto const path =
+      std::filesystem::temp_directory_path() / "ara_map_image_bench.img";
+    ara::core::SaveMapImage(path, ara::core::MakeMapImage(table));
+
+    {
+        ara::core::MappedFile const file(path);
+        View const                  view(file.bytes());
+        CHECK(Lookup(view, rows) == Lookup(table, rows));
+        WARN("image bytes " << file.bytes().size());
+    }
+
+    BENCHMARK("Map, rebuild from source rows")
+    {
+        return Build(rows).size();
+    };
+
+    BENCHMARK("MapImage, mmap and verify checksum")
+    {
+        ara::core::MappedFile const file(path);
+        return View(file.bytes()).size();
+    };
+
+    BENCHMARK("MapImage, mmap and verify header")
+    {
+        ara::core::MappedFile const file(path);
+        return View(file.bytes(), ara::core::ImageCheck::kHeader).size();
+    };
+
+    BENCHMARK("MapImage, mmap, verify header and first lookups")
+    {
+        ara::core::MappedFile const file(path);
+        return Lookup(View(file.bytes(), ara::core::ImageCheck::kHeader), rows);
+    };
+
+    BENCHMARK("Map, lookups") { return Lookup(table, rows); };
+
+    ara::core::MappedFile const file(path);
+    View const                  view(file.bytes());
+    BENCHMARK("MapImage, lookups") { return Lookup(view, rows); };
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <random>
+
+#include "ara/core/map.h"
+#include "ara/core/order_statistic_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kElements = 1 << 20;
+
+/**
+ * @brief kElements random latencies, in microseconds, with unique keys.
+ */
+ara::core::Vector<std::uint64_t> Latencies()
+{
+    std::mt19937_64                              gen{101};
+    std::uniform_int_distribution<std::uint64_t> latency(0, 1ULL << 40);
+    ara::core::Vector<std::uint64_t>             latencies;
+    for (std::size_t i = 0; i < kElements; ++i)
+    { latencies.push_back(latency(gen)); }
+
+    return latencies;
+}
+}  // namespace
+
+TEST_CASE("OrderStatisticMap vs Map, percentiles of 1M entries",
+          "[!benchmark][OrderStatisticMap]")
+{
+    auto const latencies = Latencies();
+
+    ara::core::Map<std::uint64_t, std::uint32_t>               map;
+    ara::core::OrderStatisticMap<std::uint64_t, std::uint32_t> tree;
+    for (auto const latency : latencies)
+    {
+        map.try_emplace(latency, 0);
+        tree.try_emplace(latency, 0);
+    }
+    REQUIRE(map.size() == tree.size());
+
+    // p50, p90, p99 and p99.9.
+    std::size_t const ranks[] = {map.size() / 2,
+                                 map.size() * 9 / 10,
+                                 map.size() * 99 / 100,
+                                 map.size() * 999 / 1000};
+
+    BENCHMARK("Map, std::advance to 4 percentiles")
+    {
+        std::uint64_t sum = 0;
+        for (auto const rank : ranks)
+        {
+            auto it = map.begin();
+            std::advance(it, static_cast<std::ptrdiff_t>(rank));
+            sum += it->first;
+        }
+        return sum;
+    };
+
+    BENCHMARK("OrderStatisticMap, select 4 percentiles")
+    {
+        std::uint64_t sum = 0;
+        for (auto const rank : ranks) { sum += tree.select(rank)->first; }
+        return sum;
+    };
+
+    BENCHMARK("Map, std::distance for the rank of 4 keys")
+    {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            sum += static_cast<std::size_t>(std::distance(
+              map.begin(), map.lower_bound(latencies[i])));
+        }
+        return sum;
+    };
+
+    BENCHMARK("OrderStatisticMap, rank of 4 keys")
+    {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < 4; ++i) { sum += tree.rank(latencies[i]); }
+        return sum;
+    };
+
+    BENCHMARK("OrderStatisticMap, 1000 range counts")
+    {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i + 1 < 1001; ++i)
+        { sum += tree.count_range(latencies[i], latencies[i + 1]); }
+        return sum;
+    };
+}
+
+TEST_CASE("OrderStatisticMap vs Map, insert and erase of 1M entries",
+          "[!benchmark][OrderStatisticMap]")
+{
+    auto const latencies = Latencies();
+
+    BENCHMARK("Map, insert and erase random keys")
+    {
+        ara::core::Map<std::uint64_t, std::uint32_t> map;
+        for (auto const latency : latencies) { map.try_emplace(latency, 0); }
+        for (auto const latency : latencies) { map.erase(latency); }
+        return map.size();
+    };
+
+    BENCHMARK("OrderStatisticMap, insert and erase random keys")
+    {
+        ara::core::OrderStatisticMap<std::uint64_t, std::uint32_t> tree;
+        for (auto const latency : latencies) { tree.try_emplace(latency, 0); }
+        for (auto const latency : latencies) { tree.erase(latency); }
+        return tree.size();
+    };
+
+    BENCHMARK("Map, insert ascending keys")
+    {
+        ara::core::Map<std::uint64_t, std::uint32_t> map;
+        for (std::uint64_t i = 0; i < kElements; ++i)
+        { map.try_emplace(i, 0); }
+        return map.size();
+    };
+
+    BENCHMARK("OrderStatisticMap, insert ascending keys")
+    {
+        ara::core::OrderStatisticMap<std::uint64_t, std::uint32_t> tree;
+        for (std::uint64_t i = 0; i < kElements; ++i)
+        { tree.try_emplace(i, 0); }
+        return tree.size();
+    };
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+
+#include "ara/core/parallel.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kElements = 1 << 22;
+
+ara::core::Vector<std::size_t> ThreadCounts()
+{
+    ara::core::Vector<std::size_t> counts;
+    auto const max = ara::core::ThreadPool::DefaultConcurrency();
+    for (std::size_t n = 1; n < max; n *= 2) { counts.push_back(n); }
+    counts.push_back(max);
+
+    return counts;
+}
+
+ara::core::Vector<double> RandomVector(std::size_t size)
+{
+    std::mt19937                           gen{7};
+    std::uniform_real_distribution<double> dist{0.0, 1.0};
+    ara::core::Vector<double>              vector;
+    for (std::size_t i = 0; i < size; ++i) { vector.push_back(dist(gen)); }
+
+    return vector;
+}
+
+/**
+ * @brief Measures sort on a fresh copy of input in every run, so that no run
+ * sorts data an earlier run has sorted already.
+ */
+template<class Sort>
+void BenchmarkSort(Catch::Benchmark::Chronometer    meter,
+                   const ara::core::Vector<double>& input,
+                   Sort                             sort)
+{
+    ara::core::Vector<ara::core::Vector<double>> copies(
+      static_cast<std::size_t>(meter.runs()), input);
+    meter.measure([&](int run) {
+        auto& data = copies[static_cast<std::size_t>(run)];
+        sort(data);
+        return data.front();
+    });
+}
+}  // namespace
+
+TEST_CASE("parallel scaling", "[!benchmark][parallel]")
+{
+    auto const input = RandomVector(kElements);
+
+    for (auto threads : ThreadCounts())
+    {
+        ara::core::ThreadPool pool{threads};
+        std::string const     suffix = " / threads " + std::to_string(threads);
+
+        BENCHMARK_ADVANCED("sort" + suffix)
+        (Catch::Benchmark::Chronometer meter)
+        {
+            BenchmarkSort(meter, input, [&pool](auto& data) {
+                ara::core::parallel::sort(pool, data);
+            });
+        };
+
+        BENCHMARK_ADVANCED("stable_sort" + suffix)
+        (Catch::Benchmark::Chronometer meter)
+        {
+            BenchmarkSort(meter, input, [&pool](auto& data) {
+                ara::core::parallel::stable_sort(pool, data);
+            });
+        };
+
+        ara::core::Vector<double> output(input.size());
+        BENCHMARK("transform" + suffix)
+        {
+            return ara::core::parallel::transform(
+              pool, input, output.begin(), [](double x) { return x * x; });
+        };
+
+        BENCHMARK("reduce" + suffix)
+        {
+            return ara::core::parallel::reduce(pool, input, 0.0);
+        };
+
+        BENCHMARK("for_each" + suffix)
+        {
+            ara::core::parallel::for_each(
+              pool, output, [](double& x) { x = x * 0.5 + 1.0; });
+        };
+
+        BENCHMARK("inclusive_scan" + suffix)
+        {
+            return ara::core::parallel::inclusive_scan(
+              pool, input, output.begin());
+        };
+    }
+}
@@ -0,0 +1,186 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/radix_map.h"
+#include "ara/core/unordered_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kLookups = 1 << 16;
+
+/**
+ * @brief Paths of the elements of a meta-model as an application manifest
+ * lists them: packages, software components, their ports and the data
+ * elements of the ports, each path including the paths of its ancestors.
+ */
+ara::core::Vector<std::string> MetaModelPaths()
+{
+    char const* const domains[] = {
+      "Body", "Chassis", "Powertrain", "Infotainment", "Adas", "Diagnostics"};
+
+    std::mt19937_64                            gen{23};
+    std::uniform_int_distribution<std::size_t> ports{4, 24};
+    std::uniform_int_distribution<std::size_t> elements{1, 8};
+    ara::core::Vector<std::string>             paths;
+    for (const char* domain : domains)
+    {
+        std::string const package = std::string("/Vehicle/") + domain;
+        paths.push_back(package);
+        for (std::size_t swc = 0; swc < 64; ++swc)
+        {
+            std::string const component = package + "/SwComponentTypes/"
+                                          + domain + std::to_string(swc);
+            paths.push_back(component);
+            for (std::size_t port = ports(gen); port > 0; --port)
+            {
+                std::string const portPath =
+                  component + "/Ports/PPortPrototype" + std::to_string(port);
+                paths.push_back(portPath);
+                for (std::size_t data = elements(gen); data > 0; --data)
+                {
+                    paths.push_back(portPath + "/VariableDataPrototype"
+                                    + std::to_string(data));
+                }
+            }
+        }
+    }
+
+    return paths;
+}
+
+ara::core::Vector<std::string>
+Probes(const ara::core::Vector<std::string>& paths, const char* suffix)
+{
+    std::mt19937_64                            gen{29};
+    std::uniform_int_distribution<std::size_t> pick{0, paths.size() - 1};
+    ara::core::Vector<std::string>             probes;
+    for (std::size_t i = 0; i < kLookups; ++i)
+    { probes.push_back(paths[pick(gen)] + suffix); }
+
+    return probes;
+}
+
+template<class Container>
+Container Build(const ara::core::Vector<std::string>& paths)
+{
+    Container     map;
+    std::uint32_t id = 0;
+    for (const auto& path : paths) { map.try_emplace(path, id++); }
+
+    return map;
+}
+
+/**
+ * @brief The element whose key is the longest byte prefix of key, found by
+ * looking up key with one more trailing byte removed each time. This is
+ * what RadixMap::longest_prefix_match() returns.
+ */
+template<class Container>
+std::uint64_t LongestPrefix(const Container& map, std::string key)
+{
+    for (; ! key.empty(); key.pop_back())
+    {
+        auto const it = map.find(key);
+        if (it != map.end())
+        { return it->second; }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Average heap memory owned per element.
+ */
+template<class Container> std::size_t BytesPerElement(const Container& map)
+{
+    return ara::core::memory_footprint(map).bytes_reserved / map.size();
+}
+}  // namespace
+
+TEST_CASE("RadixMap vs Map vs UnorderedMap, meta-model paths",
+          "[!benchmark][RadixMap]")
+{
+    using Radix = ara::core::RadixMap<std::uint32_t>;
+    using Tree  = ara::core::Map<std::string, std::uint32_t>;
+    using Hash  = ara::core::UnorderedMap<std::string, std::uint32_t>;
+
+    auto const paths       = MetaModelPaths();
+    auto const probes      = Probes(paths, "");
+    auto const descendants = Probes(paths, "/Init/Value");
+
+    auto const radix = Build<Radix>(paths);
+    auto const tree  = Build<Tree>(paths);
+    auto const hash  = Build<Hash>(paths);
+
+    BENCHMARK("Map build") { return Build<Tree>(paths).size(); };
+
+    BENCHMARK("UnorderedMap build") { return Build<Hash>(paths).size(); };
+
+    BENCHMARK("RadixMap build") { return Build<Radix>(paths).size(); };
+
+    BENCHMARK("Map::find")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : probes) { sum += tree.find(path)->second; }
+        return sum;
+    };
+
+    BENCHMARK("UnorderedMap::find")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : probes) { sum += hash.find(path)->second; }
+        return sum;
+    };
+
+    BENCHMARK("RadixMap::find")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : probes)
+        {
+            auto const it = radix.find(path);
+            sum += it != radix.end() ? it.value() : 0;
+        }
+        return sum;
+    };
+
+    BENCHMARK("Map longest prefix")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : descendants)
+        { sum += LongestPrefix(tree, path); }
+        return sum;
+    };
+
+    BENCHMARK("UnorderedMap longest prefix")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : descendants)
+        { sum += LongestPrefix(hash, path); }
+        return sum;
+    };
+
+    BENCHMARK("RadixMap::longest_prefix_match")
+    {
+        std::uint64_t sum = 0;
+        for (const auto& path : descendants)
+        {
+            auto const it = radix.longest_prefix_match(path);
+            sum += it != radix.end() ? it.value() : 0;
+        }
+        return sum;
+    };
+
+    auto const radixBytes = BytesPerElement(radix);
+    auto const treeBytes  = BytesPerElement(tree);
+    auto const hashBytes  = BytesPerElement(hash);
+    WARN(paths.size() << " paths, heap bytes per element: Map " << treeBytes
+                      << ", UnorderedMap " << hashBytes << ", RadixMap "
+                      << radixBytes);
+    CHECK(radixBytes < treeBytes);
+    CHECK(radixBytes < hashBytes);
+}
@@ -0,0 +1,120 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+
+#include "ara/core/flat_set.h"
+#include "ara/core/map.h"
+#include "ara/core/set.h"
+#include "ara/core/set_algorithm.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kElements = 1 << 20;
+
+/**
+ * @brief kElements sorted unique keys, drawn from [0, range).
+ */
+template<class K> ara::core::Vector<K> SortedKeys(std::uint64_t seed, K range)
+{
+    std::mt19937_64                  gen{seed};
+    std::uniform_int_distribution<K> key(0, range - 1);
+    ara::core::Vector<K>             keys;
+    while (keys.size() < kElements)
+    {
+        for (std::size_t i = keys.size(); i < kElements; ++i)
+        { keys.push_back(key(gen)); }
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+
+    return keys;
+}
+
+/**
+ * @brief Intersection and union of two FlatSets, against the standard
+ * algorithms on the same keys. range sets the density, and with it how many
+ * keys are common and how long the runs from one side are.
+ */
+template<class K> void BenchmarkSetOperations(K range)
+{
+    using Set = ara::core::FlatSet<K>;
+
+    Set const lhs(ara::core::sorted_unique, SortedKeys<K>(83, range));
+    Set const rhs(ara::core::sorted_unique, SortedKeys<K>(89, range));
+
+    ara::core::Vector<K> out(2 * kElements);
+    CHECK(ara::core::intersect(lhs, rhs).size()
+          == static_cast<std::size_t>(
+            std::set_intersection(
+              lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), out.begin())
+            - out.begin()));
+    WARN("common keys " << ara::core::intersect(lhs, rhs).size());
+
+    BENCHMARK("std::set_intersection")
+    {
+        return std::set_intersection(
+                 lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), out.begin())
+               - out.begin();
+    };
+
+    BENCHMARK("SIMD intersect")
+    {
+        return ara::core::intersect(lhs, rhs).size();
+    };
+
+    BENCHMARK("std::set_union")
+    {
+        return std::set_union(
+                 lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), out.begin())
+               - out.begin();
+    };
+
+    BENCHMARK("SIMD unite") { return ara::core::unite(lhs, rhs).size(); };
+}
+}  // namespace
+
+TEST_CASE("FlatSet<uint32_t> intersect and unite, 1/2 common",
+          "[!benchmark][Set]")
+{
+    BenchmarkSetOperations<std::uint32_t>(2 * kElements);
+}
+
+TEST_CASE("FlatSet<uint32_t> intersect and unite, sparse",
+          "[!benchmark][Set]")
+{
+    BenchmarkSetOperations<std::uint32_t>(64 * kElements);
+}
+
+TEST_CASE("FlatSet<uint64_t> intersect and unite, sparse",
+          "[!benchmark][Set]")
+{
+    BenchmarkSetOperations<std::uint64_t>(64 * kElements);
+}
+
+TEST_CASE("Set vs Map with a dummy value", "[!benchmark][Set]")
+{
+    auto const keys = SortedKeys<std::uint64_t>(97, 4 * kElements);
+
+    BENCHMARK("Map<uint64_t, bool>, build from sorted keys")
+    {
+        ara::core::Map<std::uint64_t, bool> map;
+        for (auto const key : keys) { map.emplace_hint(map.end(), key, true); }
+        return map.size();
+    };
+
+    BENCHMARK("Set<uint64_t>, build from sorted keys")
+    {
+        return ara::core::Set<std::uint64_t>(
+                 ara::core::sorted_unique, keys.begin(), keys.end())
+          .size();
+    };
+
+    BENCHMARK("FlatSet<uint64_t>, adopt sorted keys")
+    {
+        return ara::core::FlatSet<std::uint64_t>(ara::core::sorted_unique, keys)
+          .size();
+    };
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/small_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kMaps    = 1 << 14;
+constexpr std::size_t kLookups = 1 << 16;
+
+/**
+ * @brief Map sizes as seen in practice: 80% of the maps hold fewer than 8
+ * entries, the rest up to 64.
+ */
+ara::core::Vector<std::size_t> RealisticSizes()
+{
+    std::mt19937_64                            gen{17};
+    std::bernoulli_distribution                small{0.8};
+    std::uniform_int_distribution<std::size_t> few{0, 7};
+    std::uniform_int_distribution<std::size_t> many{8, 64};
+    ara::core::Vector<std::size_t>             sizes;
+    for (std::size_t i = 0; i < kMaps; ++i)
+    { sizes.push_back(small(gen) ? few(gen) : many(gen)); }
+
+    return sizes;
+}
+
+template<class Container>
+ara::core::Vector<Container>
+Build(const ara::core::Vector<std::size_t>& sizes)
+{
+    ara::core::Vector<Container> maps(sizes.size());
+    for (std::size_t i = 0; i < sizes.size(); ++i)
+    {
+        for (std::uint32_t key = 0; key < sizes[i]; ++key)
+        { maps[i].emplace(key * 7 % 97, key); }
+    }
+
+    return maps;
+}
+
+/**
+ * @brief Random probes of the maps whose size satisfies the predicate, about
+ * half of them for present keys.
+ */
+template<class Predicate>
+ara::core::Vector<std::pair<std::size_t, std::uint32_t>>
+Probes(const ara::core::Vector<std::size_t>& sizes, Predicate predicate)
+{
+    ara::core::Vector<std::size_t> maps;
+    for (std::size_t i = 0; i < sizes.size(); ++i)
+    {
+        if (predicate(sizes[i]))
+        { maps.push_back(i); }
+    }
+
+    ara::core::Vector<std::pair<std::size_t, std::uint32_t>> probes;
+    std::mt19937_64                                           gen{19};
+    std::uniform_int_distribution<std::size_t>  pick{0, maps.size() - 1};
+    std::uniform_int_distribution<std::uint32_t> key{0, 96};
+    for (std::size_t i = 0; i < kLookups; ++i)
+    { probes.emplace_back(maps[pick(gen)], key(gen)); }
+
+    return probes;
+}
+
+template<class Container> std::uint64_t
+Lookup(const ara::core::Vector<Container>&                             maps,
+       const ara::core::Vector<std::pair<std::size_t, std::uint32_t>>& probes)
+{
+    std::uint64_t sum = 0;
+    for (auto [map, key] : probes)
+    {
+        auto const it = maps[map].find(key);
+        if (it != maps[map].end())
+        { sum += it->second; }
+    }
+
+    return sum;
+}
+
+/**
+ * @brief Average size of the map objects plus the heap memory they own.
+ */
+template<class Container>
+std::size_t BytesPerMap(const ara::core::Vector<Container>& maps)
+{
+    std::size_t bytes = 0;
+    for (const auto& map : maps)
+    { bytes += sizeof(map) + ara::core::memory_footprint(map).bytes_reserved; }
+
+    return bytes / maps.size();
+}
+}  // namespace
+
+TEST_CASE("SmallMap vs Map, realistic size distribution",
+          "[!benchmark][SmallMap]")
+{
+    using Small = ara::core::SmallMap<std::uint32_t, std::uint64_t>;
+    using Tree  = ara::core::Map<std::uint32_t, std::uint64_t>;
+
+    auto const sizes = RealisticSizes();
+    auto const all   = Probes(sizes, [](std::size_t) { return true; });
+    auto const few   = Probes(sizes, [](std::size_t n) { return n < 8; });
+    auto const many  = Probes(sizes, [](std::size_t n) { return n >= 8; });
+
+    auto const small = Build<Small>(sizes);
+    auto const tree  = Build<Tree>(sizes);
+
+    BENCHMARK("Map build") { return Build<Tree>(sizes).size(); };
+
+    BENCHMARK("SmallMap build") { return Build<Small>(sizes).size(); };
+
+    BENCHMARK("Map::find") { return Lookup(tree, all); };
+
+    BENCHMARK("SmallMap::find") { return Lookup(small, all); };
+
+    BENCHMARK("Map::find / below 8") { return Lookup(tree, few); };
+
+    BENCHMARK("SmallMap::find / below 8") { return Lookup(small, few); };
+
+    BENCHMARK("Map::find / 8 and more") { return Lookup(tree, many); };
+
+    BENCHMARK("SmallMap::find / 8 and more") { return Lookup(small, many); };
+
+    auto const smallBytes = BytesPerMap(small);
+    auto const treeBytes  = BytesPerMap(tree);
+    WARN("bytes per map, object and heap: Map " << treeBytes << ", SmallMap "
+                                                << smallBytes);
+    CHECK(smallBytes < treeBytes);
+}
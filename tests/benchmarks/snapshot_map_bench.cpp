@@ -0,0 +1,106 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+#include "ara/core/map.h"
+#include "ara/core/snapshot_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::uint64_t kKeys  = 1 << 10;
+constexpr std::size_t   kReads = 1 << 20;
+
+/**
+ * @brief Runs kReads lookups of random keys split over the given number of
+ * threads.
+ */
+template<class Read> std::uint64_t RunReaders(std::size_t threads, Read read)
+{
+    std::atomic<std::uint64_t>     total{0};
+    ara::core::Vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&, t] {
+            std::mt19937_64                              gen{t};
+            std::uniform_int_distribution<std::uint64_t> key{0, kKeys - 1};
+
+            std::uint64_t sum = 0;
+            for (std::size_t i = 0; i < kReads / threads; ++i)
+            { sum += read(key(gen)); }
+            total += sum;
+        });
+    }
+    for (auto& worker : workers) { worker.join(); }
+
+    return total;
+}
+}  // namespace
+
+TEST_CASE("SnapshotMap read throughput", "[!benchmark][SnapshotMap]")
+{
+    auto const hardware =
+      std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+    ara::core::SnapshotMap<std::uint64_t, std::uint64_t> snapshots;
+    ara::core::Map<std::uint64_t, std::uint64_t>         locked;
+    std::mutex                                           mutex;
+    std::shared_mutex                                    sharedMutex;
+    snapshots.update([](auto& draft) {
+        for (std::uint64_t key = 0; key < kKeys; ++key) { draft[key] = key; }
+    });
+    for (std::uint64_t key = 0; key < kKeys; ++key) { locked[key] = key; }
+
+    for (std::size_t threads = 1; threads <= hardware; threads *= 2)
+    {
+        std::string const suffix = " / threads " + std::to_string(threads);
+
+        BENCHMARK("SnapshotMap" + suffix)
+        {
+            return RunReaders(threads, [&](std::uint64_t key) {
+                return snapshots.snapshot()->at(key);
+            });
+        };
+
+        BENCHMARK("std::shared_mutex + Map" + suffix)
+        {
+            return RunReaders(threads, [&](std::uint64_t key) {
+                std::shared_lock<std::shared_mutex> lock{sharedMutex};
+                return locked.at(key);
+            });
+        };
+
+        BENCHMARK("std::mutex + Map" + suffix)
+        {
+            return RunReaders(threads, [&](std::uint64_t key) {
+                std::lock_guard<std::mutex> lock{mutex};
+                return locked.at(key);
+            });
+        };
+    }
+}
+
+TEST_CASE("SnapshotMap batched update", "[!benchmark][SnapshotMap]")
+{
+    ara::core::SnapshotMap<std::uint64_t, std::uint64_t> map;
+    map.update([](auto& draft) {
+        for (std::uint64_t key = 0; key < kKeys; ++key) { draft[key] = key; }
+    });
+
+    for (std::uint64_t batch : {1u, 16u, 256u})
+    {
+        BENCHMARK("SnapshotMap::update / batch " + std::to_string(batch))
+        {
+            return map.update([batch](auto& draft) {
+                for (std::uint64_t key = 0; key < batch; ++key)
+                { ++draft[key]; }
+            });
+        };
+    }
+
+    CHECK(map.reclaim() == 0);
+}
@@ -0,0 +1,112 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "ara/core/map.h"
+#include "ara/core/unordered_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+constexpr std::size_t kOperations = 1 << 16;
+
+ara::core::Vector<std::uint64_t> RandomKeys(std::size_t size, unsigned seed)
+{
+    std::mt19937_64                  gen{seed};
+    ara::core::Vector<std::uint64_t> keys;
+    for (std::size_t i = 0; i < size; ++i) { keys.push_back(gen()); }
+
+    return keys;
+}
+
+template<class Container>
+std::uint64_t Lookup(const Container&                        map,
+                     const ara::core::Vector<std::uint64_t>& probes)
+{
+    std::uint64_t found = 0;
+    for (auto key : probes) { found += map.count(key); }
+
+    return found;
+}
+
+/**
+ * Replaces existing keys by fresh ones and back again, one erase and one
+ * insertion per step, so the container ends up in its original state.
+ */
+template<class Container>
+std::size_t Churn(Container&                              map,
+                  const ara::core::Vector<std::uint64_t>& keys,
+                  const ara::core::Vector<std::uint64_t>& fresh)
+{
+    for (std::size_t i = 0; i < fresh.size(); ++i)
+    {
+        map.erase(keys[i]);
+        map.emplace(fresh[i], i);
+    }
+    for (std::size_t i = 0; i < fresh.size(); ++i)
+    {
+        map.erase(fresh[i]);
+        map.emplace(keys[i], i);
+    }
+
+    return map.size();
+}
+}  // namespace
+
+TEST_CASE("UnorderedMap vs Map vs std::unordered_map",
+          "[!benchmark][UnorderedMap]")
+{
+    for (std::size_t size : {std::size_t{1} << 10, std::size_t{1} << 20})
+    {
+        std::string const suffix = " / entries " + std::to_string(size);
+
+        auto const keys   = RandomKeys(size, 7);
+        auto const misses = RandomKeys(kOperations, 13);
+        auto const fresh  = RandomKeys(std::min(size, kOperations), 17);
+
+        ara::core::Vector<std::uint64_t> hits;
+        std::mt19937_64                  gen{11};
+        for (std::size_t i = 0; i < kOperations; ++i)
+        { hits.push_back(keys[gen() % size]); }
+
+        ara::core::Map<std::uint64_t, std::uint64_t>           tree;
+        std::unordered_map<std::uint64_t, std::uint64_t>       node;
+        ara::core::UnorderedMap<std::uint64_t, std::uint64_t> swiss;
+        for (auto key : keys)
+        {
+            tree.emplace(key, key);
+            node.emplace(key, key);
+            swiss.emplace(key, key);
+        }
+
+        BENCHMARK("Map hit" + suffix) { return Lookup(tree, hits); };
+        BENCHMARK("std::unordered_map hit" + suffix)
+        {
+            return Lookup(node, hits);
+        };
+        BENCHMARK("UnorderedMap hit" + suffix) { return Lookup(swiss, hits); };
+
+        BENCHMARK("Map miss" + suffix) { return Lookup(tree, misses); };
+        BENCHMARK("std::unordered_map miss" + suffix)
+        {
+            return Lookup(node, misses);
+        };
+        BENCHMARK("UnorderedMap miss" + suffix)
+        {
+            return Lookup(swiss, misses);
+        };
+
+        BENCHMARK("Map churn" + suffix) { return Churn(tree, keys, fresh); };
+        BENCHMARK("std::unordered_map churn" + suffix)
+        {
+            return Churn(node, keys, fresh);
+        };
+        BENCHMARK("UnorderedMap churn" + suffix)
+        {
+            return Churn(swiss, keys, fresh);
+        };
+    }
+}
@@ -0,0 +1,223 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "ara/core/bloom_filter.h"
+#include "ara/core/flat_map.h"
+#include "ara/core/functional.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+
+namespace {
+/**
+ * @brief Applies a random mix of insertions, erasures and lookups to a
+ * FilteredMap and a std::map, and returns the number of diverging results.
+ */
+template<class Container> std::size_t DivergenceFromStdMap(int operations)
+{
+    ara::core::FilteredMap<Container> map;
+    std::map<int, int>                expected;
+    std::mt19937                      gen{41};
+    std::uniform_int_distribution<int> key{0, 999};
+    std::uniform_int_distribution<int> action{0, 9};
+
+    std::size_t divergence = 0;
+    for (int i = 0; i < operations; ++i)
+    {
+        int const k = key(gen);
+        switch (action(gen))
+        {
+        case 0:
+        case 1:
+            divergence += map.erase(k) != expected.erase(k);
+            break;
+        case 2: map[k] = i; expected[k] = i; break;
+        case 3:
+            divergence += map.try_emplace(k, i).second
+                          != expected.try_emplace(k, i).second;
+            break;
+        case 4:
+            divergence += map.insert({k, i}).second
+                          != expected.insert({k, i}).second;
+            break;
+        default:
+        {
+            auto const it    = map.find(k);
+            auto const other = expected.find(k);
+            divergence += (it == map.end()) != (other == expected.end());
+            divergence += it != map.end() && it->second != other->second;
+            break;
+        }
+        }
+        divergence += map.size() != expected.size();
+    }
+    for (const auto& [k, value] : expected)
+    { divergence += ! map.contains(k) || map.at(k) != value; }
+
+    return divergence;
+}
+
+/**
+ * @brief Hash that throws on multiples of 7.
+ */
+struct ThrowingHash
+{
+    std::size_t operator()(int key) const
+    {
+        if (key % 7 == 0)
+        { throw std::runtime_error("ThrowingHash"); }
+
+        return std::hash<int>{}(key);
+    }
+};
+
+/**
+ * @brief Hash that throws while fail is set.
+ */
+struct FailingHash
+{
+    inline static bool fail = false;
+
+    std::size_t operator()(int key) const
+    {
+        if (fail)
+        { throw std::runtime_error("FailingHash"); }
+
+        return std::hash<int>{}(key);
+    }
+};
+}  // namespace
+
+TEST_CASE("BlockedBloomFilter has no false negatives and few false positives",
+          "[BloomFilter]")
+{
+    constexpr std::size_t kKeys = 10000;
+
+    ara::core::BlockedBloomFilter filter(kKeys);
+    CHECK(filter.capacity() == kKeys);
+    CHECK(filter.size_in_bytes() >= kKeys * 12 / 8);
+
+    for (std::uint64_t key = 0; key < kKeys; ++key) { filter.insert(key); }
+    for (std::uint64_t key = 0; key < kKeys; ++key)
+    { REQUIRE(filter.may_contain(key)); }
+
+    std::size_t falsePositives = 0;
+    for (std::uint64_t key = kKeys; key < 11 * kKeys; ++key)
+    { falsePositives += filter.may_contain(key); }
+    CHECK(falsePositives < kKeys * 10 / 100);
+
+    filter.clear();
+    CHECK_FALSE(filter.may_contain(0));
+
+    ara::core::BlockedBloomFilter const none;
+    CHECK(none.may_contain(0));
+    CHECK(none.size_in_bytes() == 0);
+}
+
+TEST_CASE("FilteredMap agrees with std::map", "[BloomFilter]")
+{
+    CHECK(DivergenceFromStdMap<ara::core::Map<int, int>>(20000) == 0);
+    CHECK(DivergenceFromStdMap<ara::core::FlatMap<int, int>>(20000) == 0);
+}
+
+TEST_CASE("FilteredMap grows and rebuilds its filter", "[BloomFilter]")
+{
+    ara::core::FilteredMap<ara::core::Map<int, int>> map;
+    std::size_t const initial = map.filter().capacity();
+    for (int i = 0; i < 1000; ++i) { map.emplace(i, i); }
+    CHECK(map.filter().capacity() >= map.size());
+    CHECK(map.filter().capacity() > initial);
+    CHECK_THROWS_AS(map.at(1000), std::out_of_range);
+
+    std::size_t const grown = map.filter().capacity();
+    for (int i = 0; i < 900; ++i) { CHECK(map.erase(i) == 1); }
+    CHECK(map.erase(0) == 0);
+    CHECK(map.size() == 100);
+    CHECK(map.filter().capacity() < grown);
+    for (int i = 900; i < 1000; ++i) { CHECK(map.count(i) == 1); }
+
+    map.clear();
+    CHECK(map.empty());
+    CHECK_FALSE(map.contains(950));
+
+    ara::core::Map<int, int> base{{1, 1}, {2, 2}};
+    ara::core::FilteredMap<ara::core::Map<int, int>> const filled(base);
+    CHECK(filled.at(2) == 2);
+    CHECK(filled.base() == base);
+    CHECK(ara::core::memory_footprint(filled).bytes_reserved
+          == ara::core::memory_footprint(base).bytes_reserved
+               + filled.filter().size_in_bytes());
+}
+
+TEST_CASE("FilteredMap keeps its keys findable if the hash throws",
+          "[BloomFilter]")
+{
+    ara::core::FilteredMap<ara::core::Map<int, int>, ThrowingHash> map;
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 7 == 0)
+        { CHECK_THROWS_AS(map.emplace(i, i), std::runtime_error); }
+        else
+        { map.emplace(i, i); }
+    }
+
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 7 != 0)
+        { REQUIRE(map.contains(i)); }
+    }
+    CHECK(map.size() == 200 - 29);
+}
+
+TEST_CASE("FilteredMap erase keeps the element if the rebuild throws",
+          "[BloomFilter]")
+{
+    ara::core::FilteredMap<ara::core::Map<int, int>, FailingHash> map;
+    for (int i = 0; i < 100; ++i) { map.emplace(i, i); }
+
+    // Only the erase that rebuilds the filter hashes, and throws.
+    int key = 0;
+    for (; key < 100; ++key)
+    {
+        auto const pos    = map.base().find(key);
+        FailingHash::fail = true;
+        bool threw        = false;
+        try
+        {
+            map.erase(pos);
+        }
+        catch (const std::runtime_error&)
+        {
+            threw = true;
+        }
+        FailingHash::fail = false;
+        if (threw)
+        { break; }
+    }
+
+    REQUIRE(key < 100);
+    CHECK(map.size() == static_cast<std::size_t>(100 - key));
+    CHECK(map.contains(key));
+    CHECK(map.erase(key) == 1);
+    CHECK_FALSE(map.contains(key));
+    CHECK(map.contains(99));
+}
+
+TEST_CASE("FilteredMap with heterogeneous lookup", "[BloomFilter]")
+{
+    using Strings = ara::core::
+      FlatMap<std::string, int, ara::core::StringLess>;
+    ara::core::FilteredMap<Strings, ara::core::StringHash> map;
+    map["Body"]    = 1;
+    map["Chassis"] = 2;
+
+    CHECK(map.find("Body")->second == 1);
+    CHECK(map.find(ara::core::StringView("Chassis")) != map.end());
+    CHECK(map.find("Powertrain") == map.end());
+    CHECK(map.count("Chassis") == 1);
+    CHECK_FALSE(map.contains("Adas"));
+}
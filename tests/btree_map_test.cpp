@@ -0,0 +1,264 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "ara/core/btree_map.h"
+
+namespace {
+/**
+ * @brief Applies a random mix of insertions, erasures and bound lookups to a
+ * BTreeMap and a std::map, and returns the number of diverging results.
+ */
+template<class K, class Key>
+std::size_t DivergenceFromStdMap(Key makeKey, int operations, unsigned range)
+{
+    ara::core::BTreeMap<K, int> tree;
+    std::map<K, int>            reference;
+    std::mt19937                             gen{11};
+    std::uniform_int_distribution<unsigned> keys{0, range - 1};
+    std::uniform_int_distribution<int>      operation{0, 5};
+    std::size_t                             mismatches = 0;
+
+    auto const sameElement = [&](auto it, auto ref) {
+        if (ref == reference.end())
+        { return it == tree.end(); }
+
+        return it != tree.end() && it->first == ref->first
+               && it->second == ref->second;
+    };
+
+    for (int i = 0; i < operations; ++i)
+    {
+        K const key = makeKey(keys(gen));
+        switch (operation(gen))
+        {
+        case 0:
+        case 1:
+        {
+            auto const inserted = tree.try_emplace(key, i).second;
+            mismatches += inserted != reference.try_emplace(key, i).second;
+            break;
+        }
+        case 2:
+            mismatches += tree.erase(key) != reference.erase(key);
+            break;
+        case 3:
+        {
+            auto       it  = tree.lower_bound(key);
+            auto const ref = reference.lower_bound(key);
+            mismatches += ! sameElement(it, ref);
+            if (ref != reference.end())
+            {
+                it = tree.erase(it);
+                mismatches += ! sameElement(it, reference.erase(ref));
+            }
+            break;
+        }
+        case 4:
+            mismatches +=
+              ! sameElement(tree.upper_bound(key), reference.upper_bound(key));
+            mismatches += ! sameElement(tree.find(key), reference.find(key));
+            break;
+        default:
+        {
+            auto const hint = tree.upper_bound(key);
+            tree.emplace_hint(hint, key, i);
+            reference.emplace(key, i);
+            break;
+        }
+        }
+    }
+
+    mismatches += tree.size() != reference.size();
+    mismatches += ! std::equal(tree.begin(),
+                               tree.end(),
+                               reference.begin(),
+                               reference.end());
+    mismatches += ! std::equal(tree.rbegin(),
+                               tree.rend(),
+                               reference.rbegin(),
+                               reference.rend());
+
+    return mismatches;
+}
+}  // namespace
+
+TEST_CASE("BTreeMap insert / find / at", "[BTreeMap]")
+{
+    ara::core::BTreeMap<std::string, int> map;
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    CHECK(map.find("a") == map.end());
+
+    CHECK(map.insert({"a", 1}).second);
+    CHECK_FALSE(map.insert({"a", 2}).second);
+    CHECK(map.emplace("b", 2).second);
+    map["c"] = 3;
+
+    CHECK(map.size() == 3);
+    CHECK(map.at("a") == 1);
+    CHECK(map.find("b")->second == 2);
+    CHECK(map.count("c") == 1);
+    CHECK_FALSE(map.contains("d"));
+    CHECK_THROWS_AS(map.at("d"), std::out_of_range);
+
+    auto const range = map.equal_range("b");
+    CHECK(std::distance(range.first, range.second) == 1);
+    auto const none = map.equal_range("bb");
+    CHECK(none.first == none.second);
+    CHECK(none.first->first == "c");
+}
+
+TEST_CASE("BTreeMap matches std::map under random operations", "[BTreeMap]")
+{
+    CHECK(DivergenceFromStdMap<int>(
+            [](unsigned x) { return static_cast<int>(x) - 2000; }, 50000, 4000)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::uint64_t>(
+            [](unsigned x) { return x * 0x9E3779B97F4A7C15ull; }, 50000, 4000)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::int64_t>(
+            [](unsigned x) { return (std::int64_t{x} - 2000) << 33; },
+            50000,
+            4000)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::uint8_t>(
+            [](unsigned x) { return static_cast<std::uint8_t>(x); }, 5000, 256)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::int16_t>(
+            [](unsigned x) { return static_cast<std::int16_t>(x - 30000); },
+            50000,
+            60000)
+          == 0);
+    CHECK(DivergenceFromStdMap<double>(
+            [](unsigned x) { return static_cast<double>(x) - 999.5; },
+            50000,
+            2000)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::string>(
+            [](unsigned x) { return std::to_string(x); }, 30000, 2000)
+          == 0);
+}
+
+TEST_CASE("BTreeMap erase returns the following element", "[BTreeMap]")
+{
+    ara::core::BTreeMap<int, int> map;
+    for (int i = 0; i < 1000; ++i) { map.emplace(i, i); }
+
+    auto it = map.find(10);
+    for (int i = 10; i < 500; ++i)
+    {
+        REQUIRE(it->first == i);
+        it = map.erase(it);
+    }
+    CHECK(it->first == 500);
+
+    it = map.erase(map.find(600), map.find(900));
+    CHECK(it->first == 900);
+    CHECK(map.size() == 210);
+
+    it = map.erase(std::prev(map.end()));
+    CHECK(it == map.end());
+    it = map.erase(map.begin(), map.end());
+    CHECK(it == map.end());
+    CHECK(map.empty());
+}
+
+TEST_CASE("BTreeMap construction from sorted input", "[BTreeMap]")
+{
+    std::vector<std::pair<int, std::string>> sorted;
+    for (int i = 0; i < 1000; ++i) { sorted.emplace_back(2 * i, "value"); }
+
+    ara::core::BTreeMap<int, std::string> const fromRange(sorted.begin(),
+                                                          sorted.end());
+    ara::core::BTreeMap<int, std::string> fromSorted(
+      ara::core::sorted_unique, sorted.begin(), sorted.end());
+    CHECK(fromSorted == fromRange);
+
+    std::vector<std::pair<int, std::string>> const odd{{1, "one"},
+                                                       {3, "three"}};
+    fromSorted.insert(ara::core::sorted_unique, odd.begin(), odd.end());
+    CHECK(fromSorted.size() == 1002);
+    CHECK(std::next(fromSorted.begin())->second == "one");
+}
+
+TEST_CASE("BTreeMap try_emplace / insert_or_assign", "[BTreeMap]")
+{
+    ara::core::BTreeMap<int, std::unique_ptr<int>> map;
+
+    auto value = std::make_unique<int>(1);
+    CHECK(map.try_emplace(1, std::move(value)).second);
+    CHECK(value == nullptr);
+
+    value = std::make_unique<int>(2);
+    CHECK_FALSE(map.try_emplace(1, std::move(value)).second);
+    CHECK(value != nullptr);
+
+    auto const hinted = map.try_emplace(map.end(), 2, std::make_unique<int>(3));
+    CHECK(*hinted->second == 3);
+
+    CHECK_FALSE(map.insert_or_assign(1, std::move(value)).second);
+    CHECK(*map.at(1) == 2);
+    CHECK(*map.insert_or_assign(map.end(), 5, std::make_unique<int>(6))->second
+          == 6);
+}
+
+TEST_CASE("BTreeMap copy / move / compare / merge", "[BTreeMap]")
+{
+    ara::core::BTreeMap<int, std::string> map;
+    for (int i = 0; i < 500; ++i) { map.emplace(i, std::to_string(i)); }
+
+    auto copy = map;
+    CHECK(copy == map);
+    copy[1000] = "x";
+    CHECK(copy != map);
+    CHECK(map < copy);
+
+    auto moved = std::move(copy);
+    CHECK(moved.size() == 501);
+    CHECK(copy.empty());
+
+    copy = moved;
+    swap(copy, map);
+    CHECK(map.size() == 501);
+    CHECK(copy.size() == 500);
+
+    ara::core::BTreeMap<int, std::string, std::greater<>> source{
+      {1, "dup"}, {2000, "new"}};
+    map.merge(source);
+    CHECK(map.at(2000) == "new");
+    CHECK(map.at(1) == "1");
+    CHECK(source.size() == 1);
+}
+
+TEST_CASE("BTreeMap transparent lookup does not allocate", "[BTreeMap]")
+{
+    std::string const longKey(64, 'k');
+
+    ara::core::BTreeMap<std::string, int, ara::core::StringLess> map{
+      {longKey, 1}, {"beta", 2}};
+    const auto& constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found    = map.find(key);
+    auto const                  contains = map.contains("beta");
+    auto const                  missing  = map.count("gamma");
+    auto const                  bound    = constMap.lower_bound("c");
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found->second == 1);
+    CHECK(contains);
+    CHECK(missing == 0);
+    CHECK(bound->first == longKey);
+}
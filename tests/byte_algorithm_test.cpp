@@ -0,0 +1,133 @@
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+
+#include "ara/core/array.h"
+#include "ara/core/byte_algorithm.h"
+#include "ara/core/vector.h"
+
+namespace {
+using ara::core::Byte;
+using ara::core::detail::ByteKernelIsa;
+
+ara::core::Vector<Byte> RandomBytes(std::mt19937& gen, std::size_t size)
+{
+    ara::core::Vector<Byte> bytes;
+    for (std::size_t i = 0; i < size; ++i)
+    { bytes.push_back(Byte(static_cast<std::uint8_t>(gen() % 8))); }
+
+    return bytes;
+}
+
+/**
+ * @brief Compares the active kernels with scalar loops over Byte on random
+ * buffers of every size up to a few registers, at every offset from a 64-byte
+ * boundary.
+ */
+std::size_t KernelDivergence()
+{
+    std::mt19937 gen{149};
+    std::size_t  divergence = 0;
+    for (std::size_t size = 0; size < 300; ++size)
+    {
+        std::size_t const offset = size % 64;
+        auto const        lhsAll = RandomBytes(gen, size + offset);
+        auto const        rhsAll = RandomBytes(gen, size + offset);
+        ara::core::Span<const Byte> const lhs =
+          ara::core::Span(lhsAll).subspan(offset);
+        ara::core::Span<const Byte> const rhs =
+          ara::core::Span(rhsAll).subspan(offset);
+
+        ara::core::Vector<Byte> out(size);
+        ara::core::bytes_xor(lhs, rhs, out);
+        for (std::size_t i = 0; i < size; ++i)
+        { divergence += out[i] != (lhs[i] ^ rhs[i]); }
+        ara::core::bytes_and(lhs, rhs, out);
+        for (std::size_t i = 0; i < size; ++i)
+        { divergence += out[i] != (lhs[i] & rhs[i]); }
+        ara::core::bytes_or(lhs, rhs, out);
+        for (std::size_t i = 0; i < size; ++i)
+        { divergence += out[i] != (lhs[i] | rhs[i]); }
+        ara::core::bytes_not(lhs, out);
+        for (std::size_t i = 0; i < size; ++i)
+        { divergence += out[i] != ~lhs[i]; }
+
+        std::size_t bits = 0;
+        std::size_t twos = 0;
+        for (auto const byte : lhs)
+        {
+            bits += static_cast<std::size_t>(
+              std::popcount(ara::core::to_integer<std::uint8_t>(byte)));
+            twos += byte == Byte(2);
+        }
+        divergence += ara::core::popcount(lhs) != bits;
+        divergence += ara::core::count_byte(lhs, Byte(2)) != twos;
+        divergence += ara::core::count_byte(lhs, Byte(0xff)) != 0;
+
+        std::size_t first = size;
+        for (std::size_t i = 0; i < size && first == size; ++i)
+        {
+            if (lhs[i] == Byte(7))
+            { first = i; }
+        }
+        divergence += ara::core::find_byte(lhs, Byte(7)) != first;
+        divergence += ara::core::find_byte(lhs, Byte(0xff)) != size;
+    }
+
+    // Long runs of matches overflow the byte counters of the count kernels.
+    ara::core::Vector<Byte> const same(100000, Byte(0xaa));
+    divergence += ara::core::count_byte(same, Byte(0xaa)) != same.size();
+    divergence += ara::core::popcount(same) != 4 * same.size();
+
+    return divergence;
+}
+}  // namespace
+
+TEST_CASE("Byte kernels match scalar loops on every instruction set",
+          "[ByteAlgorithm]")
+{
+    auto const detected = ara::core::detail::ActiveByteKernels();
+    for (auto const isa : {ByteKernelIsa::kScalar,
+                           ByteKernelIsa::kSse2,
+                           ByteKernelIsa::kAvx2,
+                           ByteKernelIsa::kAvx512})
+    {
+        if (! ara::core::detail::UseByteKernels(isa))
+        {
+            WARN("byte kernels " << static_cast<int>(isa) << " unsupported");
+            continue;
+        }
+        CHECK(ara::core::detail::ActiveByteKernels() == isa);
+        CHECK(KernelDivergence() == 0);
+    }
+    CHECK(ara::core::detail::UseByteKernels(detected));
+}
+
+TEST_CASE("Byte kernels work in place on Vector and Array", "[ByteAlgorithm]")
+{
+    ara::core::Array<Byte, 4> mask{Byte(0x0f), Byte(0xf0), Byte(0xff), Byte(0)};
+    ara::core::Vector<Byte>   buffer(4, Byte(0x3c));
+
+    ara::core::bytes_and(buffer, mask, buffer);
+    CHECK(buffer
+          == ara::core::Vector<Byte>{
+            Byte(0x0c), Byte(0x30), Byte(0x3c), Byte(0)});
+    ara::core::bytes_not(buffer, buffer);
+    ara::core::bytes_xor(buffer, mask, buffer);
+    CHECK(buffer
+          == ara::core::Vector<Byte>{
+            Byte(0xfc), Byte(0x3f), Byte(0x3c), Byte(0xff)});
+    ara::core::bytes_or(mask, buffer, buffer);
+    CHECK(ara::core::popcount(buffer) == 8 + 8 + 8 + 8);
+    CHECK(ara::core::find_byte(mask, Byte(0xff)) == 2);
+    CHECK(ara::core::count_byte(buffer, Byte(0xff)) == 4);
+
+    ara::core::Vector<Byte> shorter(3);
+    CHECK_THROWS_AS(ara::core::bytes_xor(buffer, mask, shorter),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(ara::core::bytes_not(buffer, shorter),
+                    std::invalid_argument);
+}
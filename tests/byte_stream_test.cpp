@@ -0,0 +1,164 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+
+#include "ara/core/array.h"
+#include "ara/core/byte_stream.h"
+#include "ara/core/vector.h"
+
+namespace {
+using ara::core::Byte;
+
+enum class Tag : std::uint16_t
+{
+    kPing = 0x0102
+};
+
+ara::core::Vector<Byte> Bytes(std::initializer_list<std::uint8_t> values)
+{
+    ara::core::Vector<Byte> bytes;
+    for (auto const value : values) { bytes.push_back(Byte(value)); }
+
+    return bytes;
+}
+}  // namespace
+
+TEST_CASE("ByteWriter stores big- and little-endian values", "[ByteStream]")
+{
+    ara::core::Vector<Byte> buffer;
+    {
+        ara::core::ByteWriter writer(buffer);
+        writer.write_be(std::uint32_t{0x01020304}, std::int16_t{-2});
+        writer.write_le(std::uint32_t{0x01020304}, Tag::kPing);
+        writer.write_be(std::uint8_t{0xab});
+        CHECK(writer.size() == 13);
+        CHECK(writer.written().size() == 13);
+    }
+
+    CHECK(buffer == Bytes({1, 2, 3, 4, 0xff, 0xfe, 4, 3, 2, 1, 2, 1, 0xab}));
+
+    ara::core::ByteReader reader(buffer);
+    CHECK(reader.read_be<std::uint32_t>() == 0x01020304);
+    CHECK(reader.read_be<std::int16_t>() == -2);
+    auto const [word, tag] = reader.read_le<std::uint32_t, Tag>();
+    CHECK(word == 0x01020304);
+    CHECK(tag == Tag::kPing);
+    CHECK(reader.read_le<std::uint8_t>() == 0xab);
+    CHECK(reader.empty());
+}
+
+TEST_CASE("ByteWriter and ByteReader round trip every width", "[ByteStream]")
+{
+    ara::core::Vector<Byte> buffer(2, Byte(0x55));
+    {
+        ara::core::ByteWriter writer(buffer);
+        for (int i = 0; i < 100; ++i)
+        {
+            writer.write_be(static_cast<std::uint64_t>(i) * 0x0101010101010101,
+                            -1.5 * i,
+                            static_cast<std::int8_t>(-i));
+            writer.write_le(static_cast<std::uint16_t>(i * 257),
+                            static_cast<float>(i) / 4,
+                            static_cast<std::int64_t>(-i) << 40);
+        }
+    }
+
+    // The writer appends after what the vector held.
+    REQUIRE(buffer.size() == 2 + 100 * (8 + 8 + 1 + 2 + 4 + 8));
+    CHECK(buffer[0] == Byte(0x55));
+
+    ara::core::ByteReader reader(buffer);
+    reader.skip(2);
+    bool same = true;
+    for (int i = 0; i < 100; ++i)
+    {
+        auto const [u64, f64, i8] =
+          reader.read_be<std::uint64_t, double, std::int8_t>();
+        auto const [u16, f32, i64] =
+          reader.read_le<std::uint16_t, float, std::int64_t>();
+        same = same
+               && u64 == static_cast<std::uint64_t>(i) * 0x0101010101010101
+               && f64 == -1.5 * i && i8 == static_cast<std::int8_t>(-i)
+               && u16 == static_cast<std::uint16_t>(i * 257)
+               && f32 == static_cast<float>(i) / 4
+               && i64 == static_cast<std::int64_t>(-i) << 40;
+    }
+    CHECK(same);
+    CHECK(reader.empty());
+}
+
+TEST_CASE("ByteWriter and ByteReader copy ranges and bytes in bulk",
+          "[ByteStream]")
+{
+    ara::core::Vector<std::uint32_t> words;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    { words.push_back(i * 0x01020304); }
+    ara::core::Array<std::uint16_t, 3> const shorts{std::uint16_t{0x0102},
+                                                    std::uint16_t{0x0304},
+                                                    std::uint16_t{0x0506}};
+    auto const                               payload = Bytes({9, 8, 7});
+
+    ara::core::Vector<Byte> buffer;
+    ara::core::ByteWriter   writer(buffer);
+    writer.write_be(words);
+    writer.write_le(words);
+    writer.write_be(shorts);
+    writer.write_bytes(payload);
+    writer.flush();
+    REQUIRE(buffer.size() == 2 * 4000 + 6 + 3);
+    CHECK(buffer[0] == Byte(0));
+    CHECK(buffer[4] == Byte(0x01));
+    CHECK(buffer[4000 + 4] == Byte(0x04));
+    CHECK(buffer[8000] == Byte(0x01));
+    CHECK(buffer[8001] == Byte(0x02));
+
+    ara::core::ByteReader              reader(buffer);
+    ara::core::Vector<std::uint32_t>   big(1000);
+    ara::core::Vector<std::uint32_t>   little(1000);
+    ara::core::Array<std::uint16_t, 3> shortsBack{};
+    reader.read_be(big);
+    reader.read_le(little);
+    reader.read_be(shortsBack);
+    CHECK(big == words);
+    CHECK(little == words);
+    CHECK(shortsBack == shorts);
+
+    // read_bytes() returns a view into the buffer.
+    auto const bytes = reader.read_bytes(3);
+    CHECK(bytes.data() == buffer.data() + 8006);
+    CHECK(bytes[2] == Byte(7));
+    CHECK(reader.position() == buffer.size());
+}
+
+TEST_CASE("ByteWriter over a span and ByteReader check bounds per batch",
+          "[ByteStream]")
+{
+    ara::core::Array<Byte, 6> storage{};
+    ara::core::ByteWriter     writer(storage);
+    writer.write_be(std::uint32_t{0xdeadbeef});
+
+    // Neither value is written when both don't fit.
+    CHECK_THROWS_AS(writer.write_be(std::uint8_t{1}, std::uint16_t{2}),
+                    std::out_of_range);
+    CHECK(writer.size() == 4);
+    writer.write_le(std::uint16_t{0x0102});
+    CHECK_THROWS_AS(writer.write_bytes(Bytes({1})), std::out_of_range);
+    CHECK(storage[4] == Byte(2));
+
+    ara::core::ByteReader reader(storage);
+    CHECK_THROWS_AS((reader.read_be<std::uint32_t, std::uint32_t>()),
+                    std::out_of_range);
+    CHECK(reader.position() == 0);
+    CHECK(reader.read_be<std::uint32_t>() == 0xdeadbeef);
+
+    ara::core::Vector<std::uint16_t> tooMany(2);
+    CHECK_THROWS_AS(reader.read_le(tooMany), std::out_of_range);
+    CHECK_THROWS_AS(reader.read_bytes(3), std::out_of_range);
+    CHECK_THROWS_AS(reader.skip(3), std::out_of_range);
+    CHECK(reader.remaining() == 2);
+    CHECK(reader.rest().data() == storage.data() + 4);
+    CHECK(reader.read_le<std::uint16_t>() == 0x0102);
+    CHECK_THROWS_AS(reader.read_le<std::uint8_t>(), std::out_of_range);
+}
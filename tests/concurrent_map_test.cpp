@@ -0,0 +1,150 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "ara/core/concurrent_map.h"
+#include "ara/core/functional.h"
+#include "ara/core/string_view.h"
+#include "ara/core/vector.h"
+
+TEST_CASE("ConcurrentMap insert / find / update / erase", "[ConcurrentMap]")
+{
+    ara::core::ConcurrentMap<int, std::string> map{4};
+    CHECK(map.shard_count() == 4);
+    CHECK(map.empty());
+
+    CHECK(map.insert({1, "one"}));
+    CHECK_FALSE(map.insert({1, "uno"}));
+    CHECK(map.try_emplace(2, "two"));
+    CHECK_FALSE(map.try_emplace(2, "zwei"));
+    CHECK(map.insert_or_assign(3, "three"));
+    CHECK_FALSE(map.insert_or_assign(3, "drei"));
+    CHECK(map.size() == 3);
+
+    CHECK(map.find(1) == "one");
+    CHECK(map.find(3) == "drei");
+    CHECK_FALSE(map.find(4).has_value());
+    CHECK(map.contains(2));
+    CHECK_FALSE(map.contains(4));
+
+    std::size_t length = 0;
+    CHECK(map.visit(2, [&length](const std::string& v) { length = v.size(); }));
+    CHECK(length == 3);
+
+    CHECK(map.update(1, [](std::string& v) { v += "!"; }));
+    CHECK_FALSE(map.update(4, [](std::string& v) { v += "!"; }));
+    CHECK(map.find(1) == "one!");
+
+    auto const append = [](std::string& v) { v += "4"; };
+    CHECK(map.try_emplace_and_update(4, append));
+    CHECK_FALSE(map.try_emplace_and_update(4, append));
+    CHECK(map.find(4) == "44");
+
+    CHECK(map.erase(1) == 1);
+    CHECK(map.erase(1) == 0);
+    CHECK(map.size() == 3);
+
+    map.clear();
+    CHECK(map.empty());
+}
+
+TEST_CASE("ConcurrentMap shard count", "[ConcurrentMap]")
+{
+    CHECK(ara::core::ConcurrentMap<int, int>{}.shard_count()
+          == ara::core::ConcurrentMap<int, int>::DefaultShardCount());
+    CHECK(ara::core::ConcurrentMap<int, int>{0}.shard_count()
+          == ara::core::ConcurrentMap<int, int>::DefaultShardCount());
+    CHECK(ara::core::ConcurrentMap<int, int>{5}.shard_count() == 8);
+
+    ara::core::ConcurrentMap<int, int> single{1};
+    for (int i = 0; i < 100; ++i) { single.try_emplace(i, i); }
+    CHECK(single.size() == 100);
+    CHECK(single.find(99) == 99);
+}
+
+TEST_CASE("ConcurrentMap for_each_shard", "[ConcurrentMap]")
+{
+    ara::core::ConcurrentMap<int, int> map{8};
+    map.reserve(1000);
+    for (int i = 0; i < 1000; ++i) { map.try_emplace(i, i); }
+
+    std::size_t shards   = 0;
+    std::size_t elements = 0;
+    long        sum      = 0;
+    std::as_const(map).for_each_shard([&](const auto& shard) {
+        ++shards;
+        elements += shard.size();
+        for (const auto& [key, value] : shard) { sum += value; }
+    });
+    CHECK(shards == 8);
+    CHECK(elements == 1000);
+    CHECK(sum == 999 * 1000 / 2);
+
+    map.for_each_shard([](auto& shard) {
+        for (auto& [key, value] : shard) { value = -key; }
+    });
+    CHECK(map.find(10) == -10);
+}
+
+TEST_CASE("ConcurrentMap transparent lookup", "[ConcurrentMap]")
+{
+    ara::core::ConcurrentMap<std::string,
+                             int,
+                             ara::core::StringHash,
+                             ara::core::StringEqual>
+      map;
+    map.try_emplace("a", 1);
+
+    CHECK(map.find(ara::core::StringView{"a"}) == 1);
+    CHECK(map.contains("a"));
+    CHECK_FALSE(map.contains(ara::core::StringView{"b"}));
+    CHECK(map.visit("a", [](int) {}));
+}
+
+TEST_CASE("ConcurrentMap concurrent writers and readers", "[ConcurrentMap]")
+{
+    constexpr int kThreads = 4;
+    constexpr int kKeys    = 1000;
+    constexpr int kRounds  = 20;
+
+    ara::core::ConcurrentMap<int, int> map{16};
+    std::atomic<bool>                  done{false};
+    std::atomic<bool>                  consistent{true};
+
+    std::thread reader([&] {
+        while (! done.load())
+        {
+            for (int key = 0; key < kKeys; ++key)
+            {
+                auto const value = map.find(key);
+                if (value && (*value < 1 || *value > kThreads * kRounds))
+                { consistent = false; }
+            }
+        }
+    });
+
+    ara::core::Vector<std::thread> writers;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        writers.emplace_back([&map] {
+            for (int round = 0; round < kRounds; ++round)
+            {
+                for (int key = 0; key < kKeys; ++key)
+                { map.try_emplace_and_update(key, [](int& v) { ++v; }, 0); }
+            }
+        });
+    }
+    for (auto& writer : writers) { writer.join(); }
+    done = true;
+    reader.join();
+
+    bool allCounted = true;
+    for (int key = 0; key < kKeys; ++key)
+    { allCounted &= map.find(key) == kThreads * kRounds; }
+
+    CHECK(consistent);
+    CHECK(allCounted);
+    CHECK(map.size() == kKeys);
+}
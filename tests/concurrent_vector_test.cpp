@@ -0,0 +1,201 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ara/core/concurrent_vector.h"
+#include "ara/core/vector.h"
+
+namespace {
+/**
+ * @brief Blocks handed out by ArenaAllocator with the id of their arena.
+ */
+std::vector<std::pair<void*, int>> arenaBlocks;
+
+/**
+ * @brief Allocator with an arena id. Freeing memory through an allocator of
+ * another arena fails the test.
+ */
+template<class T, bool Propagate> struct ArenaAllocator
+{
+    using value_type = T;
+    using propagate_on_container_move_assignment =
+      std::bool_constant<Propagate>;
+
+    template<class U> struct rebind
+    {
+        using other = ArenaAllocator<U, Propagate>;
+    };
+
+    explicit ArenaAllocator(int id) noexcept : id{id} {}
+
+    template<class U>
+    ArenaAllocator(const ArenaAllocator<U, Propagate>& other) noexcept
+      : id{other.id}
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        T* p = std::allocator<T>{}.allocate(n);
+        arenaBlocks.emplace_back(p, id);
+
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        auto it = std::find_if(
+          arenaBlocks.begin(), arenaBlocks.end(),
+          [p](auto const& block) { return block.first == p; });
+        CHECK(it != arenaBlocks.end());
+        if (it != arenaBlocks.end())
+        {
+            CHECK(it->second == id);
+            arenaBlocks.erase(it);
+        }
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<class U>
+    friend bool operator==(const ArenaAllocator& lhs,
+                           const ArenaAllocator<U, Propagate>& rhs) noexcept
+    {
+        return lhs.id == rhs.id;
+    }
+
+    int id;
+};
+}  // namespace
+
+TEST_CASE("ConcurrentVector push_back / index", "[ConcurrentVector]")
+{
+    ara::core::ConcurrentVector<std::string> vector;
+    CHECK(vector.empty());
+    CHECK(vector.capacity() == 0);
+
+    bool indicesInOrder = true;
+    for (std::size_t i = 0; i < 1000; ++i)
+    { indicesInOrder &= vector.push_back(std::to_string(i)) == i; }
+
+    CHECK(indicesInOrder);
+    CHECK(vector.size() == 1000);
+    CHECK(vector[0] == "0");
+    CHECK(vector.at(999) == "999");
+    CHECK_THROWS_AS(vector.at(1000), std::out_of_range);
+    CHECK(std::distance(vector.begin(), vector.end()) == 1000);
+}
+
+TEST_CASE("ConcurrentVector references stay valid", "[ConcurrentVector]")
+{
+    ara::core::ConcurrentVector<int> vector;
+    vector.push_back(42);
+    int const* first = &vector[0];
+
+    for (int i = 0; i < 10000; ++i) { vector.push_back(i); }
+
+    CHECK(first == &vector[0]);
+    CHECK(*first == 42);
+}
+
+TEST_CASE("ConcurrentVector reserve / clear / copy / move",
+          "[ConcurrentVector]")
+{
+    ara::core::ConcurrentVector<int> vector;
+    vector.reserve(100);
+    CHECK(vector.capacity() >= 100);
+    CHECK(vector.empty());
+
+    for (int i = 0; i < 100; ++i) { vector.emplace_back(i); }
+    auto copy = vector;
+    CHECK(copy.size() == 100);
+    CHECK(copy[99] == 99);
+
+    auto moved = std::move(vector);
+    CHECK(moved.size() == 100);
+    CHECK(vector.empty());
+
+    moved.clear();
+    CHECK(moved.empty());
+    CHECK(moved.capacity() >= 100);
+}
+
+TEST_CASE("ConcurrentVector move assignment across allocators",
+          "[ConcurrentVector]")
+{
+    SECTION("propagating allocator moves with the segments")
+    {
+        using Allocator = ArenaAllocator<int, true>;
+        ara::core::ConcurrentVector<int, Allocator> source{Allocator{1}};
+        for (int i = 0; i < 100; ++i) { source.push_back(i); }
+
+        ara::core::ConcurrentVector<int, Allocator> target{Allocator{2}};
+        target.push_back(-1);
+        target = std::move(source);
+        CHECK(target.get_allocator().id == 1);
+        CHECK(target.size() == 100);
+        CHECK(target[99] == 99);
+    }
+
+    SECTION("non-propagating allocator moves the elements")
+    {
+        using Allocator = ArenaAllocator<int, false>;
+        ara::core::ConcurrentVector<int, Allocator> source{Allocator{1}};
+        for (int i = 0; i < 100; ++i) { source.push_back(i); }
+
+        ara::core::ConcurrentVector<int, Allocator> target{Allocator{2}};
+        target = std::move(source);
+        CHECK(target.get_allocator().id == 2);
+        CHECK(target.size() == 100);
+        CHECK(target[99] == 99);
+        CHECK(source.empty());
+    }
+
+    CHECK(arenaBlocks.empty());
+}
+
+TEST_CASE("ConcurrentVector concurrent producers and readers",
+          "[ConcurrentVector]")
+{
+    constexpr int kProducers = 4;
+    constexpr int kPerThread = 20000;
+
+    ara::core::ConcurrentVector<int> vector;
+    std::atomic<bool>                done{false};
+    std::atomic<bool>                consistent{true};
+
+    std::thread reader([&] {
+        while (! done.load())
+        {
+            // Every published element is fully constructed (non-zero).
+            for (int value : vector)
+            {
+                if (value <= 0)
+                { consistent = false; }
+            }
+        }
+    });
+
+    ara::core::Vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p)
+    {
+        producers.emplace_back([&vector, p] {
+            for (int i = 0; i < kPerThread; ++i)
+            { vector.push_back(p * kPerThread + i + 1); }
+        });
+    }
+    for (auto& producer : producers) { producer.join(); }
+    done = true;
+    reader.join();
+
+    CHECK(consistent.load());
+    REQUIRE(vector.size() == std::size_t{kProducers * kPerThread});
+
+    ara::core::Vector<char> seen(vector.size() + 1, 0);
+    for (int value : vector) { seen[static_cast<std::size_t>(value)] = 1; }
+    CHECK(std::count(seen.begin(), seen.end(), 1) == kProducers * kPerThread);
+}
@@ -0,0 +1,218 @@
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+
+#include "allocation_counter.h"
+#include "ara/core/flat_map.h"
+#include "ara/core/map.h"
+
+TEST_CASE("FlatMap insert / find / at", "[FlatMap]")
+{
+    ara::core::FlatMap<std::string, int> map;
+
+    CHECK(map.insert({"b", 2}).second);
+    CHECK(map.insert({"a", 1}).second);
+    CHECK_FALSE(map.insert({"a", 3}).second);
+    CHECK(map.emplace("c", 3).second);
+
+    REQUIRE(map.size() == 3);
+    CHECK(map.at("a") == 1);
+    CHECK(map["b"] == 2);
+    CHECK(map.find("c")->second == 3);
+    CHECK(map.find("d") == map.end());
+    CHECK(map.count("a") == 1);
+    CHECK(map.count("z") == 0);
+    CHECK(map.contains("b"));
+    CHECK_FALSE(map.contains("z"));
+    CHECK_THROWS_AS(map.at("z"), std::out_of_range);
+
+    map["d"] = 4;
+    CHECK(map.keys() == ara::core::Vector<std::string>{"a", "b", "c", "d"});
+    CHECK(map.values() == ara::core::Vector<int>{1, 2, 3, 4});
+}
+
+TEST_CASE("FlatMap iterates like Map", "[FlatMap]")
+{
+    ara::core::Map<int, int>     tree{{3, 30}, {1, 10}, {2, 20}};
+    ara::core::FlatMap<int, int> flat{{3, 30}, {1, 10}, {2, 20}};
+
+    auto const same = [](const auto& lhs, const auto& rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    };
+    CHECK(std::equal(
+      flat.begin(), flat.end(), tree.begin(), tree.end(), same));
+    CHECK(std::equal(
+      flat.rbegin(), flat.rend(), tree.rbegin(), tree.rend(), same));
+
+    for (auto [key, value] : flat) { value = key * 100; }
+    CHECK(flat.at(2) == 200);
+
+    ara::core::FlatMap<int, int>::const_iterator it = flat.begin();
+    CHECK(it == flat.cbegin());
+    CHECK(flat.end() - it == 3);
+    CHECK(it[2].first == 3);
+}
+
+TEST_CASE("FlatMap lower_bound / upper_bound / equal_range", "[FlatMap]")
+{
+    ara::core::FlatMap<int, int> const map{{10, 1}, {20, 2}, {30, 3}};
+
+    CHECK(map.lower_bound(20)->first == 20);
+    CHECK(map.lower_bound(21)->first == 30);
+    CHECK(map.upper_bound(20)->first == 30);
+    CHECK(map.upper_bound(30) == map.end());
+
+    auto const hit = map.equal_range(20);
+    CHECK(std::distance(hit.first, hit.second) == 1);
+    CHECK(hit.first->second == 2);
+
+    auto const miss = map.equal_range(25);
+    CHECK(miss.first == miss.second);
+    CHECK(miss.first->first == 30);
+}
+
+TEST_CASE("FlatMap emplace_hint", "[FlatMap]")
+{
+    ara::core::FlatMap<int, int> map;
+
+    for (int i = 0; i < 10; ++i) { map.emplace_hint(map.end(), i, i); }
+    CHECK(map.size() == 10);
+
+    // wrong hints still insert at the right position
+    auto const it = map.emplace_hint(map.begin(), 20, 20);
+    CHECK(it->first == 20);
+    CHECK(std::prev(map.end())->first == 20);
+
+    // existing keys are not replaced
+    CHECK(map.emplace_hint(map.begin(), 5, 50)->second == 5);
+    CHECK(map.size() == 11);
+}
+
+TEST_CASE("FlatMap insert_or_assign", "[FlatMap]")
+{
+    ara::core::FlatMap<std::string, int> map;
+
+    std::string const key = "b";
+    CHECK(map.insert_or_assign(key, 2).second);
+    CHECK(map.insert_or_assign(std::string("a"), 1).second);
+    auto const [it, inserted] = map.insert_or_assign("a", 10);
+    CHECK_FALSE(inserted);
+    CHECK(it->first == "a");
+    CHECK(it->second == 10);
+
+    // correct and wrong hints both end up at the right position
+    CHECK(map.insert_or_assign(map.end(), "c", 3)->first == "c");
+    CHECK(map.insert_or_assign(map.end(), std::string("0"), 0)->first == "0");
+    CHECK(map.insert_or_assign(map.begin(), key, 20)->second == 20);
+
+    CHECK(map.keys() == ara::core::Vector<std::string>{"0", "a", "b", "c"});
+    CHECK(map.values() == ara::core::Vector<int>{0, 10, 20, 3});
+}
+
+TEST_CASE("FlatMap bulk insert", "[FlatMap]")
+{
+    ara::core::FlatMap<int, std::string> map{{2, "two"}, {4, "four"}};
+
+    ara::core::Vector<std::pair<int, std::string>> const incoming{
+      {5, "five"}, {1, "one"}, {4, "FOUR"}, {3, "three"}, {1, "ONE"}};
+    map.insert(incoming.begin(), incoming.end());
+
+    CHECK(map.keys() == ara::core::Vector<int>{1, 2, 3, 4, 5});
+    CHECK(map.at(1) == "one");
+    CHECK(map.at(4) == "four");
+
+    map.insert(ara::core::sorted_unique, {{0, "zero"}, {6, "six"}});
+    CHECK(map.size() == 7);
+    CHECK(map.begin()->second == "zero");
+    CHECK(map.rbegin()->second == "six");
+}
+
+TEST_CASE("FlatMap adopts containers", "[FlatMap]")
+{
+    ara::core::FlatMap<int, char> unsorted{
+      ara::core::Vector<int>{3, 1, 2, 1},
+      ara::core::Vector<char>{'c', 'a', 'b', 'x'}};
+    CHECK(unsorted.keys() == ara::core::Vector<int>{1, 2, 3});
+    CHECK(unsorted.values() == ara::core::Vector<char>{'a', 'b', 'c'});
+
+    ara::core::Vector<int>        keys{1, 2, 3};
+    int const*                    data = keys.data();
+    ara::core::FlatMap<int, char> sorted{
+      ara::core::sorted_unique,
+      std::move(keys),
+      ara::core::Vector<char>{'a', 'b', 'c'}};
+    CHECK(sorted.keys().data() == data);
+    CHECK(sorted == unsorted);
+
+    auto containers = std::move(sorted).extract();
+    CHECK(sorted.empty());
+    CHECK(containers.keys.data() == data);
+
+    containers.keys.push_back(4);
+    containers.values.push_back('d');
+    sorted.replace(std::move(containers.keys), std::move(containers.values));
+    CHECK(sorted.at(4) == 'd');
+    CHECK(unsorted < sorted);
+
+    CHECK_THROWS_AS((ara::core::FlatMap<int, char>{ara::core::Vector<int>{1},
+                                                   ara::core::Vector<char>{}}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("FlatMap erase", "[FlatMap]")
+{
+    ara::core::FlatMap<int, int> map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+
+    CHECK(map.erase(2) == 1);
+    CHECK(map.erase(2) == 0);
+    CHECK(map.erase(map.begin())->first == 3);
+    auto const next = map.erase(map.begin(), map.end());
+    CHECK(next == map.end());
+    CHECK(map.empty());
+}
+
+TEST_CASE("FlatMap with custom comparator", "[FlatMap]")
+{
+    ara::core::FlatMap<int, int, std::greater<int>> map{
+      {1, 1}, {3, 3}, {2, 2}};
+
+    CHECK(map.keys() == ara::core::Vector<int>{3, 2, 1});
+    CHECK(map.lower_bound(2)->first == 2);
+    CHECK(map.upper_bound(2)->first == 1);
+}
+
+TEST_CASE("FlatMap transparent lookup does not allocate", "[FlatMap]")
+{
+    std::string const longKey(64, 'k');
+
+    ara::core::FlatMap<std::string, int, ara::core::StringLess> map{
+      {longKey, 1}, {"b", 2}, {"d", 4}};
+    const auto& constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found      = map.find(key);
+    auto const                  count      = map.count(key);
+    auto const                  missing    = map.count("c");
+    auto const                  lower      = map.lower_bound("c");
+    auto const                  upper      = map.upper_bound("b");
+    auto const                  range      = map.equal_range("b");
+    auto const                  constFound = constMap.find("d");
+    auto const                  constRange = constMap.equal_range("x");
+    bool const                  contained  = map.contains(key);
+    bool const                  absent     = map.contains("c");
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found->second == 1);
+    CHECK(count == 1);
+    CHECK(missing == 0);
+    CHECK(lower->first == "d");
+    CHECK(upper->first == "d");
+    CHECK(range.second - range.first == 1);
+    CHECK(constFound->second == 4);
+    CHECK(constRange.first == constMap.end());
+    CHECK(contained);
+    CHECK_FALSE(absent);
+}
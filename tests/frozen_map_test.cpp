@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ara/core/core_error_domain.h"
+#include "ara/core/frozen_map.h"
+#include "ara/core/string_view.h"
+
+namespace {
+using ara::core::StringView;
+
+constexpr auto kNames = ara::core::MakeFrozenMap<int, StringView>(
+  {{1, "one"}, {2, "two"}, {3, "three"}, {-4, "minus four"}, {1000, "k"}});
+
+static_assert(kNames.size() == 5);
+static_assert(kNames.at(2) == "two");
+static_assert(kNames.at(-4) == "minus four");
+static_assert(! kNames.contains(4));
+static_assert(std::is_trivially_destructible_v<decltype(kNames)>);
+
+constexpr auto kErrors =
+  ara::core::MakeFrozenMap<ara::core::CoreErrc, StringView>(
+    {{ara::core::CoreErrc::kInvalidArgument, "invalid argument"},
+     {ara::core::CoreErrc::kInvalidMetaModelShortname, "shortname"},
+     {ara::core::CoreErrc::kInvalidMetaModelPath, "path"}});
+
+static_assert(kErrors.at(ara::core::CoreErrc::kInvalidMetaModelPath)
+              == "path");
+
+constexpr auto kKeywords =
+  ara::core::MakeFrozenSet<StringView>({"if", "else", "for", "while", "do"});
+
+static_assert(kKeywords.contains("while"));
+static_assert(! kKeywords.contains("switch"));
+
+/**
+ * @brief A large table, built at compile time from sparse keys.
+ */
+constexpr std::size_t kLarge = 1000;
+
+constexpr std::array<std::pair<std::uint32_t, std::uint32_t>, kLarge>
+LargeItems()
+{
+    std::array<std::pair<std::uint32_t, std::uint32_t>, kLarge> items{};
+    for (std::uint32_t i = 0; i < kLarge; ++i) { items[i] = {i * 7919u, i}; }
+
+    return items;
+}
+
+constexpr ara::core::FrozenMap<std::uint32_t, std::uint32_t, kLarge> kLargeMap{
+  LargeItems()};
+}  // namespace
+
+TEST_CASE("FrozenMap lookup", "[FrozenMap]")
+{
+    CHECK(kNames.find(1)->second == "one");
+    CHECK(kNames.find(1000)->second == "k");
+    CHECK(kNames.find(5) == kNames.end());
+    CHECK(kNames.count(3) == 1);
+    CHECK(kNames.count(0) == 0);
+    CHECK_THROWS_AS(kNames.at(0), std::out_of_range);
+
+    StringView const order[] = {"one", "two", "three", "minus four", "k"};
+    bool             inOrder = true;
+    std::size_t      i       = 0;
+    for (const auto& [key, value] : kNames) { inOrder &= value == order[i++]; }
+    CHECK(inOrder);
+    CHECK(i == kNames.size());
+
+    CHECK(kErrors.at(ara::core::CoreErrc::kInvalidArgument)
+          == "invalid argument");
+}
+
+TEST_CASE("FrozenMap large table", "[FrozenMap]")
+{
+    bool allFound = true;
+    bool noFalse  = true;
+    for (std::uint32_t i = 0; i < kLarge; ++i)
+    {
+        auto const it = kLargeMap.find(i * 7919u);
+        allFound &= it != kLargeMap.end() && it->second == i;
+        noFalse &= ! kLargeMap.contains(i * 7919u + 1);
+    }
+
+    CHECK(allFound);
+    CHECK(noFalse);
+}
+
+TEST_CASE("FrozenSet lookup", "[FrozenMap]")
+{
+    CHECK(kKeywords.size() == 5);
+    CHECK(kKeywords.contains("for"));
+    CHECK(*kKeywords.find("do") == "do");
+    CHECK(kKeywords.find("") == kKeywords.end());
+
+    constexpr auto kEmpty = ara::core::FrozenSet<int, 0>{std::array<int, 0>{}};
+    CHECK(kEmpty.empty());
+    CHECK_FALSE(kEmpty.contains(0));
+}
+
+TEST_CASE("FrozenMap rejects duplicate keys", "[FrozenMap]")
+{
+    CHECK_THROWS_AS((ara::core::MakeFrozenMap<int, int>(
+                      {{1, 1}, {2, 2}, {1, 3}})),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(ara::core::MakeFrozenSet<StringView>({"a", "b", "a"}),
+                    std::invalid_argument);
+}
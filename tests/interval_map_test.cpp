@@ -0,0 +1,309 @@
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ara/core/interval_map.h"
+#include "ara/core/memory_footprint.h"
+
+namespace {
+using Segments = std::vector<std::pair<std::pair<int, int>, char>>;
+
+template<class IntervalMap> Segments SegmentsOf(const IntervalMap& map)
+{
+    Segments segments;
+    for (const auto& segment : map)
+    {
+        segments.push_back(
+          {{segment.lower, segment.upper}, static_cast<char>(segment.value)});
+    }
+
+    return segments;
+}
+
+/**
+ * @brief Checks that the segments are non-empty, sorted, disjoint and
+ * coalesced.
+ */
+template<class IntervalMap> bool IsCanonical(const IntervalMap& map)
+{
+    const typename IntervalMap::value_type* previous = nullptr;
+    for (const auto& segment : map)
+    {
+        if (! (segment.lower < segment.upper))
+        { return false; }
+        if (previous != nullptr
+            && (segment.lower < previous->upper
+                || (segment.lower == previous->upper
+                    && segment.value == previous->value)))
+        { return false; }
+        previous = &segment;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Number of allocations LimitedAllocator still grants.
+ */
+int allocationBudget = 0;
+
+/**
+ * @brief Allocator that throws std::bad_alloc once allocationBudget is used
+ * up.
+ */
+template<class T> struct LimitedAllocator
+{
+    using value_type = T;
+
+    LimitedAllocator() = default;
+
+    template<class U> LimitedAllocator(const LimitedAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        if (allocationBudget == 0)
+        { throw std::bad_alloc(); }
+        --allocationBudget;
+
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    friend bool
+    operator==(const LimitedAllocator&, const LimitedAllocator&) = default;
+};
+}  // namespace
+
+TEST_CASE("IntervalMap assign splits, overwrites and coalesces",
+          "[IntervalMap]")
+{
+    ara::core::IntervalMap<int, char> map;
+    CHECK(map.empty());
+    CHECK(map.find(0) == map.end());
+
+    map.assign(10, 20, 'a');
+    map.assign(30, 40, 'b');
+    CHECK(SegmentsOf(map) == Segments{{{10, 20}, 'a'}, {{30, 40}, 'b'}});
+    CHECK(map.at(10) == 'a');
+    CHECK(map.at(39) == 'b');
+    CHECK_FALSE(map.contains(20));
+    CHECK_FALSE(map.contains(9));
+    CHECK_THROWS_AS(map.at(25), std::out_of_range);
+
+    // Inside a segment with another value: split into three.
+    map.assign(12, 15, 'c');
+    CHECK(SegmentsOf(map)
+          == Segments{{{10, 12}, 'a'},
+                      {{12, 15}, 'c'},
+                      {{15, 20}, 'a'},
+                      {{30, 40}, 'b'}});
+
+    // Across several segments and a gap, cutting both ends.
+    map.assign(14, 35, 'd');
+    CHECK(SegmentsOf(map)
+          == Segments{{{10, 12}, 'a'},
+                      {{12, 14}, 'c'},
+                      {{14, 35}, 'd'},
+                      {{35, 40}, 'b'}});
+
+    // Adjacent to equal values on both sides: coalesced.
+    map.assign(40, 50, 'b');
+    map.assign(5, 10, 'a');
+    map.assign(12, 14, 'a');
+    CHECK(SegmentsOf(map)
+          == Segments{{{5, 14}, 'a'}, {{14, 35}, 'd'}, {{35, 50}, 'b'}});
+    map.assign(14, 35, 'a');
+    map.assign(35, 50, 'a');
+    CHECK(SegmentsOf(map) == Segments{{{5, 50}, 'a'}});
+
+    // Empty and inverted ranges do nothing.
+    map.assign(7, 7, 'x');
+    map.assign(8, 6, 'x');
+    map.erase(9, 9);
+    CHECK(map.size() == 1);
+}
+
+TEST_CASE("IntervalMap assign leaves the map unchanged if allocation fails",
+          "[IntervalMap]")
+{
+    using Allocator = LimitedAllocator<std::pair<const int, char>>;
+
+    allocationBudget = 3;
+    ara::core::IntervalMap<int, char, std::less<int>, Allocator> map;
+    map.assign(10, 20, 'a');
+    map.assign(30, 40, 'b');
+    map.assign(40, 50, 'c');
+    Segments const before = SegmentsOf(map);
+
+    // Split into three, cut both ends of a gap, cut one segment in two.
+    for (auto const& [lower, upper] : {std::pair{12, 15},
+                                      std::pair{15, 25},
+                                      std::pair{32, 35},
+                                      std::pair{35, 45}})
+    {
+        allocationBudget = 0;
+        CHECK_THROWS_AS(map.assign(lower, upper, 'x'), std::bad_alloc);
+        CHECK(SegmentsOf(map) == before);
+    }
+
+    allocationBudget = 1;
+    CHECK_THROWS_AS(map.assign(12, 15, 'x'), std::bad_alloc);
+    CHECK(SegmentsOf(map) == before);
+
+    allocationBudget = 3;
+    map.assign(12, 15, 'x');
+    map.assign(35, 45, 'x');
+    CHECK(SegmentsOf(map)
+          == Segments{{{10, 12}, 'a'},
+                      {{12, 15}, 'x'},
+                      {{15, 20}, 'a'},
+                      {{30, 35}, 'b'},
+                      {{35, 45}, 'x'},
+                      {{45, 50}, 'c'}});
+}
+
+TEST_CASE("IntervalMap erase and overlap queries", "[IntervalMap]")
+{
+    ara::core::IntervalMap<int, char> map;
+    map.assign(0, 100, 'a');
+    map.erase(10, 20);
+    map.erase(50, 60);
+    CHECK(SegmentsOf(map)
+          == Segments{{{0, 10}, 'a'}, {{20, 50}, 'a'}, {{60, 100}, 'a'}});
+
+    map.erase(5, 70);
+    CHECK(SegmentsOf(map) == Segments{{{0, 5}, 'a'}, {{70, 100}, 'a'}});
+
+    CHECK(map.overlaps(4, 6));
+    CHECK_FALSE(map.overlaps(5, 70));
+    CHECK(map.overlaps(69, 71));
+    CHECK_FALSE(map.overlaps(100, 200));
+    CHECK_FALSE(map.overlaps(3, 3));
+
+    auto const [first, last] = map.overlapping(-10, 1000);
+    CHECK(std::distance(first, last) == 2);
+    auto const [inner, innerEnd] = map.overlapping(80, 90);
+    REQUIRE(inner != innerEnd);
+    CHECK(inner->lower == 70);
+    CHECK(std::next(inner) == innerEnd);
+
+    map.erase(-100, 1000);
+    CHECK(map.empty());
+}
+
+TEST_CASE("IntervalMap trims a segment starting at the lower bound",
+          "[IntervalMap]")
+{
+    ara::core::IntervalMap<int, char> map;
+    map.assign(0, 10, 'a');
+    map.assign(0, 5, 'b');
+    CHECK(SegmentsOf(map) == Segments{{{0, 5}, 'b'}, {{5, 10}, 'a'}});
+
+    map.assign(20, 30, 'c');
+    map.assign(20, 25, 'd');
+    map.assign(40, 50, 'e');
+    map.erase(40, 45);
+    CHECK(SegmentsOf(map)
+          == Segments{{{0, 5}, 'b'},
+                      {{5, 10}, 'a'},
+                      {{20, 25}, 'd'},
+                      {{25, 30}, 'c'},
+                      {{45, 50}, 'e'}});
+
+    map.erase(0, 5);
+    CHECK(SegmentsOf(map).front() == Segments::value_type{{5, 10}, 'a'});
+    CHECK(IsCanonical(map));
+}
+
+TEST_CASE("IntervalMap agrees with an array of values", "[IntervalMap]")
+{
+    constexpr std::size_t kKeys = 64;
+
+    ara::core::IntervalMap<std::size_t, char>  map;
+    std::array<std::optional<char>, kKeys>     expected{};
+    std::mt19937                               gen{59};
+    std::uniform_int_distribution<std::size_t> key{0, kKeys};
+    std::uniform_int_distribution<int>         value{'a', 'c'};
+    std::uniform_int_distribution<int>         action{0, 3};
+
+    std::size_t divergence = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        std::size_t lower = key(gen);
+        std::size_t upper = key(gen);
+        char const  v     = static_cast<char>(value(gen));
+        if (lower > upper)
+        { std::swap(lower, upper); }
+
+        if (action(gen) == 0)
+        {
+            map.erase(lower, upper);
+            for (auto k = lower; k < upper; ++k) { expected[k].reset(); }
+        }
+        else
+        {
+            map.assign(lower, upper, v);
+            for (auto k = lower; k < upper; ++k) { expected[k] = v; }
+        }
+
+        divergence += ! IsCanonical(map);
+        std::size_t runs = 0;
+        for (std::size_t k = 0; k < kKeys; ++k)
+        {
+            auto const it = map.find(k);
+            divergence += (it == map.end()) != ! expected[k].has_value();
+            divergence += it != map.end() && it->value != *expected[k];
+            runs += expected[k].has_value()
+                    && (k == 0 || expected[k] != expected[k - 1]);
+        }
+        divergence += map.size() != runs;
+
+        bool expectOverlap = false;
+        for (auto k = lower; k < upper; ++k)
+        { expectOverlap |= expected[k].has_value(); }
+        divergence += map.overlaps(lower, upper) != expectOverlap;
+    }
+    CHECK(divergence == 0);
+}
+
+TEST_CASE("IntervalMap with string values and custom order", "[IntervalMap]")
+{
+    ara::core::IntervalMap<std::uint64_t, std::string, std::greater<>> map{
+      std::greater<>()};
+    map.assign(100, 50, "high");
+    map.assign(60, 10, "low");
+    CHECK(map.at(99) == "high");
+    CHECK(map.at(60) == "low");
+    CHECK(map.at(11) == "low");
+    CHECK_FALSE(map.contains(10));
+    CHECK(map.size() == 2);
+    CHECK(map.begin()->lower == 100);
+    CHECK(map.begin()->upper == 60);
+
+    auto copy = map;
+    CHECK(copy == map);
+    copy.assign(60, 50, "high");
+    CHECK_FALSE(copy == map);
+    CHECK(copy.size() == 2);
+
+    auto const footprint = ara::core::memory_footprint(map);
+    CHECK(footprint.allocations == 2);
+
+    // Values owning heap memory are measured once per segment.
+    copy.assign(40, 30, std::string(100, 'x'));
+    CHECK(ara::core::memory_footprint(copy).allocations == 5);
+}
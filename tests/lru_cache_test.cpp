@@ -0,0 +1,367 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <list>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "ara/core/lru_cache.h"
+
+namespace {
+/**
+ * @brief Keys of the elements of cache, newest or most recently used first.
+ */
+template<class Cache> std::vector<int> Keys(const Cache& cache)
+{
+    std::vector<int> keys;
+    cache.for_each([&keys](int key, const auto&) { keys.push_back(key); });
+
+    return keys;
+}
+
+struct StringWeight
+{
+    std::size_t operator()(int, const std::string& value) const noexcept
+    {
+        return value.size();
+    }
+};
+
+/**
+ * @brief Weighs by string length, but rejects empty strings.
+ */
+struct NonEmptyWeight
+{
+    std::size_t operator()(int, const std::string& value) const
+    {
+        if (value.empty())
+        { throw std::invalid_argument("NonEmptyWeight"); }
+
+        return value.size();
+    }
+};
+
+/**
+ * @brief LRU cache the way it is written by hand, as a reference.
+ */
+class ListLru
+{
+ public:
+    explicit ListLru(std::size_t capacity) : capacity_(capacity) {}
+
+    const int* find(int key)
+    {
+        auto const it = index_.find(key);
+        if (it == index_.end())
+        { return nullptr; }
+
+        order_.splice(order_.begin(), order_, it->second);
+        return &it->second->second;
+    }
+
+    void insert_or_assign(int key, int value)
+    {
+        if (find(key) != nullptr)
+        {
+            order_.front().second = value;
+            return;
+        }
+        if (order_.size() == capacity_)
+        {
+            index_.erase(order_.back().first);
+            order_.pop_back();
+        }
+        order_.emplace_front(key, value);
+        index_[key] = order_.begin();
+    }
+
+    void erase(int key)
+    {
+        auto const it = index_.find(key);
+        if (it != index_.end())
+        {
+            order_.erase(it->second);
+            index_.erase(it);
+        }
+    }
+
+ private:
+    std::size_t                                                 capacity_;
+    std::list<std::pair<int, int>>                              order_;
+    std::map<int, std::list<std::pair<int, int>>::iterator> index_;
+};
+}  // namespace
+
+TEST_CASE("LruCache evicts the least recently used element", "[LruCache]")
+{
+    ara::core::LruCache<int, std::string> cache(3);
+    CHECK(cache.try_emplace(1, "one").second);
+    CHECK(cache.try_emplace(2, "two").second);
+    CHECK(cache.try_emplace(3, "three").second);
+    CHECK_FALSE(cache.try_emplace(3, "drei").second);
+    CHECK(Keys(cache) == std::vector<int>{3, 2, 1});
+
+    REQUIRE(cache.find(1) != nullptr);
+    CHECK(*cache.find(1) == "one");
+    CHECK(cache.find(4) == nullptr);
+    CHECK(Keys(cache) == std::vector<int>{1, 3, 2});
+
+    CHECK(*cache.insert_or_assign(4, "four") == "four");
+    CHECK(Keys(cache) == std::vector<int>{4, 1, 3});
+    CHECK_FALSE(cache.contains(2));
+
+    // Neither peek() nor contains() count as a use.
+    CHECK(*cache.peek(3) == "three");
+    CHECK(cache.insert_or_assign(5, "five") != nullptr);
+    CHECK(Keys(cache) == std::vector<int>{5, 4, 1});
+
+    CHECK(cache.stats()
+          == ara::core::CacheStats{.hits = 2, .misses = 1, .evictions = 2});
+    cache.reset_stats();
+    CHECK(cache.stats() == ara::core::CacheStats{});
+
+    CHECK(cache.erase(4) == 1);
+    CHECK(cache.erase(4) == 0);
+    CHECK(Keys(cache) == std::vector<int>{5, 1});
+    cache.clear();
+    CHECK(cache.empty());
+    CHECK(cache.insert_or_assign(6, "six") != nullptr);
+    CHECK(cache.size() == 1);
+}
+
+TEST_CASE("SieveCache evicts unvisited elements", "[LruCache]")
+{
+    ara::core::SieveCache<int, int> cache(3);
+    for (int key = 1; key <= 3; ++key) { cache.try_emplace(key, key); }
+
+    // A hit marks the element and leaves the order alone.
+    REQUIRE(cache.find(1) != nullptr);
+    CHECK(Keys(cache) == std::vector<int>{3, 2, 1});
+
+    // The hand spares 1, clearing its mark, and evicts 2, then moves on to
+    // the newer elements, evicting each unvisited one it reaches.
+    cache.try_emplace(4, 4);
+    CHECK(Keys(cache) == std::vector<int>{4, 3, 1});
+    cache.try_emplace(5, 5);
+    cache.try_emplace(6, 6);
+    cache.try_emplace(7, 7);
+    CHECK(Keys(cache) == std::vector<int>{7, 6, 1});
+    CHECK(cache.stats().evictions == 4);
+
+    // New elements are evicted quickly while 1 stays.
+    cache.try_emplace(8, 8);
+    CHECK(Keys(cache) == std::vector<int>{8, 7, 1});
+
+    // With the newer elements marked, the hand wraps around to 1.
+    REQUIRE(cache.find(7) != nullptr);
+    REQUIRE(cache.find(8) != nullptr);
+    cache.try_emplace(9, 9);
+    CHECK(Keys(cache) == std::vector<int>{9, 8, 7});
+
+    // A scan of keys used once does not evict a marked element.
+    REQUIRE(cache.find(7) != nullptr);
+    for (int key = 100; key < 110; ++key) { cache.try_emplace(key, key); }
+    CHECK(cache.contains(7));
+}
+
+TEST_CASE("BoundedCache limited by weight", "[LruCache]")
+{
+    ara::core::LruCache<int,
+                        std::string,
+                        std::hash<int>,
+                        std::equal_to<int>,
+                        StringWeight>
+      cache(10);
+    cache.try_emplace(1, "aaaa");
+    cache.try_emplace(2, "bbbb");
+    CHECK(cache.weight() == 8);
+    CHECK(cache.try_emplace(3, "ccc").first != nullptr);
+    CHECK(Keys(cache) == std::vector<int>{3, 2});
+    CHECK(cache.weight() == 7);
+
+    // Heavier than the capacity: not cached, and the old value goes away.
+    CHECK(cache.try_emplace(4, std::string(11, 'd')).first == nullptr);
+    CHECK(cache.insert_or_assign(2, std::string(11, 'b')) == nullptr);
+    CHECK(Keys(cache) == std::vector<int>{3});
+    CHECK(cache.weight() == 3);
+
+    // Growing an element evicts others, never the element itself.
+    cache.try_emplace(5, "ee");
+    cache.try_emplace(6, "ff");
+    CHECK(*cache.insert_or_assign(3, std::string(8, 'c')) == "cccccccc");
+    CHECK(Keys(cache) == std::vector<int>{3, 6});
+    CHECK(cache.weight() == 10);
+
+    cache.set_capacity(8);
+    CHECK(Keys(cache) == std::vector<int>{3});
+    cache.set_capacity(0);
+    CHECK(cache.empty());
+    CHECK(cache.weight() == 0);
+    CHECK(cache.try_emplace(7, "").first != nullptr);
+}
+
+TEST_CASE("BoundedCache keeps its order if the weigher throws", "[LruCache]")
+{
+    ara::core::LruCache<int,
+                        std::string,
+                        std::hash<int>,
+                        std::equal_to<int>,
+                        NonEmptyWeight>
+      cache(6);
+    cache.try_emplace(1, "a");
+    cache.try_emplace(2, "b");
+    cache.try_emplace(3, "c");
+
+    CHECK_THROWS_AS(cache.insert_or_assign(2, ""), std::invalid_argument);
+    CHECK(Keys(cache) == std::vector<int>{3, 2, 1});
+    CHECK(cache.weight() == 3);
+
+    // Eviction still walks the whole list.
+    cache.try_emplace(4, "dddd");
+    CHECK(Keys(cache) == std::vector<int>{4, 3, 2});
+    CHECK(cache.weight() == 6);
+    cache.try_emplace(5, "e");
+    CHECK(Keys(cache) == std::vector<int>{5, 4, 3});
+}
+
+TEST_CASE("LruCache agrees with a list-based LRU cache", "[LruCache]")
+{
+    ara::core::LruCache<int, int>      cache(50);
+    ListLru                            expected(50);
+    std::mt19937                       gen{43};
+    std::uniform_int_distribution<int> key{0, 99};
+    std::uniform_int_distribution<int> action{0, 9};
+
+    std::size_t divergence = 0;
+    for (int i = 0; i < 20000; ++i)
+    {
+        int const k = key(gen);
+        switch (action(gen))
+        {
+        case 0: cache.erase(k); expected.erase(k); break;
+        case 1:
+        case 2:
+        case 3:
+            cache.insert_or_assign(k, i);
+            expected.insert_or_assign(k, i);
+            break;
+        default:
+        {
+            auto const* const value = cache.find(k);
+            auto const* const other = expected.find(k);
+            divergence += (value == nullptr) != (other == nullptr);
+            divergence += value != nullptr && other != nullptr
+                          && *value != *other;
+            break;
+        }
+        }
+        divergence += cache.size() > 50;
+    }
+    CHECK(divergence == 0);
+}
+
+TEST_CASE("BoundedCache hardly allocates once warm", "[LruCache]")
+{
+    ara::core::LruCache<std::uint64_t, std::uint64_t>   lru(256);
+    ara::core::SieveCache<std::uint64_t, std::uint64_t> sieve(256);
+    for (std::uint64_t key = 0; key < 512; ++key)
+    {
+        lru.try_emplace(key, key);
+        sieve.try_emplace(key, key);
+    }
+
+    std::mt19937_64                              gen{47};
+    std::uniform_int_distribution<std::uint64_t> key{0, 1023};
+    test::AllocationCounter const                counter;
+    for (int i = 0; i < 10000; ++i)
+    {
+        std::uint64_t const k = key(gen);
+        if (lru.find(k) == nullptr)
+        { lru.try_emplace(k, k); }
+        if (sieve.find(k) == nullptr)
+        { sieve.try_emplace(k, k); }
+    }
+    // Only the index allocates, when it rebuilds after many erasures.
+    auto const misses = lru.stats().misses + sieve.stats().misses;
+    CHECK(misses > 5000);
+    CHECK(counter.allocations() * 1000 < misses);
+    CHECK(lru.size() == 256);
+    CHECK(sieve.size() == 256);
+    CHECK(lru.stats().hits + lru.stats().misses == 10000);
+}
+
+TEST_CASE("BoundedCache copy and move", "[LruCache]")
+{
+    ara::core::SieveCache<int, std::string> cache(4);
+    for (int key = 0; key < 6; ++key)
+    { cache.try_emplace(key, std::to_string(key)); }
+
+    auto copy = cache;
+    CHECK(Keys(copy) == Keys(cache));
+    copy.try_emplace(6, "6");
+    CHECK(Keys(copy) != Keys(cache));
+
+    auto moved = std::move(cache);
+    CHECK(moved.size() == 4);
+    CHECK(cache.empty());  // NOLINT(bugprone-use-after-move)
+    CHECK(cache.try_emplace(1, "1").second);
+
+    copy = std::move(moved);
+    CHECK(copy.size() == 4);
+    CHECK(copy.contains(5));
+}
+
+TEST_CASE("ShardedCache with concurrent readers and writers", "[LruCache]")
+{
+    using Cache = ara::core::ShardedCache<ara::core::LruCache<int, int>>;
+
+    Cache cache(1024, 8);
+    CHECK(cache.shard_count() == 8);
+
+    constexpr int kThreads = 4;
+    constexpr int kLookups = 20000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t)
+    {
+        threads.emplace_back([&cache, t] {
+            std::mt19937                       gen{static_cast<unsigned>(t)};
+            std::uniform_int_distribution<int> key{0, 2047};
+            for (int i = 0; i < kLookups; ++i)
+            {
+                int const  k     = key(gen);
+                auto const value = cache.find(k);
+                if (! value)
+                { cache.try_emplace(k, k * 2); }
+                else if (*value != k * 2)
+                { cache.erase(k); }
+            }
+        });
+    }
+    for (auto& thread : threads) { thread.join(); }
+
+    auto const stats = cache.stats();
+    CHECK(stats.hits + stats.misses == kThreads * kLookups);
+    CHECK(stats.hits > 0);
+    CHECK(cache.size() <= 1024);
+    CHECK(cache.size() == cache.weight());
+
+    bool consistent = true;
+    for (int key = 0; key < 2048; ++key)
+    {
+        cache.visit(key, [&](int value) { consistent &= value == key * 2; });
+    }
+    CHECK(consistent);
+
+    CHECK(cache.insert_or_assign(5000, 1));
+    CHECK(cache.contains(5000));
+    CHECK(cache.erase(5000) == 1);
+    cache.clear();
+    CHECK(cache.size() == 0);
+}
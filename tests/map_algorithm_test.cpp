@@ -0,0 +1,133 @@
+#include <catch2/catch.hpp>
+
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "ara/core/map.h"
+#include "ara/core/map_algorithm.h"
+#include "ara/core/vector.h"
+
+namespace {
+using IntMap = ara::core::Map<int, int>;
+
+IntMap RandomMap(std::mt19937& gen, int keys, int values)
+{
+    std::uniform_int_distribution<int> key{0, keys - 1};
+    std::uniform_int_distribution<int> value{0, values - 1};
+    IntMap                             map;
+    for (int i = 0; i < keys / 2; ++i) { map[key(gen)] = value(gen); }
+
+    return map;
+}
+}  // namespace
+
+TEST_CASE("diff / apply_diff", "[MapAlgorithm]")
+{
+    IntMap const from{{1, 10}, {2, 20}, {3, 30}, {5, 50}};
+    IntMap const to{{0, 0}, {2, 20}, {3, 31}, {4, 40}};
+
+    auto const changes = ara::core::diff(from, to);
+    CHECK(changes.added
+          == ara::core::Vector<std::pair<int, int>>{{0, 0}, {4, 40}});
+    CHECK(changes.removed == ara::core::Vector<int>{1, 5});
+    CHECK(changes.changed == ara::core::Vector<std::pair<int, int>>{{3, 31}});
+    CHECK(changes.size() == 5);
+    CHECK(ara::core::diff(to, to).empty());
+
+    auto map = from;
+    ara::core::apply_diff(map, changes);
+    CHECK(map == to);
+}
+
+TEST_CASE("apply_diff turns random maps into each other", "[MapAlgorithm]")
+{
+    std::mt19937 gen{31};
+    for (int round = 0; round < 200; ++round)
+    {
+        // Few values make unchanged elements likely; few differences against
+        // a large map take the lookup path of apply_diff.
+        int const    keys = round % 2 == 0 ? 64 : 4096;
+        IntMap const from = RandomMap(gen, keys, 3);
+        IntMap       to   = from;
+        if (round % 4 < 2)
+        { to = RandomMap(gen, keys, 3); }
+        else
+        {
+            to.erase(to.begin());
+            to[keys] = 1;
+            to.begin()->second += 1;
+        }
+
+        auto const  changes  = ara::core::diff(from, to);
+        std::size_t expected = 0;
+        for (const auto& [key, value] : from)
+        {
+            auto const it = to.find(key);
+            expected += it == to.end() || it->second != value;
+        }
+        for (const auto& element : to)
+        { expected += from.count(element.first) == 0; }
+        CHECK(changes.size() == expected);
+
+        auto map = from;
+        ara::core::apply_diff(map, changes);
+        CHECK(map == to);
+    }
+}
+
+TEST_CASE("diff against a sorted range, with custom order and equality",
+          "[MapAlgorithm]")
+{
+    ara::core::Map<std::string, double, std::greater<>> const from{
+      {"c", 1.0}, {"b", 2.0}, {"a", 3.0}};
+    ara::core::Vector<std::pair<std::string, double>> const to{
+      {"d", 0.0}, {"b", 2.05}, {"a", 4.0}};
+
+    auto const changes =
+      ara::core::diff(from, to, [](double lhs, double rhs) {
+          return lhs - rhs < 0.1 && rhs - lhs < 0.1;
+      });
+    CHECK(changes.added.size() == 1);
+    CHECK(changes.added.front().first == "d");
+    CHECK(changes.removed == ara::core::Vector<std::string>{"c"});
+    CHECK(changes.changed.size() == 1);
+    CHECK(changes.changed.front().first == "a");
+
+    auto map = from;
+    ara::core::apply_diff(map, changes);
+    CHECK(map.size() == 3);
+    CHECK(map.begin()->first == "d");
+    CHECK(map.at("b") == 2.0);
+    CHECK(map.at("a") == 4.0);
+}
+
+TEST_CASE("intersect / union_with", "[MapAlgorithm]")
+{
+    IntMap const lhs{{1, 1}, {2, 2}, {4, 4}, {8, 8}};
+    IntMap const rhs{{2, 20}, {3, 30}, {8, 80}, {9, 90}};
+    ara::core::Vector<std::pair<int, int>> const range{{0, 0}, {4, 40}};
+
+    CHECK(ara::core::intersect(lhs, rhs) == IntMap{{2, 2}, {8, 8}});
+    CHECK(ara::core::intersect(lhs, range) == IntMap{{4, 4}});
+    CHECK(ara::core::intersect(lhs, IntMap{}).empty());
+
+    CHECK(ara::core::union_with(lhs, rhs, std::plus<>())
+          == IntMap{{1, 1}, {2, 22}, {3, 30}, {4, 4}, {8, 88}, {9, 90}});
+    CHECK(ara::core::union_with(IntMap{}, range, std::plus<>())
+          == IntMap{{0, 0}, {4, 40}});
+
+    std::size_t onlyLhs = 0;
+    std::size_t both    = 0;
+    std::size_t onlyRhs = 0;
+    ara::core::merge_join(
+      lhs,
+      rhs,
+      [&](const auto&) { ++onlyLhs; },
+      [&](const auto& l, const auto& r) { both += l.first == r.first; },
+      [&](const auto&) { ++onlyRhs; });
+    CHECK(onlyLhs == 2);
+    CHECK(both == 2);
+    CHECK(onlyRhs == 2);
+}
@@ -0,0 +1,217 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "ara/core/flat_map.h"
+#include "ara/core/map.h"
+#include "ara/core/map_image.h"
+
+namespace {
+/**
+ * @brief Trivially copyable value with padding bytes.
+ */
+struct Record
+{
+    std::uint8_t  kind;
+    std::uint64_t offset;
+
+    friend bool operator==(const Record&, const Record&) = default;
+};
+
+/**
+ * @brief Returns a copy of the header of image.
+ */
+ara::core::MapImageHeader
+HeaderOf(const ara::core::Vector<ara::core::Byte>& image)
+{
+    ara::core::MapImageHeader header;
+    std::memcpy(&header, image.data(), sizeof(header));
+
+    return header;
+}
+
+/**
+ * @brief Overwrites the header of image, without updating the checksum.
+ */
+void SetHeader(ara::core::Vector<ara::core::Byte>& image,
+               const ara::core::MapImageHeader&    header)
+{
+    std::memcpy(static_cast<void*>(image.data()), &header, sizeof(header));
+}
+}  // namespace
+
+TEST_CASE("MapImage of a Map", "[MapImage]")
+{
+    ara::core::Map<std::uint32_t, Record> map;
+    std::mt19937                          gen{71};
+    for (std::uint8_t i = 0; i < 200; ++i)
+    { map[static_cast<std::uint32_t>(gen())] = Record{i, gen()}; }
+
+    auto const image = ara::core::MakeMapImage(map);
+    CHECK(ara::core::MakeMapImage(map) == image);
+
+    ara::core::MapImage<std::uint32_t, Record> const view(image);
+    REQUIRE(view.size() == map.size());
+    CHECK_FALSE(view.empty());
+    CHECK(std::equal(map.begin(), map.end(), view.begin(), view.end(),
+                     [](const auto& lhs, const auto& rhs) {
+                         return lhs.first == rhs.first
+                                && lhs.second == rhs.second;
+                     }));
+
+    std::size_t divergence = 0;
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto const key = static_cast<std::uint32_t>(gen());
+        auto const it  = map.lower_bound(key);
+        auto const jt  = view.lower_bound(key);
+        divergence += (it == map.end()) != (jt == view.end());
+        divergence += it != map.end() && jt != view.end()
+                      && it->first != jt->first;
+        divergence += map.count(key) != view.count(key);
+    }
+    CHECK(divergence == 0);
+
+    auto const& [key, record] = *std::next(map.begin(), 17);
+    CHECK(view.at(key) == record);
+    CHECK(view.find(key)->second == record);
+    CHECK(view.contains(key));
+    CHECK(std::distance(view.begin(), view.upper_bound(key)) == 18);
+    auto const [first, last] = view.equal_range(key);
+    CHECK(std::distance(first, last) == 1);
+    CHECK(view.keys().size() == 200);
+    CHECK(view.values()[17] == record);
+
+    ara::core::Map<std::uint32_t, Record> const empty;
+    auto const emptyImage = ara::core::MakeMapImage(empty);
+    ara::core::MapImage<std::uint32_t, Record> const emptyView(emptyImage);
+    CHECK(emptyView.empty());
+    CHECK(emptyView.find(1) == emptyView.end());
+    CHECK_THROWS_AS(emptyView.at(1), std::out_of_range);
+}
+
+TEST_CASE("MapImage of a FlatMap with transparent lookup", "[MapImage]")
+{
+    ara::core::FlatMap<std::int64_t, double, std::greater<>> map{
+      {{-3, 0.5}, {7, 1.5}, {42, 2.5}}};
+    auto const image = ara::core::MakeMapImage(map);
+
+    ara::core::MapImage<std::int64_t, double, std::greater<>> const view(image);
+    CHECK(view.begin()->first == 42);
+    CHECK(view.at(-3) == 0.5);
+    CHECK(view.find(7)->second == 1.5);
+    CHECK(view.find(std::int8_t{42}) == view.begin());
+    CHECK(view.lower_bound(8)->first == 7);
+}
+
+TEST_CASE("MapImage rejects invalid images", "[MapImage]")
+{
+    using View = ara::core::MapImage<std::uint32_t, std::uint16_t>;
+
+    ara::core::Map<std::uint32_t, std::uint16_t> map;
+    for (std::uint16_t i = 0; i < 100; ++i) { map[i * 3u] = i; }
+    auto const image = ara::core::MakeMapImage(map);
+    CHECK_NOTHROW(View(image));
+
+    // A flipped bit in the data fails the checksum, unless it is skipped.
+    auto corrupt = image;
+    corrupt[corrupt.size() - 1] ^= ara::core::Byte{1};
+    CHECK_THROWS_AS(View(corrupt), std::invalid_argument);
+    CHECK_NOTHROW(View(corrupt, ara::core::ImageCheck::kHeader));
+
+    auto header = HeaderOf(image);
+    header.version += 1;
+    auto newer = image;
+    SetHeader(newer, header);
+    CHECK_THROWS_AS(View(newer, ara::core::ImageCheck::kHeader),
+                    std::invalid_argument);
+
+    header      = HeaderOf(image);
+    header.size = 1ull << 62;
+    auto huge   = image;
+    SetHeader(huge, header);
+    CHECK_THROWS_AS(View(huge, ara::core::ImageCheck::kHeader),
+                    std::invalid_argument);
+
+    using Wider = ara::core::MapImage<std::uint32_t, std::uint32_t>;
+    CHECK_THROWS_AS(Wider(image), std::invalid_argument);
+
+    auto const truncated = std::span(image).first(image.size() - 2);
+    CHECK_THROWS_AS(View(truncated), std::invalid_argument);
+    CHECK_THROWS_AS(View(std::span(image).first(8)), std::invalid_argument);
+
+    auto swapped = image;
+    std::reverse(swapped.begin(), swapped.begin() + 8);
+    CHECK_THROWS_AS(View(swapped), std::invalid_argument);
+
+    ara::core::Vector<ara::core::Byte> shifted(image.size() + 8);
+    std::copy(image.begin(), image.end(), shifted.begin() + 4);
+    CHECK_THROWS_AS(View(std::span(shifted).subspan(4)),
+                    std::invalid_argument);
+}
+
+TEST_CASE("MapImage saved to and mapped from a file", "[MapImage]")
+{
+    auto const path =
+      std::filesystem::temp_directory_path() / "ara_map_image_test.img";
+
+    ara::core::Map<std::uint64_t, std::uint64_t> map;
+    for (std::uint64_t i = 0; i < 10000; ++i) { map[i * i] = i; }
+    ara::core::SaveMapImage(path, ara::core::MakeMapImage(map));
+
+    {
+        ara::core::MappedFile file(path);
+        ara::core::MapImage<std::uint64_t, std::uint64_t> const view(
+          file.bytes());
+        CHECK(view.size() == 10000);
+        CHECK(view.at(81) == 9);
+        CHECK_FALSE(view.contains(82));
+
+        // Replacing the file leaves the mapping of the old one intact.
+        map[82] = 1;
+        ara::core::SaveMapImage(path, ara::core::MakeMapImage(map));
+        CHECK_FALSE(view.contains(82));
+        CHECK(view.at(9999 * 9999) == 9999);
+
+        // Moving the file keeps the mapping, and the view valid.
+        auto const moved = std::move(file);
+        CHECK(file.bytes().empty());  // NOLINT(bugprone-use-after-move)
+        CHECK(moved.bytes().size() > 10000 * 16);
+        CHECK(view.at(81) == 9);
+    }
+
+    ara::core::MappedFile const file(path);
+    CHECK(ara::core::MapImage<std::uint64_t, std::uint64_t>(file.bytes())
+            .contains(82));
+
+    std::filesystem::remove(path);
+    CHECK_THROWS_AS(ara::core::MappedFile(path), std::system_error);
+}
+
+TEST_CASE("SaveMapImage removes its temporary file on failure", "[MapImage]")
+{
+    auto const directory =
+      std::filesystem::temp_directory_path() / "ara_map_image_test_dir";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory / "target");
+
+    // The temporary file is written, but cannot replace a directory.
+    ara::core::Map<std::uint64_t, std::uint64_t> const map{{1, 2}};
+    CHECK_THROWS_AS(
+      ara::core::SaveMapImage(directory / "target",
+                              ara::core::MakeMapImage(map)),
+      std::system_error);
+    CHECK(std::distance(std::filesystem::directory_iterator(directory),
+                        std::filesystem::directory_iterator())
+          == 1);
+
+    std::filesystem::remove_all(directory);
+}
@@ -1,5 +1,13 @@
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
 #include "ara/core/map.h"
 
 TEST_CASE("Map can be constructed / insert / at",
@@ -183,3 +191,153 @@ TEST_CASE("swap", "[SWS_CORE], [SWS_CORE_01496]")
     CHECK(p['a'] == 1);
     CHECK(q['a'] == 0);
 }
+
+TEST_CASE("Map transparent lookup does not allocate", "[Map]")
+{
+    std::string const longKey(64, 'k');
+
+    ara::core::Map<std::string, int, ara::core::StringLess> map{
+      {longKey, 1}, {"b", 2}, {"d", 4}};
+    const auto& constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found      = map.find(key);
+    auto const                  count      = map.count(key);
+    auto const                  missing    = map.count("c");
+    auto const                  lower      = map.lower_bound("c");
+    auto const                  upper      = map.upper_bound("b");
+    auto const                  range      = map.equal_range("b");
+    auto const                  constFound = constMap.find("d");
+    auto const                  constLower = constMap.lower_bound("a");
+    auto const                  constUpper = constMap.upper_bound("x");
+    auto const                  constRange = constMap.equal_range("x");
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found->second == 1);
+    CHECK(count == 1);
+    CHECK(missing == 0);
+    CHECK(lower->first == "d");
+    CHECK(upper->first == "d");
+    CHECK(range.first->second == 2);
+    CHECK(constFound->second == 4);
+    CHECK(constLower->first == "b");
+    CHECK(constUpper == constMap.end());
+    CHECK(constRange.first == constRange.second);
+}
+
+TEST_CASE("AllocationCounter counts allocations", "[Map]")
+{
+    test::AllocationCounter const counter;
+
+    std::string const key(64, 'k');
+    auto const        allocations = counter.allocations();
+
+    CHECK(allocations == 1);
+}
+
+TEST_CASE("Map extract / insert node moves without allocating", "[Map]")
+{
+    ara::core::Map<int, std::string> source{{1, std::string(64, 'a')},
+                                            {2, std::string(64, 'b')}};
+    ara::core::Map<int, std::string> target{{2, "two"}};
+
+    test::AllocationCounter const counter;
+
+    auto       node        = source.extract(1);
+    auto const inserted    = target.insert(std::move(node));
+    auto       missing     = source.extract(3);
+    auto       duplicate   = source.extract(source.begin());
+    auto const rejected    = target.insert(std::move(duplicate));
+    auto const allocations = counter.allocations();
+
+    CHECK(allocations == 0);
+    CHECK(inserted.inserted);
+    CHECK(inserted.position->first == 1);
+    CHECK(missing.empty());
+    CHECK_FALSE(rejected.inserted);
+    CHECK(rejected.node.key() == 2);
+    CHECK(rejected.position->second == "two");
+    CHECK(source.empty());
+    CHECK(target.size() == 2);
+
+    // re-key a node handle in place
+    auto rekeyed  = target.extract(1);
+    rekeyed.key() = 10;
+    target.insert(target.end(), std::move(rekeyed));
+    CHECK(target.count(10) == 1);
+    CHECK(target.count(1) == 0);
+}
+
+TEST_CASE("Map merge", "[Map]")
+{
+    ara::core::Map<int, int>                    target{{1, 1}, {2, 2}};
+    ara::core::Map<int, int, std::greater<int>> source{{2, 20}, {3, 30}};
+
+    test::AllocationCounter const counter;
+    target.merge(source);
+    auto const allocations = counter.allocations();
+
+    CHECK(allocations == 0);
+    CHECK(target.size() == 3);
+    CHECK(target.at(2) == 2);
+    CHECK(target.at(3) == 30);
+    REQUIRE(source.size() == 1);
+    CHECK(source.at(2) == 20);
+
+    target.merge(ara::core::Map<int, int>{{4, 4}});
+    CHECK(target.size() == 4);
+}
+
+TEST_CASE("Map try_emplace / insert_or_assign", "[Map]")
+{
+    ara::core::Map<int, std::unique_ptr<int>> map;
+
+    auto value = std::make_unique<int>(1);
+    CHECK(map.try_emplace(1, std::move(value)).second);
+    CHECK(value == nullptr);
+
+    value = std::make_unique<int>(2);
+    CHECK_FALSE(map.try_emplace(1, std::move(value)).second);
+    CHECK(value != nullptr);
+
+    auto const hinted = map.try_emplace(map.end(), 2, std::make_unique<int>(3));
+    CHECK(*hinted->second == 3);
+
+    CHECK_FALSE(map.insert_or_assign(1, std::move(value)).second);
+    CHECK(*map.at(1) == 2);
+    CHECK(map.insert_or_assign(5, std::make_unique<int>(5)).second);
+    CHECK(*map.insert_or_assign(map.end(), 5, std::make_unique<int>(6))->second
+          == 6);
+}
+
+TEST_CASE("Map construction / insert from sorted input", "[Map]")
+{
+    using Map = ara::core::Map<int, std::string>;
+
+    std::vector<std::pair<int, std::string>> const sorted{
+      {1, "one"}, {3, "three"}, {5, "five"}, {7, "seven"}};
+
+    Map const fromRange(sorted.begin(), sorted.end());
+    Map const fromSorted(
+      ara::core::sorted_unique, sorted.begin(), sorted.end());
+    Map const fromList(ara::core::sorted_unique, {{1, "one"}, {3, "three"}});
+
+    CHECK(fromSorted == fromRange);
+    CHECK(fromSorted.size() == 4);
+    CHECK(fromList.size() == 2);
+    CHECK(fromList.at(3) == "three");
+
+    Map interleaved{{0, "zero"}, {4, "four"}, {9, "nine"}};
+    interleaved.insert(ara::core::sorted_unique, sorted.begin(), sorted.end());
+
+    CHECK(interleaved.size() == 7);
+    CHECK(std::is_sorted(
+      interleaved.begin(), interleaved.end(), interleaved.value_comp()));
+    CHECK(interleaved.at(5) == "five");
+    CHECK(interleaved.at(9) == "nine");
+
+    interleaved.insert(ara::core::sorted_unique, sorted.end(), sorted.end());
+    CHECK(interleaved.size() == 7);
+}
@@ -0,0 +1,308 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+
+#include "ara/core/array.h"
+#include "ara/core/btree_map.h"
+#include "ara/core/concurrent_map.h"
+#include "ara/core/concurrent_vector.h"
+#include "ara/core/flat_map.h"
+#include "ara/core/lru_cache.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/radix_map.h"
+#include "ara/core/ring_buffer.h"
+#include "ara/core/small_map.h"
+#include "ara/core/unordered_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+struct Blob
+{
+    ara::core::Vector<char> payload;
+};
+}  // namespace
+
+template<> struct ara::core::MemoryFootprintTraits<Blob>
+{
+    static constexpr bool kOwnsHeap = true;
+
+    static MemoryFootprint heap(const Blob& blob)
+    {
+        return memory_footprint(blob.payload);
+    }
+};
+
+TEST_CASE("memory_footprint of plain values", "[MemoryFootprint]")
+{
+    CHECK(ara::core::memory_footprint(42) == ara::core::MemoryFootprint{});
+    CHECK(ara::core::memory_footprint(ara::core::Array<int, 4>{1, 2, 3, 4})
+          == ara::core::MemoryFootprint{});
+}
+
+TEST_CASE("memory_footprint of Vector reports slack capacity",
+          "[MemoryFootprint]")
+{
+    ara::core::Vector<int> vector;
+    CHECK(ara::core::memory_footprint(vector) == ara::core::MemoryFootprint{});
+
+    vector.reserve(16);
+    vector.push_back(1);
+    vector.push_back(2);
+
+    auto const footprint = ara::core::memory_footprint(vector);
+    CHECK(footprint.bytes_used == 2 * sizeof(int));
+    CHECK(footprint.bytes_reserved == 16 * sizeof(int));
+    CHECK(footprint.allocations == 1);
+}
+
+TEST_CASE("memory_footprint of strings", "[MemoryFootprint]")
+{
+    std::string const shortString = "a";
+    std::string const longString(100, 'x');
+
+    CHECK(ara::core::memory_footprint(shortString).allocations == 0);
+    CHECK(ara::core::memory_footprint(longString).allocations == 1);
+    CHECK(ara::core::memory_footprint(longString).bytes_used == 101);
+    CHECK(ara::core::memory_footprint(longString).bytes_reserved
+          >= ara::core::memory_footprint(longString).bytes_used);
+}
+
+TEST_CASE("memory_footprint of pairs with const members", "[MemoryFootprint]")
+{
+    using Element = std::pair<const std::string, int>;
+    STATIC_REQUIRE(ara::core::MemoryFootprintTraits<Element>::kOwnsHeap);
+
+    ara::core::Vector<Element> elements;
+    elements.reserve(2);
+    elements.emplace_back(std::string(100, 'x'), 1);
+    elements.emplace_back("y", 2);
+
+    auto const footprint = ara::core::memory_footprint(elements);
+    CHECK(footprint.allocations == 2);
+    CHECK(footprint.bytes_used == 2 * sizeof(Element) + 101);
+}
+
+TEST_CASE("memory_footprint of Map counts one node per entry",
+          "[MemoryFootprint]")
+{
+    ara::core::Map<int, int> map{{1, 1}, {2, 2}, {3, 3}};
+
+    auto const footprint = ara::core::memory_footprint(map);
+    CHECK(footprint.allocations == 3);
+    CHECK(footprint.bytes_used == footprint.bytes_reserved);
+    CHECK(footprint.bytes_used
+          >= 3 * (sizeof(std::pair<const int, int>) + 3 * sizeof(void*)));
+}
+
+TEST_CASE("memory_footprint recurses into nested containers",
+          "[MemoryFootprint]")
+{
+    ara::core::Map<int, ara::core::Vector<int>> map;
+    map[1].reserve(10);
+    map[2].push_back(7);
+
+    auto const nodes =
+      ara::core::memory_footprint(ara::core::Map<int, int>{{1, 1}, {2, 2}});
+    auto const footprint = ara::core::memory_footprint(map);
+
+    CHECK(footprint.allocations == 4);
+    CHECK(footprint.bytes_reserved
+          >= 11 * sizeof(int) + 2 * sizeof(ara::core::Vector<int>));
+    CHECK(footprint.bytes_used > nodes.bytes_used);
+}
+
+TEST_CASE("memory_footprint customization point", "[MemoryFootprint]")
+{
+    ara::core::Vector<Blob> blobs(std::size_t{2});
+    blobs[0].payload.reserve(64);
+    blobs[1].payload.reserve(32);
+
+    auto const footprint = ara::core::memory_footprint(blobs);
+    CHECK(footprint.allocations == 3);
+    CHECK(footprint.bytes_reserved == 2 * sizeof(Blob) + 96);
+    CHECK(footprint.bytes_used == 2 * sizeof(Blob));
+}
+
+TEST_CASE("memory_footprint of RingBuffer and ConcurrentVector",
+          "[MemoryFootprint]")
+{
+    ara::core::RingBuffer<int> ring{8};
+    ring.push_back(1);
+    CHECK(ara::core::memory_footprint(ring)
+          == ara::core::MemoryFootprint{sizeof(int), 8 * sizeof(int), 1});
+
+    ara::core::StaticRingBuffer<std::string, 2> fixed;
+    fixed.push_back(std::string(64, 'y'));
+    CHECK(ara::core::memory_footprint(fixed).allocations == 1);
+
+    ara::core::ConcurrentVector<int> vector;
+    vector.push_back(1);
+    auto const footprint = ara::core::memory_footprint(vector);
+    CHECK(footprint.allocations == 2);
+    CHECK(footprint.bytes_used == sizeof(int) + 1);
+    CHECK(footprint.bytes_reserved
+          == ara::core::ConcurrentVector<int>::kFirstSegmentSize
+               * (sizeof(int) + 1));
+}
+
+TEST_CASE("memory_footprint of FlatMap", "[MemoryFootprint]")
+{
+    ara::core::FlatMap<int, std::string> map{{1, "a"},
+                                             {2, std::string(64, 'z')}};
+
+    auto const footprint = ara::core::memory_footprint(map);
+    CHECK(footprint.allocations == 3);
+    CHECK(footprint.bytes_used
+          == 2 * sizeof(int) + 2 * sizeof(std::string) + 65);
+}
+
+TEST_CASE("memory_footprint of UnorderedMap", "[MemoryFootprint]")
+{
+    ara::core::UnorderedMap<int, int> map;
+    CHECK(ara::core::memory_footprint(map) == ara::core::MemoryFootprint{});
+
+    map.emplace(1, 1);
+    auto const footprint = ara::core::memory_footprint(map);
+    CHECK(footprint.allocations == 1);
+    CHECK(footprint.bytes_reserved
+          >= map.bucket_count() * (sizeof(std::pair<const int, int>) + 1));
+    CHECK(footprint.bytes_used < footprint.bytes_reserved);
+}
+
+TEST_CASE("memory_footprint of UnorderedMap counts heap-owning keys",
+          "[MemoryFootprint]")
+{
+    ara::core::UnorderedMap<std::string, int> map;
+    ara::core::Map<std::string, int>          tree;
+    for (int i = 0; i < 10; ++i)
+    {
+        map.emplace(std::string(100, static_cast<char>('a' + i)), i);
+        tree.emplace(std::string(100, static_cast<char>('a' + i)), i);
+    }
+
+    auto const footprint = ara::core::memory_footprint(map);
+    auto const nodes     = ara::core::memory_footprint(tree);
+    CHECK(footprint.allocations == 1 + 10);
+    CHECK(nodes.allocations == 10 + 10);
+    CHECK(footprint.bytes_used >= 10 * 101);
+}
+
+TEST_CASE("memory_footprint of BTreeMap", "[MemoryFootprint]")
+{
+    ara::core::BTreeMap<std::uint64_t, std::uint64_t> tree;
+    CHECK(ara::core::memory_footprint(tree) == ara::core::MemoryFootprint{});
+
+    ara::core::Map<std::uint64_t, std::uint64_t> map;
+    for (std::uint64_t i = 0; i < 10000; ++i)
+    {
+        tree.emplace(i, i);
+        map.emplace(i, i);
+    }
+
+    auto const footprint = ara::core::memory_footprint(tree);
+    CHECK(footprint.bytes_used <= footprint.bytes_reserved);
+    CHECK(footprint.bytes_reserved
+          < ara::core::memory_footprint(map).bytes_reserved);
+    CHECK(footprint.allocations < tree.size() / 4);
+}
+
+TEST_CASE("memory_footprint of SmallMap", "[MemoryFootprint]")
+{
+    ara::core::SmallMap<int, std::string, 2> map{{1, std::string(100, 'x')}};
+    auto const small = ara::core::memory_footprint(map);
+    CHECK(small.allocations == 1);
+    CHECK(small.bytes_used >= 100);
+
+    map.try_emplace(2);
+    map.try_emplace(3);
+    ara::core::Map<int, std::string> reference{
+      {1, std::string(100, 'x')}, {2, {}}, {3, {}}};
+    CHECK(ara::core::memory_footprint(map)
+          == ara::core::memory_footprint(reference));
+}
+
+TEST_CASE("memory_footprint of RadixMap", "[MemoryFootprint]")
+{
+    ara::core::RadixMap<std::string> map;
+    CHECK(ara::core::memory_footprint(map) == ara::core::MemoryFootprint{});
+
+    std::string const                        prefix = "/Package/Component/";
+    ara::core::Map<std::string, std::string> reference;
+    for (int i = 0; i < 100; ++i)
+    {
+        map.try_emplace(prefix + std::to_string(i), std::string(100, 'x'));
+        reference.try_emplace(prefix + std::to_string(i), 100, 'x');
+    }
+    auto const filled = ara::core::memory_footprint(map);
+    CHECK(filled.allocations > 200);
+    CHECK(filled.bytes_used >= 100 * 100);
+    CHECK(filled.bytes_reserved >= filled.bytes_used);
+    CHECK(filled.bytes_used
+          < ara::core::memory_footprint(reference).bytes_used);
+
+    for (int i = 1; i < 100; ++i) { map.erase(prefix + std::to_string(i)); }
+    auto const single = ara::core::memory_footprint(map);
+    CHECK(single.allocations == 2);
+    CHECK(single.bytes_used < filled.bytes_used / 50);
+}
+
+TEST_CASE("memory_footprint of LruCache", "[MemoryFootprint]")
+{
+    ara::core::LruCache<int, std::string> cache(10);
+    CHECK(ara::core::memory_footprint(cache) == ara::core::MemoryFootprint{});
+
+    for (int i = 0; i < 20; ++i) { cache.try_emplace(i, 100, 'x'); }
+    auto const full = ara::core::memory_footprint(cache);
+    CHECK(full.allocations == 2 + 10);
+    CHECK(full.bytes_used >= 10 * 100);
+    CHECK(full.bytes_reserved >= full.bytes_used);
+
+    for (int i = 10; i < 19; ++i) { cache.erase(i); }
+    auto const single = ara::core::memory_footprint(cache);
+    CHECK(single.allocations == 2 + 1);
+    CHECK(single.bytes_reserved == full.bytes_reserved - 9 * 101);
+
+    ara::core::ShardedCache<ara::core::LruCache<int, int>> sharded(64, 4);
+    sharded.try_emplace(1, 1);
+    CHECK(ara::core::memory_footprint(sharded).allocations == 1 + 2);
+}
+
+TEST_CASE("memory_footprint of LruCache counts heap-owning keys",
+          "[MemoryFootprint]")
+{
+    ara::core::LruCache<std::string, int> cache(10);
+    for (int i = 0; i < 10; ++i)
+    { cache.try_emplace(std::string(100, static_cast<char>('a' + i)), i); }
+
+    // Both the node and the index own a copy of every key.
+    auto const full = ara::core::memory_footprint(cache);
+    CHECK(full.allocations == 2 + 2 * 10);
+    CHECK(full.bytes_used >= 2 * 10 * 101);
+}
+
+TEST_CASE("memory_footprint of ConcurrentMap", "[MemoryFootprint]")
+{
+    ara::core::ConcurrentMap<int, std::string> map{4};
+    auto const empty = ara::core::memory_footprint(map);
+    CHECK(empty.allocations == 1);
+    CHECK(empty.bytes_reserved >= 4 * 64);
+
+    map.try_emplace(1, std::string(100, 'x'));
+    auto const filled = ara::core::memory_footprint(map);
+    CHECK(filled.allocations == 3);
+    CHECK(filled.bytes_used >= empty.bytes_used + 100);
+}
+
+TEST_CASE("memory_footprint of ConcurrentMap counts heap-owning keys",
+          "[MemoryFootprint]")
+{
+    ara::core::ConcurrentMap<std::string, int> map{4};
+    auto const empty = ara::core::memory_footprint(map);
+
+    map.try_emplace(std::string(100, 'x'), 1);
+    auto const filled = ara::core::memory_footprint(map);
+    CHECK(filled.allocations == empty.allocations + 2);
+    CHECK(filled.bytes_used >= empty.bytes_used + 101);
+}
@@ -0,0 +1,229 @@
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "allocation_counter.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/order_statistic_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+using Map = ara::core::OrderStatisticMap<int, int>;
+
+/**
+ * @brief Checks rank(), select(), index_of() and count_range() of map against
+ * iterator distances in reference, which holds the same elements.
+ */
+bool MatchesReference(const Map& map, const ara::core::Map<int, int>& reference)
+{
+    if (map.size() != reference.size()
+        || ! std::equal(map.begin(), map.end(), reference.begin()))
+    { return false; }
+
+    std::size_t index = 0;
+    for (auto it = map.begin(); it != map.end(); ++it, ++index)
+    {
+        if (map.select(index) != it || map.index_of(it) != index
+            || map.rank(it->first) != index
+            || map.rank(it->first + 1) != index + 1)
+        { return false; }
+    }
+    if (map.select(index) != map.end() || map.index_of(map.end()) != index)
+    { return false; }
+
+    for (int lower = -2; lower < 102; lower += 7)
+    {
+        auto const upper    = lower + 13;
+        auto const expected = std::distance(reference.lower_bound(lower),
+                                            reference.lower_bound(upper));
+        if (map.count_range(lower, upper)
+              != static_cast<std::size_t>(expected)
+            || map.count_range(upper, lower) != 0)
+        { return false; }
+    }
+
+    return true;
+}
+}  // namespace
+
+TEST_CASE("OrderStatisticMap insert / find / erase", "[OrderStatisticMap]")
+{
+    ara::core::OrderStatisticMap<std::string, int, std::less<>> map{
+      {"b", 2}, {"a", 1}, {"c", 3}, {"a", 4}};
+
+    REQUIRE(map.size() == 3);
+    CHECK(map.begin()->first == "a");
+    CHECK(map.begin()->second == 1);
+    CHECK(map.at("b") == 2);
+    CHECK_THROWS_AS(map.at("d"), std::out_of_range);
+    CHECK(map.contains(std::string_view("c")));
+    CHECK(map.count(std::string_view("a")) == 1);
+    CHECK(map.lower_bound(std::string_view("bb"))->first == "c");
+    CHECK(map.upper_bound("c") == map.end());
+    CHECK(std::prev(map.end())->first == "c");
+
+    map["d"] = 5;
+    CHECK(map.try_emplace("d", 6).first->second == 5);
+    CHECK_FALSE(map.insert_or_assign("d", 7).second);
+    CHECK(map.at("d") == 7);
+    CHECK(map.emplace("e", 8).second);
+    CHECK(map.erase("a") == 1);
+    CHECK(map.erase("a") == 0);
+
+    ara::core::OrderStatisticMap<std::string, int, std::less<>> const expected{
+      {"b", 2}, {"c", 3}, {"d", 7}, {"e", 8}};
+    CHECK(map == expected);
+    CHECK(map < ara::core::OrderStatisticMap<std::string, int, std::less<>>{
+            {"c", 0}});
+    CHECK(std::equal(map.rbegin(),
+                     map.rend(),
+                     std::make_reverse_iterator(expected.end())));
+}
+
+TEST_CASE("OrderStatisticMap rank and select", "[OrderStatisticMap]")
+{
+    ara::core::OrderStatisticMap<std::string, int, std::less<>> map;
+    for (int i = 0; i < 100; ++i)
+    { map.emplace(std::to_string(1000 + 10 * i), i); }
+
+    CHECK(map.select(0)->second == 0);
+    CHECK(map.select(49)->second == 49);
+    CHECK(map.select(99)->second == 99);
+    CHECK(map.select(100) == map.end());
+
+    CHECK(map.rank("1000") == 0);
+    CHECK(map.rank(std::string_view("1005")) == 1);
+    CHECK(map.rank("9999") == 100);
+    CHECK(map.index_of(map.find("1500")) == 50);
+    CHECK(map.count_range("1100", "1200") == 10);
+    CHECK(map.count_range(std::string_view("1100"), "1205") == 11);
+    CHECK(map.count_range("1200", "1100") == 0);
+
+    // The 90th percentile of a latency sample.
+    auto const percentile = map.select(map.size() * 90 / 100);
+    CHECK(percentile->first == "1900");
+}
+
+TEST_CASE("OrderStatisticMap matches Map under random inserts and erases",
+          "[OrderStatisticMap]")
+{
+    std::mt19937                       gen{131};
+    std::uniform_int_distribution<int> key(0, 99);
+
+    Map                      map;
+    ara::core::Map<int, int> reference;
+    std::size_t              divergence = 0;
+    for (int round = 0; round < 2000; ++round)
+    {
+        int const k = key(gen);
+        switch (gen() % 4)
+        {
+            case 0:
+            case 1:
+                map.try_emplace(k, round);
+                reference.try_emplace(k, round);
+                break;
+            case 2:
+                map.erase(k);
+                reference.erase(k);
+                break;
+            default:
+            {
+                auto const lower = map.lower_bound(k);
+                auto const upper = map.upper_bound(k + 10);
+                map.erase(lower, upper);
+                reference.erase(reference.lower_bound(k),
+                                reference.upper_bound(k + 10));
+                break;
+            }
+        }
+        divergence += ! MatchesReference(map, reference);
+    }
+    CHECK(divergence == 0);
+}
+
+TEST_CASE("OrderStatisticMap iterators survive other inserts and erases",
+          "[OrderStatisticMap]")
+{
+    Map  map;
+    auto kept = map.emplace(500, 0).first;
+    for (int i = 0; i < 1000; ++i)
+    { map.try_emplace(i, i); }
+    for (int i = 0; i < 1000; i += 2)
+    {
+        if (i != 500)
+        { map.erase(i); }
+    }
+
+    CHECK(kept->first == 500);
+    CHECK(map.index_of(kept) == 250);
+    CHECK(std::next(kept)->first == 501);
+    CHECK(std::prev(kept)->first == 499);
+    CHECK(map.erase(kept)->first == 501);
+    CHECK(map.size() == 500);
+}
+
+TEST_CASE("OrderStatisticMap sorted construction, copy, move and swap",
+          "[OrderStatisticMap]")
+{
+    ara::core::Vector<std::pair<int, int>> sorted;
+    for (int i = 0; i < 1000; ++i) { sorted.emplace_back(i, -i); }
+
+    test::AllocationCounter const counter;
+    Map                           map(
+      ara::core::sorted_unique, sorted.begin(), sorted.end());
+    // One node per element and the scratch buffer of node pointers.
+    CHECK(counter.allocations() == 1001);
+    CHECK(map.size() == 1000);
+    CHECK(map.select(123)->second == -123);
+
+    Map copy = map;
+    CHECK(copy == map);
+    copy.erase(copy.begin());
+    CHECK(copy.rank(0) == 0);
+    CHECK(copy.select(0)->first == 1);
+
+    Map moved = std::move(copy);
+    CHECK(copy.empty());  // NOLINT(bugprone-use-after-move)
+    CHECK(copy.begin() == copy.end());
+    CHECK(moved.size() == 999);
+
+    swap(map, moved);
+    CHECK(map.size() == 999);
+    CHECK(moved.size() == 1000);
+    CHECK(std::prev(map.end())->first == 999);
+    CHECK(map.index_of(map.find(999)) == 998);
+
+    map.insert(ara::core::sorted_unique, sorted.begin(), sorted.begin() + 2);
+    CHECK(map == moved);
+
+    Map other{{-1, 0}, {0, 1}};
+    map.merge(other);
+    CHECK(map.size() == 1001);
+    CHECK(other.size() == 1);
+
+    map.clear();
+    CHECK(map.empty());
+    CHECK(map.rank(5) == 0);
+    CHECK(map.select(0) == map.end());
+}
+
+TEST_CASE("memory_footprint of OrderStatisticMap",
+          "[OrderStatisticMap][MemoryFootprint]")
+{
+    ara::core::OrderStatisticMap<std::uint64_t, std::uint64_t> map{
+      {1, 1}, {2, 2}, {3, 3}};
+    ara::core::Map<std::uint64_t, std::uint64_t> const tree{
+      {1, 1}, {2, 2}, {3, 3}};
+
+    auto const footprint = ara::core::memory_footprint(map);
+    CHECK(footprint.allocations == 3);
+    CHECK(footprint.bytes_used == ara::core::memory_footprint(tree).bytes_used);
+}
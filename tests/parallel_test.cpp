@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+
+#include "ara/core/array.h"
+#include "ara/core/map.h"
+#include "ara/core/parallel.h"
+#include "ara/core/vector.h"
+
+namespace {
+ara::core::Vector<int> RandomVector(std::size_t size)
+{
+    std::mt19937                       gen{42};
+    std::uniform_int_distribution<int> dist{-1000, 1000};
+    ara::core::Vector<int>             vector;
+    for (std::size_t i = 0; i < size; ++i) { vector.push_back(dist(gen)); }
+
+    return vector;
+}
+}  // namespace
+
+TEST_CASE("parallel::sort", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    for (std::size_t size : {0u, 1u, 100u, 50000u, 100003u})
+    {
+        auto vector   = RandomVector(size);
+        auto expected = vector;
+        std::sort(expected.begin(), expected.end());
+
+        ara::core::parallel::sort(pool, vector);
+        CHECK(vector == expected);
+
+        ara::core::parallel::sort(pool, vector, std::greater<>());
+        CHECK(std::is_sorted(vector.begin(), vector.end(), std::greater<>()));
+    }
+}
+
+TEST_CASE("parallel::sort of Array and default pool", "[parallel]")
+{
+    ara::core::Array<int, 5> array{5, 3, 1, 4, 2};
+
+    ara::core::parallel::sort(array);
+
+    CHECK(array == ara::core::Array<int, 5>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("parallel::stable_sort", "[parallel]")
+{
+    ara::core::ThreadPool pool{3};
+
+    auto const                            keys = RandomVector(60000);
+    ara::core::Vector<std::pair<int, int>> vector;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    { vector.push_back({keys[i] % 16, static_cast<int>(i)}); }
+    auto expected = vector;
+
+    auto byKey = [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    };
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+    ara::core::parallel::stable_sort(pool, vector, byKey);
+
+    CHECK(vector == expected);
+}
+
+TEST_CASE("parallel::transform", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    auto const             input = RandomVector(70000);
+    ara::core::Vector<int> expected(input.size());
+    ara::core::Vector<int> output(input.size());
+    auto                   twice = [](int x) { return x * 2; };
+    std::transform(input.begin(), input.end(), expected.begin(), twice);
+
+    auto end =
+      ara::core::parallel::transform(pool, input, output.begin(), twice);
+
+    CHECK(end == output.end());
+    CHECK(output == expected);
+}
+
+TEST_CASE("parallel::reduce", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    auto const input    = RandomVector(90000);
+    auto const expected = std::accumulate(input.begin(), input.end(), 7L);
+
+    CHECK(ara::core::parallel::reduce(pool, input, 7L) == expected);
+    CHECK(ara::core::parallel::reduce(pool, ara::core::Vector<int>{}, 7) == 7);
+    CHECK(ara::core::parallel::reduce(
+            pool, input, 0, [](int a, int b) { return std::max(a, b); })
+          == *std::max_element(input.begin(), input.end()));
+}
+
+TEST_CASE("parallel::for_each", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    ara::core::Vector<int> vector(std::size_t{80000}, 1);
+    ara::core::parallel::for_each(pool, vector, [](int& x) { x += 1; });
+
+    CHECK(std::all_of(
+      vector.begin(), vector.end(), [](int x) { return x == 2; }));
+}
+
+TEST_CASE("parallel::inclusive_scan", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    auto const             input = RandomVector(100001);
+    ara::core::Vector<int> expected(input.size());
+    ara::core::Vector<int> output(input.size());
+    std::inclusive_scan(input.begin(), input.end(), expected.begin());
+
+    ara::core::parallel::inclusive_scan(pool, input, output.begin());
+    CHECK(output == expected);
+
+    auto inPlace = input;
+    ara::core::parallel::inclusive_scan(pool, inPlace, inPlace.begin());
+    CHECK(inPlace == expected);
+}
+
+TEST_CASE("parallel::insert sorted_unique into Map", "[parallel]")
+{
+    ara::core::ThreadPool pool{4};
+
+    ara::core::Vector<std::pair<int, int>> sorted;
+    for (int i = 0; i < 100000; ++i) { sorted.emplace_back(2 * i, i); }
+
+    ara::core::Map<int, int> expected(sorted.begin(), sorted.end());
+    ara::core::Map<int, int> map;
+    ara::core::parallel::insert(pool, map, ara::core::sorted_unique, sorted);
+    CHECK(map == expected);
+
+    ara::core::Map<int, int> interleaved{{-1, 0}, {1001, 0}, {300001, 0}};
+    ara::core::parallel::insert(
+      pool, interleaved, ara::core::sorted_unique, sorted);
+    expected.insert({{-1, 0}, {1001, 0}, {300001, 0}});
+    CHECK(interleaved == expected);
+}
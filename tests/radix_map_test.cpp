@@ -0,0 +1,337 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "ara/core/radix_map.h"
+
+namespace {
+/**
+ * @brief Random path of up to 5 components from a small alphabet, so that
+ * keys share prefixes, end inside one another and diverge at any depth.
+ */
+std::string RandomPath(std::mt19937& gen)
+{
+    static std::string const kParts[] = {
+      "/a", "/ab", "/b", "/Port", "/Port1", "/x", "", "\xff", {"\0", 1}};
+    std::uniform_int_distribution<std::size_t> count{0, 5};
+    std::uniform_int_distribution<std::size_t> part{0, std::size(kParts) - 1};
+
+    std::string path;
+    for (std::size_t i = count(gen); i > 0; --i) { path += kParts[part(gen)]; }
+
+    return path;
+}
+
+/**
+ * @brief Applies a random mix of insertions, erasures and prefix queries to
+ * a RadixMap and a std::map, and returns the number of diverging results.
+ */
+std::size_t DivergenceFromStdMap(int operations)
+{
+    ara::core::RadixMap<int>           map;
+    std::map<std::string, int>         reference;
+    std::mt19937                       gen{7};
+    std::uniform_int_distribution<int> operation{0, 7};
+    std::size_t                        mismatches = 0;
+
+    for (int i = 0; i < operations; ++i)
+    {
+        std::string const key = RandomPath(gen);
+        switch (operation(gen))
+        {
+        case 0:
+        case 1:
+        case 2:
+        {
+            auto const inserted = map.try_emplace(key, i).second;
+            mismatches += inserted != reference.try_emplace(key, i).second;
+            break;
+        }
+        case 3:
+            mismatches += map.erase(key) != reference.erase(key);
+            break;
+        case 4:
+        {
+            auto const ref = reference.lower_bound(key);
+            if (ref != reference.end())
+            {
+                auto const next    = map.erase(map.find(ref->first));
+                auto const refNext = reference.erase(ref);
+                mismatches += refNext == reference.end()
+                                ? next != map.end()
+                                : next == map.end()
+                                    || next.key() != refNext->first;
+            }
+            break;
+        }
+        case 5:
+        {
+            auto const [first, last] = map.prefix_range(key);
+            std::vector<std::pair<std::string, int>> expected;
+            for (auto it = reference.lower_bound(key);
+                 it != reference.end() && it->first.starts_with(key);
+                 ++it)
+            { expected.emplace_back(it->first, it->second); }
+
+            std::vector<std::pair<std::string, int>> actual;
+            for (auto it = first; it != last; ++it)
+            { actual.emplace_back(it.key(), it.value()); }
+            mismatches += actual != expected;
+            break;
+        }
+        case 6:
+        {
+            auto expected = reference.end();
+            for (auto it = reference.begin(); it != reference.end(); ++it)
+            {
+                if (key.starts_with(it->first))
+                { expected = it; }
+            }
+            auto const match = map.longest_prefix_match(key);
+            mismatches += expected == reference.end()
+                            ? match != map.end()
+                            : match == map.end()
+                                || match.key() != expected->first;
+            break;
+        }
+        default:
+        {
+            auto const it  = map.find(key);
+            auto const ref = reference.find(key);
+            mismatches += ref == reference.end()
+                            ? it != map.end()
+                            : it == map.end() || it.value() != ref->second;
+            break;
+        }
+        }
+    }
+
+    mismatches += map.size() != reference.size();
+    auto ref = reference.begin();
+    for (auto const& [key, value] : map)
+    {
+        mismatches += ref == reference.end() || key != ref->first
+                      || value != ref->second;
+        ++ref;
+    }
+
+    return mismatches;
+}
+}  // namespace
+
+TEST_CASE("RadixMap insert / find / at", "[RadixMap]")
+{
+    ara::core::RadixMap<int> map;
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+    CHECK(map.find("a") == map.end());
+
+    CHECK(map.insert({"/pkg/b", 2}).second);
+    CHECK_FALSE(map.insert({"/pkg/b", 3}).second);
+    CHECK(map.try_emplace("/pkg/a", 1).second);
+    map["/pkg"] = 3;
+    map[""]     = 4;
+
+    CHECK(map.size() == 4);
+    CHECK(map.begin().key().empty());
+    CHECK(std::next(map.begin())->first == "/pkg");
+    CHECK(map.at("/pkg/a") == 1);
+    CHECK(map.find("/pkg/b")->second == 2);
+    CHECK(map.find("/pkg/b").value() == 2);
+    CHECK(map.count("/pkg") == 1);
+    CHECK_FALSE(map.contains("/pk"));
+    CHECK_FALSE(map.contains("/pkg/"));
+    CHECK_FALSE(map.contains("/pkg/ab"));
+    CHECK_THROWS_AS(map.at("/pkg/c"), std::out_of_range);
+
+    std::vector<std::string> keys;
+    for (auto const& [key, value] : map) { keys.push_back(key); }
+    CHECK(keys == std::vector<std::string>{"", "/pkg", "/pkg/a", "/pkg/b"});
+
+    map.find("/pkg/a")->second = 10;
+    CHECK(map.at("/pkg/a") == 10);
+}
+
+TEST_CASE("RadixMap matches std::map under random operations", "[RadixMap]")
+{
+    CHECK(DivergenceFromStdMap(50000) == 0);
+}
+
+TEST_CASE("RadixMap grows and shrinks its nodes with all byte values",
+          "[RadixMap]")
+{
+    ara::core::RadixMap<int> map;
+    for (int b = 255; b >= 0; --b)
+    {
+        std::string key = "/root/";
+        key += static_cast<char>(b);
+        map.try_emplace(key + "/leaf", b);
+        map.try_emplace(key, -b);
+    }
+    CHECK(map.size() == 512);
+
+    int expected = 0;
+    for (auto it = map.begin(); it != map.end(); ++it, ++expected)
+    {
+        CHECK(static_cast<unsigned char>(it.key()[6]) == expected / 2);
+        CHECK(it.value() == (expected % 2 == 0 ? -1 : 1) * (expected / 2));
+    }
+
+    auto const range = map.prefix_range(std::string("/root/\x80", 7));
+    CHECK(std::distance(range.first, range.second) == 2);
+
+    for (int b = 0; b < 256; ++b)
+    {
+        if (b % 64 != 0)
+        {
+            std::string key = "/root/";
+            key += static_cast<char>(b);
+            CHECK(map.erase(key + "/leaf") == 1);
+            CHECK(map.erase(key) == 1);
+        }
+    }
+    CHECK(map.size() == 8);
+    CHECK(map.at(std::string("/root/\xc0/leaf")) == 192);
+    CHECK(map.at(std::string("/root/\0", 7)) == 0);
+
+    for (auto it = map.begin(); it != map.end();) { it = map.erase(it); }
+    CHECK(map.empty());
+    CHECK(map.begin() == map.end());
+}
+
+TEST_CASE("RadixMap prefix_range / longest_prefix_match", "[RadixMap]")
+{
+    ara::core::RadixMap<int> map{{"/Vehicle", 1},
+                                 {"/Vehicle/Body", 2},
+                                 {"/Vehicle/Body/Door", 3},
+                                 {"/Vehicle/Body/DoorLock", 4},
+                                 {"/Vehicle/Powertrain", 5}};
+    const auto& constMap = map;
+
+    auto const body = constMap.prefix_range("/Vehicle/Body/");
+    CHECK(std::distance(body.first, body.second) == 2);
+    CHECK(body.first.key() == "/Vehicle/Body/Door");
+    CHECK(body.second.key() == "/Vehicle/Powertrain");
+
+    auto const door = map.prefix_range("/Vehicle/Body/Door");
+    CHECK(std::distance(door.first, door.second) == 2);
+    CHECK(std::distance(map.prefix_range("").first, map.end()) == 5);
+    CHECK(map.prefix_range("/Vehicle/Chassis").first == map.end());
+    CHECK(map.prefix_range("/Vehicle/Body/DoorLockX").first == map.end());
+
+    CHECK(map.longest_prefix_match("/Vehicle/Body/Door/Handle").key()
+          == "/Vehicle/Body/Door");
+    CHECK(map.longest_prefix_match("/Vehicle/Body/Do").key()
+          == "/Vehicle/Body");
+    CHECK(map.longest_prefix_match("/Vehicle/Body").value() == 2);
+    CHECK(constMap.longest_prefix_match("/Vehicle/Powertrain/Engine").value()
+          == 5);
+    CHECK(map.longest_prefix_match("/Vehicl") == map.end());
+    CHECK(map.longest_prefix_match("/Vehicle/Powertrains").key()
+          == "/Vehicle/Powertrain");
+}
+
+TEST_CASE("RadixMap elements keep their address", "[RadixMap]")
+{
+    ara::core::RadixMap<std::unique_ptr<int>> map;
+    map.try_emplace("/a/b/c", std::make_unique<int>(1));
+    auto* const value = &map.at("/a/b/c");
+    auto const  it    = map.find("/a/b/c");
+
+    for (int i = 0; i < 300; ++i)
+    {
+        map.try_emplace("/a/b/c" + std::to_string(i));
+        map.try_emplace("/a/" + std::to_string(i));
+        map.try_emplace("/a/b");
+    }
+    for (int i = 0; i < 300; ++i)
+    {
+        map.erase("/a/b/c" + std::to_string(i));
+        map.erase("/a/" + std::to_string(i));
+    }
+    map.erase("/a/b");
+
+    CHECK(map.size() == 1);
+    CHECK(&map.at("/a/b/c") == value);
+    CHECK(it == map.find("/a/b/c"));
+    CHECK(*it.value() == 1);
+}
+
+TEST_CASE("RadixMap try_emplace / insert_or_assign", "[RadixMap]")
+{
+    ara::core::RadixMap<std::unique_ptr<int>> map;
+
+    auto value = std::make_unique<int>(1);
+    CHECK(map.try_emplace("one", std::move(value)).second);
+    CHECK(value == nullptr);
+
+    value = std::make_unique<int>(2);
+    CHECK_FALSE(map.try_emplace("one", std::move(value)).second);
+    CHECK(value != nullptr);
+
+    CHECK_FALSE(map.insert_or_assign("one", std::move(value)).second);
+    CHECK(*map.at("one") == 2);
+    CHECK(map.insert_or_assign("onex", std::make_unique<int>(3)).second);
+    CHECK(*map.at("onex") == 3);
+}
+
+TEST_CASE("RadixMap copy / move / swap / compare", "[RadixMap]")
+{
+    ara::core::RadixMap<std::string> map;
+    for (int i = 0; i < 200; ++i)
+    { map.try_emplace("/pkg/" + std::to_string(i * 7), std::to_string(i)); }
+
+    auto copy = map;
+    CHECK(copy == map);
+    copy["/pkg/x"] = "x";
+    CHECK(copy != map);
+
+    auto moved = std::move(copy);
+    CHECK(moved.size() == 201);
+    CHECK(copy.empty());
+
+    ara::core::RadixMap<std::string> other{{"a", "1"}};
+    swap(other, moved);
+    CHECK(other.size() == 201);
+    CHECK(moved.size() == 1);
+    other = moved;
+    CHECK(other == moved);
+    other = {{"b", "2"}, {"c", "3"}};
+    CHECK(other.size() == 2);
+    CHECK(other.begin()->first == "b");
+}
+
+TEST_CASE("RadixMap lookup does not allocate", "[RadixMap]")
+{
+    std::string const longKey =
+      "/Package/SubPackage/Component/Port" + std::string(64, 'k');
+    std::string const descendant = longKey + "/Element";
+
+    ara::core::RadixMap<int> map{{longKey, 1}, {"/Package/Other", 2}};
+    const auto&              constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found    = map.find(key);
+    auto const                  contains = map.contains("/Package/Other");
+    auto const                  missing  = map.count("/Package/Missing");
+    auto const                  range    = constMap.prefix_range("/Package/");
+    auto const                  match    = map.longest_prefix_match(descendant);
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found.value() == 1);
+    CHECK(contains);
+    CHECK(missing == 0);
+    CHECK(range.first.value() == 2);
+    CHECK(match == found);
+}
@@ -0,0 +1,196 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include "ara/core/ring_buffer.h"
+#include "ara/core/vector.h"
+
+TEST_CASE("RingBuffer push_back / pop_front", "[RingBuffer]")
+{
+    ara::core::RingBuffer<int> buffer;
+    CHECK(buffer.empty());
+    CHECK(buffer.capacity() == 0);
+
+    for (int i = 0; i < 10; ++i) { buffer.push_back(i); }
+    CHECK(buffer.size() == 10);
+    CHECK(buffer.capacity() == 16);
+    CHECK(buffer.front() == 0);
+    CHECK(buffer.back() == 9);
+
+    buffer.pop_front();
+    buffer.pop_front();
+    CHECK(buffer.front() == 2);
+    CHECK(buffer[1] == 3);
+    CHECK(buffer.at(7) == 9);
+    CHECK_THROWS_AS(buffer.at(8), std::out_of_range);
+}
+
+TEST_CASE("RingBuffer keeps order when growing wrapped contents",
+          "[RingBuffer]")
+{
+    ara::core::RingBuffer<std::string> buffer{4};
+    CHECK(buffer.capacity() == 4);
+
+    buffer.push_back("a");
+    buffer.push_back("b");
+    buffer.push_back("c");
+    buffer.pop_front();
+    buffer.push_back("d");
+    buffer.push_back("e");  // wraps around
+    buffer.push_back("f");  // grows
+
+    CHECK(buffer.capacity() == 8);
+    ara::core::Vector<std::string> contents(buffer.begin(), buffer.end());
+    CHECK(contents == ara::core::Vector<std::string>{"b", "c", "d", "e", "f"});
+}
+
+TEST_CASE("RingBuffer grows when pushing its own elements", "[RingBuffer]")
+{
+    ara::core::RingBuffer<std::string> buffer{2};
+    buffer.push_back(std::string(32, 'a'));
+    buffer.push_back(std::string(32, 'b'));
+    CHECK(buffer.full());
+
+    buffer.push_back(buffer.front());
+    buffer.emplace_back(buffer[1]);
+    CHECK(buffer.capacity() == 4);
+    CHECK(buffer.full());
+
+    buffer.push(buffer.begin(), buffer.end());
+    CHECK(buffer.capacity() == 8);
+
+    ara::core::Vector<std::string> contents(buffer.begin(), buffer.end());
+    ara::core::Vector<std::string> const half{std::string(32, 'a'),
+                                              std::string(32, 'b'),
+                                              std::string(32, 'a'),
+                                              std::string(32, 'b')};
+    CHECK(std::equal(half.begin(), half.end(), contents.begin()));
+    CHECK(std::equal(half.begin(), half.end(), contents.begin() + 4));
+}
+
+TEST_CASE("RingBuffer capacity is a power of two", "[RingBuffer]")
+{
+    ara::core::RingBuffer<int> buffer{100};
+    CHECK(buffer.capacity() == 128);
+
+    buffer.push_back(1);
+    buffer.shrink_to_fit();
+    CHECK(buffer.capacity() == 1);
+    CHECK(buffer.front() == 1);
+}
+
+TEST_CASE("RingBuffer try_push_back does not grow", "[RingBuffer]")
+{
+    ara::core::RingBuffer<int> buffer{2};
+
+    CHECK(buffer.try_push_back(1));
+    CHECK(buffer.try_push_back(2));
+    CHECK_FALSE(buffer.try_push_back(3));
+    CHECK(buffer.full());
+
+    int value = 0;
+    CHECK(buffer.try_pop_front(value));
+    CHECK(value == 1);
+    CHECK(buffer.try_pop_front(value));
+    CHECK(value == 2);
+    CHECK_FALSE(buffer.try_pop_front(value));
+}
+
+TEST_CASE("RingBuffer bulk push / pop", "[RingBuffer]")
+{
+    ara::core::RingBuffer<int> buffer{8};
+    ara::core::Vector<int>     input(std::size_t{6});
+    std::iota(input.begin(), input.end(), 0);
+
+    buffer.push(input.begin(), input.end());
+    ara::core::Vector<int> output(std::size_t{4});
+    CHECK(buffer.pop(output.begin(), 4) == 4);
+    CHECK(output == ara::core::Vector<int>{0, 1, 2, 3});
+
+    // 2 elements left, 6 free slots split over the end of the storage
+    CHECK(buffer.try_push(input.begin(), input.end()) == 6);
+    CHECK(buffer.try_push(input.begin(), input.end()) == 0);
+
+    buffer.push(input.begin(), input.end());
+    CHECK(buffer.size() == 14);
+    CHECK(buffer.capacity() == 16);
+
+    ara::core::Vector<int> all(buffer.size());
+    CHECK(buffer.pop(all.begin(), 100) == 14);
+    CHECK(all
+          == ara::core::Vector<int>{4, 5, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5});
+    CHECK(buffer.empty());
+}
+
+TEST_CASE("RingBuffer readable / writable spans", "[RingBuffer]")
+{
+    ara::core::RingBuffer<char> buffer{8};
+
+    auto [w1, w2] = buffer.writable();
+    CHECK(w1.size() == 8);
+    CHECK(w2.empty());
+    std::memcpy(w1.data(), "abcdef", 6);
+    buffer.commit(6);
+    buffer.consume(4);
+
+    auto [r1, r2] = buffer.readable();
+    CHECK(std::string(r1.begin(), r1.end()) == "ef");
+    CHECK(r2.empty());
+
+    // free region wraps: 2 slots at the end, 4 at the beginning
+    auto [f1, f2] = buffer.writable();
+    CHECK(f1.size() == 2);
+    CHECK(f2.size() == 4);
+    std::memcpy(f1.data(), "gh", 2);
+    std::memcpy(f2.data(), "ij", 2);
+    buffer.commit(4);
+
+    auto [s1, s2] = buffer.readable();
+    CHECK(std::string(s1.begin(), s1.end()) == "efgh");
+    CHECK(std::string(s2.begin(), s2.end()) == "ij");
+}
+
+TEST_CASE("RingBuffer copy / move / swap", "[RingBuffer]")
+{
+    ara::core::RingBuffer<std::unique_ptr<int>> buffer;
+    buffer.push_back(std::make_unique<int>(1));
+    buffer.emplace_back(std::make_unique<int>(2));
+
+    auto moved = std::move(buffer);
+    CHECK(buffer.empty());
+    CHECK(*moved.back() == 2);
+
+    ara::core::RingBuffer<int> a{4};
+    ara::core::RingBuffer<int> b;
+    a.push_back(7);
+    auto c = a;
+    swap(a, b);
+    CHECK(a.empty());
+    CHECK(b.front() == 7);
+    CHECK(c.front() == 7);
+}
+
+TEST_CASE("StaticRingBuffer has fixed capacity", "[RingBuffer]")
+{
+    ara::core::StaticRingBuffer<int, 4> buffer;
+    CHECK(buffer.capacity() == 4);
+    CHECK(decltype(buffer)::max_size() == 4);
+
+    for (int i = 0; i < 4; ++i) { buffer.push_back(i); }
+    CHECK_THROWS_AS(buffer.push_back(4), std::length_error);
+    CHECK_FALSE(buffer.try_push_back(4));
+
+    buffer.pop_front();
+    buffer.push_back(4);
+    ara::core::Vector<int> contents(buffer.begin(), buffer.end());
+    CHECK(contents == ara::core::Vector<int>{1, 2, 3, 4});
+
+    auto copy = buffer;
+    CHECK(copy.size() == 4);
+    CHECK(copy.front() == 1);
+    CHECK(std::distance(copy.rbegin(), copy.rend()) == 4);
+}
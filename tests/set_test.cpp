@@ -0,0 +1,257 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "allocation_counter.h"
+#include "ara/core/flat_set.h"
+#include "ara/core/map.h"
+#include "ara/core/memory_footprint.h"
+#include "ara/core/set.h"
+#include "ara/core/set_algorithm.h"
+
+namespace {
+/**
+ * @brief Sorted unique random keys in [0, range).
+ */
+template<class K>
+ara::core::Vector<K>
+RandomKeys(std::mt19937& gen, std::size_t count, int range)
+{
+    std::uniform_int_distribution<int> key(0, range - 1);
+    ara::core::Vector<K>               keys;
+    for (std::size_t i = 0; i < count; ++i)
+    { keys.push_back(static_cast<K>(key(gen))); }
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    return keys;
+}
+
+/**
+ * @brief Compares intersect() and unite() of FlatSets with std::set_
+ * intersection and std::set_union on random sets of several densities.
+ */
+template<class K> std::size_t SetOperationDivergence(int range)
+{
+    using Set = ara::core::FlatSet<K>;
+
+    std::mt19937 gen{79};
+    std::size_t  divergence = 0;
+    for (int round = 0; round < 200; ++round)
+    {
+        auto const lhsKeys = RandomKeys<K>(gen, gen() % 300, range);
+        auto const rhsKeys = RandomKeys<K>(gen, gen() % 300, range);
+        Set const lhs(ara::core::sorted_unique, lhsKeys);
+        Set const rhs(ara::core::sorted_unique, rhsKeys);
+
+        ara::core::Vector<K> common;
+        std::set_intersection(lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(),
+                              rhsKeys.end(), std::back_inserter(common));
+        ara::core::Vector<K> all;
+        std::set_union(lhsKeys.begin(), lhsKeys.end(), rhsKeys.begin(),
+                       rhsKeys.end(), std::back_inserter(all));
+
+        divergence += ara::core::intersect(lhs, rhs).keys() != common;
+        divergence += ara::core::intersect(rhs, lhs).keys() != common;
+        divergence += ara::core::unite(lhs, rhs).keys() != all;
+        divergence += ara::core::unite(rhs, lhs).keys() != all;
+    }
+
+    return divergence;
+}
+}  // namespace
+
+TEST_CASE("Set insert / find / erase", "[Set]")
+{
+    ara::core::Set<std::string, std::less<>> set{"b", "a", "c", "a"};
+
+    REQUIRE(set.size() == 3);
+    CHECK(*set.begin() == "a");
+    CHECK(set.contains("b"));
+    CHECK(set.contains(std::string_view("c")));
+    CHECK_FALSE(set.contains("d"));
+    CHECK(set.count(std::string_view("a")) == 1);
+    CHECK(*set.lower_bound(std::string_view("bb")) == "c");
+
+    auto const [it, inserted] = set.insert("d");
+    CHECK(inserted);
+    CHECK(*it == "d");
+    CHECK_FALSE(set.insert("d").second);
+    CHECK(set.erase("a") == 1);
+    CHECK(set.erase("a") == 0);
+
+    auto node = set.extract("b");
+    REQUIRE_FALSE(node.empty());
+    node.value() = "e";
+    CHECK(set.insert(std::move(node)).inserted);
+    CHECK(set == ara::core::Set<std::string, std::less<>>{"c", "d", "e"});
+    CHECK(set < ara::core::Set<std::string, std::less<>>{"d"});
+}
+
+TEST_CASE("Set bulk construction from sorted keys", "[Set]")
+{
+    ara::core::Vector<int> keys(1000);
+    for (int i = 0; i < 1000; ++i) { keys[static_cast<std::size_t>(i)] = i; }
+
+    ara::core::Set<int> const sorted(
+      ara::core::sorted_unique, keys.begin(), keys.end());
+    ara::core::Set<int> const unsorted(keys.rbegin(), keys.rend());
+    CHECK(sorted == unsorted);
+
+    ara::core::Set<int> set{-1};
+    set.insert(ara::core::sorted_unique, keys.begin() + 500, keys.end());
+    set.insert(ara::core::sorted_unique, keys.begin(), keys.begin() + 600);
+    CHECK(set.size() == 1001);
+    CHECK(std::is_sorted(set.begin(), set.end()));
+
+    ara::core::Set<int> other{-1, 5000};
+    set.merge(other);
+    CHECK(set.size() == 1002);
+    CHECK(other == ara::core::Set<int>{-1});
+
+    set.merge(ara::core::Set<int>{-2, 5000});
+    CHECK(set.size() == 1003);
+}
+
+TEST_CASE("MultiSet and MultiMap keep equivalent keys", "[Set]")
+{
+    ara::core::MultiSet<int> set{3, 1, 3, 2, 3};
+    CHECK(set.size() == 5);
+    CHECK(set.count(3) == 3);
+    CHECK(set.erase(3) == 3);
+    ara::core::Vector<int> const more{4, 4, 5};
+    set.insert(ara::core::sorted_equivalent, more.begin(), more.end());
+    CHECK(set == ara::core::MultiSet<int>{1, 2, 4, 4, 5});
+    set.merge(ara::core::MultiSet<int>{1, 6});
+    CHECK(set == ara::core::MultiSet<int>{1, 1, 2, 4, 4, 5, 6});
+
+    ara::core::MultiMap<std::string, int, std::less<>> map{
+      {"a", 1}, {"b", 2}, {"a", 3}};
+    CHECK(map.count(std::string_view("a")) == 2);
+    auto const [first, last] = map.equal_range(std::string_view("a"));
+    REQUIRE(std::distance(first, last) == 2);
+    CHECK(first->second == 1);
+    CHECK(std::next(first)->second == 3);
+
+    ara::core::Vector<std::pair<std::string, int>> const sorted{
+      {"a", 4}, {"c", 5}, {"c", 6}};
+    map.insert(ara::core::sorted_equivalent, sorted.begin(), sorted.end());
+    CHECK(map.size() == 6);
+    CHECK(std::prev(map.upper_bound("a"))->second == 4);
+    CHECK(map.count("c") == 2);
+
+    ara::core::MultiMap<std::string, int, std::less<>> const copy(
+      ara::core::sorted_equivalent, map.begin(), map.end());
+    CHECK(copy == map);
+
+    map.merge(ara::core::MultiMap<std::string, int, std::less<>>{{"c", 7}});
+    CHECK(map.count("c") == 3);
+}
+
+TEST_CASE("FlatSet insert / find / erase", "[FlatSet]")
+{
+    ara::core::FlatSet<std::string, std::less<>> set{"b", "a", "c", "a"};
+
+    CHECK(set.keys() == ara::core::Vector<std::string>{"a", "b", "c"});
+    CHECK(set.contains(std::string_view("b")));
+    CHECK(set.find("d") == set.end());
+    CHECK(set.count(std::string_view("c")) == 1);
+    CHECK(*set.upper_bound("a") == "b");
+
+    CHECK(set.insert("d").second);
+    CHECK_FALSE(set.insert("a").second);
+    CHECK(*set.emplace_hint(set.begin(), "0") == "0");
+    CHECK(*set.emplace_hint(set.end(), "bb") == "bb");
+    CHECK(set.erase("a") == 1);
+    CHECK(set.keys()
+          == ara::core::Vector<std::string>{"0", "b", "bb", "c", "d"});
+
+    set.insert({"z", "e", "z"});
+    CHECK(set.size() == 7);
+    CHECK(set.keys().back() == "z");
+
+    auto keys = std::move(set).extract();
+    CHECK(set.empty());  // NOLINT(bugprone-use-after-move)
+    keys.pop_back();
+    set.replace(std::move(keys));
+    CHECK(set.size() == 6);
+    CHECK(set < ara::core::FlatSet<std::string, std::less<>>{"1"});
+}
+
+TEST_CASE("FlatSet bulk insert allocates once", "[FlatSet]")
+{
+    ara::core::Vector<std::uint32_t> keys;
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    { keys.push_back(i * 7919 % 1000); }
+
+    ara::core::FlatSet<std::uint32_t> set;
+    set.insert(keys.begin(), keys.end());
+    CHECK(set.size() == 1000);
+    CHECK(std::is_sorted(set.begin(), set.end()));
+
+    ara::core::FlatSet<std::uint32_t> const adopted(std::move(keys));
+    CHECK(adopted == set);
+
+    ara::core::Vector<std::uint32_t> const more{1000, 1001, 1002};
+    test::AllocationCounter const          counter;
+    set.insert(ara::core::sorted_unique, more.begin(), more.end());
+    CHECK(counter.allocations() == 1);
+    CHECK(set.size() == 1003);
+}
+
+TEST_CASE("FlatSet intersect and unite match the standard algorithms",
+          "[FlatSet]")
+{
+    // Dense and sparse key ranges, for long runs and many matches.
+    CHECK(SetOperationDivergence<std::int8_t>(100) == 0);
+    CHECK(SetOperationDivergence<std::uint16_t>(500) == 0);
+    CHECK(SetOperationDivergence<std::int32_t>(400) == 0);
+    CHECK(SetOperationDivergence<std::uint32_t>(100000) == 0);
+    CHECK(SetOperationDivergence<std::int64_t>(600) == 0);
+    CHECK(SetOperationDivergence<std::uint64_t>(5000) == 0);
+    CHECK(SetOperationDivergence<float>(700) == 0);
+    CHECK(SetOperationDivergence<double>(700) == 0);
+
+    using Strings = ara::core::FlatSet<std::string>;
+    CHECK(ara::core::intersect(Strings{"a", "b", "c"}, Strings{"b", "d"})
+          == Strings{"b"});
+    CHECK(ara::core::unite(Strings{"a", "c"}, Strings{"b", "c"})
+          == Strings{"a", "b", "c"});
+
+    using Descending = ara::core::FlatSet<int, std::greater<>>;
+    CHECK(ara::core::intersect(Descending{1, 2, 3, 4, 5, 6, 7, 8, 9},
+                               Descending{9, 7, 5, 3})
+            .keys()
+          == ara::core::Vector<int>{9, 7, 5, 3});
+
+    ara::core::Set<int> const lhs{1, 2, 3, 4};
+    ara::core::Set<int> const rhs{3, 4, 5};
+    CHECK(ara::core::intersect(lhs, rhs) == ara::core::Set<int>{3, 4});
+    CHECK(ara::core::unite(lhs, rhs) == ara::core::Set<int>{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("memory_footprint of sets", "[Set][MemoryFootprint]")
+{
+    ara::core::Set<std::uint64_t> set{1, 2, 3};
+    auto const                    tree = ara::core::memory_footprint(set);
+    CHECK(tree.allocations == 3);
+    CHECK(tree.bytes_used
+          == 3
+               * (ara::core::detail::kTreeNodeOverhead
+                  + sizeof(std::uint64_t)));
+
+    ara::core::Map<std::uint64_t, bool> map{{1, true}, {2, true}, {3, true}};
+    CHECK(ara::core::memory_footprint(map).bytes_used >= tree.bytes_used);
+
+    ara::core::MultiSet<std::string> strings{std::string(100, 'x'), "y"};
+    CHECK(ara::core::memory_footprint(strings).allocations == 3);
+
+    ara::core::FlatSet<std::uint64_t> flat{1, 2, 3};
+    CHECK(ara::core::memory_footprint(flat).bytes_used
+          == 3 * sizeof(std::uint64_t));
+}
@@ -0,0 +1,309 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.h"
+#include "ara/core/small_map.h"
+
+namespace {
+/**
+ * @brief Applies a random mix of insertions, erasures, bound lookups and
+ * storage changes to a SmallMap holding 4 elements inline and a std::map, and
+ * returns the number of diverging results.
+ */
+template<class K, class Key>
+std::size_t DivergenceFromStdMap(Key makeKey, int operations, unsigned range)
+{
+    ara::core::SmallMap<K, int, 4>          map;
+    std::map<K, int>                        reference;
+    std::mt19937                            gen{13};
+    std::uniform_int_distribution<unsigned> keys{0, range - 1};
+    std::uniform_int_distribution<int>      operation{0, 7};
+    std::size_t                             mismatches = 0;
+
+    auto const sameElement = [&](auto it, auto ref) {
+        if (ref == reference.end())
+        { return it == map.end(); }
+
+        return it != map.end() && it->first == ref->first
+               && it->second == ref->second;
+    };
+
+    for (int i = 0; i < operations; ++i)
+    {
+        K const key = makeKey(keys(gen));
+        switch (operation(gen))
+        {
+        case 0:
+        case 1:
+        {
+            auto const inserted = map.try_emplace(key, i).second;
+            mismatches += inserted != reference.try_emplace(key, i).second;
+            break;
+        }
+        case 2:
+            mismatches += map.erase(key) != reference.erase(key);
+            break;
+        case 3:
+        {
+            auto       it  = map.lower_bound(key);
+            auto const ref = reference.lower_bound(key);
+            mismatches += ! sameElement(it, ref);
+            if (ref != reference.end())
+            {
+                it = map.erase(it);
+                mismatches += ! sameElement(it, reference.erase(ref));
+            }
+            break;
+        }
+        case 4:
+            mismatches +=
+              ! sameElement(map.upper_bound(key), reference.upper_bound(key));
+            mismatches += ! sameElement(map.find(key), reference.find(key));
+            break;
+        case 5:
+            map.shrink_to_fit();
+            mismatches += map.is_inline() != (reference.size() <= 4);
+            break;
+        case 6:
+            if (reference.size() > 6)
+            {
+                map.clear();
+                reference.clear();
+                mismatches += ! map.is_inline();
+            }
+            break;
+        default:
+        {
+            auto const hint = map.upper_bound(key);
+            map.emplace_hint(hint, key, i);
+            reference.emplace(key, i);
+            break;
+        }
+        }
+    }
+
+    mismatches += map.size() != reference.size();
+    mismatches +=
+      ! std::equal(map.begin(), map.end(), reference.begin(), reference.end());
+    mismatches += ! std::equal(
+      map.rbegin(), map.rend(), reference.rbegin(), reference.rend());
+
+    return mismatches;
+}
+}  // namespace
+
+TEST_CASE("SmallMap insert / find / at", "[SmallMap]")
+{
+    ara::core::SmallMap<std::string, int> map;
+    CHECK(map.empty());
+    CHECK(map.is_inline());
+    CHECK(map.begin() == map.end());
+    CHECK(map.find("a") == map.end());
+
+    CHECK(map.insert({"b", 2}).second);
+    CHECK_FALSE(map.insert({"b", 3}).second);
+    CHECK(map.emplace("a", 1).second);
+    map["c"] = 3;
+
+    CHECK(map.size() == 3);
+    CHECK(map.begin()->first == "a");
+    CHECK(map.at("a") == 1);
+    CHECK(map.find("b")->second == 2);
+    CHECK(map.count("c") == 1);
+    CHECK_FALSE(map.contains("d"));
+    CHECK_THROWS_AS(map.at("d"), std::out_of_range);
+
+    auto const range = map.equal_range("b");
+    CHECK(std::distance(range.first, range.second) == 1);
+    auto const none = map.equal_range("bb");
+    CHECK(none.first == none.second);
+    CHECK(none.first->first == "c");
+}
+
+TEST_CASE("SmallMap matches std::map under random operations", "[SmallMap]")
+{
+    CHECK(DivergenceFromStdMap<int>(
+            [](unsigned x) { return static_cast<int>(x) - 6; }, 50000, 12)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::uint64_t>(
+            [](unsigned x) { return x * 0x9E3779B97F4A7C15ull; }, 50000, 12)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::uint8_t>(
+            [](unsigned x) { return static_cast<std::uint8_t>(x * 37); },
+            50000,
+            12)
+          == 0);
+    CHECK(DivergenceFromStdMap<double>(
+            [](unsigned x) { return static_cast<double>(x) - 5.5; }, 50000, 12)
+          == 0);
+    CHECK(DivergenceFromStdMap<std::string>(
+            [](unsigned x) { return std::to_string(x); }, 50000, 12)
+          == 0);
+}
+
+TEST_CASE("SmallMap moves its elements into a Map past N", "[SmallMap]")
+{
+    ara::core::SmallMap<int, std::string, 4> map;
+    for (int i = 0; i < 4; ++i) { map.emplace(2 * i, std::to_string(i)); }
+    CHECK(map.is_inline());
+
+    auto const it = map.emplace(3, "new").first;
+    CHECK_FALSE(map.is_inline());
+    CHECK(it->second == "new");
+    CHECK(std::next(it)->first == 4);
+    CHECK(map.size() == 5);
+
+    map.erase(map.begin(), map.find(6));
+    CHECK(map.size() == 1);
+    CHECK_FALSE(map.is_inline());
+
+    map.shrink_to_fit();
+    CHECK(map.is_inline());
+    CHECK(map.begin()->second == "3");
+
+    for (int i = 0; i < 10; ++i) { map.try_emplace(i, "x"); }
+    map.clear();
+    CHECK(map.is_inline());
+    CHECK(map.empty());
+}
+
+TEST_CASE("SmallMap erase of an empty range changes nothing", "[SmallMap]")
+{
+    ara::core::SmallMap<int, std::string, 8> map;
+    for (int i = 0; i < 5; ++i)
+    { map.emplace(i, std::string(30, static_cast<char>('a' + i))); }
+    CHECK(map.is_inline());
+
+    auto const it = map.erase(map.find(2), map.find(2));
+    CHECK(it->first == 2);
+    CHECK(map.erase(map.end(), map.end()) == map.end());
+    CHECK(map.size() == 5);
+    for (int i = 0; i < 5; ++i)
+    { CHECK(map.at(i) == std::string(30, static_cast<char>('a' + i))); }
+}
+
+TEST_CASE("SmallMap inserts elements referring to its own elements",
+          "[SmallMap]")
+{
+    ara::core::SmallMap<int, std::string, 2> map{{1, std::string(40, 'a')},
+                                                  {2, std::string(40, 'b')}};
+
+    map.try_emplace(0, map.at(2));
+    CHECK_FALSE(map.is_inline());
+    CHECK(map.at(0) == std::string(40, 'b'));
+    CHECK(map.at(2) == std::string(40, 'b'));
+
+    map.clear();
+    map.try_emplace(3, std::string(40, 'c'));
+    map.try_emplace(1, map.at(3));
+    CHECK(map.at(1) == map.at(3));
+}
+
+TEST_CASE("SmallMap try_emplace / insert_or_assign", "[SmallMap]")
+{
+    ara::core::SmallMap<int, std::unique_ptr<int>, 2> map;
+
+    auto value = std::make_unique<int>(1);
+    CHECK(map.try_emplace(1, std::move(value)).second);
+    CHECK(value == nullptr);
+
+    value = std::make_unique<int>(2);
+    CHECK_FALSE(map.try_emplace(1, std::move(value)).second);
+    CHECK(value != nullptr);
+
+    auto const hinted = map.try_emplace(map.end(), 2, std::make_unique<int>(3));
+    CHECK(*hinted->second == 3);
+
+    CHECK_FALSE(map.insert_or_assign(1, std::move(value)).second);
+    CHECK(*map.at(1) == 2);
+    CHECK(*map.insert_or_assign(map.end(), 5, std::make_unique<int>(6))->second
+          == 6);
+    CHECK_FALSE(map.is_inline());
+}
+
+TEST_CASE("SmallMap copy / move / swap / compare / merge", "[SmallMap]")
+{
+    ara::core::SmallMap<int, std::string, 4> small{{1, "1"}, {2, "2"}};
+    ara::core::SmallMap<int, std::string, 4> large;
+    for (int i = 0; i < 100; ++i) { large.emplace(i, std::to_string(i)); }
+
+    auto copy = large;
+    CHECK(copy == large);
+    copy[1000] = "x";
+    CHECK(copy != large);
+    CHECK(large < copy);
+
+    auto moved = std::move(copy);
+    CHECK(moved.size() == 101);
+    CHECK(copy.empty());
+
+    auto smallCopy = small;
+    CHECK(smallCopy.is_inline());
+    auto smallMoved = std::move(smallCopy);
+    CHECK(smallMoved == small);
+    CHECK(smallCopy.empty());
+
+    swap(small, large);
+    CHECK(small.size() == 100);
+    CHECK_FALSE(small.is_inline());
+    CHECK(large.size() == 2);
+    CHECK(large.is_inline());
+    small.swap(moved);
+    CHECK(small.size() == 101);
+    CHECK(moved.size() == 100);
+
+    ara::core::SmallMap<int, std::string, 2, std::greater<>> source{
+      {1, "dup"}, {2000, "new"}, {3000, "newer"}};
+    large.merge(source);
+    CHECK(large.at(2000) == "new");
+    CHECK(large.at(1) == "1");
+    CHECK(source.size() == 1);
+}
+
+TEST_CASE("SmallMap does not allocate while inline", "[SmallMap]")
+{
+    test::AllocationCounter const counter;
+
+    ara::core::SmallMap<std::uint32_t, std::uint64_t> map;
+    for (std::uint32_t i = 8; i > 0; --i) { map.emplace(i, i); }
+    auto const copy = map;
+    map.erase(3);
+
+    CHECK(counter.allocations() == 0);
+    CHECK(copy.size() == 8);
+    CHECK(map.find(4)->second == 4);
+    CHECK(map.lower_bound(3)->first == 4);
+    CHECK(map.upper_bound(8) == map.end());
+}
+
+TEST_CASE("SmallMap transparent lookup does not allocate", "[SmallMap]")
+{
+    std::string const longKey(64, 'k');
+
+    ara::core::SmallMap<std::string, int, 8, ara::core::StringLess> map{
+      {longKey, 1}, {"beta", 2}};
+    const auto& constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found    = map.find(key);
+    auto const                  contains = map.contains("beta");
+    auto const                  missing  = map.count("gamma");
+    auto const                  bound    = constMap.lower_bound("c");
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found->second == 1);
+    CHECK(contains);
+    CHECK(missing == 0);
+    CHECK(bound->first == longKey);
+}
@@ -0,0 +1,136 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+#include "ara/core/snapshot_map.h"
+#include "ara/core/vector.h"
+
+namespace {
+/**
+ * @brief Counts its live instances, to observe the reclamation of snapshots.
+ */
+struct Tracked
+{
+    static inline std::atomic<int> live{0};
+
+    explicit Tracked(int v = 0) : value{v} { ++live; }
+    Tracked(const Tracked& other) : value{other.value} { ++live; }
+    Tracked(Tracked&& other) noexcept : value{other.value} { ++live; }
+    Tracked& operator=(const Tracked&) = default;
+    Tracked& operator=(Tracked&&) noexcept = default;
+    ~Tracked() { --live; }
+
+    int value;
+};
+}  // namespace
+
+TEST_CASE("SnapshotMap update / snapshot", "[SnapshotMap]")
+{
+    ara::core::SnapshotMap<std::string, int> map;
+    CHECK(map.snapshot()->empty());
+    CHECK(map.snapshot().version() == 0);
+
+    CHECK(map.update([](auto& draft) {
+        draft["a"] = 1;
+        draft["b"] = 2;
+    }) == 1);
+    CHECK(map.insert_or_assign("c", 3) == 2);
+    CHECK(map.erase("a") == 3);
+
+    auto const snapshot = map.snapshot();
+    CHECK(snapshot.version() == 3);
+    CHECK(snapshot->size() == 2);
+    CHECK(snapshot->at("b") == 2);
+    CHECK(map.read([](const auto& m) { return m.count("c") == 1; }));
+
+    CHECK_THROWS_AS(map.update([](auto&) { throw std::runtime_error("x"); }),
+                    std::runtime_error);
+    CHECK(map.snapshot().version() == 3);
+
+    ara::core::FlatMap<std::string, int> replacement{{"z", 26}};
+    CHECK(map.assign(std::move(replacement)) == 4);
+    CHECK(map.snapshot()->at("z") == 26);
+}
+
+TEST_CASE("SnapshotMap pinned snapshots stay unchanged", "[SnapshotMap]")
+{
+    ara::core::SnapshotMap<int, int> map;
+    map.insert_or_assign(1, 1);
+
+    auto const pinned = map.snapshot();
+    for (int i = 0; i < 10; ++i) { map.insert_or_assign(1, 100 + i); }
+
+    CHECK(pinned->at(1) == 1);
+    CHECK(map.snapshot()->at(1) == 109);
+}
+
+TEST_CASE("SnapshotMap reclaims replaced snapshots", "[SnapshotMap]")
+{
+    {
+        ara::core::SnapshotMap<int, Tracked> map;
+        map.update([](auto& draft) { draft.try_emplace(1, 1); });
+        for (int i = 0; i < 10; ++i)
+        {
+            map.update([i](auto& draft) { draft.at(1).value = i; });
+        }
+        CHECK(map.reclaim() == 0);
+        CHECK(Tracked::live == 1);
+
+        {
+            auto const pinned = map.snapshot();
+            map.update([](auto& draft) { draft.at(1).value = 100; });
+            map.update([](auto& draft) { draft.at(1).value = 101; });
+            CHECK(pinned->at(1).value == 9);
+            CHECK(map.reclaim() > 0);
+            CHECK(Tracked::live > 1);
+        }
+        CHECK(map.reclaim() == 0);
+        CHECK(Tracked::live == 1);
+    }
+    CHECK(Tracked::live == 0);
+}
+
+TEST_CASE("SnapshotMap concurrent readers and writer", "[SnapshotMap]")
+{
+    constexpr int kKeys     = 64;
+    constexpr int kVersions = 200;
+
+    ara::core::SnapshotMap<int, int> map;
+    map.update([](auto& draft) {
+        for (int key = 0; key < kKeys; ++key) { draft.try_emplace(key, 0); }
+    });
+
+    std::atomic<bool>              done{false};
+    std::atomic<bool>              consistent{true};
+    ara::core::Vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t)
+    {
+        readers.emplace_back([&] {
+            while (! done.load())
+            {
+                auto const snapshot = map.snapshot();
+                int const  first    = snapshot->begin()->second;
+                for (const auto& [key, value] : *snapshot)
+                {
+                    if (value != first)
+                    { consistent = false; }
+                }
+            }
+        });
+    }
+
+    for (int version = 1; version <= kVersions; ++version)
+    {
+        map.update([version](auto& draft) {
+            for (auto&& [key, value] : draft) { value = version; }
+        });
+    }
+    done = true;
+    for (auto& reader : readers) { reader.join(); }
+
+    CHECK(consistent);
+    CHECK(map.snapshot()->at(0) == kVersions);
+    CHECK(map.reclaim() == 0);
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ara/core/array.h"
+#include "ara/core/span.h"
+#include "ara/core/vector.h"
+
+namespace {
+/**
+ * @brief Takes any buffer of ints without copying it.
+ */
+int Sum(ara::core::Span<const int> values)
+{
+    return std::accumulate(values.begin(), values.end(), 0);
+}
+}  // namespace
+
+static_assert(sizeof(ara::core::Span<int, 4>) == sizeof(int*));
+static_assert(sizeof(ara::core::Span<int>) == 2 * sizeof(int*));
+static_assert(std::ranges::contiguous_range<ara::core::Span<int>>);
+static_assert(std::ranges::borrowed_range<ara::core::Span<int>>);
+static_assert(std::ranges::view<ara::core::Span<int>>);
+static_assert(std::is_trivially_copyable_v<ara::core::Span<int>>);
+
+TEST_CASE("Span deduction from Vector, Array and C arrays", "[Span]")
+{
+    int                            raw[] = {1, 2, 3};
+    ara::core::Array<int, 4>       array{1, 2, 3, 4};
+    ara::core::Array<int, 4> const constArray{5, 6, 7, 8};
+    ara::core::Vector<int>         vector{1, 2, 3, 4, 5};
+    ara::core::Vector<int> const   constVector{6, 7};
+
+    ara::core::Span rawSpan(raw);
+    ara::core::Span arraySpan(array);
+    ara::core::Span constArraySpan(constArray);
+    ara::core::Span vectorSpan(vector);
+    ara::core::Span constVectorSpan(constVector);
+    ara::core::Span pointerSpan(vector.data(), 2);
+    ara::core::Span iteratorSpan(vector.begin() + 1, vector.end());
+
+    static_assert(std::is_same_v<decltype(rawSpan), ara::core::Span<int, 3>>);
+    static_assert(
+      std::is_same_v<decltype(arraySpan), ara::core::Span<int, 4>>);
+    static_assert(std::is_same_v<decltype(constArraySpan),
+                                 ara::core::Span<const int, 4>>);
+    static_assert(std::is_same_v<decltype(vectorSpan), ara::core::Span<int>>);
+    static_assert(std::is_same_v<decltype(constVectorSpan),
+                                 ara::core::Span<const int>>);
+    static_assert(
+      std::is_same_v<decltype(pointerSpan), ara::core::Span<int>>);
+    static_assert(
+      std::is_same_v<decltype(iteratorSpan), ara::core::Span<int>>);
+
+    CHECK(rawSpan.size() == 3);
+    CHECK(arraySpan.back() == 4);
+    CHECK(constArraySpan.front() == 5);
+    CHECK(vectorSpan.size() == 5);
+    CHECK(constVectorSpan[1] == 7);
+    CHECK(pointerSpan.size() == 2);
+    CHECK(iteratorSpan.front() == 2);
+
+    CHECK(Sum(raw) == 6);
+    CHECK(Sum(array) == 10);
+    CHECK(Sum(constArray) == 26);
+    CHECK(Sum(vector) == 15);
+    CHECK(Sum(constVector) == 13);
+    CHECK(Sum(ara::core::Vector<int>{1, 1}) == 2);
+    CHECK(Sum(arraySpan) == 10);
+    CHECK(Sum({}) == 0);
+
+    // Writes through a span reach the container.
+    vectorSpan[0] = 10;
+    std::ranges::sort(vectorSpan, std::greater<>());
+    CHECK(vector == ara::core::Vector<int>{10, 5, 4, 3, 2});
+}
+
+TEST_CASE("Span first / last / subspan", "[Span]")
+{
+    ara::core::Array<int, 6> array{0, 1, 2, 3, 4, 5};
+    ara::core::Span<int, 6>  span(array);
+
+    auto const first = span.first<2>();
+    static_assert(
+      std::is_same_v<decltype(first), const ara::core::Span<int, 2>>);
+    CHECK(first.back() == 1);
+
+    auto const last = span.last<3>();
+    static_assert(
+      std::is_same_v<decltype(last), const ara::core::Span<int, 3>>);
+    CHECK(last.front() == 3);
+
+    auto const tail = span.subspan<2>();
+    static_assert(
+      std::is_same_v<decltype(tail), const ara::core::Span<int, 4>>);
+    CHECK(tail.front() == 2);
+
+    auto const middle = span.subspan<1, 3>();
+    static_assert(
+      std::is_same_v<decltype(middle), const ara::core::Span<int, 3>>);
+    CHECK(std::ranges::equal(middle, ara::core::Vector<int>{1, 2, 3}));
+
+    ara::core::Span<int> dynamic = span;
+    CHECK(dynamic.first(4).last(2).front() == 2);
+    CHECK(dynamic.subspan(3).size() == 3);
+    CHECK(dynamic.subspan(1, 2).back() == 2);
+    CHECK(dynamic.subspan(6).empty());
+    static_assert(std::is_same_v<decltype(dynamic.subspan<1>()),
+                                 ara::core::Span<int>>);
+
+    ara::core::Span<int, 2> const fixed{dynamic.first(2)};
+    CHECK(fixed.size() == 2);
+    CHECK(std::equal(dynamic.rbegin(),
+                     dynamic.rend(),
+                     ara::core::Vector<int>{5, 4, 3, 2, 1, 0}.begin()));
+
+    CHECK(dynamic.at(5) == 5);
+    CHECK_THROWS_AS(dynamic.at(6), std::out_of_range);
+}
+
+TEST_CASE("Span as_bytes and as_writable_bytes", "[Span]")
+{
+    ara::core::Array<std::uint32_t, 2> words{0x01020304U, 0U};
+    ara::core::Span                    span(words);
+
+    auto const bytes = ara::core::as_bytes(span);
+    static_assert(std::is_same_v<decltype(bytes),
+                                 const ara::core::Span<const ara::core::Byte,
+                                                       8>>);
+    CHECK(bytes.size() == span.size_bytes());
+
+    auto const writable = ara::core::as_writable_bytes(span.last<1>());
+    for (std::size_t i = 0; i < writable.size(); ++i)
+    { writable[i] = bytes[i]; }
+    CHECK(words[1] == 0x01020304U);
+
+    ara::core::Vector<std::uint16_t> vector{1, 2, 3};
+    auto const dynamic = ara::core::as_bytes(ara::core::Span(vector));
+    static_assert(std::is_same_v<decltype(dynamic),
+                                 const ara::core::Span<const ara::core::Byte>>);
+    CHECK(dynamic.size() == 6);
+}
+
+TEST_CASE("Span interoperates with std::span", "[Span]")
+{
+    ara::core::Vector<int> vector{1, 2, 3};
+    std::span<int> const   standard(vector);
+    ara::core::Span<int>   span(standard);
+    CHECK(span.data() == vector.data());
+
+    std::span<const int> const back(span);
+    CHECK(back.size() == 3);
+    CHECK(Sum(back) == 6);
+}
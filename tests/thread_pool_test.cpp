@@ -0,0 +1,66 @@
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+#include "ara/core/thread_pool.h"
+
+TEST_CASE("ThreadPool concurrency", "[ThreadPool]")
+{
+    ara::core::ThreadPool single{1};
+    ara::core::ThreadPool zero{0};
+    ara::core::ThreadPool quad{4};
+
+    CHECK(single.concurrency() == 1);
+    CHECK(zero.concurrency() == 1);
+    CHECK(quad.concurrency() == 4);
+    CHECK(ara::core::ThreadPool::DefaultConcurrency() >= 1);
+}
+
+TEST_CASE("TaskGroup runs all tasks", "[ThreadPool]")
+{
+    for (std::size_t threads : {1u, 2u, 4u})
+    {
+        ara::core::ThreadPool     pool{threads};
+        ara::core::TaskGroup      group{pool};
+        std::atomic<std::size_t>  counter{0};
+
+        for (int i = 0; i < 1000; ++i)
+        { group.run([&counter] { counter.fetch_add(1); }); }
+        group.wait();
+
+        CHECK(counter.load() == 1000);
+    }
+}
+
+TEST_CASE("TaskGroup supports nested groups", "[ThreadPool]")
+{
+    ara::core::ThreadPool    pool{2};
+    ara::core::TaskGroup     outer{pool};
+    std::atomic<std::size_t> counter{0};
+
+    for (int i = 0; i < 8; ++i)
+    {
+        outer.run([&pool, &counter] {
+            ara::core::TaskGroup inner{pool};
+            for (int j = 0; j < 8; ++j)
+            { inner.run([&counter] { counter.fetch_add(1); }); }
+            inner.wait();
+        });
+    }
+    outer.wait();
+
+    CHECK(counter.load() == 64);
+}
+
+TEST_CASE("TaskGroup rethrows task exception", "[ThreadPool]")
+{
+    ara::core::ThreadPool pool{2};
+    ara::core::TaskGroup  group{pool};
+
+    group.run([] { throw std::runtime_error("task failed"); });
+    group.run([] {});
+
+    CHECK_THROWS_AS(group.wait(), std::runtime_error);
+    CHECK_NOTHROW(group.wait());
+}
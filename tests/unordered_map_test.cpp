@@ -0,0 +1,220 @@
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "allocation_counter.h"
+#include "ara/core/unordered_map.h"
+
+namespace {
+/**
+ * @brief Hash that throws once its budget of calls is used up.
+ */
+struct ThrowingHash
+{
+    int* budget;
+
+    std::size_t operator()(const std::string& key) const
+    {
+        // A negative budget never runs out.
+        if (*budget == 0)
+        { throw std::runtime_error("hash"); }
+        --*budget;
+
+        return std::hash<std::string>{}(key);
+    }
+};
+}  // namespace
+
+TEST_CASE("UnorderedMap insert / find / at", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<std::string, int> map;
+    CHECK(map.empty());
+    CHECK(map.bucket_count() == 0);
+    CHECK(map.find("a") == map.end());
+
+    CHECK(map.insert({"a", 1}).second);
+    CHECK_FALSE(map.insert({"a", 2}).second);
+    CHECK(map.emplace("b", 2).second);
+    map["c"] = 3;
+
+    CHECK(map.size() == 3);
+    CHECK(map.at("a") == 1);
+    CHECK(map.find("b")->second == 2);
+    CHECK(map.count("c") == 1);
+    CHECK_FALSE(map.contains("d"));
+    CHECK_THROWS_AS(map.at("d"), std::out_of_range);
+
+    auto const range = map.equal_range("b");
+    CHECK(std::distance(range.first, range.second) == 1);
+}
+
+TEST_CASE("UnorderedMap grows and keeps all elements", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<int, int> map;
+    for (int i = 0; i < 10000; ++i) { map.emplace(i, i * 2); }
+
+    CHECK(map.size() == 10000);
+    CHECK(map.load_factor() <= map.max_load_factor());
+
+    int visited = 0;
+    for (const auto& [key, value] : map)
+    { visited += value == key * 2 ? 1 : 0; }
+    CHECK(visited == 10000);
+
+    int found = 0;
+    for (int i = 0; i < 10000; ++i) { found += map.at(i) == i * 2 ? 1 : 0; }
+    CHECK(found == 10000);
+    CHECK_FALSE(map.contains(10000));
+}
+
+TEST_CASE("UnorderedMap try_emplace / insert_or_assign", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<int, std::unique_ptr<int>> map;
+
+    auto value = std::make_unique<int>(1);
+    CHECK(map.try_emplace(1, std::move(value)).second);
+    CHECK(value == nullptr);
+
+    value = std::make_unique<int>(2);
+    CHECK_FALSE(map.try_emplace(1, std::move(value)).second);
+    CHECK(value != nullptr);
+    CHECK(*map.at(1) == 1);
+
+    CHECK_FALSE(map.insert_or_assign(1, std::move(value)).second);
+    CHECK(*map.at(1) == 2);
+}
+
+TEST_CASE("UnorderedMap erase", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<int, int> map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+
+    CHECK(map.erase(2) == 1);
+    CHECK(map.erase(2) == 0);
+    CHECK_FALSE(map.contains(2));
+
+    for (auto it = map.begin(); it != map.end();)
+    {
+        if (it->first % 2 == 1)
+        { it = map.erase(it); }
+        else
+        { ++it; }
+    }
+    CHECK(map.size() == 1);
+    CHECK(map.contains(4));
+
+    map.erase(map.begin(), map.end());
+    CHECK(map.empty());
+}
+
+TEST_CASE("UnorderedMap churn does not grow the table", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<int, int> map;
+    map.reserve(100);
+    auto const buckets = map.bucket_count();
+
+    std::size_t erased = 0;
+    for (int i = 0; i < 100000; ++i)
+    {
+        map.emplace(i, i);
+        if (i >= 100)
+        { erased += map.erase(i - 100); }
+    }
+
+    CHECK(erased == 99900);
+    CHECK(map.size() == 100);
+    CHECK(map.bucket_count() == buckets);
+    CHECK(map.contains(99900));
+    CHECK(map.contains(99999));
+}
+
+TEST_CASE("UnorderedMap reserve / rehash", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<int, int> map;
+    map.reserve(1000);
+    auto const buckets = map.bucket_count();
+    CHECK(buckets >= 1000);
+
+    for (int i = 0; i < 1000; ++i) { map.emplace(i, i); }
+    CHECK(map.bucket_count() == buckets);
+
+    for (int i = 0; i < 990; ++i) { map.erase(i); }
+    map.rehash(0);
+    CHECK(map.bucket_count() < buckets);
+    CHECK(map.size() == 10);
+    CHECK(map.at(995) == 995);
+
+    map.clear();
+    map.rehash(0);
+    CHECK(map.bucket_count() == 0);
+}
+
+TEST_CASE("UnorderedMap keeps its elements if growing throws",
+          "[UnorderedMap]")
+{
+    int                                                     budget = -1;
+    ara::core::UnorderedMap<std::string, int, ThrowingHash> map(
+      0, ThrowingHash{&budget});
+    int const count = 20;
+    for (int i = 0; i < count; ++i) { map.emplace(std::to_string(i), i); }
+
+    auto const buckets = map.bucket_count();
+    budget             = 3;
+    CHECK_THROWS_AS(map.rehash(buckets * 2), std::runtime_error);
+    budget = -1;
+
+    CHECK(map.bucket_count() == buckets);
+    CHECK(map.size() == static_cast<std::size_t>(count));
+    int found = 0;
+    for (int i = 0; i < count; ++i)
+    { found += map.at(std::to_string(i)) == i ? 1 : 0; }
+    CHECK(found == count);
+}
+
+TEST_CASE("UnorderedMap copy / move / compare", "[UnorderedMap]")
+{
+    ara::core::UnorderedMap<std::string, int> map{{"a", 1}, {"b", 2}};
+
+    auto copy = map;
+    CHECK(copy == map);
+    copy["c"] = 3;
+    CHECK_FALSE(copy == map);
+
+    auto moved = std::move(copy);
+    CHECK(moved.size() == 3);
+    CHECK(copy.empty());
+
+    copy = moved;
+    CHECK(copy == moved);
+    swap(copy, map);
+    CHECK(map.size() == 3);
+    CHECK(copy.size() == 2);
+}
+
+TEST_CASE("UnorderedMap transparent lookup does not allocate",
+          "[UnorderedMap]")
+{
+    std::string const longKey(64, 'k');
+
+    ara::core::UnorderedMap<std::string,
+                            int,
+                            ara::core::StringHash,
+                            ara::core::StringEqual>
+      map{{longKey, 1}, {"beta", 2}};
+    const auto& constMap = map;
+
+    test::AllocationCounter const counter;
+
+    ara::core::StringView const key{longKey};
+    auto const                  found      = map.find(key);
+    auto const                  contains   = map.contains("beta");
+    auto const                  missing    = map.count("gamma");
+    auto const                  constFound = constMap.find("beta");
+
+    CHECK(counter.allocations() == 0);
+    CHECK(found->second == 1);
+    CHECK(contains);
+    CHECK(missing == 0);
+    CHECK(constFound->second == 2);
+}